@@ -0,0 +1,132 @@
+/*
+ * Includes the memory mapped read-only asset partition
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "AssetStore.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "assets";
+
+//===============================================================
+// Global variables
+//===============================================================
+AssetStore Assets;
+
+//===============================================================
+// Constructor
+//===============================================================
+AssetStore::AssetStore()
+{
+}
+
+//===============================================================
+// Maps the asset partition and returns false if not available
+//===============================================================
+bool AssetStore::Begin()
+{
+  _partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ASSETS_PARTITIONSUBTYPE, ASSETS_PARTITIONLABEL);
+  if (!_partition)
+  {
+    ESP_LOGE(TAG, "No asset partition found");
+    return false;
+  }
+
+  // Map whole partition (Mapped in 64 KB pages by the MMU)
+  const void* data = NULL;
+  esp_err_t error = esp_partition_mmap(_partition, 0, _partition->size, ESP_PARTITION_MMAP_DATA, &data, &_handle);
+  if (error != ESP_OK)
+  {
+    ESP_LOGE(TAG, "Failed to map asset partition: %s", esp_err_to_name(error));
+    _partition = NULL;
+    return false;
+  }
+  _data = (const uint8_t*)data;
+
+  // Check header and directory
+  const Header* header = (const Header*)_data;
+  if (header->magic != ASSETS_MAGIC ||
+    header->version != ASSETS_VERSION ||
+    header->usedSize > _partition->size ||
+    sizeof(Header) + header->count * sizeof(Entry) > header->usedSize)
+  {
+    ESP_LOGE(TAG, "Asset partition not valid (Not flashed?)");
+    esp_partition_munmap(_handle);
+    _partition = NULL;
+    _data = NULL;
+    return false;
+  }
+
+  _header = header;
+  _entries = (const Entry*)(_data + sizeof(Header));
+
+  ESP_LOGI(TAG, "Mapped %d assets (%d / %d Bytes)", _header->count, _header->usedSize, _partition->size);
+  return true;
+}
+
+//===============================================================
+// Returns the name of an asset
+//===============================================================
+const char* AssetStore::GetName(uint16_t index) const
+{
+  if (!_header || index >= _header->count)
+  {
+    return NULL;
+  }
+  return _entries[index].name;
+}
+
+//===============================================================
+// Returns the mapped data of an asset (Binary search)
+//===============================================================
+const uint8_t* AssetStore::Find(const char* name, uint32_t* length) const
+{
+  *length = 0;
+  if (!_header || !name)
+  {
+    return NULL;
+  }
+
+  // Names are stored without leading slash
+  if (name[0] == '/')
+  {
+    name++;
+  }
+
+  int32_t lower = 0;
+  int32_t upper = _header->count - 1;
+  while (lower <= upper)
+  {
+    int32_t middle = (lower + upper) / 2;
+    int compare = strncmp(_entries[middle].name, name, ASSETS_MAXNAMELENGTH);
+    if (compare == 0)
+    {
+      // Check data is inside the used area
+      if (_entries[middle].offset + _entries[middle].length > _header->usedSize)
+      {
+        return NULL;
+      }
+
+      *length = _entries[middle].length;
+      return _data + _entries[middle].offset;
+    }
+    else if (compare < 0)
+    {
+      lower = middle + 1;
+    }
+    else
+    {
+      upper = middle - 1;
+    }
+  }
+
+  return NULL;
+}
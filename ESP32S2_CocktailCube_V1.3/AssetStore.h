@@ -0,0 +1,94 @@
+/*
+ * Includes the memory mapped read-only asset partition
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ASSETSTORE_H
+#define ASSETSTORE_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <esp_log.h>
+
+//===============================================================
+// Defines
+//===============================================================
+#define ASSETS_PARTITIONLABEL       "assets"
+#define ASSETS_PARTITIONSUBTYPE     0x40        // Custom data subtype (See 'partitions.csv')
+#define ASSETS_MAGIC                0x53415443  // "CTAS"
+#define ASSETS_VERSION              1
+#define ASSETS_MAXNAMELENGTH        32          // Same as SPIFFS object names
+
+//===============================================================
+// Class for the asset partition
+// The partition image is built by 'Tools/asset_builder.py' from
+// the stock themes and web files (Little endian):
+//   Header | Directory[count] (Sorted by name) | Data...
+// The whole partition is mapped into the data address space, so
+// assets are used straight from flash without copies
+//===============================================================
+class AssetStore
+{
+  public:
+    // Constructor
+    AssetStore();
+
+    // Maps the asset partition and returns false if not available
+    bool Begin();
+
+    // Returns true if the partition is mapped
+    bool IsMounted() const { return _header != NULL; }
+
+    // Returns the asset count
+    uint16_t GetCount() const { return _header ? _header->count : 0; }
+
+    // Returns the used bytes of the partition
+    uint32_t GetUsedSize() const { return _header ? _header->usedSize : 0; }
+
+    // Returns the size of the partition
+    uint32_t GetPartitionSize() const { return _partition ? _partition->size : 0; }
+
+    // Returns the name of an asset (NULL if not available)
+    const char* GetName(uint16_t index) const;
+
+    // Returns the mapped data of an asset (Binary search, NULL if not found)
+    const uint8_t* Find(const char* name, uint32_t* length) const;
+
+  private:
+    // Header of the partition image
+    struct Header
+    {
+      uint32_t magic;
+      uint16_t version;
+      uint16_t count;
+      uint32_t usedSize;
+      uint32_t reserved;
+    };
+
+    // Single directory entry
+    struct Entry
+    {
+      char name[ASSETS_MAXNAMELENGTH];
+      uint32_t offset;
+      uint32_t length;
+    };
+
+    const esp_partition_t* _partition = NULL;
+    esp_partition_mmap_handle_t _handle = 0;
+    const uint8_t* _data = NULL;
+    const Header* _header = NULL;
+    const Entry* _entries = NULL;
+};
+
+//===============================================================
+// Global variables
+//===============================================================
+extern AssetStore Assets;
+
+#endif
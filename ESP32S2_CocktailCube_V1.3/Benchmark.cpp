@@ -0,0 +1,1329 @@
+/*
+ * Includes on-device benchmark functions
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "Benchmark.h"
+
+// Only built for benchmark firmwares (See 'BENCHMARK_ON_BOOT' in 'Config.h')
+#if BENCHMARK_ON_BOOT
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "benchmark";
+
+//===============================================================
+// Global variables
+//===============================================================
+BenchmarkRunner Benchmark;
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+//===============================================================
+// Heap hooks for counting every allocation (Only available if
+// the core is built with CONFIG_HEAP_USE_HOOKS)
+//===============================================================
+static volatile uint32_t _allocationCount = 0;
+static volatile uint32_t _allocationBytes = 0;
+
+void IRAM_ATTR esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps)
+{
+  _allocationCount++;
+  _allocationBytes += size;
+}
+
+void IRAM_ATTR esp_heap_trace_free_hook(void* ptr)
+{
+}
+#endif
+
+//===============================================================
+// Constructor
+//===============================================================
+BenchmarkRunner::BenchmarkRunner()
+{
+}
+
+//===============================================================
+// Initializes the benchmark runner
+//===============================================================
+void BenchmarkRunner::Begin(CountingST7789* tft)
+{
+  _tft = tft;
+  _glyphCache.Begin(&FreeSans9pt7b);
+}
+
+//===============================================================
+// Runs all benchmarks and prints the results to serial
+//===============================================================
+void BenchmarkRunner::RunAll()
+{
+  ESP_LOGI(TAG, "Begin running benchmarks");
+  _resultCount = 0;
+  _frameResultCount = 0;
+
+  RunValueUpdate();
+  RunAllocations();
+  RunThemeIndex();
+  RunThemeLoad();
+  RunThemeBundle();
+  RunThemeSwitch();
+  RunAssets();
+  RunImages();
+  RunJson();
+  RunJsonFileList();
+  RunUpload();
+  RunFileSystem();
+  RunRender();
+
+  // Print results
+  for (uint8_t index = 0; index < _resultCount; index++)
+  {
+    ESP_LOGI(TAG, "%-40s %12.2f %s", _results[index].name, _results[index].value, _results[index].unit);
+  }
+
+  // Print render table
+  if (_frameResultCount > 0)
+  {
+    ESP_LOGI(TAG, "%s", GetFrameTableHeader().c_str());
+  }
+  for (uint8_t index = 0; index < _frameResultCount; index++)
+  {
+    ESP_LOGI(TAG, "%s", GetFrameResultString(index).c_str());
+  }
+
+  ESP_LOGI(TAG, "Finished running benchmarks");
+}
+
+//===============================================================
+// Returns all results as string
+//===============================================================
+String BenchmarkRunner::GetReportString()
+{
+  String report = "";
+  for (uint8_t index = 0; index < _resultCount; index++)
+  {
+    report += String(_results[index].name) + ": " + String(_results[index].value, 2) + " " + _results[index].unit + "\n";
+  }
+
+  if (_frameResultCount > 0)
+  {
+    report += "\n" + GetFrameTableHeader() + "\n";
+    for (uint8_t index = 0; index < _frameResultCount; index++)
+    {
+      report += GetFrameResultString(index) + "\n";
+    }
+  }
+  return report;
+}
+
+//===============================================================
+// Adds a result
+//===============================================================
+void BenchmarkRunner::AddResult(const char* name, const char* unit, double value)
+{
+  if (_resultCount >= BENCHMARK_MAXRESULTS)
+  {
+    ESP_LOGE(TAG, "Result table full, dropping '%s'", name);
+    return;
+  }
+
+  _results[_resultCount++] = { name, unit, value };
+}
+
+//===============================================================
+// Adds a frame result (Averaged over the frame count)
+//===============================================================
+void BenchmarkRunner::AddFrameResult(const char* name, const RenderFrameStats& stats, uint16_t frameCount)
+{
+  if (_frameResultCount >= BENCHMARK_MAXFRAMES)
+  {
+    ESP_LOGE(TAG, "Frame table full, dropping '%s'", name);
+    return;
+  }
+
+  _frameResults[_frameResultCount++] = { name, frameCount, stats };
+}
+
+//===============================================================
+// Returns the header of the render table
+//===============================================================
+String BenchmarkRunner::GetFrameTableHeader()
+{
+  char line[128];
+  snprintf(line, sizeof(line), "| %-34s | %8s | %8s | %8s | %8s | %8s |",
+    "Frame", "Windows", "Pixels", "Overdraw", "Bus [ms]", "CPU [ms]");
+  return String(line);
+}
+
+//===============================================================
+// Returns a single line of the render table
+//===============================================================
+String BenchmarkRunner::GetFrameResultString(uint8_t index)
+{
+  char line[128];
+  const FrameResult& result = _frameResults[index];
+  double frames = max((uint16_t)1, result.frameCount);
+  snprintf(line, sizeof(line), "| %-34s | %8.0f | %8.0f | %8.0f | %8.2f | %8.2f |",
+    result.name,
+    result.stats.windows / frames,
+    result.stats.pixels / frames,
+    result.stats.overdraw / frames,
+    result.stats.BusTime_us() / frames / 1000.0,
+    result.stats.cpuTime_us / frames / 1000.0);
+
+  return String(line);
+}
+
+//===============================================================
+// Runs the value update latency benchmark
+// Compares the former clear and print approach with the glyph
+// cache on a single percentage field and measures the complete
+// dashboard value update
+//===============================================================
+void BenchmarkRunner::RunValueUpdate()
+{
+  if (!_tft)
+  {
+    return;
+  }
+
+  int16_t x = 55;
+  int16_t y = HEADEROFFSET_Y + 25;
+  char text[8] = "";
+  char lastText[8] = "";
+
+  _tft->fillScreen(Config.tftColorBackground);
+  _tft->setTextSize(1);
+
+  // Former approach: Print the old string in background color and the new string in foreground color
+  uint32_t startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_ITERATIONS; index++)
+  {
+    snprintf(text, sizeof(text), "%2d%%", index % 100);
+    _tft->setTextColor(Config.tftColorBackground);
+    _tft->setCursor(x, y);
+    _tft->print(lastText);
+    _tft->setTextColor(Config.tftColorLiquid1);
+    _tft->setCursor(x, y);
+    _tft->print(text);
+    strcpy(lastText, text);
+  }
+  AddResult("Value field update (GFX clear+print)", "us", (double)(micros() - startTime_us) / BENCHMARK_ITERATIONS);
+
+  // Warm up atlas for the glyph cache measurement
+  _glyphCache.DrawText(_tft, x, y, text, Config.tftColorLiquid1, Config.tftColorBackground, 40);
+
+  // Glyph cache: Single opaque blit
+  startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_ITERATIONS; index++)
+  {
+    snprintf(text, sizeof(text), "%2d%%", index % 100);
+    _glyphCache.DrawText(_tft, x, y, text, Config.tftColorLiquid1, Config.tftColorBackground, 40);
+  }
+  AddResult("Value field update (glyph cache)", "us", (double)(micros() - startTime_us) / BENCHMARK_ITERATIONS);
+
+  // Complete value update of the dashboard (All three fields)
+  startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_ITERATIONS; index++)
+  {
+    Display.DrawCurrentValues(true);
+  }
+  AddResult("Dashboard value update (3 fields)", "us", (double)(micros() - startTime_us) / BENCHMARK_ITERATIONS);
+}
+
+//===============================================================
+// Counts the heap allocations of the steady state display and
+// state updates. Every allocation is counted with the heap hooks
+// if available, otherwise the allocated heap blocks are compared
+// (Catches every allocation that is kept, like growing strings)
+//===============================================================
+void BenchmarkRunner::RunAllocations()
+{
+  // First run may fill caches
+  Display.DrawCurrentValues(false);
+  Display.DrawSettings(false);
+  Statemachine.GetMixtureString();
+
+  multi_heap_info_t heapInfo;
+  heap_caps_get_info(&heapInfo, MALLOC_CAP_DEFAULT);
+  uint32_t allocatedBlocks = heapInfo.allocated_blocks;
+#ifdef CONFIG_HEAP_USE_HOOKS
+  uint32_t allocationCount = _allocationCount;
+#endif
+
+  for (uint16_t index = 0; index < BENCHMARK_ITERATIONS; index++)
+  {
+    Display.DrawCurrentValues(false);
+    Display.DrawSettings(false);
+    Statemachine.GetMixtureString();
+  }
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+  AddResult("Loop heap allocations", "count", (double)(_allocationCount - allocationCount) / BENCHMARK_ITERATIONS);
+#endif
+  heap_caps_get_info(&heapInfo, MALLOC_CAP_DEFAULT);
+  AddResult("Loop heap blocks (kept)", "count", (double)((int32_t)heapInfo.allocated_blocks - (int32_t)allocatedBlocks) / BENCHMARK_ITERATIONS);
+}
+
+//===============================================================
+// Runs the render benchmark for all pages and partial updates
+// Counts address windows, pixels, overdraw and the estimated bus
+// time for each frame. Multi-frame rows are averaged per frame
+//===============================================================
+void BenchmarkRunner::RunRender()
+{
+  if (!_tft)
+  {
+    return;
+  }
+
+  // Intro page releases its images, so load them again
+  Display.LoadImages();
+  _tft->BeginFrame();
+  Display.ShowIntroPage();
+  AddFrameResult("ShowIntroPage", _tft->EndFrame());
+
+  _tft->BeginFrame();
+  Display.ShowHelpPage();
+  AddFrameResult("ShowHelpPage", _tft->EndFrame());
+
+  _tft->BeginFrame();
+  Display.ShowMenuPage();
+  AddFrameResult("ShowMenuPage", _tft->EndFrame());
+
+  _tft->BeginFrame();
+  Display.ShowCleaningPage();
+  AddFrameResult("ShowCleaningPage", _tft->EndFrame());
+
+  // Toggle a single check box (Restored by the next page)
+  _tft->BeginFrame();
+  Display.DrawCheckBoxes(Statemachine.GetCleaningLiquid() == eLiquid1 ? eLiquid2 : eLiquid1);
+  AddFrameResult("DrawCheckBoxes (partial)", _tft->EndFrame());
+
+  _tft->BeginFrame();
+  Display.ShowSettingsPage();
+  AddFrameResult("ShowSettingsPage", _tft->EndFrame());
+
+  _tft->BeginFrame();
+  Display.DrawSettings(true);
+  AddFrameResult("DrawSettings (full)", _tft->EndFrame());
+
+  _tft->BeginFrame();
+  Display.DrawSettings();
+  AddFrameResult("DrawSettings (partial)", _tft->EndFrame());
+
+  if (Config.isMixer)
+  {
+    _tft->BeginFrame();
+    Display.ShowDashboardPage();
+    AddFrameResult("ShowDashboardPage", _tft->EndFrame());
+
+    _tft->BeginFrame();
+    Display.DrawDoughnutChart3();
+    AddFrameResult("DrawDoughnutChart3 (full)", _tft->EndFrame());
+
+    // One encoder step forth and back, like on the dashboard (Values and doughnut partial)
+    RenderFrameStats stepStats;
+    for (int8_t direction = 1; direction >= -1; direction -= 2)
+    {
+      int16_t stepIncrements_Degrees[3] = { (int16_t)(direction * STEPANGLE_DEGREES), 0, 0 };
+      _tft->BeginFrame();
+      Statemachine.UpdateValuesFromWifi(stepIncrements_Degrees, 0);
+      RenderFrameStats stats = _tft->EndFrame();
+      stepStats.windows += stats.windows;
+      stepStats.pixels += stats.pixels;
+      stepStats.overdraw += stats.overdraw;
+      stepStats.cpuTime_us += stats.cpuTime_us;
+    }
+    AddFrameResult("DrawDoughnutChart3 (partial step)", stepStats, 2);
+
+    // Burst of 5 web steps applied one by one and back as one coalesced batch
+    RenderFrameStats burstStats;
+    int16_t singleIncrements_Degrees[3] = { STEPANGLE_DEGREES, 0, 0 };
+    for (uint8_t step = 0; step < 5; step++)
+    {
+      _tft->BeginFrame();
+      Statemachine.UpdateValuesFromWifi(singleIncrements_Degrees, 0);
+      RenderFrameStats stats = _tft->EndFrame();
+      burstStats.windows += stats.windows;
+      burstStats.pixels += stats.pixels;
+      burstStats.overdraw += stats.overdraw;
+      burstStats.cpuTime_us += stats.cpuTime_us;
+    }
+    AddFrameResult("Web burst (5 single updates)", burstStats);
+
+    int16_t increments_Degrees[3] = { -5 * STEPANGLE_DEGREES, 0, 0 };
+    _tft->BeginFrame();
+    Statemachine.UpdateValuesFromWifi(increments_Degrees, 0);
+    AddFrameResult("Web burst (1 coalesced batch)", _tft->EndFrame());
+  }
+  else
+  {
+    _tft->BeginFrame();
+    Display.ShowDashboardPage();
+    AddFrameResult("ShowDashboardPage (bar)", _tft->EndFrame());
+
+    _tft->BeginFrame();
+    Display.ShowBarPage();
+    AddFrameResult("ShowBarPage", _tft->EndFrame());
+
+    _tft->BeginFrame();
+    Display.DrawBar(false, true);
+    AddFrameResult("DrawBar (full)", _tft->EndFrame());
+
+    _tft->BeginFrame();
+    Display.DrawBar(false);
+    AddFrameResult("DrawBar (partial)", _tft->EndFrame());
+  }
+
+  _tft->BeginFrame();
+  Display.ShowScreenSaverPage();
+  AddFrameResult("ShowScreenSaverPage", _tft->EndFrame());
+
+  // Screen saver frames are averaged
+  RenderFrameStats saverStats;
+  for (uint16_t frame = 0; frame < BENCHMARK_SCREENSAVERFRAMES; frame++)
+  {
+    _tft->BeginFrame();
+    Display.DrawScreenSaver();
+    RenderFrameStats stats = _tft->EndFrame();
+    saverStats.windows += stats.windows;
+    saverStats.pixels += stats.pixels;
+    saverStats.overdraw += stats.overdraw;
+    saverStats.cpuTime_us += stats.cpuTime_us;
+  }
+  AddFrameResult("DrawScreenSaver (per frame)", saverStats, BENCHMARK_SCREENSAVERFRAMES);
+
+  // Screen saver in real time with fixed frame rate (Idle time is left to other tasks)
+  Display.ShowScreenSaverPage();
+  uint32_t startTime_ms = millis();
+  while (millis() - startTime_ms < BENCHMARK_SCREENSAVERTIME_MS)
+  {
+    delay(Display.UpdateScreenSaver());
+  }
+  AddResult("Screen saver CPU load", "%", Display.GetScreenSaverCpuLoad());
+
+  // Same frames and time window with the former screen saver
+  RunLegacyScreenSaver();
+}
+
+//===============================================================
+// Runs the former screen saver for comparison. It drew a frame in
+// every loop without frame limit, stars were drawn with single
+// pixel and line writes and checked against the logo with
+// 'GetPixel()' (Code of the firmware before the screen saver
+// engine, see 'ScreenSaver.cpp')
+//===============================================================
+void BenchmarkRunner::RunLegacyScreenSaver()
+{
+  // Own copy of the logo, the screen saver of the display keeps its buffers
+  SPIFFSBMPImage logo;
+  logo.Allocate(Config.imageLogo);
+
+  _legacyLogo_x = 10;
+  _legacyLogo_y = TFT_HEIGHT / 2;
+  _legacyXDir = 1;
+  _legacyYDir = 1;
+  for (uint8_t index = 0; index < SCREENSAVER_STARCOUNT; index++)
+  {
+    _legacyStars[index] = Star();
+  }
+
+  // Frames are averaged
+  _tft->fillScreen(Config.tftColorBackground);
+  RenderFrameStats saverStats;
+  for (uint16_t frame = 0; frame < BENCHMARK_SCREENSAVERFRAMES; frame++)
+  {
+    _tft->BeginFrame();
+    DrawLegacyScreenSaver(&logo);
+    RenderFrameStats stats = _tft->EndFrame();
+    saverStats.windows += stats.windows;
+    saverStats.pixels += stats.pixels;
+    saverStats.overdraw += stats.overdraw;
+    saverStats.cpuTime_us += stats.cpuTime_us;
+  }
+  AddFrameResult("DrawScreenSaver legacy (per frame)", saverStats, BENCHMARK_SCREENSAVERFRAMES);
+
+  // Real time without frame limit, like the former state machine loop
+  _tft->fillScreen(Config.tftColorBackground);
+  uint32_t frameCount = 0;
+  uint32_t busyTime_us = 0;
+  uint32_t startTime_ms = millis();
+  while (millis() - startTime_ms < BENCHMARK_SCREENSAVERTIME_MS)
+  {
+    uint32_t frameStart_us = micros();
+    DrawLegacyScreenSaver(&logo);
+    busyTime_us += micros() - frameStart_us;
+    frameCount++;
+  }
+  uint32_t duration_ms = millis() - startTime_ms;
+  AddResult("Legacy screen saver CPU load", "%", busyTime_us / (duration_ms * 10.0));
+  AddResult("Legacy screen saver frame rate", "fps", frameCount * 1000.0 / duration_ms);
+  logo.Deallocate();
+}
+
+//===============================================================
+// Draws a frame of the former screen saver
+//===============================================================
+void BenchmarkRunner::DrawLegacyScreenSaver(SPIFFSBMPImage* logo)
+{
+  int16_t logoWidth = logo->IsValid() ? logo->Width() : 0;
+  int16_t logoHeight = logo->IsValid() ? logo->Height() : 0;
+
+  // Move logo indexes
+  int16_t logo_x = _legacyLogo_x + _legacyXDir;
+  int16_t logo_y = _legacyLogo_y + _legacyYDir;
+
+  // Move logo if image is available
+  logo->Move(_legacyLogo_x, _legacyLogo_y, logo_x, logo_y, _tft, Config.tftColorBackground);
+
+  // Impact collision with the left or right edge
+  if (logo_x <= -logoWidth / 2 || logo_x >= TFT_WIDTH - logoWidth / 2)
+  {
+    _legacyXDir = -_legacyXDir;
+  }
+
+  // Impact collision with the top or bottom edge
+  if (logo_y <= -logoHeight / 2 || logo_y >= TFT_HEIGHT - logoHeight / 2)
+  {
+    _legacyYDir = -_legacyYDir;
+  }
+
+  // Draw stars
+  for (uint8_t index = 0; index < SCREENSAVER_STARCOUNT; index++)
+  {
+    Star& star = _legacyStars[index];
+
+    // Init new star, if star animation finished
+    if (star.Size >= star.MaxSize)
+    {
+      // Clear old star only outside of the non-transparent part of the logo
+      if (!logo->IsValid() ||
+        !(star.X > logo_x && star.X < logo_x + logoWidth &&
+        star.Y > logo_y && star.Y < logo_y + logoHeight &&
+        logo->GetPixel(star.X - logo_x, star.Y - logo_y) != logo->TransparencyColor()))
+      {
+        DrawLegacyStar(star.X, star.Y, star.FullStars, Config.tftColorBackground, star.Size);
+      }
+
+      star.X = random(0, TFT_WIDTH);
+      star.Y = random(0, TFT_HEIGHT);
+      star.MaxSize = random(1, 6);
+      star.FullStars = random(0, 12) < 6 ? true : false;
+      star.Size = 0;
+    }
+
+    // Draw new star only outside of the non-transparent part of the logo
+    if (!logo->IsValid() ||
+      !(star.X > logo_x && star.X < logo_x + logoWidth &&
+      star.Y > logo_y && star.Y < logo_y + logoHeight &&
+      logo->GetPixel(star.X - logo_x, star.Y - logo_y) != logo->TransparencyColor()))
+    {
+      DrawLegacyStar(star.X, star.Y, star.FullStars, Config.tftColorForeground, star.Size);
+    }
+
+    // Increment star size
+    star.Size++;
+  }
+
+  _legacyLogo_x = logo_x;
+  _legacyLogo_y = logo_y;
+}
+
+//===============================================================
+// Draws a star of the former screen saver
+//===============================================================
+void BenchmarkRunner::DrawLegacyStar(int16_t x0, int16_t y0, bool fullStars, uint16_t color, int16_t size)
+{
+  _tft->writePixel(x0, y0, color);
+
+  if (size > 0)
+  {
+    DrawLegacyStarTail(x0, y0, 1, 2, fullStars, color);
+  }
+  if (size > 1)
+  {
+    DrawLegacyStarTail(x0, y0, 4, 5, fullStars, color);
+  }
+  if (size > 2)
+  {
+    DrawLegacyStarTail(x0, y0, 7, 8, fullStars, color);
+  }
+  if (size > 3)
+  {
+    DrawLegacyStarTail(x0, y0, 10, 11, fullStars, color);
+  }
+  if (size > 4)
+  {
+    DrawLegacyStarTail(x0, y0, 13, 14, fullStars, color);
+  }
+}
+
+//===============================================================
+// Draws a star tail of the former screen saver (Up, down, right,
+// left and the diagonals for full stars)
+//===============================================================
+void BenchmarkRunner::DrawLegacyStarTail(int16_t x0, int16_t y0, int16_t start, int16_t end, bool fullStars, uint16_t color)
+{
+  _tft->writeLine(x0, y0 - start, x0, y0 - end, color);
+  _tft->writeLine(x0, y0 + start, x0, y0 + end, color);
+  _tft->writeLine(x0 + start, y0, x0 + end, y0, color);
+  _tft->writeLine(x0 - start, y0, x0 - end, y0, color);
+
+  if (fullStars)
+  {
+    _tft->writeLine(x0 + start, y0 - start, x0 + end, y0 - end, color);
+    _tft->writeLine(x0 - start, y0 - start, x0 - end, y0 - end, color);
+    _tft->writeLine(x0 + start, y0 + start, x0 + end, y0 + end, color);
+    _tft->writeLine(x0 - start, y0 + start, x0 - end, y0 + end, color);
+  }
+}
+
+//===============================================================
+// Runs the theme enumeration benchmark with synthetic theme files
+// Copies of the current theme are written to SPIFFS and removed
+// afterwards. Compares parsing every file with the theme index
+//===============================================================
+void BenchmarkRunner::RunThemeIndex()
+{
+  // Read current theme as template
+  char currentConfig[THEMEINDEX_MAXNAMELENGTH];
+  char templatePath[FILESYSTEM_MAXPATH];
+  Config.GetCurrent(currentConfig, sizeof(currentConfig));
+  snprintf(templatePath, sizeof(templatePath), "/%s", currentConfig);
+  File templateFile = FileSystem.open(templatePath, FILE_READ);
+  if (!templateFile)
+  {
+    ESP_LOGE(TAG, "No theme file for the theme index benchmark");
+    return;
+  }
+  String content = templateFile.readString();
+  templateFile.close();
+
+  RunThemeIndex(content, 15, "Theme enumeration (parse all, 15)", "Theme index (cold, 15)", "Theme index (warm, 15)");
+  RunThemeIndex(content, 100, "Theme enumeration (parse all, 100)", "Theme index (cold, 100)", "Theme index (warm, 100)");
+  RunThemeIndex(content, BENCHMARK_THEMEFILES, "Theme enumeration (parse all, 500)", "Theme index (cold, 500)", "Theme index (warm, 500)");
+  RunThemeCatalogue();
+
+  // Remove synthetic theme files
+  char fileName[32];
+  for (uint16_t index = 0; index < BENCHMARK_THEMEFILES; index++)
+  {
+    snprintf(fileName, sizeof(fileName), BENCHMARK_THEMEFILEPATTERN, index);
+    FileSystem.remove(fileName);
+  }
+  FileSystem.remove(BENCHMARK_THEMEINDEXPATH);
+  FileSystem.remove(BENCHMARK_THEMECATALOGUEPATH);
+}
+
+//===============================================================
+// Measures the theme enumeration with a count of synthetic
+// theme files (Existing files are reused)
+//===============================================================
+void BenchmarkRunner::RunThemeIndex(const String& content, uint16_t fileCount, const char* parseName, const char* coldName, const char* warmName)
+{
+  // Create synthetic theme files
+  char fileName[32];
+  for (uint16_t index = 0; index < fileCount; index++)
+  {
+    snprintf(fileName, sizeof(fileName), BENCHMARK_THEMEFILEPATTERN, index);
+    if (!FileSystem.exists(fileName))
+    {
+      File file = FileSystem.open(fileName, FILE_WRITE);
+      if (!file || file.print(content) != content.length())
+      {
+        ESP_LOGE(TAG, "Failed to write '%s' (SPIFFS full?)", fileName);
+        file.close();
+        return;
+      }
+      file.close();
+    }
+  }
+
+  // Former approach: Parse and validate every json file
+  uint32_t startTime_us = micros();
+  File rootDirectory = FileSystem.open("/", FILE_READ);
+  File entry = rootDirectory.openNextFile();
+  while (entry)
+  {
+    JsonDocument doc;
+    if (!entry.isDirectory() &&
+      String(entry.name()).endsWith(".json") &&
+      deserializeJson(doc, entry).code() == DeserializationError::Ok)
+    {
+      Config.CheckValid(doc);
+    }
+    entry = rootDirectory.openNextFile();
+  }
+  rootDirectory.close();
+  AddResult(parseName, "ms", (micros() - startTime_us) / 1000.0);
+
+  // Theme index without index file (First boot or all files changed)
+  FileSystem.remove(BENCHMARK_THEMEINDEXPATH);
+  startTime_us = micros();
+  {
+    ThemeIndex themeIndex(BENCHMARK_THEMEINDEXPATH, BENCHMARK_THEMECATALOGUEPATH);
+    themeIndex.Update();
+  }
+  AddResult(coldName, "ms", (micros() - startTime_us) / 1000.0);
+
+  // Theme index with unchanged files (Regular boot)
+  startTime_us = micros();
+  {
+    ThemeIndex themeIndex(BENCHMARK_THEMEINDEXPATH, BENCHMARK_THEMECATALOGUEPATH);
+    themeIndex.Update();
+  }
+  AddResult(warmName, "ms", (micros() - startTime_us) / 1000.0);
+}
+
+//===============================================================
+// Measures the catalogue navigation with the synthetic theme
+// files (Like turning the encoder on the settings page)
+//===============================================================
+void BenchmarkRunner::RunThemeCatalogue()
+{
+  ThemeCatalogue catalogue(BENCHMARK_THEMECATALOGUEPATH);
+  if (!catalogue.Begin() || catalogue.GetCount() == 0)
+  {
+    ESP_LOGE(TAG, "No catalogue for the theme catalogue benchmark");
+    return;
+  }
+
+  // Step through all themes
+  char name[THEMEINDEX_MAXNAMELENGTH];
+  uint32_t startTime_us = micros();
+  for (uint16_t index = 0; index < catalogue.GetCount(); index++)
+  {
+    catalogue.GetName(index, name, sizeof(name));
+  }
+  AddResult("Theme catalogue step (500)", "us", (double)(micros() - startTime_us) / catalogue.GetCount());
+
+  // Look up the last theme (Like loading the saved theme at boot)
+  startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_ITERATIONS; index++)
+  {
+    catalogue.Find(name);
+  }
+  AddResult("Theme catalogue find (500)", "us", (double)(micros() - startTime_us) / BENCHMARK_ITERATIONS);
+  AddResult("Theme catalogue RAM", "bytes", sizeof(ThemeCatalogue));
+}
+
+//===============================================================
+// Measures loading the current theme from json and from the
+// compiled theme (Both end with the same configuration)
+//===============================================================
+void BenchmarkRunner::RunThemeLoad()
+{
+  char currentConfig[THEMEINDEX_MAXNAMELENGTH];
+  Config.GetCurrent(currentConfig, sizeof(currentConfig));
+
+  // Parse json file, check and convert all values
+  uint32_t startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_ITERATIONS; index++)
+  {
+    if (!Config.LoadConfig(currentConfig, false))
+    {
+      ESP_LOGE(TAG, "No theme file for the theme load benchmark");
+      return;
+    }
+  }
+  AddResult("Theme load (json)", "us", (double)(micros() - startTime_us) / BENCHMARK_ITERATIONS);
+
+  // Create compiled theme if missing
+  Config.LoadConfig(currentConfig);
+
+  // Single read of the compiled theme
+  startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_ITERATIONS; index++)
+  {
+    Config.LoadConfig(currentConfig);
+  }
+  AddResult("Theme load (compiled)", "us", (double)(micros() - startTime_us) / BENCHMARK_ITERATIONS);
+  AddResult("Theme compiled size", "bytes", sizeof(ThemeBlob));
+}
+
+//===============================================================
+// Measures loading config and images of the current theme from
+// single files and from a bundle built from the same files
+//===============================================================
+void BenchmarkRunner::RunThemeBundle()
+{
+  char currentConfig[THEMEINDEX_MAXNAMELENGTH];
+  Config.GetCurrent(currentConfig, sizeof(currentConfig));
+  if (strstr(currentConfig, THEMEBUNDLE_EXTENSION) != NULL)
+  {
+    ESP_LOGI(TAG, "Current theme is a bundle, skipping bundle benchmark");
+    return;
+  }
+
+  // Build bundle from the current theme
+  ThemeBlob blob;
+  Config.ToBlob(&blob);
+  const char* imagePaths[THEMEBUNDLE_SECTIONS - 1] =
+  {
+    Config.imageLogo, Config.imageGlass, Config.imageBottle1,
+    Config.imageBottle2, Config.imageBottle3, Config.imageBottle4
+  };
+  if (!ThemeBundle::Save(BENCHMARK_THEMEBUNDLEPATH, &blob, imagePaths))
+  {
+    ESP_LOGE(TAG, "Failed to create bundle for the theme bundle benchmark");
+    return;
+  }
+
+  // Compiled config and one file per image
+  uint32_t startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_THEMELOADS; index++)
+  {
+    Config.LoadConfig(currentConfig);
+    Display.LoadImages();
+  }
+  AddResult("Theme load (files)", "ms", (micros() - startTime_us) / 1000.0 / BENCHMARK_THEMELOADS);
+
+  // Config and images through one handle
+  startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_THEMELOADS; index++)
+  {
+    Config.LoadConfig(BENCHMARK_THEMEBUNDLEPATH);
+    Display.LoadImages();
+  }
+  AddResult("Theme load (bundle)", "ms", (micros() - startTime_us) / 1000.0 / BENCHMARK_THEMELOADS);
+
+  // Restore current theme
+  Config.LoadConfig(currentConfig);
+  Display.LoadImages();
+  FileSystem.remove(BENCHMARK_THEMEBUNDLEPATH);
+}
+
+//===============================================================
+// Measures switching to the current theme the old way (Main loop
+// blocked by config and image loading) and with the background
+// prefetch (Main loop only blocked by the swap)
+//===============================================================
+void BenchmarkRunner::RunThemeSwitch()
+{
+  char currentConfig[THEMEINDEX_MAXNAMELENGTH];
+  Config.GetCurrent(currentConfig, sizeof(currentConfig));
+
+  // Blocking load on the main loop
+  uint32_t startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_THEMELOADS; index++)
+  {
+    Config.LoadConfig(currentConfig);
+    Display.LoadImages();
+  }
+  AddResult("Theme switch (blocking)", "ms", (micros() - startTime_us) / 1000.0 / BENCHMARK_THEMELOADS);
+
+  // Prefetch in background and swap in (Visible time includes polling)
+  uint32_t switchTime_ms = 0;
+  uint32_t swapTime_us = 0;
+  for (uint16_t index = 0; index < BENCHMARK_THEMELOADS; index++)
+  {
+    ThemeSwitch.Request(currentConfig);
+    ThemeSwitch.Finish();
+    switchTime_ms += ThemeSwitch.GetLastSwitchTime_ms();
+    swapTime_us += ThemeSwitch.GetLastSwapTime_us();
+  }
+  AddResult("Theme switch (prefetch visible)", "ms", (double)switchTime_ms / BENCHMARK_THEMELOADS);
+  AddResult("Theme switch (prefetch swap)", "us", (double)swapTime_us / BENCHMARK_THEMELOADS);
+}
+
+//===============================================================
+// Compares the RAM footprint and load time of the theme images
+// copied from SPIFFS into PSRAM/heap and mapped from the asset
+// partition. Only images available in both are measured
+//===============================================================
+void BenchmarkRunner::RunAssets()
+{
+  if (!Assets.IsMounted())
+  {
+    ESP_LOGI(TAG, "No asset partition, skipping asset benchmark");
+    return;
+  }
+
+  const char* names[] = { Config.imageLogo, Config.imageGlass, Config.imageBottle1 };
+  const uint8_t imageCount = sizeof(names) / sizeof(names[0]);
+  SPIFFSBMPImage images[imageCount];
+  bool isAvailable[imageCount];
+  for (uint8_t index = 0; index < imageCount; index++)
+  {
+    uint32_t length = 0;
+    char path[FILESYSTEM_MAXPATH];
+    snprintf(path, sizeof(path), "%s%s", names[index][0] == '/' ? "" : "/", names[index]);
+    isAvailable[index] = Assets.Find(names[index], &length) != NULL &&
+      FileSystem.exists(path);
+  }
+
+  // Copy from SPIFFS
+  uint32_t freeHeap = ESP.getFreeHeap();
+  uint32_t freePsram = ESP.getFreePsram();
+  uint32_t startTime_us = micros();
+  for (uint8_t index = 0; index < imageCount; index++)
+  {
+    if (isAvailable[index])
+    {
+      images[index].Allocate(names[index]);
+    }
+  }
+  AddResult("Image load (SPIFFS copy)", "us", micros() - startTime_us);
+  AddResult("Image heap (SPIFFS copy)", "bytes", (int32_t)(freeHeap - ESP.getFreeHeap()));
+  AddResult("Image PSRAM (SPIFFS copy)", "bytes", (int32_t)(freePsram - ESP.getFreePsram()));
+  for (uint8_t index = 0; index < imageCount; index++)
+  {
+    images[index].Deallocate();
+  }
+
+  // Map from asset partition
+  freeHeap = ESP.getFreeHeap();
+  freePsram = ESP.getFreePsram();
+  startTime_us = micros();
+  for (uint8_t index = 0; index < imageCount; index++)
+  {
+    uint32_t length = 0;
+    const uint8_t* data = Assets.Find(names[index], &length);
+    if (isAvailable[index])
+    {
+      images[index].Allocate(data, length, names[index]);
+    }
+  }
+  AddResult("Image load (asset mapped)", "us", micros() - startTime_us);
+  AddResult("Image heap (asset mapped)", "bytes", (int32_t)(freeHeap - ESP.getFreeHeap()));
+  AddResult("Image PSRAM (asset mapped)", "bytes", (int32_t)(freePsram - ESP.getFreePsram()));
+  for (uint8_t index = 0; index < imageCount; index++)
+  {
+    images[index].Deallocate();
+  }
+}
+
+//===============================================================
+// Compares loading and drawing the images of the current theme
+// as bitmap (Header parsing, bottom-up rows, per pixel writes)
+// and transcoded (Spans written with one address window each).
+// Bitmap loads are only measured for bitmaps on SPIFFS
+//===============================================================
+void BenchmarkRunner::RunImages()
+{
+  const char* names[] = { Config.imageLogo, Config.imageGlass, Config.imageBottle1 };
+  const uint8_t imageCount = sizeof(names) / sizeof(names[0]);
+  uint32_t bitmapLoad_us = 0;
+  uint32_t transcodedLoad_us = 0;
+  uint32_t bitmapDraw_us = 0;
+  uint32_t transcodedDraw_us = 0;
+  uint8_t bitmapLoads = 0;
+  uint8_t transcodedCount = 0;
+
+  for (uint8_t index = 0; index < imageCount; index++)
+  {
+    if (names[index][0] == '\0')
+    {
+      continue;
+    }
+
+    // Bitmap from SPIFFS or the asset partition
+    char path[FILESYSTEM_MAXPATH];
+    snprintf(path, sizeof(path), "%s%s", names[index][0] == '/' ? "" : "/", names[index]);
+    SPIFFSBMPImage bitmap;
+    uint32_t length = 0;
+    const uint8_t* data = Assets.Find(names[index], &length);
+    uint32_t startTime_us = micros();
+    if (FileSystem.exists(path))
+    {
+      File file = FileSystem.open(path, FILE_READ);
+      bitmap.Allocate(&file, 0, path);
+      file.close();
+      bitmapLoad_us += micros() - startTime_us;
+      bitmapLoads++;
+    }
+    else if (data)
+    {
+      bitmap.Allocate(data, length, path);
+    }
+
+    char transcodedPath[32];
+    snprintf(transcodedPath, sizeof(transcodedPath), BENCHMARK_IMAGEPATTERN, index);
+    if (!bitmap.IsValid() ||
+      bitmap.SaveTranscoded(transcodedPath) != IMAGE_SUCCESS)
+    {
+      continue;
+    }
+
+    SPIFFSBMPImage transcoded;
+    startTime_us = micros();
+    transcoded.Allocate(transcodedPath);
+    transcodedLoad_us += micros() - startTime_us;
+    transcodedCount++;
+
+    if (_tft &&
+      transcoded.IsValid())
+    {
+      startTime_us = micros();
+      for (uint8_t draw = 0; draw < BENCHMARK_IMAGEDRAWS; draw++)
+      {
+        bitmap.Draw(0, 0, _tft);
+      }
+      bitmapDraw_us += micros() - startTime_us;
+
+      startTime_us = micros();
+      for (uint8_t draw = 0; draw < BENCHMARK_IMAGEDRAWS; draw++)
+      {
+        transcoded.Draw(0, 0, _tft);
+      }
+      transcodedDraw_us += micros() - startTime_us;
+    }
+
+    transcoded.Deallocate();
+    FileSystem.remove(transcodedPath);
+  }
+
+  if (bitmapLoads > 0)
+  {
+    AddResult("Image load (bitmap)", "us", (double)bitmapLoad_us / bitmapLoads);
+  }
+  if (transcodedCount > 0)
+  {
+    AddResult("Image load (transcoded)", "us", (double)transcodedLoad_us / transcodedCount);
+  }
+  if (transcodedCount > 0 &&
+    _tft)
+  {
+    AddResult("Image draw (bitmap)", "us", (double)bitmapDraw_us / transcodedCount / BENCHMARK_IMAGEDRAWS);
+    AddResult("Image draw (transcoded)", "us", (double)transcodedDraw_us / transcodedCount / BENCHMARK_IMAGEDRAWS);
+  }
+}
+
+//===============================================================
+// Compares Json responses built from Strings with the streaming
+// writer (Same document as the '/control?settings' response)
+//===============================================================
+void BenchmarkRunner::RunJson()
+{
+  uint32_t length = 0;
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+  uint32_t allocationCount = _allocationCount;
+  uint32_t allocationBytes = _allocationBytes;
+#endif
+  uint32_t startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_ITERATIONS; index++)
+  {
+    String output = "[{";
+    output += "\"NEED_UPDATE\":" + String(Statemachine.GetNeedUpdate()) + ",";
+    output += "\"" + String(IS_MIXER) + "\":" + String(Config.isMixer) + ",";
+    output += "\"" + String(MIXER_NAME) + "\":\"" + Config.mixerName + "\",";
+    output += "\"" + String(LIQUID_NAME_1) + "\":\"" + Config.liquidName1 + "\",";
+    output += "\"" + String(LIQUID_NAME_2) + "\":\"" + Config.liquidName2 + "\",";
+    output += "\"" + String(LIQUID_NAME_3) + "\":\"" + Config.liquidName3 + "\",";
+    output += "\"" + String(LIQUID_COLOR_1) + "\":\"" + Config.liquidColor1 + "\",";
+    output += "\"" + String(LIQUID_COLOR_2) + "\":\"" + Config.liquidColor2 + "\",";
+    output += "\"" + String(LIQUID_COLOR_3) + "\":\"" + Config.liquidColor3 + "\",";
+    output += "\"" + String(LIQUID_ANGLE_1) + "\":" + String(Statemachine.GetAngle(eLiquid1)) + ",";
+    output += "\"" + String(LIQUID_ANGLE_2) + "\":" + String(Statemachine.GetAngle(eLiquid2)) + ",";
+    output += "\"" + String(LIQUID_ANGLE_3) + "\":" + String(Statemachine.GetAngle(eLiquid3)) + ",";
+    output += "\"" + String(CYCLE_TIMESPAN) + "\":" + String(Pumps.GetCycleTimespan());
+    output += "}]";
+    length = output.length();
+  }
+  AddResult("Json settings (String)", "us", (double)(micros() - startTime_us) / BENCHMARK_ITERATIONS);
+#ifdef CONFIG_HEAP_USE_HOOKS
+  AddResult("Json settings (String) allocations", "count", (double)(_allocationCount - allocationCount) / BENCHMARK_ITERATIONS);
+  AddResult("Json settings (String) allocated", "bytes", (double)(_allocationBytes - allocationBytes) / BENCHMARK_ITERATIONS);
+  allocationCount = _allocationCount;
+#endif
+
+  startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_ITERATIONS; index++)
+  {
+    char buffer[JSONWRITER_BUFFERSIZE];
+    JsonStreamWriter writer(buffer, sizeof(buffer));
+    writer.BeginArray();
+    writer.BeginObject();
+    writer.Add("NEED_UPDATE", Statemachine.GetNeedUpdate());
+    writer.Add(IS_MIXER, Config.isMixer);
+    writer.Add(MIXER_NAME, Config.mixerName);
+    writer.Add(LIQUID_NAME_1, Config.liquidName1);
+    writer.Add(LIQUID_NAME_2, Config.liquidName2);
+    writer.Add(LIQUID_NAME_3, Config.liquidName3);
+    writer.Add(LIQUID_COLOR_1, Config.liquidColor1);
+    writer.Add(LIQUID_COLOR_2, Config.liquidColor2);
+    writer.Add(LIQUID_COLOR_3, Config.liquidColor3);
+    writer.Add(LIQUID_ANGLE_1, Statemachine.GetAngle(eLiquid1));
+    writer.Add(LIQUID_ANGLE_2, Statemachine.GetAngle(eLiquid2));
+    writer.Add(LIQUID_ANGLE_3, Statemachine.GetAngle(eLiquid3));
+    writer.Add(CYCLE_TIMESPAN, Pumps.GetCycleTimespan());
+    writer.EndObject();
+    writer.EndArray();
+    length = writer.GetLength();
+  }
+  AddResult("Json settings (writer)", "us", (double)(micros() - startTime_us) / BENCHMARK_ITERATIONS);
+#ifdef CONFIG_HEAP_USE_HOOKS
+  AddResult("Json settings (writer) allocations", "count", (double)(_allocationCount - allocationCount) / BENCHMARK_ITERATIONS);
+#endif
+  AddResult("Json settings size", "bytes", length);
+}
+
+//===============================================================
+// Measures the file list of the SPIFFS editor with synthetic
+// files. The String list is kept completely in RAM, the streamed
+// list only keeps a single entry
+//===============================================================
+void BenchmarkRunner::RunJsonFileList()
+{
+  // Create empty synthetic files
+  char path[32];
+  for (uint16_t index = 0; index < BENCHMARK_LISTFILES; index++)
+  {
+    snprintf(path, sizeof(path), BENCHMARK_LISTFILEPATTERN, index);
+    File file = FileSystem.open(path, FILE_WRITE);
+    file.close();
+  }
+
+  // Old list built from Strings
+#ifdef CONFIG_HEAP_USE_HOOKS
+  uint32_t allocationCount = _allocationCount;
+#endif
+  uint32_t startTime_us = micros();
+  File dir = FileSystem.open("/", FILE_READ);
+  String output = "[";
+  File entry = dir.openNextFile();
+  while (entry)
+  {
+    if (output != "[")
+    {
+      output += ',';
+    }
+    output += "{\"type\":\"file\",\"name\":\"";
+    output += String(entry.name());
+    output += "\",\"size\":";
+    output += String(entry.size());
+    output += "}";
+    entry = dir.openNextFile();
+  }
+  dir.close();
+  output += "]";
+  AddResult("File list (String)", "ms", (double)(micros() - startTime_us) / 1000.0);
+  AddResult("File list (String) RAM", "bytes", output.length());
+#ifdef CONFIG_HEAP_USE_HOOKS
+  AddResult("File list (String) allocations", "count", _allocationCount - allocationCount);
+#endif
+  output = String();
+
+  // Streamed list into chunk sized buffers
+  uint8_t* buffer = (uint8_t*)malloc(BENCHMARK_CHUNKSIZE);
+  if (buffer)
+  {
+#ifdef CONFIG_HEAP_USE_HOOKS
+    allocationCount = _allocationCount;
+#endif
+    startTime_us = micros();
+    JsonFileList list(FileSystem, "/");
+    uint32_t length = 0;
+    uint32_t chunks = 0;
+    for (size_t read = list.Read(buffer, BENCHMARK_CHUNKSIZE); read > 0; read = list.Read(buffer, BENCHMARK_CHUNKSIZE))
+    {
+      length += read;
+      chunks++;
+    }
+    AddResult("File list (streamed)", "ms", (double)(micros() - startTime_us) / 1000.0);
+    AddResult("File list (streamed) RAM", "bytes", sizeof(JsonFileList));
+#ifdef CONFIG_HEAP_USE_HOOKS
+    AddResult("File list (streamed) allocations", "count", _allocationCount - allocationCount);
+#endif
+    ESP_LOGI(TAG, "Streamed %d files in %d chunks (%d Bytes)", list.GetCount(), chunks, length);
+    free(buffer);
+  }
+
+  // Remove synthetic files
+  for (uint16_t index = 0; index < BENCHMARK_LISTFILES; index++)
+  {
+    snprintf(path, sizeof(path), BENCHMARK_LISTFILEPATTERN, index);
+    FileSystem.remove(path);
+  }
+}
+
+//===============================================================
+// Compares uploads written per network segment with the staged
+// upload of the SPIFFS editor (Write-behind buffer, checksum,
+// temporary file and rename). Network time is not included
+//===============================================================
+void BenchmarkRunner::RunUpload()
+{
+  uint8_t* segment = (uint8_t*)malloc(BENCHMARK_CHUNKSIZE);
+  uint8_t* buffer = (uint8_t*)ps_malloc(SPIFFSEDITOR_WRITEBUFFER);
+  if (!segment ||
+    !buffer)
+  {
+    free(segment);
+    free(buffer);
+    return;
+  }
+  for (uint16_t index = 0; index < BENCHMARK_CHUNKSIZE; index++)
+  {
+    segment[index] = (uint8_t)(index * 7);
+  }
+
+  // Old upload, each segment is written to the target file
+  FileSystem.remove(BENCHMARK_UPLOADPATH);
+  uint32_t startTime_us = micros();
+  File file = FileSystem.open(BENCHMARK_UPLOADPATH, FILE_WRITE);
+  for (uint32_t written = 0; written < BENCHMARK_UPLOADSIZE; written += BENCHMARK_CHUNKSIZE)
+  {
+    file.write(segment, min((uint32_t)BENCHMARK_CHUNKSIZE, BENCHMARK_UPLOADSIZE - written));
+  }
+  file.close();
+  uint32_t elapsed_us = micros() - startTime_us;
+  AddResult("Upload 64 KB (per segment)", "KB/s", BENCHMARK_UPLOADSIZE / 1024.0 / (elapsed_us / 1000000.0));
+
+  // Staged upload, segments are collected and written in blocks, then renamed into place
+  startTime_us = micros();
+  uint32_t crc = 0;
+  size_t bufferLength = 0;
+  file = FileSystem.open(BENCHMARK_UPLOADTEMPPATH, FILE_WRITE);
+  for (uint32_t written = 0; written < BENCHMARK_UPLOADSIZE; written += BENCHMARK_CHUNKSIZE)
+  {
+    size_t length = min((uint32_t)BENCHMARK_CHUNKSIZE, BENCHMARK_UPLOADSIZE - written);
+    crc = esp_rom_crc32_le(crc, segment, length);
+    for (size_t offset = 0; offset < length; )
+    {
+      size_t copyLength = min(length - offset, (size_t)SPIFFSEDITOR_WRITEBUFFER - bufferLength);
+      memcpy(buffer + bufferLength, segment + offset, copyLength);
+      bufferLength += copyLength;
+      offset += copyLength;
+      if (bufferLength == SPIFFSEDITOR_WRITEBUFFER)
+      {
+        file.write(buffer, bufferLength);
+        bufferLength = 0;
+      }
+    }
+  }
+  file.write(buffer, bufferLength);
+  file.close();
+  FileSystem.remove(BENCHMARK_UPLOADPATH);
+  FileSystem.rename(BENCHMARK_UPLOADTEMPPATH, BENCHMARK_UPLOADPATH);
+  elapsed_us = micros() - startTime_us;
+  AddResult("Upload 64 KB (staged)", "KB/s", BENCHMARK_UPLOADSIZE / 1024.0 / (elapsed_us / 1000000.0));
+  ESP_LOGI(TAG, "Staged upload crc32: %08lx", (unsigned long)crc);
+
+  FileSystem.remove(BENCHMARK_UPLOADPATH);
+  free(segment);
+  free(buffer);
+}
+
+//===============================================================
+// Measures open, read, write and list latency of the file system
+// with 20, 100 and 300 synthetic files. Only the mounted file
+// system is measured, for a comparison the firmware is built once
+// with 'FILESYSTEM_USE_LITTLEFS' set to 0
+//===============================================================
+void BenchmarkRunner::RunFileSystem()
+{
+  ESP_LOGI(TAG, "File system: %s (%d / %d Bytes used)", FileSystem.GetName(), FileSystem.UsedBytes(), FileSystem.TotalBytes());
+
+  RunFileSystem(20, "FS open (20 files)", "FS read 1 KB (20 files)", "FS write 1 KB (20 files)", "FS write max (20 files)", "FS list (20 files)");
+  RunFileSystem(100, "FS open (100 files)", "FS read 1 KB (100 files)", "FS write 1 KB (100 files)", "FS write max (100 files)", "FS list (100 files)");
+  RunFileSystem(BENCHMARK_FSFILES, "FS open (300 files)", "FS read 1 KB (300 files)", "FS write 1 KB (300 files)", "FS write max (300 files)", "FS list (300 files)");
+
+  // Remove synthetic files
+  char fileName[32];
+  for (uint16_t index = 0; index < BENCHMARK_FSFILES; index++)
+  {
+    snprintf(fileName, sizeof(fileName), BENCHMARK_FSFILEPATTERN, index);
+    FileSystem.remove(fileName);
+  }
+}
+
+//===============================================================
+// Measures the file system latencies with a count of synthetic
+// files (Existing files are reused). Writes replace existing
+// files, so the maximum shows garbage collection stalls
+//===============================================================
+void BenchmarkRunner::RunFileSystem(uint16_t fileCount, const char* openName, const char* readName, const char* writeName, const char* writeMaxName, const char* listName)
+{
+  uint8_t* buffer = (uint8_t*)malloc(BENCHMARK_FSFILESIZE);
+  if (!buffer)
+  {
+    return;
+  }
+  for (uint16_t index = 0; index < BENCHMARK_FSFILESIZE; index++)
+  {
+    buffer[index] = (uint8_t)(index * 7);
+  }
+
+  // Create synthetic files
+  char fileName[32];
+  for (uint16_t index = 0; index < fileCount; index++)
+  {
+    snprintf(fileName, sizeof(fileName), BENCHMARK_FSFILEPATTERN, index);
+    if (!FileSystem.exists(fileName))
+    {
+      File file = FileSystem.open(fileName, FILE_WRITE);
+      if (!file || file.write(buffer, BENCHMARK_FSFILESIZE) != BENCHMARK_FSFILESIZE)
+      {
+        ESP_LOGE(TAG, "Failed to write '%s' (File system full?)", fileName);
+        file.close();
+        free(buffer);
+        return;
+      }
+      file.close();
+    }
+  }
+
+  // Open by name (Path lookup), spread over all files
+  uint32_t startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_FSOPERATIONS; index++)
+  {
+    snprintf(fileName, sizeof(fileName), BENCHMARK_FSFILEPATTERN, (index * 7) % fileCount);
+    File file = FileSystem.open(fileName, FILE_READ);
+    file.close();
+  }
+  AddResult(openName, "us", (double)(micros() - startTime_us) / BENCHMARK_FSOPERATIONS);
+
+  // Open, read and close
+  startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_FSOPERATIONS; index++)
+  {
+    snprintf(fileName, sizeof(fileName), BENCHMARK_FSFILEPATTERN, (index * 7) % fileCount);
+    File file = FileSystem.open(fileName, FILE_READ);
+    file.read(buffer, BENCHMARK_FSFILESIZE);
+    file.close();
+  }
+  AddResult(readName, "us", (double)(micros() - startTime_us) / BENCHMARK_FSOPERATIONS);
+
+  // Rewrite files (Open, write and close)
+  uint32_t maxTime_us = 0;
+  startTime_us = micros();
+  for (uint16_t index = 0; index < BENCHMARK_FSOPERATIONS; index++)
+  {
+    uint32_t writeTime_us = micros();
+    snprintf(fileName, sizeof(fileName), BENCHMARK_FSFILEPATTERN, (index * 7) % fileCount);
+    File file = FileSystem.open(fileName, FILE_WRITE);
+    file.write(buffer, BENCHMARK_FSFILESIZE);
+    file.close();
+    maxTime_us = max(maxTime_us, (uint32_t)(micros() - writeTime_us));
+  }
+  AddResult(writeName, "us", (double)(micros() - startTime_us) / BENCHMARK_FSOPERATIONS);
+  AddResult(writeMaxName, "us", maxTime_us);
+
+  // List root directory (Like the editor file list and the theme index)
+  uint16_t entryCount = 0;
+  startTime_us = micros();
+  File rootDirectory = FileSystem.open("/", FILE_READ);
+  File entry = rootDirectory.openNextFile();
+  while (entry)
+  {
+    entryCount++;
+    entry = rootDirectory.openNextFile();
+  }
+  rootDirectory.close();
+  AddResult(listName, "ms", (micros() - startTime_us) / 1000.0);
+  ESP_LOGI(TAG, "Listed %d entries", entryCount);
+
+  free(buffer);
+}
+
+#endif
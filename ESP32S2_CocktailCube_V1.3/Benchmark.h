@@ -0,0 +1,189 @@
+/*
+ * Includes on-device benchmark functions
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <Adafruit_ST7789.h>
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#include "Config.h"
+#include "DisplayDriver.h"
+#include "GlyphCache.h"
+#include "CountingST7789.h"
+#include "ThemeIndex.h"
+#include "AssetStore.h"
+#include "ThemeSwitcher.h"
+#include "JsonStreamWriter.h"
+#include "JsonFileList.h"
+#include "SPIFFSEditor.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define BENCHMARK_MAXRESULTS        96
+#define BENCHMARK_ITERATIONS        100
+#define BENCHMARK_MAXFRAMES         24
+#define BENCHMARK_SCREENSAVERFRAMES 100
+#define BENCHMARK_SCREENSAVERTIME_MS 3000
+#define BENCHMARK_THEMEINDEXPATH    "/bench.idx"
+#define BENCHMARK_THEMECATALOGUEPATH "/bench.cat"
+#define BENCHMARK_THEMEFILES        500
+#define BENCHMARK_THEMEFILEPATTERN  "/bench_%03d.json"
+#define BENCHMARK_THEMEBUNDLEPATH   "/bench.ctp"
+#define BENCHMARK_THEMELOADS        10
+#define BENCHMARK_LISTFILES         300
+#define BENCHMARK_LISTFILEPATTERN   "/lst_%03d.txt"
+#define BENCHMARK_CHUNKSIZE         1436        // TCP segment, typical buffer of a chunked response
+#define BENCHMARK_UPLOADSIZE        65536       // Size of the synthetic upload (Theme image)
+#define BENCHMARK_UPLOADPATH        "/bench.up"
+#define BENCHMARK_UPLOADTEMPPATH    "/~bench.tmp"
+#define BENCHMARK_IMAGEPATTERN      "/bench_%d.cci"
+#define BENCHMARK_IMAGEDRAWS        10
+#define BENCHMARK_FSFILES           300
+#define BENCHMARK_FSFILEPATTERN     "/fs_%03d.bin"
+#define BENCHMARK_FSFILESIZE        1024
+#define BENCHMARK_FSOPERATIONS      50
+
+//===============================================================
+// Class for running benchmarks on the device
+//===============================================================
+class BenchmarkRunner
+{
+  public:
+    // Constructor
+    BenchmarkRunner();
+
+    // Initializes the benchmark runner
+    void Begin(CountingST7789* tft);
+
+    // Runs all benchmarks and prints the results to serial
+    void RunAll();
+
+    // Returns all results as string
+    String GetReportString();
+
+  private:
+    // Single benchmark result
+    struct Result
+    {
+      const char* name;
+      const char* unit;
+      double value;
+    };
+
+    // Single render frame result
+    struct FrameResult
+    {
+      const char* name;
+      uint16_t frameCount;
+      RenderFrameStats stats;
+    };
+
+    // Display variable
+    CountingST7789* _tft = NULL;
+
+    // Results
+    Result _results[BENCHMARK_MAXRESULTS];
+    uint8_t _resultCount = 0;
+    FrameResult _frameResults[BENCHMARK_MAXFRAMES];
+    uint8_t _frameResultCount = 0;
+
+    // Glyph cache for text benchmarks
+    GlyphCache _glyphCache;
+
+    // Former screen saver (See 'RunLegacyScreenSaver()')
+    int16_t _legacyLogo_x = 10;
+    int16_t _legacyLogo_y = TFT_HEIGHT / 2;
+    int16_t _legacyXDir = 1;
+    int16_t _legacyYDir = 1;
+    Star _legacyStars[SCREENSAVER_STARCOUNT];
+
+    // Adds a result
+    void AddResult(const char* name, const char* unit, double value);
+
+    // Adds a frame result (Averaged over the frame count)
+    void AddFrameResult(const char* name, const RenderFrameStats& stats, uint16_t frameCount = 1);
+
+    // Returns the header of the render table
+    String GetFrameTableHeader();
+
+    // Returns a single line of the render table
+    String GetFrameResultString(uint8_t index);
+
+    // Runs the value update latency benchmark
+    void RunValueUpdate();
+
+    // Counts the heap allocations of the steady state display and state updates
+    void RunAllocations();
+
+    // Runs the render benchmark for all pages and partial updates
+    void RunRender();
+
+    // Runs the former screen saver without frame limit for comparison
+    void RunLegacyScreenSaver();
+
+    // Draws a frame of the former screen saver
+    void DrawLegacyScreenSaver(SPIFFSBMPImage* logo);
+
+    // Draws a star of the former screen saver
+    void DrawLegacyStar(int16_t x0, int16_t y0, bool fullStars, uint16_t color, int16_t size);
+
+    // Draws a star tail of the former screen saver
+    void DrawLegacyStarTail(int16_t x0, int16_t y0, int16_t start, int16_t end, bool fullStars, uint16_t color);
+
+    // Runs the theme enumeration benchmark with synthetic theme files
+    void RunThemeIndex();
+
+    // Measures the theme enumeration with a count of synthetic theme files
+    void RunThemeIndex(const String& content, uint16_t fileCount, const char* parseName, const char* coldName, const char* warmName);
+
+    // Measures the catalogue navigation with the synthetic theme files
+    void RunThemeCatalogue();
+
+    // Measures loading the current theme from json and from the compiled theme
+    void RunThemeLoad();
+
+    // Measures loading config and images from single files and from a bundle
+    void RunThemeBundle();
+
+    // Runs the theme switch benchmark (Blocking load versus prefetch and swap)
+    void RunThemeSwitch();
+
+    // Compares the RAM footprint of images copied from SPIFFS and mapped from the asset partition
+    void RunAssets();
+
+    // Compares loading and drawing the theme images as bitmap and transcoded
+    void RunImages();
+
+    // Compares Json responses built from Strings with the streaming writer
+    void RunJson();
+
+    // Measures the file list of the SPIFFS editor with synthetic files
+    void RunJsonFileList();
+
+    // Compares uploads written per network segment with the staged upload of the SPIFFS editor
+    void RunUpload();
+
+    // Measures open, read, write and list latency of the file system with synthetic files
+    void RunFileSystem();
+
+    // Measures the file system latencies with a count of synthetic files
+    void RunFileSystem(uint16_t fileCount, const char* openName, const char* readName, const char* writeName, const char* writeMaxName, const char* listName);
+};
+
+//===============================================================
+// Global variables
+//===============================================================
+extern BenchmarkRunner Benchmark;
+
+#endif
@@ -0,0 +1,219 @@
+/*
+ * Includes the boot sequencer for concurrent startup phases
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "BootSequencer.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "boot";
+
+//===============================================================
+// Global variables
+//===============================================================
+BootSequencer Boot;
+
+//===============================================================
+// Constructor
+//===============================================================
+BootSequencer::BootSequencer()
+{
+}
+
+//===============================================================
+// Initializes the boot sequencer
+//===============================================================
+void BootSequencer::Begin()
+{
+  _eventGroup = xEventGroupCreate();
+  if (!_eventGroup)
+  {
+    ESP_LOGE(TAG, "Failed to create event group, boot tasks run inline");
+  }
+
+  _phaseCount = 0;
+  _finish_ms = 0;
+}
+
+//===============================================================
+// Starts an inline phase and returns its index
+//===============================================================
+int8_t BootSequencer::BeginPhase(const char* name)
+{
+  int8_t index = -1;
+
+  portENTER_CRITICAL(&_mux);
+  if (_phaseCount < BOOT_MAXPHASES)
+  {
+    index = _phaseCount++;
+    _phases[index] = BootPhase();
+    _phases[index].name = name;
+    _phases[index].start_ms = millis();
+  }
+  portEXIT_CRITICAL(&_mux);
+
+  if (index < 0)
+  {
+    ESP_LOGE(TAG, "Phase table full, not timing '%s'", name);
+  }
+  return index;
+}
+
+//===============================================================
+// Finishes an inline phase
+//===============================================================
+void BootSequencer::EndPhase(int8_t index, bool result)
+{
+  if (index < 0 || index >= _phaseCount)
+  {
+    return;
+  }
+
+  portENTER_CRITICAL(&_mux);
+  _phases[index].end_ms = millis();
+  _phases[index].result = result;
+  _phases[index].isFinished = true;
+  portEXIT_CRITICAL(&_mux);
+
+  ESP_LOGI(TAG, "Phase '%s' finished after %lu ms%s",
+    _phases[index].name,
+    (unsigned long)(_phases[index].end_ms - _phases[index].start_ms),
+    result ? "" : " (failed)");
+
+  if (_eventGroup)
+  {
+    xEventGroupSetBits(_eventGroup, 1 << index);
+  }
+}
+
+//===============================================================
+// Starts a phase as task and returns its index
+//===============================================================
+int8_t BootSequencer::StartTask(const char* name, BootTaskFunction function, uint32_t stackSize)
+{
+  int8_t index = BeginPhase(name);
+  if (index < 0)
+  {
+    // Not timed, but still run
+    function();
+    return -1;
+  }
+
+  _phases[index].isTask = true;
+  _functions[index] = function;
+
+  if (!_eventGroup ||
+    xTaskCreate(TaskEntry, name, stackSize, (void*)(intptr_t)index, BOOT_TASKPRIORITY, NULL) != pdPASS)
+  {
+    ESP_LOGE(TAG, "Failed to create task '%s', running inline", name);
+    _phases[index].isTask = false;
+    EndPhase(index, function());
+  }
+
+  return index;
+}
+
+//===============================================================
+// Waits for a phase to finish and returns its result
+//===============================================================
+bool BootSequencer::Wait(int8_t index)
+{
+  if (index < 0 || index >= _phaseCount)
+  {
+    return true;
+  }
+
+  if (_eventGroup)
+  {
+    xEventGroupWaitBits(_eventGroup, 1 << index, pdFALSE, pdTRUE, portMAX_DELAY);
+  }
+  return _phases[index].result;
+}
+
+//===============================================================
+// Finishes the boot sequence and prints the report to serial
+//===============================================================
+void BootSequencer::Finish()
+{
+  _finish_ms = millis();
+
+  // Print line by line
+  String report = GetReportString();
+  const char* line = report.c_str();
+  while (*line)
+  {
+    const char* end = strchr(line, '\n');
+    int length = end ? end - line : strlen(line);
+    ESP_LOGI(TAG, "%.*s", length, line);
+    line += end ? length + 1 : length;
+  }
+}
+
+//===============================================================
+// Returns the time from power on to the end of the boot sequence
+//===============================================================
+uint32_t BootSequencer::GetBootTime_ms()
+{
+  return _finish_ms;
+}
+
+//===============================================================
+// Returns the boot timing report as string
+// Timestamps are relative to power on, tasks are marked with '*'
+//===============================================================
+String BootSequencer::GetReportString()
+{
+  char line[96];
+  String report = "";
+
+  snprintf(line, sizeof(line), "| %-24s | %10s | %10s | %13s |\n", "Phase", "Start [ms]", "End [ms]", "Duration [ms]");
+  report += line;
+
+  for (uint8_t index = 0; index < _phaseCount; index++)
+  {
+    const BootPhase& phase = _phases[index];
+    char name[32];
+    snprintf(name, sizeof(name), "%s%s%s", phase.name, phase.isTask ? " *" : "", !phase.isFinished ? " (running)" : (phase.result ? "" : " (failed)"));
+
+    if (phase.isFinished)
+    {
+      snprintf(line, sizeof(line), "| %-24s | %10lu | %10lu | %13lu |\n",
+        name,
+        (unsigned long)phase.start_ms,
+        (unsigned long)phase.end_ms,
+        (unsigned long)(phase.end_ms - phase.start_ms));
+    }
+    else
+    {
+      snprintf(line, sizeof(line), "| %-24s | %10lu | %10s | %13s |\n", name, (unsigned long)phase.start_ms, "-", "-");
+    }
+    report += line;
+  }
+
+  if (_finish_ms > 0)
+  {
+    report += "Boot time: " + String(_finish_ms) + " ms\n";
+  }
+  return report;
+}
+
+//===============================================================
+// Task entry for all boot tasks
+//===============================================================
+void BootSequencer::TaskEntry(void* parameter)
+{
+  int8_t index = (int8_t)(intptr_t)parameter;
+
+  bool result = Boot._functions[index]();
+  Boot.EndPhase(index, result);
+
+  vTaskDelete(NULL);
+}
@@ -0,0 +1,104 @@
+/*
+ * Includes the boot sequencer for concurrent startup phases
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef BOOTSEQUENCER_H
+#define BOOTSEQUENCER_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/event_groups.h>
+#include <esp_log.h>
+
+//===============================================================
+// Defines
+//===============================================================
+#define BOOT_MAXPHASES              20    // Maximum 24 because of the event group bits
+#define BOOT_TASKSTACKSIZE          8192
+#define BOOT_TASKPRIORITY           1     // Same as the loop task
+
+//===============================================================
+// Typedefs
+//===============================================================
+// Boot task function, returns true on success
+typedef bool (*BootTaskFunction)();
+
+//===============================================================
+// Timestamps of a single boot phase
+//===============================================================
+struct BootPhase
+{
+  const char* name = NULL;
+  uint32_t start_ms = 0;
+  uint32_t end_ms = 0;
+  bool isTask = false;
+  bool isFinished = false;
+  bool result = false;
+};
+
+//===============================================================
+// Class for running and timing the boot phases
+// Phases are either run inline (BeginPhase/EndPhase) or as
+// concurrent FreeRTOS tasks (StartTask/Wait)
+//===============================================================
+class BootSequencer
+{
+  public:
+    // Constructor
+    BootSequencer();
+
+    // Initializes the boot sequencer
+    void Begin();
+
+    // Starts an inline phase and returns its index (-1 if table is full)
+    int8_t BeginPhase(const char* name);
+
+    // Finishes an inline phase
+    void EndPhase(int8_t index, bool result = true);
+
+    // Starts a phase as task and returns its index (Runs inline if the task could not be created)
+    int8_t StartTask(const char* name, BootTaskFunction function, uint32_t stackSize = BOOT_TASKSTACKSIZE);
+
+    // Waits for a phase to finish and returns its result
+    bool Wait(int8_t index);
+
+    // Finishes the boot sequence and prints the report to serial
+    void Finish();
+
+    // Returns the time from power on to the end of the boot sequence
+    uint32_t GetBootTime_ms();
+
+    // Returns the boot timing report as string
+    String GetReportString();
+
+  private:
+    // Port mux
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+
+    // Event group for finished phases
+    EventGroupHandle_t _eventGroup = NULL;
+
+    // Phase variables
+    BootPhase _phases[BOOT_MAXPHASES];
+    BootTaskFunction _functions[BOOT_MAXPHASES] = {};
+    uint8_t _phaseCount = 0;
+    uint32_t _finish_ms = 0;
+
+    // Task entry for all boot tasks
+    static void TaskEntry(void* parameter);
+};
+
+//===============================================================
+// Global variables
+//===============================================================
+extern BootSequencer Boot;
+
+#endif
@@ -10,6 +10,7 @@
 // Includes
 //===============================================================
 #include "Config.h"
+#include "ThemeIndex.h"
 
 //===============================================================
 // Constants
@@ -49,7 +50,9 @@ bool Configuration::Begin()
   Load();
   
   // Load initial configuration
-  bool result = LoadConfig(GetCurrent());
+  char currentConfigFileName[THEMEINDEX_MAXNAMELENGTH];
+  GetCurrent(currentConfigFileName, sizeof(currentConfigFileName));
+  bool result = LoadConfig(currentConfigFileName);
   
   // Log startup info
   ESP_LOGI(TAG, "Finished initializing configuration");
@@ -90,15 +93,7 @@ void Configuration::Load()
     encoderDirection = _preferences.getChar(KEY_ENCODER, 1);
     screenSaverMode = _preferences.getChar(KEY_SCREENSAVER, e30s);
 
-    _currentConfigindex = -1;
-    for (uint8_t index = 0; index < _fileCount; index++)
-    {
-      if (currentConfigFileName == _files[index])
-      {
-        _currentConfigindex = index;
-        break;
-      }
-    }
+    _currentConfigindex = _catalogue.Find(currentConfigFileName.c_str());
 
     ESP_LOGI(TAG, "Preferences successfully loaded from '%s'", SETTINGS_NAME);
   }
@@ -117,7 +112,9 @@ void Configuration::Save()
 {
   if (_preferences.begin(SETTINGS_NAME, READWRITE_MODE))
   {
-    _preferences.putString(KEY_CONFIGFILE, GetCurrent());
+    char currentConfigFileName[THEMEINDEX_MAXNAMELENGTH];
+    GetCurrent(currentConfigFileName, sizeof(currentConfigFileName));
+    _preferences.putString(KEY_CONFIGFILE, currentConfigFileName);
     _preferences.putChar(KEY_LEDMODE_IDLE, ledModeIdle);
     _preferences.putChar(KEY_LEDMODE_DISPENSING, ledModeDispensing);
     _preferences.putChar(KEY_ENCODER, encoderDirection);
@@ -134,17 +131,32 @@ void Configuration::Save()
 }
 
 //===============================================================
-// Returns currently loaded configuration
+// Copies the name of the currently loaded configuration into a
+// buffer (No heap allocation)
 //===============================================================
-String Configuration::GetCurrent()
+void Configuration::GetCurrent(char* name, size_t length)
 {
-  if (_currentConfigindex >= 0 && 
-    _currentConfigindex < _fileCount)
+  if (_currentConfigindex < 0 ||
+    !_catalogue.GetName(_currentConfigindex, name, length))
   {
-    return _files[_currentConfigindex];
+    strlcpy(name, "default", length);
   }
+}
+
+//===============================================================
+// Returns the catalogue position of the current configuration
+//===============================================================
+int16_t Configuration::GetCurrentIndex()
+{
+  return _currentConfigindex;
+}
 
-  return "default";
+//===============================================================
+// Returns the count of valid configurations
+//===============================================================
+uint16_t Configuration::GetCount()
+{
+  return _catalogue.GetCount();
 }
 
 //===============================================================
@@ -152,14 +164,14 @@ String Configuration::GetCurrent()
 //===============================================================
 bool Configuration::Increment()
 {
-  if (_fileCount == 0)
+  if (_catalogue.GetCount() == 0)
   {
     return false;
   }
 
   _currentConfigindex++;
   
-  if (_currentConfigindex >= _fileCount)
+  if (_currentConfigindex >= _catalogue.GetCount())
   {
     _currentConfigindex = 0;
   }
@@ -172,7 +184,7 @@ bool Configuration::Increment()
 //===============================================================
 bool Configuration::Decrement()
 {
-  if (_fileCount == 0)
+  if (_catalogue.GetCount() == 0)
   {
     return false;
   }
@@ -181,7 +193,7 @@ bool Configuration::Decrement()
   
   if (_currentConfigindex < 0)
   {
-    _currentConfigindex = _fileCount - 1;
+    _currentConfigindex = _catalogue.GetCount() - 1;
   }
 
   return true;
@@ -189,82 +201,73 @@ bool Configuration::Decrement()
 
 //===============================================================
 // Enumerates all valid json config files
+// Uses the theme index, so only new or changed files are parsed.
+// Valid files are listed in the sorted on-flash catalogue
 //===============================================================
 void Configuration::EnumerateConfigs()
 {
   ESP_LOGI(TAG, "Started enumerating config files");
 
-  // Reset all config file names
-  _fileCount = 0;
-  for (uint8_t index = 0; index < MAXCONFIGS; index++)
-  {
-    _files[index] = "";
-  }
-
-  // Open root directory
-  File rootDirectory = SPIFFS.open("/", FILE_READ);
-
-  // Check if existing
-  if (!rootDirectory)
+  uint16_t parsedCount = 0;
   {
-    ESP_LOGI(TAG, "No root directory found");
-    return;
-  }
-
-  // Open first file
-  File entry = rootDirectory.openNextFile();;
-
-  // Iterate through all files and save valid config file names
-  String currentName = "";
-  while (entry)
-  {
-    if (_fileCount >= MAXCONFIGS)
-    {
-      break;
-    }
-
-    // Check for json file and valid config
-    JsonDocument doc;
-    if (!entry.isDirectory() &&
-      String(entry.name()).endsWith(".json") &&
-      deserializeJson(doc, entry).code() == DeserializationError::Ok &&
-      CheckValid(doc))
+    // Update theme index (Released after update)
+    ThemeIndex themeIndex;
+    if (!themeIndex.Update())
     {
-      ESP_LOGI(TAG, "Found: %s", entry.name());
-      _files[_fileCount++] = String(entry.name());
+      ESP_LOGE(TAG, "Failed to update theme index");
     }
-    
-    // Clear json document
-    doc.clear();
-
-    // Get next file
-    entry = rootDirectory.openNextFile();
+    parsedCount = themeIndex.GetParsedCount();
   }
 
-  // Close root directory
-  rootDirectory.close();
+  // Open catalogue of valid config files
+  _catalogue.Begin();
 
-  ESP_LOGI(TAG, "Finished enumerating config files. Found %d files.", _fileCount);
+  ESP_LOGI(TAG, "Finished enumerating config files. Found %d files (%d parsed).", _catalogue.GetCount(), parsedCount);
 }
 
 //===============================================================
 // Loads the configuration
+// The compiled theme (.ctb) next to the json file is preferred.
+// If it is missing or outdated, the json file is parsed and the
+// compiled theme is created for the next load
 //===============================================================
-bool Configuration::LoadConfig(String configFileName)
+bool Configuration::LoadConfig(const char* configFileName, bool allowBlob)
 {
-  ESP_LOGI(TAG, "Starting load config file '%s'", configFileName.c_str());
+  ESP_LOGI(TAG, "Starting load config file '%s'", configFileName);
 
-  String configFilePath = configFileName;
-  if (!configFileName.startsWith("/"))
+  char configFilePath[FILESYSTEM_MAXPATH];
+  snprintf(configFilePath, sizeof(configFilePath), "%s%s", configFileName[0] == '/' ? "" : "/", configFileName);
+  size_t pathLength = strlen(configFilePath);
+
+  // Load config and images from a single bundle file
+  CloseBundle();
+  _bundlePath[0] = '\0';
+  if (pathLength > strlen(THEMEBUNDLE_EXTENSION) &&
+    strcmp(configFilePath + pathLength - strlen(THEMEBUNDLE_EXTENSION), THEMEBUNDLE_EXTENSION) == 0)
+  {
+    return LoadBundle(configFilePath);
+  }
+
+  // Try compiled theme first (Same name as the json file)
+  char blobPath[FILESYSTEM_MAXPATH] = "";
+  if (pathLength > strlen(".json") &&
+    strcmp(configFilePath + pathLength - strlen(".json"), ".json") == 0)
+  {
+    snprintf(blobPath, sizeof(blobPath), "%.*s" THEMEBLOB_EXTENSION, (int)(pathLength - strlen(".json")), configFilePath);
+  }
+  if (allowBlob &&
+    blobPath[0] != '\0' &&
+    LoadBlob(blobPath))
   {
-    configFilePath = "/" + configFileName;
+    ESP_LOGI(TAG, "Finished load compiled config file '%s'", blobPath);
+    return true;
   }
 
   // Open config file (JSON file)
-  File configFile = SPIFFS.open(configFilePath, FILE_READ);
+  File configFile = FileSystem.open(configFilePath, FILE_READ);
   if (!configFile)
   {
-    ESP_LOGE(TAG, "Failed to open config file '%s'", configFilePath.c_str());
+    ESP_LOGE(TAG, "Failed to open config file '%s'", configFilePath);
     return false;
   }
 
@@ -284,8 +287,16 @@ bool Configuration::LoadConfig(String configFileName)
   // Clear json document and close file
   doc.clear();
   configFile.close();
+
+  // Compile theme for the next load
+  if (result &&
+    allowBlob &&
+    blobPath[0] != '\0')
+  {
+    SaveBlob(blobPath);
+  }
   
-  ESP_LOGI(TAG, "Finished load config file '%s'", configFileName.c_str());
+  ESP_LOGI(TAG, "Finished load config file '%s'", configFileName);
   return result;
 }
 
@@ -294,43 +305,43 @@ bool Configuration::LoadConfig(String configFileName)
 //===============================================================
 void Configuration::ResetConfig()
 {
-  Config.isMixer = true;
-  Config.mixerName = "CocktailCube";
-  Config.liquidName1 = "Liquid 1";
-  Config.liquidName2 = "Liquid 2";
-  Config.liquidName3 = "Liquid 3";
-  Config.liquidAngle1 = 0;
-  Config.liquidAngle2 = 120;
-  Config.liquidAngle3 = 240;
-  Config.liquidColor1 = "#FE5000";
-  Config.liquidColor2 = "#01FFFF";
-  Config.liquidColor3 = "#00E784";
-  Config.tftColorLiquid1 = 0xFC00;
-  Config.tftColorLiquid2 = 0x0F1F;
-  Config.tftColorLiquid3 = 0x0390;
-  Config.tftColorStartPage = 0xFC00;
-  Config.tftColorStartPageForeground = 0xDF9E;
-  Config.tftColorStartPageBackground = 0xA6DC;
-  Config.tftColorTextHeader = 0xFC00;
-  Config.tftColorTextBody = 0xFFFF;
-  Config.tftColorInfoBoxBorder = 0xFC00;
-  Config.tftColorInfoBoxForeground = 0xFC00;
-  Config.tftColorInfoBoxBackground = 0xFFFF;
-  Config.tftColorMenuSelector = 0xFC00;
-  Config.tftColorForeground = 0xFFFF;
-  Config.tftColorBackground = 0x0000;
-  Config.imageLogo = "";
-  Config.imageGlass = "";
-  Config.imageBottle1 = "";
-  Config.imageBottle2 = "";
-  Config.imageBottle3 = "";
-  Config.imageBottle4 = "";
-  Config.tftLogoPosX = 0;
-  Config.tftLogoPosY = 0;
-  Config.tftGlassPosX = 0;
-  Config.tftGlassPosY = 0;
-  Config.tftBottlePosX = 0;
-  Config.tftBottlePosY = 0;
+  isMixer = true;
+  strlcpy(mixerName, "CocktailCube", sizeof(mixerName));
+  strlcpy(liquidName1, "Liquid 1", sizeof(liquidName1));
+  strlcpy(liquidName2, "Liquid 2", sizeof(liquidName2));
+  strlcpy(liquidName3, "Liquid 3", sizeof(liquidName3));
+  liquidAngle1 = 0;
+  liquidAngle2 = 120;
+  liquidAngle3 = 240;
+  strlcpy(liquidColor1, "#FE5000", sizeof(liquidColor1));
+  strlcpy(liquidColor2, "#01FFFF", sizeof(liquidColor2));
+  strlcpy(liquidColor3, "#00E784", sizeof(liquidColor3));
+  tftColorLiquid1 = 0xFC00;
+  tftColorLiquid2 = 0x0F1F;
+  tftColorLiquid3 = 0x0390;
+  tftColorStartPage = 0xFC00;
+  tftColorStartPageForeground = 0xDF9E;
+  tftColorStartPageBackground = 0xA6DC;
+  tftColorTextHeader = 0xFC00;
+  tftColorTextBody = 0xFFFF;
+  tftColorInfoBoxBorder = 0xFC00;
+  tftColorInfoBoxForeground = 0xFC00;
+  tftColorInfoBoxBackground = 0xFFFF;
+  tftColorMenuSelector = 0xFC00;
+  tftColorForeground = 0xFFFF;
+  tftColorBackground = 0x0000;
+  strlcpy(imageLogo, "", sizeof(imageLogo));
+  strlcpy(imageGlass, "", sizeof(imageGlass));
+  strlcpy(imageBottle1, "", sizeof(imageBottle1));
+  strlcpy(imageBottle2, "", sizeof(imageBottle2));
+  strlcpy(imageBottle3, "", sizeof(imageBottle3));
+  strlcpy(imageBottle4, "", sizeof(imageBottle4));
+  tftLogoPosX = 0;
+  tftLogoPosY = 0;
+  tftGlassPosX = 0;
+  tftGlassPosY = 0;
+  tftBottlePosX = 0;
+  tftBottlePosY = 0;
 }
 
 //===============================================================
@@ -338,7 +349,7 @@ void Configuration::ResetConfig()
 //===============================================================
 uint32_t Configuration::GetScreenSaverTimeout_ms()
 {
-  switch (Config.screenSaverMode)
+  switch (screenSaverMode)
   {
     case e2s:
       return 2000;
@@ -365,58 +376,58 @@ bool Configuration::CheckValid(JsonDocument doc)
   bool valid = true;
   
   // Check mixer config file state
-  valid |= doc[IS_MIXER].is<bool>();
+  valid &= doc[IS_MIXER].is<bool>();
 
   // Check mixer name
-  valid |= doc[MIXER_NAME].is<String>() && doc[MIXER_NAME].as<String>().length() <= 15;
+  valid &= doc[MIXER_NAME].is<String>() && doc[MIXER_NAME].as<String>().length() <= 15;
 
   // Check liquid names
-  valid |= doc[LIQUID_NAME_1].is<String>() && doc[LIQUID_NAME_1].as<String>().length() <= 10;
-  valid |= doc[LIQUID_NAME_2].is<String>() && doc[LIQUID_NAME_2].as<String>().length() <= 10;
-  valid |= doc[LIQUID_NAME_3].is<String>() && doc[LIQUID_NAME_3].as<String>().length() <= 10;
+  valid &= doc[LIQUID_NAME_1].is<String>() && doc[LIQUID_NAME_1].as<String>().length() <= 10;
+  valid &= doc[LIQUID_NAME_2].is<String>() && doc[LIQUID_NAME_2].as<String>().length() <= 10;
+  valid &= doc[LIQUID_NAME_3].is<String>() && doc[LIQUID_NAME_3].as<String>().length() <= 10;
   
   // Check default liquid angles
-  valid |= doc[LIQUID_ANGLE_1].is<int16_t>();
-  valid |= doc[LIQUID_ANGLE_2].is<int16_t>();
-  valid |= doc[LIQUID_ANGLE_3].is<int16_t>();
+  valid &= doc[LIQUID_ANGLE_1].is<int16_t>();
+  valid &= doc[LIQUID_ANGLE_2].is<int16_t>();
+  valid &= doc[LIQUID_ANGLE_3].is<int16_t>();
 
   // Check liquid wifi colors
-  valid |= doc[LIQUID_COLOR_1].is<String>();
-  valid |= doc[LIQUID_COLOR_2].is<String>();
-  valid |= doc[LIQUID_COLOR_3].is<String>();
+  valid &= doc[LIQUID_COLOR_1].is<String>();
+  valid &= doc[LIQUID_COLOR_2].is<String>();
+  valid &= doc[LIQUID_COLOR_3].is<String>();
 
   // Check and convert TFT colors
   uint16_t dummyValue;
-  valid |= doc[TFT_COLOR_LIQUID_1].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_LIQUID_1].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_LIQUID_2].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_LIQUID_2].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_LIQUID_3].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_LIQUID_3].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_STARTPAGE].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_STARTPAGE_FOREGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE_FOREGROUND].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_STARTPAGE_BACKGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE_BACKGROUND].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_TEXT_HEADER].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_TEXT_HEADER].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_TEXT_BODY].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_TEXT_BODY].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_INFOBOX_BORDER].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_BORDER].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_INFOBOX_FOREGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_FOREGROUND].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_INFOBOX_BACKGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_BACKGROUND].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_MENU_SELECTOR].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_MENU_SELECTOR].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_FOREGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_FOREGROUND].as<String>(), &dummyValue);
-  valid |= doc[TFT_COLOR_BACKGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_BACKGROUND].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_LIQUID_1].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_LIQUID_1].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_LIQUID_2].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_LIQUID_2].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_LIQUID_3].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_LIQUID_3].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_STARTPAGE].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_STARTPAGE_FOREGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE_FOREGROUND].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_STARTPAGE_BACKGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE_BACKGROUND].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_TEXT_HEADER].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_TEXT_HEADER].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_TEXT_BODY].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_TEXT_BODY].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_INFOBOX_BORDER].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_BORDER].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_INFOBOX_FOREGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_FOREGROUND].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_INFOBOX_BACKGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_BACKGROUND].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_MENU_SELECTOR].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_MENU_SELECTOR].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_FOREGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_FOREGROUND].as<String>(), &dummyValue);
+  valid &= doc[TFT_COLOR_BACKGROUND].is<String>() && TryHexStringToUint16(doc[TFT_COLOR_BACKGROUND].as<String>(), &dummyValue);
 
   // Check image file names
-  valid |= doc[IMAGE_LOGO].is<String>();
-  valid |= doc[IMAGE_GLASS].is<String>();
-  valid |= doc[IMAGE_BOTTLE1].is<String>();
-  valid |= doc[IMAGE_BOTTLE2].is<String>();
-  valid |= doc[IMAGE_BOTTLE3].is<String>();
-  valid |= doc[IMAGE_BOTTLE4].is<String>();
+  valid &= doc[IMAGE_LOGO].is<String>();
+  valid &= doc[IMAGE_GLASS].is<String>();
+  valid &= doc[IMAGE_BOTTLE1].is<String>();
+  valid &= doc[IMAGE_BOTTLE2].is<String>();
+  valid &= doc[IMAGE_BOTTLE3].is<String>();
+  valid &= doc[IMAGE_BOTTLE4].is<String>();
 
   // Check image positions
-  valid |= doc[TFT_LOGO_POS_X].is<int16_t>();
-  valid |= doc[TFT_LOGO_POS_Y].is<int16_t>();
-  valid |= doc[TFT_GLASS_POS_X].is<int16_t>();
-  valid |= doc[TFT_GLASS_POS_Y].is<int16_t>();
-  valid |= doc[TFT_BOTTLE_POS_X].is<int16_t>();
-  valid |= doc[TFT_BOTTLE_POS_Y].is<int16_t>();
+  valid &= doc[TFT_LOGO_POS_X].is<int16_t>();
+  valid &= doc[TFT_LOGO_POS_Y].is<int16_t>();
+  valid &= doc[TFT_GLASS_POS_X].is<int16_t>();
+  valid &= doc[TFT_GLASS_POS_Y].is<int16_t>();
+  valid &= doc[TFT_BOTTLE_POS_X].is<int16_t>();
+  valid &= doc[TFT_BOTTLE_POS_Y].is<int16_t>();
   
   return valid;
 }
@@ -434,61 +445,289 @@ bool Configuration::LoadConfig(JsonDocument doc)
   }
   
   // Read mixer config file state
-  Config.isMixer = doc[IS_MIXER].as<bool>();
+  isMixer = doc[IS_MIXER].as<bool>();
   
   // Read mixer name and password
-  Config.mixerName = doc[MIXER_NAME].as<String>();
+  strlcpy(mixerName, doc[MIXER_NAME] | "", sizeof(mixerName));
 
   // Read liquid names
-  Config.liquidName1 = doc[LIQUID_NAME_1].as<String>();
-  Config.liquidName2 = doc[LIQUID_NAME_2].as<String>();
-  Config.liquidName3 = doc[LIQUID_NAME_3].as<String>();
+  strlcpy(liquidName1, doc[LIQUID_NAME_1] | "", sizeof(liquidName1));
+  strlcpy(liquidName2, doc[LIQUID_NAME_2] | "", sizeof(liquidName2));
+  strlcpy(liquidName3, doc[LIQUID_NAME_3] | "", sizeof(liquidName3));
 
   // Read default liquid angles
-  Config.liquidAngle1 = doc[LIQUID_ANGLE_1].as<int16_t>();
-  Config.liquidAngle2 = doc[LIQUID_ANGLE_2].as<int16_t>();
-  Config.liquidAngle3 = doc[LIQUID_ANGLE_3].as<int16_t>();
+  liquidAngle1 = doc[LIQUID_ANGLE_1].as<int16_t>();
+  liquidAngle2 = doc[LIQUID_ANGLE_2].as<int16_t>();
+  liquidAngle3 = doc[LIQUID_ANGLE_3].as<int16_t>();
 
   // Read wifi colors
-  Config.liquidColor1 = doc[LIQUID_COLOR_1].as<String>();
-  Config.liquidColor2 = doc[LIQUID_COLOR_2].as<String>();
-  Config.liquidColor3 = doc[LIQUID_COLOR_3].as<String>();
+  strlcpy(liquidColor1, doc[LIQUID_COLOR_1] | "", sizeof(liquidColor1));
+  strlcpy(liquidColor2, doc[LIQUID_COLOR_2] | "", sizeof(liquidColor2));
+  strlcpy(liquidColor3, doc[LIQUID_COLOR_3] | "", sizeof(liquidColor3));
 
   // Read and convert TFT colors
-  TryHexStringToUint16(doc[TFT_COLOR_LIQUID_1].as<String>(), &Config.tftColorLiquid1);
-  TryHexStringToUint16(doc[TFT_COLOR_LIQUID_2].as<String>(), &Config.tftColorLiquid2);
-  TryHexStringToUint16(doc[TFT_COLOR_LIQUID_3].as<String>(), &Config.tftColorLiquid3);
-  TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE].as<String>(), &Config.tftColorStartPage);
-  TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE_FOREGROUND].as<String>(), &Config.tftColorStartPageForeground);
-  TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE_BACKGROUND].as<String>(), &Config.tftColorStartPageBackground);
-  TryHexStringToUint16(doc[TFT_COLOR_TEXT_HEADER].as<String>(), &Config.tftColorTextHeader);
-  TryHexStringToUint16(doc[TFT_COLOR_TEXT_BODY].as<String>(), &Config.tftColorTextBody);
-  TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_BORDER].as<String>(), &Config.tftColorInfoBoxBorder);
-  TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_FOREGROUND].as<String>(), &Config.tftColorInfoBoxForeground);
-  TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_BACKGROUND].as<String>(), &Config.tftColorInfoBoxBackground);
-  TryHexStringToUint16(doc[TFT_COLOR_MENU_SELECTOR].as<String>(), &Config.tftColorMenuSelector);
-  TryHexStringToUint16(doc[TFT_COLOR_FOREGROUND].as<String>(), &Config.tftColorForeground);
-  TryHexStringToUint16(doc[TFT_COLOR_BACKGROUND].as<String>(), &Config.tftColorBackground);
+  TryHexStringToUint16(doc[TFT_COLOR_LIQUID_1].as<String>(), &tftColorLiquid1);
+  TryHexStringToUint16(doc[TFT_COLOR_LIQUID_2].as<String>(), &tftColorLiquid2);
+  TryHexStringToUint16(doc[TFT_COLOR_LIQUID_3].as<String>(), &tftColorLiquid3);
+  TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE].as<String>(), &tftColorStartPage);
+  TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE_FOREGROUND].as<String>(), &tftColorStartPageForeground);
+  TryHexStringToUint16(doc[TFT_COLOR_STARTPAGE_BACKGROUND].as<String>(), &tftColorStartPageBackground);
+  TryHexStringToUint16(doc[TFT_COLOR_TEXT_HEADER].as<String>(), &tftColorTextHeader);
+  TryHexStringToUint16(doc[TFT_COLOR_TEXT_BODY].as<String>(), &tftColorTextBody);
+  TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_BORDER].as<String>(), &tftColorInfoBoxBorder);
+  TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_FOREGROUND].as<String>(), &tftColorInfoBoxForeground);
+  TryHexStringToUint16(doc[TFT_COLOR_INFOBOX_BACKGROUND].as<String>(), &tftColorInfoBoxBackground);
+  TryHexStringToUint16(doc[TFT_COLOR_MENU_SELECTOR].as<String>(), &tftColorMenuSelector);
+  TryHexStringToUint16(doc[TFT_COLOR_FOREGROUND].as<String>(), &tftColorForeground);
+  TryHexStringToUint16(doc[TFT_COLOR_BACKGROUND].as<String>(), &tftColorBackground);
 
   // Read image file names
-  Config.imageLogo = doc[IMAGE_LOGO].as<String>();
-  Config.imageGlass = doc[IMAGE_GLASS].as<String>();
-  Config.imageBottle1 = doc[IMAGE_BOTTLE1].as<String>();
-  Config.imageBottle2 = Config.isMixer ? "" : doc[IMAGE_BOTTLE2].as<String>();
-  Config.imageBottle3 = Config.isMixer ? "" :  doc[IMAGE_BOTTLE3].as<String>();
-  Config.imageBottle4 = Config.isMixer ? "" :  doc[IMAGE_BOTTLE4].as<String>();
+  strlcpy(imageLogo, doc[IMAGE_LOGO] | "", sizeof(imageLogo));
+  strlcpy(imageGlass, doc[IMAGE_GLASS] | "", sizeof(imageGlass));
+  strlcpy(imageBottle1, doc[IMAGE_BOTTLE1] | "", sizeof(imageBottle1));
+  strlcpy(imageBottle2, isMixer ? "" : doc[IMAGE_BOTTLE2] | "", sizeof(imageBottle2));
+  strlcpy(imageBottle3, isMixer ? "" : doc[IMAGE_BOTTLE3] | "", sizeof(imageBottle3));
+  strlcpy(imageBottle4, isMixer ? "" : doc[IMAGE_BOTTLE4] | "", sizeof(imageBottle4));
   
   // Read image positions
-  Config.tftLogoPosX = doc[TFT_LOGO_POS_X].as<int16_t>();
-  Config.tftLogoPosY = doc[TFT_LOGO_POS_Y].as<int16_t>();
-  Config.tftGlassPosX = doc[TFT_GLASS_POS_X].as<int16_t>();
-  Config.tftGlassPosY = doc[TFT_GLASS_POS_Y].as<int16_t>();
-  Config.tftBottlePosX = doc[TFT_BOTTLE_POS_X].as<int16_t>();
-  Config.tftBottlePosY = doc[TFT_BOTTLE_POS_Y].as<int16_t>();
+  tftLogoPosX = doc[TFT_LOGO_POS_X].as<int16_t>();
+  tftLogoPosY = doc[TFT_LOGO_POS_Y].as<int16_t>();
+  tftGlassPosX = doc[TFT_GLASS_POS_X].as<int16_t>();
+  tftGlassPosY = doc[TFT_GLASS_POS_Y].as<int16_t>();
+  tftBottlePosX = doc[TFT_BOTTLE_POS_X].as<int16_t>();
+  tftBottlePosY = doc[TFT_BOTTLE_POS_Y].as<int16_t>();
   
   return true;
 }
 
+//===============================================================
+// Loads the configuration from a compiled theme with a single
+// read. Colors are already converted, so no parsing is needed
+//===============================================================
+bool Configuration::LoadBlob(const char* blobPath)
+{
+  File blobFile = FileSystem.open(blobPath, FILE_READ);
+  if (!blobFile)
+  {
+    return false;
+  }
+
+  ThemeBlob blob;
+  bool result = blobFile.size() == sizeof(ThemeBlob) &&
+    blobFile.read((uint8_t*)&blob, sizeof(ThemeBlob)) == sizeof(ThemeBlob) &&
+    blob.IsValid();
+  blobFile.close();
+
+  if (!result)
+  {
+    ESP_LOGE(TAG, "Compiled config file '%s' not valid", blobPath);
+    return false;
+  }
+
+  ApplyBlob(&blob);
+  return true;
+}
+
+//===============================================================
+// Saves the current configuration as compiled theme
+//===============================================================
+bool Configuration::SaveBlob(const char* blobPath)
+{
+  ThemeBlob blob;
+  ToBlob(&blob);
+
+  File blobFile = FileSystem.open(blobPath, FILE_WRITE);
+  if (!blobFile)
+  {
+    ESP_LOGE(TAG, "Failed to open '%s' for writing", blobPath);
+    return false;
+  }
+
+  bool result = blobFile.write((const uint8_t*)&blob, sizeof(ThemeBlob)) == sizeof(ThemeBlob);
+  blobFile.close();
+
+  if (!result)
+  {
+    ESP_LOGE(TAG, "Failed to write '%s'", blobPath);
+    FileSystem.remove(blobPath);
+    return false;
+  }
+
+  ESP_LOGI(TAG, "Compiled config file '%s'", blobPath);
+  return true;
+}
+
+//===============================================================
+// Loads the configuration from a theme bundle. The bundle stays
+// open, so the images are read afterwards through the same
+// handle (See DisplayDriver::LoadImages())
+//===============================================================
+bool Configuration::LoadBundle(const char* bundlePath)
+{
+  ThemeBlob blob;
+  if (!_bundle.Open(bundlePath) ||
+    !_bundle.ReadConfig(&blob))
+  {
+    ESP_LOGE(TAG, "Failed to load bundle '%s'", bundlePath);
+    CloseBundle();
+    return false;
+  }
+
+  ApplyBlob(&blob);
+  strlcpy(_bundlePath, bundlePath, sizeof(_bundlePath));
+
+  ESP_LOGI(TAG, "Finished load bundle '%s'", bundlePath);
+  return true;
+}
+
+//===============================================================
+// Copies the values of a compiled theme
+//===============================================================
+void Configuration::ApplyBlob(ThemeBlob* blob)
+{
+  // Terminate all strings
+  blob->mixerName[THEMEBLOB_MAXMIXERNAME - 1] = '\0';
+  for (uint8_t index = 0; index < THEMEBLOB_LIQUIDS; index++)
+  {
+    blob->liquidNames[index][THEMEBLOB_MAXLIQUIDNAME - 1] = '\0';
+    blob->liquidColors[index][THEMEBLOB_MAXCOLOR - 1] = '\0';
+  }
+  for (uint8_t index = 0; index < THEMEBLOB_IMAGES; index++)
+  {
+    blob->images[index][THEMEBLOB_MAXIMAGENAME - 1] = '\0';
+  }
+
+  isMixer = blob->isMixer != 0;
+  strlcpy(mixerName, blob->mixerName, sizeof(mixerName));
+  strlcpy(liquidName1, blob->liquidNames[0], sizeof(liquidName1));
+  strlcpy(liquidName2, blob->liquidNames[1], sizeof(liquidName2));
+  strlcpy(liquidName3, blob->liquidNames[2], sizeof(liquidName3));
+  liquidAngle1 = blob->liquidAngles[0];
+  liquidAngle2 = blob->liquidAngles[1];
+  liquidAngle3 = blob->liquidAngles[2];
+  strlcpy(liquidColor1, blob->liquidColors[0], sizeof(liquidColor1));
+  strlcpy(liquidColor2, blob->liquidColors[1], sizeof(liquidColor2));
+  strlcpy(liquidColor3, blob->liquidColors[2], sizeof(liquidColor3));
+  tftColorLiquid1 = blob->tftColors[0];
+  tftColorLiquid2 = blob->tftColors[1];
+  tftColorLiquid3 = blob->tftColors[2];
+  tftColorStartPage = blob->tftColors[3];
+  tftColorStartPageForeground = blob->tftColors[4];
+  tftColorStartPageBackground = blob->tftColors[5];
+  tftColorTextHeader = blob->tftColors[6];
+  tftColorTextBody = blob->tftColors[7];
+  tftColorInfoBoxBorder = blob->tftColors[8];
+  tftColorInfoBoxForeground = blob->tftColors[9];
+  tftColorInfoBoxBackground = blob->tftColors[10];
+  tftColorMenuSelector = blob->tftColors[11];
+  tftColorForeground = blob->tftColors[12];
+  tftColorBackground = blob->tftColors[13];
+  strlcpy(imageLogo, blob->images[0], sizeof(imageLogo));
+  strlcpy(imageGlass, blob->images[1], sizeof(imageGlass));
+  strlcpy(imageBottle1, blob->images[2], sizeof(imageBottle1));
+  strlcpy(imageBottle2, isMixer ? "" : blob->images[3], sizeof(imageBottle2));
+  strlcpy(imageBottle3, isMixer ? "" : blob->images[4], sizeof(imageBottle3));
+  strlcpy(imageBottle4, isMixer ? "" : blob->images[5], sizeof(imageBottle4));
+  tftLogoPosX = blob->positions[0];
+  tftLogoPosY = blob->positions[1];
+  tftGlassPosX = blob->positions[2];
+  tftGlassPosY = blob->positions[3];
+  tftBottlePosX = blob->positions[4];
+  tftBottlePosY = blob->positions[5];
+}
+
+//===============================================================
+// Writes the current configuration to a compiled theme
+//===============================================================
+void Configuration::ToBlob(ThemeBlob* blob)
+{
+  memset(blob, 0, sizeof(ThemeBlob));
+  blob->magic = THEMEBLOB_MAGIC;
+  blob->version = THEMEBLOB_VERSION;
+  blob->size = sizeof(ThemeBlob);
+  blob->isMixer = isMixer ? 1 : 0;
+  strlcpy(blob->mixerName, mixerName, THEMEBLOB_MAXMIXERNAME);
+  strlcpy(blob->liquidNames[0], liquidName1, THEMEBLOB_MAXLIQUIDNAME);
+  strlcpy(blob->liquidNames[1], liquidName2, THEMEBLOB_MAXLIQUIDNAME);
+  strlcpy(blob->liquidNames[2], liquidName3, THEMEBLOB_MAXLIQUIDNAME);
+  blob->liquidAngles[0] = liquidAngle1;
+  blob->liquidAngles[1] = liquidAngle2;
+  blob->liquidAngles[2] = liquidAngle3;
+  strlcpy(blob->liquidColors[0], liquidColor1, THEMEBLOB_MAXCOLOR);
+  strlcpy(blob->liquidColors[1], liquidColor2, THEMEBLOB_MAXCOLOR);
+  strlcpy(blob->liquidColors[2], liquidColor3, THEMEBLOB_MAXCOLOR);
+  blob->tftColors[0] = tftColorLiquid1;
+  blob->tftColors[1] = tftColorLiquid2;
+  blob->tftColors[2] = tftColorLiquid3;
+  blob->tftColors[3] = tftColorStartPage;
+  blob->tftColors[4] = tftColorStartPageForeground;
+  blob->tftColors[5] = tftColorStartPageBackground;
+  blob->tftColors[6] = tftColorTextHeader;
+  blob->tftColors[7] = tftColorTextBody;
+  blob->tftColors[8] = tftColorInfoBoxBorder;
+  blob->tftColors[9] = tftColorInfoBoxForeground;
+  blob->tftColors[10] = tftColorInfoBoxBackground;
+  blob->tftColors[11] = tftColorMenuSelector;
+  blob->tftColors[12] = tftColorForeground;
+  blob->tftColors[13] = tftColorBackground;
+  strlcpy(blob->images[0], imageLogo, THEMEBLOB_MAXIMAGENAME);
+  strlcpy(blob->images[1], imageGlass, THEMEBLOB_MAXIMAGENAME);
+  strlcpy(blob->images[2], imageBottle1, THEMEBLOB_MAXIMAGENAME);
+  strlcpy(blob->images[3], imageBottle2, THEMEBLOB_MAXIMAGENAME);
+  strlcpy(blob->images[4], imageBottle3, THEMEBLOB_MAXIMAGENAME);
+  strlcpy(blob->images[5], imageBottle4, THEMEBLOB_MAXIMAGENAME);
+  blob->positions[0] = tftLogoPosX;
+  blob->positions[1] = tftLogoPosY;
+  blob->positions[2] = tftGlassPosX;
+  blob->positions[3] = tftGlassPosY;
+  blob->positions[4] = tftBottlePosX;
+  blob->positions[5] = tftBottlePosY;
+  blob->checksum = blob->CalculateChecksum();
+}
+
+//===============================================================
+// Copies the theme values of another configuration
+// LED, encoder and screen saver settings are kept
+//===============================================================
+void Configuration::CopyTheme(Configuration* source)
+{
+  ThemeBlob blob;
+  source->ToBlob(&blob);
+  ApplyBlob(&blob);
+
+  // Bundle is reopened from the path if images are reloaded
+  CloseBundle();
+  strlcpy(_bundlePath, source->_bundlePath, sizeof(_bundlePath));
+}
+
+//===============================================================
+// Returns the opened bundle of the current configuration
+// The handle is reopened if it was closed after loading images
+//===============================================================
+ThemeBundle* Configuration::GetBundle()
+{
+  if (_bundlePath[0] == '\0')
+  {
+    return NULL;
+  }
+
+  if (!_bundle.IsOpen() &&
+    !_bundle.Open(_bundlePath))
+  {
+    return NULL;
+  }
+
+  return &_bundle;
+}
+
+//===============================================================
+// Closes the bundle handle after all images are loaded
+//===============================================================
+void Configuration::CloseBundle()
+{
+  _bundle.Close();
+}
+
 //===============================================================
 // Converts an hex string to an uint16_t value
 //===============================================================
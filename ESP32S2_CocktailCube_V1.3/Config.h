@@ -14,10 +14,13 @@
 //===============================================================
 #include <Arduino.h>
 #include <FS.h>
-#include <SPIFFS.h>
 #include <Preferences.h>
 #include <ArduinoJson.h>
 #include <Adafruit_ST77xx.h>
+#include "FileSystem.h"
+#include "ThemeCatalogue.h"
+#include "ThemeBlob.h"
+#include "ThemeBundle.h"
 
 //===============================================================
 // Defines
@@ -28,8 +31,8 @@
 #define WIFI_SSID                         "CockailCube" // Should not exceed 15 characters and be a single word -> will be the dns name in lower case and without white spaces for example "http://cocktailcube.local/"
 #define WIFI_PASSWORD                     "mixer1234"   // Should not exceed 15 characters
 
-// Max config count to load (Increasing this will cost memory!)
-#define MAXCONFIGS                        15
+// Runs the on-device benchmarks once at startup (Results are printed to serial and added to '/systeminfo')
+#define BENCHMARK_ON_BOOT                 false
 
 // Defines for preferences handling
 #define READONLY_MODE                     true
@@ -168,21 +171,22 @@ const int8_t ScreensaverModeMax = 6;
 class Configuration
 {
   public:
+    // Theme values (Fixed capacities of the compiled theme, no heap allocations)
     bool isMixer = true;
     
-    String mixerName = "CocktailCube";
+    char mixerName[THEMEBLOB_MAXMIXERNAME] = "CocktailCube";
 
-    String liquidName1 = "Liquid 1";
-    String liquidName2 = "Liquid 2";
-    String liquidName3 = "Liquid 3";
+    char liquidName1[THEMEBLOB_MAXLIQUIDNAME] = "Liquid 1";
+    char liquidName2[THEMEBLOB_MAXLIQUIDNAME] = "Liquid 2";
+    char liquidName3[THEMEBLOB_MAXLIQUIDNAME] = "Liquid 3";
 
     int16_t liquidAngle1 = 0;
     int16_t liquidAngle2 = 120;
     int16_t liquidAngle3 = 240;
 
-    String liquidColor1 = "#FE5000";
-    String liquidColor2 = "#01FFFF";
-    String liquidColor3 = "#00E784";
+    char liquidColor1[THEMEBLOB_MAXCOLOR] = "#FE5000";
+    char liquidColor2[THEMEBLOB_MAXCOLOR] = "#01FFFF";
+    char liquidColor3[THEMEBLOB_MAXCOLOR] = "#00E784";
     
     uint16_t tftColorLiquid1 = 0xFC00;
     uint16_t tftColorLiquid2 = 0x0F1F;
@@ -199,12 +203,12 @@ class Configuration
     uint16_t tftColorForeground = 0xFFFF;
     uint16_t tftColorBackground = 0x0000;
 
-    String imageLogo = "";
-    String imageGlass = "";
-    String imageBottle1 = "";
-    String imageBottle2 = "";
-    String imageBottle3 = "";
-    String imageBottle4 = "";
+    char imageLogo[THEMEBLOB_MAXIMAGENAME] = "";
+    char imageGlass[THEMEBLOB_MAXIMAGENAME] = "";
+    char imageBottle1[THEMEBLOB_MAXIMAGENAME] = "";
+    char imageBottle2[THEMEBLOB_MAXIMAGENAME] = "";
+    char imageBottle3[THEMEBLOB_MAXIMAGENAME] = "";
+    char imageBottle4[THEMEBLOB_MAXIMAGENAME] = "";
 
     int16_t tftLogoPosX = 0;
     int16_t tftLogoPosY = 0;
@@ -235,8 +239,14 @@ class Configuration
     // Save values to flash
     void Save();
 
-    // Returns currently loaded configuration
-    String GetCurrent();
+    // Copies the name of the currently loaded configuration into a buffer
+    void GetCurrent(char* name, size_t length);
+
+    // Returns the catalogue position of the current configuration (Starting with 0, -1 if none)
+    int16_t GetCurrentIndex();
+
+    // Returns the count of valid configurations
+    uint16_t GetCount();
 
     // Increments config
     bool Increment();
@@ -247,8 +257,8 @@ class Configuration
     // Enumerates all valid json config files
     void EnumerateConfigs();
 
-    // Loads the configuration
-    bool LoadConfig(String configFileName);
+    // Loads the configuration (From the compiled theme if available and allowed)
+    bool LoadConfig(const char* configFileName, bool allowBlob = true);
     
     // Resets the configuration to defaults
     void ResetConfig();
@@ -256,26 +266,53 @@ class Configuration
     // Returns the screen saver timeout in ms
     uint32_t GetScreenSaverTimeout_ms();
 
+    // Checks, if a file is an valid config file
+    bool CheckValid(JsonDocument doc);
+
+    // Writes the current configuration to a compiled theme
+    void ToBlob(ThemeBlob* blob);
+
+    // Copies the theme values of another configuration (Settings are kept)
+    void CopyTheme(Configuration* source);
+
+    // Returns the opened bundle of the current configuration (NULL if not a bundle)
+    ThemeBundle* GetBundle();
+
+    // Closes the bundle handle after all images are loaded
+    void CloseBundle();
+
   private:
     // Preferences variable
     Preferences _preferences;
     
-    // List of all config files
-    String _files[MAXCONFIGS];
-    uint8_t _fileCount = 0;
+    // Sorted list of all valid config files (Only a window is kept in RAM)
+    ThemeCatalogue _catalogue;
     
     // Current config index
     int16_t _currentConfigindex = -1;
 
+    // Bundle of the current configuration (Kept open for loading the images)
+    ThemeBundle _bundle;
+    char _bundlePath[FILESYSTEM_MAXPATH] = "";
+
     // Initializes the preferences in case of first startup ever
     void InitPreferences();
 
-    // Checks, if a file is an valid config file
-    bool CheckValid(JsonDocument doc);
-    
     // Loads the configuration from a JSON file
     bool LoadConfig(JsonDocument doc);
 
+    // Loads the configuration from a compiled theme with a single read
+    bool LoadBlob(const char* blobPath);
+
+    // Saves the current configuration as compiled theme
+    bool SaveBlob(const char* blobPath);
+
+    // Loads the configuration from a theme bundle
+    bool LoadBundle(const char* bundlePath);
+
+    // Copies the values of a compiled theme
+    void ApplyBlob(ThemeBlob* blob);
+
     // Converts an hex string to an uint16_t value
     bool TryHexStringToUint16(const String& hexString, uint16_t* value);
 };
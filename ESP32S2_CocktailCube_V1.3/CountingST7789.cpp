@@ -0,0 +1,29 @@
+/*
+ * Includes a counting display panel for render benchmarks
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "CountingST7789.h"
+
+//===============================================================
+// Constructor
+//===============================================================
+CountingST7789::CountingST7789(SPIClass* spi, int8_t cs, int8_t dc, int8_t rst) :
+  Adafruit_ST7789(spi, cs, dc, rst)
+{
+}
+
+//===============================================================
+// Counts the address window and forwards it to the panel
+//===============================================================
+void CountingST7789::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+  _counter.CountWindow(x, y, w, h);
+  Adafruit_ST7789::setAddrWindow(x, y, w, h);
+}
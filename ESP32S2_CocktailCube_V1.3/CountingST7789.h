@@ -0,0 +1,46 @@
+/*
+ * Includes a counting display panel for render benchmarks
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef COUNTINGST7789_H
+#define COUNTINGST7789_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_ST7789.h>
+#include "RenderCounter.h"
+
+//===============================================================
+// ST7789 panel which counts all address windows and pixels
+// All drawing functions of Adafruit_SPITFT end in setAddrWindow()
+// followed by exactly w*h pixels, so overriding this single
+// function is enough to count every transfer (See 'RenderCounter')
+//===============================================================
+class CountingST7789 : public Adafruit_ST7789
+{
+  public:
+    // Constructor
+    CountingST7789(SPIClass* spi, int8_t cs, int8_t dc, int8_t rst);
+
+    // Starts counting a new frame
+    void BeginFrame() { _counter.BeginFrame(); }
+
+    // Stops counting and returns the statistics of the frame
+    RenderFrameStats EndFrame() { return _counter.EndFrame(); }
+
+    // Counts the address window and forwards it to the panel
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override;
+
+  private:
+    // Counts the windows of the current frame
+    RenderCounter _counter;
+};
+
+#endif
@@ -50,6 +50,12 @@ void DisplayDriver::Begin(Adafruit_ST7789* tft)
   _tft->setFont(&FreeSans9pt7b);
   _tft->fillScreen(ST77XX_BLACK);
 
+  // Initialize glyph cache with the same font
+  _glyphCache.Begin(&FreeSans9pt7b);
+
+  // Initialize retained widgets
+  BeginWidgets();
+
   int16_t x = TFT_WIDTH / 2;
   int16_t y = TFT_HEIGHT / 2;
 
@@ -69,34 +75,144 @@ void DisplayDriver::LoadImages()
   // Log info
   ESP_LOGI(TAG, "Begin loading images");
 
+  // Theme colors may have changed, drop pre-rendered glyphs
+  _glyphCache.Clear();
+
+  // Bundled themes are read through one handle in section order
+  ThemeBundle* bundle = Config.GetBundle();
+
   // Load mandatory images
-  LoadImage(&_imageLogo, Config.imageLogo);
-  LoadImage(&_imageGlass, Config.imageGlass);
-  LoadImage(&_imageBottle1, Config.imageBottle1);
+  LoadImage(&_imageLogo, Config.imageLogo, bundle, eSectionLogo);
+  LoadImage(&_imageGlass, Config.imageGlass, bundle, eSectionGlass);
+  LoadImage(&_imageBottle1, Config.imageBottle1, bundle, eSectionBottle1);
 
   // Load non-mixer images
   if (!Config.isMixer)
   {
-    LoadImage(&_imageBottle2, Config.imageBottle2);
-    LoadImage(&_imageBottle3, Config.imageBottle3);
-    LoadImage(&_imageBottle4, Config.imageBottle4);
+    LoadImage(&_imageBottle2, Config.imageBottle2, bundle, eSectionBottle2);
+    LoadImage(&_imageBottle3, Config.imageBottle3, bundle, eSectionBottle3);
+    LoadImage(&_imageBottle4, Config.imageBottle4, bundle, eSectionBottle4);
   }
 
+  // Release bundle handle
+  Config.CloseBundle();
+
   // Log info
   ESP_LOGI(TAG, "Finished loading images");
 }
 
+//===============================================================
+// Swaps in prefetched images (Order: Logo, glass, bottle 1 to 4)
+// The previous images are left in the array for deallocation
+//===============================================================
+void DisplayDriver::SwapImages(SPIFFSBMPImage* images)
+{
+  // Theme colors have changed, drop pre-rendered glyphs
+  _glyphCache.Clear();
+
+  _imageLogo.Swap(&images[0]);
+  _imageGlass.Swap(&images[1]);
+  _imageBottle1.Swap(&images[2]);
+  _imageBottle2.Swap(&images[3]);
+  _imageBottle3.Swap(&images[4]);
+  _imageBottle4.Swap(&images[5]);
+}
+
 //===============================================================
 // Loads an image and checks for deallocation before loading
+// Images of a bundle are read from their section, built-in
+// images are mapped from the asset partition
 //===============================================================
-void DisplayDriver::LoadImage(SPIFFSBMPImage* _image, String fileName)
+void DisplayDriver::LoadImage(SPIFFSBMPImage* _image, const char* fileName, ThemeBundle* bundle, ThemeBundleSection section)
 {
   // Always delete before loading
   _image->Deallocate();
   
   // Load image to RAM
-  ImageReturnCode returnCode = _image->Allocate(fileName);
-  ESP_LOGI(TAG, "Load image '%s': %s (Heap: %d / %d Bytes)", fileName.c_str(), _image->PrintStatus(returnCode).c_str(), ESP.getFreeHeap(), ESP.getHeapSize());
+  ImageReturnCode returnCode = IMAGE_ERR_FILE_NOT_FOUND;
+  if (bundle)
+  {
+    uint32_t length = 0;
+    File* file = bundle->SeekSection(section, &length);
+    if (file)
+    {
+      returnCode = _image->Allocate(file, file->position(), fileName);
+    }
+  }
+  else
+  {
+    // Built-in images are used from the asset partition without copy,
+    // unless a file with the same name was uploaded to SPIFFS (Or transcoded)
+    uint32_t length = 0;
+    const uint8_t* data = fileName[0] == '\0' ? NULL : Assets.Find(fileName, &length);
+    if (data &&
+      !SPIFFSBMPImage::Exists(fileName))
+    {
+      returnCode = _image->Allocate(data, length, fileName);
+    }
+    else
+    {
+      returnCode = _image->Allocate(fileName);
+    }
+  }
+  ESP_LOGI(TAG, "Load image '%s': %s (Heap: %d / %d Bytes)", fileName, SPIFFSBMPImage::PrintStatus(returnCode), ESP.getFreeHeap(), ESP.getHeapSize());
+}
+
+//===============================================================
+// Initializes the layout of all retained widgets
+// Widgets are rendered in the order they are added to a tree
+//===============================================================
+void DisplayDriver::BeginWidgets()
+{
+  int16_t x0 = TFT_WIDTH / 2; // Mid screen
+  int16_t y = HEADEROFFSET_Y + 10;
+
+  // Bar: Bottles, sparkling water gauges, names and selection text
+  for (uint8_t index = 0; index < BAR_BOTTLECOUNT; index++)
+  {
+    int16_t x = x0 + (index - 1) * BAR_SPACING;
+    int16_t xGauge = x - 37;
+    int16_t yGauge = y + BAR_NAMESOFFSET_Y - 120;
+
+    _barBottles[index].Begin(x, y);
+    _barGauges[index].Begin(xGauge, yGauge, 3, 100);
+    _barPercentages[index].Begin(&_glyphCache, xGauge + 3, yGauge - 5, eAlignCenter, 27, 4, true);
+    _barNames[index].Begin(&_glyphCache, x - BAR_NAMESOFFSET_X, y + BAR_NAMESOFFSET_Y, eAlignCenter, 54, 4, true);
+    _barTree.Add(&_barBottles[index]);
+  }
+  for (uint8_t index = 0; index < BAR_BOTTLECOUNT; index++)
+  {
+    _barTree.Add(&_barGauges[index]);
+    _barTree.Add(&_barPercentages[index]);
+    _barTree.Add(&_barNames[index]);
+  }
+  _barBanner.Begin(&_glyphCache, x0, y + 25, eAlignCenter, 0, 4, true);
+  _barTree.Add(&_barBanner);
+
+  // Check boxes with liquid names below
+  for (uint8_t index = 0; index < BAR_BOTTLECOUNT; index++)
+  {
+    int16_t x = x0 + (index - 1) * BAR_SPACING;
+    _checkBoxes[index].Begin(x - CHECKBOX_SIZE / 2, HEADEROFFSET_Y + 80, CHECKBOX_SIZE);
+    _checkBoxNames[index].Begin(&_glyphCache, x, HEADEROFFSET_Y + 140, eAlignCenter, 0, 4, true);
+    _checkBoxTree.Add(&_checkBoxes[index]);
+    _checkBoxTree.Add(&_checkBoxNames[index]);
+  }
+
+  // Settings: Previous, current and next setting (Value follows the name)
+  for (uint8_t index = 0; index < 3; index++)
+  {
+    int16_t x = 15;
+    int16_t yRow = HEADEROFFSET_Y + 25 + LONGLINEOFFSET - 2 + index * SHORTLINEOFFSET;
+    _settingNames[index].Begin(&_glyphCache, x, yRow, eAlignLeft, 0, 5);
+    _settingValues[index].Begin(&_glyphCache, x, yRow, eAlignLeft);
+    _settingsTree.Add(&_settingNames[index]);
+    _settingsTree.Add(&_settingValues[index]);
+  }
+
+  // Dashboard doughnut chart and wifi icon
+  _doughnut.Begin(X0_DOUGHNUTCHART, Y0_DOUGHNUTCHART, R_INNER_DOUGHNUTCHART, R_OUTER_DOUGHNUTCHART, SPACERANGLE_DEGREES);
+  _wifiIcon.Begin(TFT_WIDTH - 24 - 5, 2, 24, 24);
 }
 
 //===============================================================
@@ -276,7 +392,7 @@ void DisplayDriver::ShowCleaningPage()
   MixtureLiquid cleaningLiquid = Statemachine.GetCleaningLiquid();
 
   // Draw checkboxes
-  DrawCheckBoxes(cleaningLiquid);
+  DrawCheckBoxes(cleaningLiquid, true);
 }
 
 //===============================================================
@@ -382,6 +498,7 @@ void DisplayDriver::ShowScreenSaverPage()
   _tft->fillScreen(Config.tftColorBackground);
 
   // Draw inital screen saver
+  _screenSaver.Begin(&_imageLogo, Config.tftColorForeground, Config.tftColorBackground);
   DrawScreenSaver();
 }
 
@@ -390,13 +507,15 @@ void DisplayDriver::ShowScreenSaverPage()
 //===============================================================
 void DisplayDriver::DrawHeader()
 {
-  DrawHeader(String("-- ") + Config.mixerName + " --");
+  char text[THEMEBLOB_MAXMIXERNAME + 6];
+  snprintf(text, sizeof(text), "-- %s --", Config.mixerName);
+  DrawHeader(text);
 }
 
 //===============================================================
 // Draws header Text
 //===============================================================
-void DisplayDriver::DrawHeader(const String &text, bool withIcons)
+void DisplayDriver::DrawHeader(const char* text, bool withIcons)
 {
   int16_t x = TFT_WIDTH / 2;
   int16_t y = HEADEROFFSET_Y / 2;
@@ -426,14 +545,23 @@ void DisplayDriver::DrawHeader(const String &text, bool withIcons)
 //===============================================================
 void DisplayDriver::DrawWifiIcons(bool isfullUpdate)
 {
-  int16_t x = TFT_WIDTH - 24 - 5;
-  int16_t y = 2;
+  int16_t x = 5;
+  int16_t y = 4;
   int16_t width = 24;
   int16_t height = 24;
 
   wifi_mode_t wifiMode = Wifihandler.GetWifiMode();
   uint16_t connectedClients = Wifihandler.GetConnectedClients();
 
+  // Draw wifi icon (Opaque icon, only drawn if changed)
+  if (isfullUpdate)
+  {
+    _wifiIcon.Invalidate();
+  }
+  _wifiIcon.SetIcon(wifiMode == WIFI_MODE_AP ? icon_wifi : icon_noWifi);
+  _wifiIcon.SetColors(Config.tftColorForeground, Config.tftColorBackground);
+  _wifiIcon.Render(_tft);
+
    // Check connected clients for changed value
   if (_lastDraw_ConnectedClients == connectedClients && !isfullUpdate)
   {
@@ -441,16 +569,6 @@ void DisplayDriver::DrawWifiIcons(bool isfullUpdate)
   }
   _lastDraw_ConnectedClients = connectedClients;
 
-  // Clear wifi icon
-  _tft->drawXBitmap(x, y, icon_wifi, width, height, Config.tftColorBackground);
-  _tft->drawXBitmap(x, y, icon_noWifi, width, height, Config.tftColorBackground);
-
-  // Draw new wifi icon
-  _tft->drawXBitmap(x, y, wifiMode == WIFI_MODE_AP ? icon_wifi : icon_noWifi, width, height, Config.tftColorForeground);
-
-  x = 5;
-  y += 2;
-
   // Clear connected clients
   _tft->fillRect(x, y, width, height, Config.tftColorBackground);
 
@@ -467,7 +585,7 @@ void DisplayDriver::DrawWifiIcons(bool isfullUpdate)
 //===============================================================
 // Draws the info box
 //===============================================================
-void DisplayDriver::DrawInfoBox(const String &line1, const String &line2)
+void DisplayDriver::DrawInfoBox(const char* line1, const char* line2)
 {
   int16_t x = INFOBOX_MARGIN_HORI;
   int16_t y = HEADEROFFSET_Y + INFOBOX_MARGIN_VERT;
@@ -580,89 +698,96 @@ void DisplayDriver::DrawMenu(bool isfullUpdate)
 //===============================================================
 void DisplayDriver::DrawBar(bool isDashboard, bool isfullUpdate)
 {
-  int16_t spacing = 78;
-  int16_t x0 = TFT_WIDTH / 2; // Mid screen
-  int16_t y = HEADEROFFSET_Y + 10;
-
   MixtureLiquid dashboardLiquid = Statemachine.GetDashboardLiquid();
-  BarBottle barBottle1 = Statemachine.GetBarBottle(0);
-  BarBottle barBottle2 = Statemachine.GetBarBottle(1);
-  BarBottle barBottle3 = Statemachine.GetBarBottle(2);
+  BarBottle barBottles[BAR_BOTTLECOUNT];
+  bool hasSparklingWater = false;
+  bool isBarEmpty = true;
 
-  double liquidPercentage1 = Statemachine.GetBarPercentage(eLiquid1);
-  double liquidPercentage2 = Statemachine.GetBarPercentage(eLiquid2);
-  double liquidPercentage3 = Statemachine.GetBarPercentage(eLiquid3);
+  for (uint8_t index = 0; index < BAR_BOTTLECOUNT; index++)
+  {
+    barBottles[index] = Statemachine.GetBarBottle(index);
+    hasSparklingWater |= barBottles[index] == eSparklingWater;
+    isBarEmpty &= barBottles[index] == eEmpty;
+  }
 
   // Draw only check boxes if complete bar stock is empty
-  if (isDashboard &&
-    barBottle1 == eEmpty &&
-    barBottle2 == eEmpty &&
-    barBottle3 == eEmpty)
-  {
-    // Print selection text
-    _tft->setTextColor(Config.tftColorForeground);
-    DrawCenteredString("Select WINE for dispensing:", x0, y + 25, false, 0, true, 0x528A); // Gray
+  bool isCheckBoxes = isDashboard && isBarEmpty;
 
-    // Draw checkboxes
-    DrawCheckBoxes(dashboardLiquid);
+  if (isfullUpdate)
+  {
+    _barTree.InvalidateAll();
   }
-  else
+
+  for (uint8_t index = 0; index < BAR_BOTTLECOUNT; index++)
   {
-    // Draw each bottle
-    DrawBarPart(x0 - spacing, y, eLiquid1, barBottle1, _lastDraw_barBottle1, liquidPercentage1, _lastDraw_liquidPercentage1, Config.liquidName1, Config.tftColorLiquid1, isDashboard, isfullUpdate);
-    DrawBarPart(x0,           y, eLiquid2, barBottle2, _lastDraw_barBottle2, liquidPercentage2, _lastDraw_liquidPercentage2, Config.liquidName2, Config.tftColorLiquid2, isDashboard, isfullUpdate);
-    DrawBarPart(x0 + spacing, y, eLiquid3, barBottle3, _lastDraw_barBottle3, liquidPercentage3, _lastDraw_liquidPercentage3, Config.liquidName3, Config.tftColorLiquid3, isDashboard, isfullUpdate);
+    BarBottle barBottle = barBottles[index];
+    uint16_t color = GetLiquidColor(index);
+    int16_t liquidPercentage = Statemachine.GetBarPercentage((MixtureLiquid)index);
+
+    // Sparkling water percentage -> only if any sparkling water is present and not beside itself
+    bool hasGauge = isDashboard &&
+      !isCheckBoxes &&
+      barBottle != eEmpty &&
+      hasSparklingWater &&
+      barBottle != eSparklingWater;
+
+    // Use red wine bottle for empty selection (draw as shadow -> black)
+    _barBottles[index].SetImage(GetBarBottlePointer(barBottle), barBottle == eEmpty);
+    _barBottles[index].SetSelected(dashboardLiquid == index);
+    _barBottles[index].SetColors(Config.tftColorForeground, Config.tftColorBackground);
+    _barBottles[index].SetVisible(!isCheckBoxes);
+
+    snprintf(_output, sizeof(_output), "%d", liquidPercentage);
+    _barGauges[index].SetValue(liquidPercentage);
+    _barGauges[index].SetColors(color, Config.tftColorForeground, Config.tftColorBackground);
+    _barGauges[index].SetVisible(hasGauge);
+    _barPercentages[index].SetText(_output);
+    _barPercentages[index].SetColors(color, Config.tftColorBackground);
+    _barPercentages[index].SetVisible(hasGauge);
+
+    _barNames[index].SetText(GetLiquidName(index));
+    _barNames[index].SetColors(color, Config.tftColorBackground);
+    _barNames[index].SetVisible(!isCheckBoxes);
+  }
 
-    if (isDashboard &&
-      (isfullUpdate || dashboardLiquid != _lastDraw_SelectedLiquid))
-    {
-      // Print selection text
-      _tft->setTextColor(Config.tftColorForeground);
-      DrawCenteredString("Select WINE for dispensing:", x0, y + 25, false, 0, true, 0x528A); // Gray
-    }
+  // Selection text is redrawn automatically if a bottle selection overlaps it
+  _barBanner.SetText("Select WINE for dispensing:");
+  _barBanner.SetColors(Config.tftColorForeground, 0x528A); // Gray
+  _barBanner.SetVisible(isDashboard);
 
-    _lastDraw_SelectedLiquid = dashboardLiquid;
-    _lastDraw_barBottle1 = barBottle1;
-    _lastDraw_barBottle2 = barBottle2;
-    _lastDraw_barBottle3 = barBottle3;
-    _lastDraw_liquidPercentage1 = liquidPercentage1;
-    _lastDraw_liquidPercentage2 = liquidPercentage2;
-    _lastDraw_liquidPercentage3 = liquidPercentage3;
+  // Render all changed widgets in one pass
+  _barTree.Render(_tft);
+
+  if (isCheckBoxes)
+  {
+    // Draw checkboxes
+    DrawCheckBoxes(dashboardLiquid, isfullUpdate);
   }
 
-  ESP_LOGI(TAG, "_barBottles: %d %d %d", barBottle1, barBottle2, barBottle3);
+  ESP_LOGI(TAG, "_barBottles: %d %d %d", barBottles[0], barBottles[1], barBottles[2]);
 }
 
 //===============================================================
 // Draw checkboxes
 //===============================================================
-void DisplayDriver::DrawCheckBoxes(MixtureLiquid liquid)
+void DisplayDriver::DrawCheckBoxes(MixtureLiquid liquid, bool isfullUpdate)
 {
-  int16_t boxSize = 30;
-  int16_t spacing = 78;
-  int16_t x0 = TFT_WIDTH / 2; // Mid screen
-  int16_t y = HEADEROFFSET_Y + 80;
-  
-  // Draw checkboxes
-  _tft->drawRect(x0 - boxSize / 2 - spacing, y, boxSize, boxSize, Config.tftColorForeground);
-  _tft->drawRect(x0 - boxSize / 2,           y, boxSize, boxSize, Config.tftColorForeground);
-  _tft->drawRect(x0 - boxSize / 2 + spacing, y, boxSize, boxSize, Config.tftColorForeground);
-  
-  // Draw activated checkboxes
-  _tft->fillRect(x0 - boxSize / 2 + 4 - spacing, y + 4, boxSize - 8, boxSize - 8, liquid == eLiquidAll || liquid == eLiquid1 ? Config.tftColorStartPage : Config.tftColorBackground);
-  _tft->fillRect(x0 - boxSize / 2 + 4,           y + 4, boxSize - 8, boxSize - 8, liquid == eLiquidAll || liquid == eLiquid2 ? Config.tftColorStartPage : Config.tftColorBackground);
-  _tft->fillRect(x0 - boxSize / 2 + 4 + spacing, y + 4, boxSize - 8, boxSize - 8, liquid == eLiquidAll || liquid == eLiquid3 ? Config.tftColorStartPage : Config.tftColorBackground);
+  if (isfullUpdate)
+  {
+    _checkBoxTree.InvalidateAll();
+  }
 
-  // Move under the boxes for liquid names
-  y = HEADEROFFSET_Y + 140;
+  for (uint8_t index = 0; index < BAR_BOTTLECOUNT; index++)
+  {
+    // Draw activated checkboxes and liquid names below
+    _checkBoxes[index].SetChecked(liquid == eLiquidAll || liquid == index);
+    _checkBoxes[index].SetColors(Config.tftColorForeground, Config.tftColorStartPage, Config.tftColorBackground);
+    _checkBoxNames[index].SetText(GetLiquidName(index));
+    _checkBoxNames[index].SetColors(GetLiquidColor(index), Config.tftColorBackground);
+  }
 
-  // Draw liquid names
-  _tft->setTextColor(Config.tftColorLiquid1);
-  DrawCenteredString(Config.liquidName1, x0 - spacing, y);
-  _tft->setTextColor(Config.tftColorLiquid2);
-  DrawCenteredString(Config.liquidName2, x0, y);
-  _tft->setTextColor(Config.tftColorLiquid3);
-  DrawCenteredString(Config.liquidName3, x0 + spacing, y);
+  // Render only changed check boxes
+  _checkBoxTree.Render(_tft);
 }
 
 //===============================================================
@@ -703,9 +828,9 @@ void DisplayDriver::DrawLegend()
   // Draw liquid text
   _tft->setTextSize(1);
   _tft->setTextColor(Config.tftColorTextBody);  
-  DrawCenteredString(Config.liquidName1, x, y,                    true, dashboardLiquid == eLiquid1 ? Config.tftColorForeground : Config.tftColorBackground, false, 0);
-  DrawCenteredString(Config.liquidName2, x, y += LOONGLINEOFFSET, true, dashboardLiquid == eLiquid2 ? Config.tftColorForeground : Config.tftColorBackground, false, 0);
-  DrawCenteredString(Config.liquidName3, x, y += LOONGLINEOFFSET, true, dashboardLiquid == eLiquid3 ? Config.tftColorForeground : Config.tftColorBackground, false, 0);
+  DrawCenteredString(Config.liquidName1, x, y,                    true, dashboardLiquid == eLiquid1 ? Config.tftColorForeground : Config.tftColorBackground);
+  DrawCenteredString(Config.liquidName2, x, y += LOONGLINEOFFSET, true, dashboardLiquid == eLiquid2 ? Config.tftColorForeground : Config.tftColorBackground);
+  DrawCenteredString(Config.liquidName3, x, y += LOONGLINEOFFSET, true, dashboardLiquid == eLiquid3 ? Config.tftColorForeground : Config.tftColorBackground);
 }
 
 //===============================================================
@@ -717,9 +842,12 @@ void DisplayDriver::DrawCurrentValues(bool isfullUpdate)
   double liquidPercentage2 = Statemachine.GetPumpPercentage(eLiquid2);
   double liquidPercentage3 = Statemachine.GetPumpPercentage(eLiquid3);
 
-  String liquidPercentage1_String = FormatValue(liquidPercentage1, 2, 0) + String("%");
-  String liquidPercentage2_String = FormatValue(liquidPercentage2, 2, 0) + String("%");
-  String liquidPercentage3_String = FormatValue(liquidPercentage3, 2, 0) + String("%");
+  char liquidPercentage1_Text[VALUE_MAXLENGTH];
+  char liquidPercentage2_Text[VALUE_MAXLENGTH];
+  char liquidPercentage3_Text[VALUE_MAXLENGTH];
+  snprintf(liquidPercentage1_Text, VALUE_MAXLENGTH, "%s%%", FormatValue(liquidPercentage1, 2, 0));
+  snprintf(liquidPercentage2_Text, VALUE_MAXLENGTH, "%s%%", FormatValue(liquidPercentage2, 2, 0));
+  snprintf(liquidPercentage3_Text, VALUE_MAXLENGTH, "%s%%", FormatValue(liquidPercentage3, 2, 0));
 
   // Set text size
   _tft->setTextSize(1);
@@ -736,20 +864,13 @@ void DisplayDriver::DrawCurrentValues(bool isfullUpdate)
   }
 
   x += 40;
-  if (_lastDraw_liquidPercentage1_String != liquidPercentage1_String || isfullUpdate)
+  if (strcmp(_lastDraw_liquidPercentage1_Text, liquidPercentage1_Text) != 0 || isfullUpdate)
   {
-    // Reset old string on display
-    _tft->setTextColor(Config.tftColorBackground);
-    _tft->setCursor(x, y);
-    _tft->print(_lastDraw_liquidPercentage1_String);
-    
-    // Draw new string on display
-    _tft->setTextColor(Config.tftColorLiquid1);
-    _tft->setCursor(x, y);
-    _tft->print(liquidPercentage1_String);
+    // Draw new string on display (Opaque field overwrites the old string)
+    _glyphCache.DrawText(_tft, x, y, liquidPercentage1_Text, Config.tftColorLiquid1, Config.tftColorBackground, 40);
     
     // Save last drawn string
-    _lastDraw_liquidPercentage1_String = liquidPercentage1_String;
+    strlcpy(_lastDraw_liquidPercentage1_Text, liquidPercentage1_Text, VALUE_MAXLENGTH);
   }
 
   x += 40;
@@ -761,20 +882,13 @@ void DisplayDriver::DrawCurrentValues(bool isfullUpdate)
   }
 
   x += 10;
-  if (_lastDraw_liquidPercentage2_String != liquidPercentage2_String || isfullUpdate)
+  if (strcmp(_lastDraw_liquidPercentage2_Text, liquidPercentage2_Text) != 0 || isfullUpdate)
   {
-    // Reset old string on display
-    _tft->setTextColor(Config.tftColorBackground);
-    _tft->setCursor(x, y);
-    _tft->print(_lastDraw_liquidPercentage2_String);
-    
-    // Draw new string on display
-    _tft->setTextColor(Config.tftColorLiquid2);
-    _tft->setCursor(x, y);
-    _tft->print(liquidPercentage2_String);
+    // Draw new string on display (Opaque field overwrites the old string)
+    _glyphCache.DrawText(_tft, x, y, liquidPercentage2_Text, Config.tftColorLiquid2, Config.tftColorBackground, 40);
 
     // Save last drawn string
-    _lastDraw_liquidPercentage2_String = liquidPercentage2_String;
+    strlcpy(_lastDraw_liquidPercentage2_Text, liquidPercentage2_Text, VALUE_MAXLENGTH);
   }
   
   x += 40;
@@ -786,20 +900,13 @@ void DisplayDriver::DrawCurrentValues(bool isfullUpdate)
   }
   
   x += 10;
-  if (_lastDraw_liquidPercentage3_String != liquidPercentage3_String || isfullUpdate)
+  if (strcmp(_lastDraw_liquidPercentage3_Text, liquidPercentage3_Text) != 0 || isfullUpdate)
   {
-    // Reset old string on display
-    _tft->setTextColor(Config.tftColorBackground);
-    _tft->setCursor(x, y);
-    _tft->print(_lastDraw_liquidPercentage3_String);
-    
-    // Draw new string on display
-    _tft->setTextColor(Config.tftColorLiquid3);
-    _tft->setCursor(x, y);
-    _tft->print(liquidPercentage3_String);
+    // Draw new string on display (Opaque field overwrites the old string)
+    _glyphCache.DrawText(_tft, x, y, liquidPercentage3_Text, Config.tftColorLiquid3, Config.tftColorBackground, 40);
 
     // Save last drawn string
-    _lastDraw_liquidPercentage3_String = liquidPercentage3_String;
+    strlcpy(_lastDraw_liquidPercentage3_Text, liquidPercentage3_Text, VALUE_MAXLENGTH);
   }
 
   x += 45;
@@ -825,95 +932,17 @@ void DisplayDriver::DrawDoughnutChart3()
 void DisplayDriver::DrawDoughnutChart3(bool clockwise, bool isfullUpdate)
 {
   MixtureLiquid dashboardLiquid = Statemachine.GetDashboardLiquid();
-  int16_t liquidAngle1 = Statemachine.GetAngle(eLiquid1);
-  int16_t liquidAngle2 = Statemachine.GetAngle(eLiquid2);
-  int16_t liquidAngle3 = Statemachine.GetAngle(eLiquid3);
 
   if (isfullUpdate)
   {
-    // Calculate count of draw_Angle's to draw
-    int16_t liquid1Distance_Degrees = GetDistanceDegrees(liquidAngle1, liquidAngle2);
-    int16_t liquid2Distance_Degrees = GetDistanceDegrees(liquidAngle2, liquidAngle3);
-    int16_t liquid3Distance_Degrees = GetDistanceDegrees(liquidAngle3, liquidAngle1);
-  
-    // Draw doughnut chart parts
-    FillArc(liquidAngle1, liquid1Distance_Degrees, Config.tftColorLiquid1);
-    FillArc(liquidAngle2, liquid2Distance_Degrees, Config.tftColorLiquid2);
-    FillArc(liquidAngle3, liquid3Distance_Degrees, Config.tftColorLiquid3);
-  }
-  else
-  {
-    DrawPartial(liquidAngle1, _lastDraw_liquidAngle1, Config.tftColorLiquid1, Config.tftColorLiquid3, clockwise);
-    DrawPartial(liquidAngle2, _lastDraw_liquidAngle2, Config.tftColorLiquid2, Config.tftColorLiquid1, clockwise);
-    DrawPartial(liquidAngle3, _lastDraw_liquidAngle3, Config.tftColorLiquid3, Config.tftColorLiquid2, clockwise);
+    _doughnut.Invalidate();
   }
 
-  // Draw black spacer and selected white
-  FillArc(Move360(liquidAngle1, -SPACERANGLE_DEGREES), 2 * SPACERANGLE_DEGREES, dashboardLiquid == eLiquid1 ? Config.tftColorForeground : Config.tftColorBackground);
-  FillArc(Move360(liquidAngle2, -SPACERANGLE_DEGREES), 2 * SPACERANGLE_DEGREES, dashboardLiquid == eLiquid2 ? Config.tftColorForeground : Config.tftColorBackground);
-  FillArc(Move360(liquidAngle3, -SPACERANGLE_DEGREES), 2 * SPACERANGLE_DEGREES, dashboardLiquid == eLiquid3 ? Config.tftColorForeground : Config.tftColorBackground);
-  
-  // Set last drawn angles
-  _lastDraw_liquidAngle1 = liquidAngle1;
-  _lastDraw_liquidAngle2 = liquidAngle2;
-  _lastDraw_liquidAngle3 = liquidAngle3;
-}
-
-//===============================================================
-// Only draws partial update of arcs
-//===============================================================
-void DisplayDriver::DrawPartial(int16_t newAngle, int16_t lastAngle,  uint16_t colorAfter, uint16_t colorBefore, bool clockwise)
-{
-  if (lastAngle != newAngle)
-  {
-    // Calculate start angle and color
-    // Draw from last angle to new angle
-    int16_t startAngle = Move360(lastAngle, clockwise ? -SPACERANGLE_DEGREES : SPACERANGLE_DEGREES);
-    uint16_t color = clockwise ? colorBefore : colorAfter;
-
-    // Calculate draw distance
-    int16_t distance_Degrees = clockwise ? GetDistanceDegrees(lastAngle, newAngle) : -360 + GetDistanceDegrees(lastAngle, newAngle);
-    
-    // Draw doughnut part
-    FillArc(startAngle, distance_Degrees, color);
-  }
-}
-
-//===============================================================
-// Draw an arc with a defined thickness
-//===============================================================
-void DisplayDriver::FillArc(int16_t start_angle, int16_t distance_Degrees, uint16_t color)
-{
-  // x,y == coords of centre of arc
-  // start_angle = 0 - 359
-  // distance_Degrees = absolut distance to draw in degrees
-  // r_inner = inner radius
-  // r_outer = outer radius
-  // color = 16 bit color value
-
-  // Draw color blocks every 1°
-  int16_t drawAngle_Degrees = distance_Degrees > 0 ? 1 : - 1;
-  for (int16_t i = start_angle; i != start_angle + distance_Degrees; i += drawAngle_Degrees)
-  {
-    // Calculate pair of coordinates for segment start
-    float sx = cos((i - 90) * TFT_DEG2RAD);
-    float sy = sin((i - 90) * TFT_DEG2RAD);
-    int16_t x0 = sx * R_INNER_DOUGHNUTCHART + X0_DOUGHNUTCHART;
-    int16_t y0 = sy * R_INNER_DOUGHNUTCHART + Y0_DOUGHNUTCHART;
-    int16_t x1 = sx * R_OUTER_DOUGHNUTCHART + X0_DOUGHNUTCHART;
-    int16_t y1 = sy * R_OUTER_DOUGHNUTCHART + Y0_DOUGHNUTCHART;
-
-    // Calculate pair of coordinates for segment end
-    float sx2 = cos((i + drawAngle_Degrees - 90) * TFT_DEG2RAD);
-    float sy2 = sin((i + drawAngle_Degrees - 90) * TFT_DEG2RAD);
-    int16_t x2 = sx2 * R_INNER_DOUGHNUTCHART + X0_DOUGHNUTCHART;
-    int16_t y2 = sy2 * R_INNER_DOUGHNUTCHART + Y0_DOUGHNUTCHART;
-    int16_t x3 = sx2 * R_OUTER_DOUGHNUTCHART + X0_DOUGHNUTCHART;
-    int16_t y3 = sy2 * R_OUTER_DOUGHNUTCHART + Y0_DOUGHNUTCHART;
-
-    _tft->fillTriangle(x0, y0, x1, y1, x2, y2, color);
-    _tft->fillTriangle(x1, y1, x2, y2, x3, y3, color);
-  }
+  // Partial updates draw only from the last drawn angles to the new angles
+  _doughnut.SetColors(Config.tftColorLiquid1, Config.tftColorLiquid2, Config.tftColorLiquid3, Config.tftColorForeground, Config.tftColorBackground);
+  _doughnut.SetAngles(Statemachine.GetAngle(eLiquid1), Statemachine.GetAngle(eLiquid2), Statemachine.GetAngle(eLiquid3), clockwise);
+  _doughnut.SetSelected(dashboardLiquid >= eLiquid1 && dashboardLiquid <= eLiquid3 ? dashboardLiquid : -1);
+  _doughnut.Render(_tft);
 }
 
 //===============================================================
@@ -924,33 +953,38 @@ void DisplayDriver::DrawSettings(bool isfullUpdate)
   int16_t x = 15;
   int16_t y = HEADEROFFSET_Y + 25 + LONGLINEOFFSET - 2;
 
-  // Clear settings text
-  DrawSettingsEntry(x, y + 0 * SHORTLINEOFFSET, _lastDraw_previousSettingName, _lastDraw_previousSettingValue, false, true, isfullUpdate);
-  DrawSettingsEntry(x, y + 1 * SHORTLINEOFFSET, _lastDraw_currentSettingName, _lastDraw_currentSettingValue, _lastDraw_settingSelected, true, isfullUpdate);
-  DrawSettingsEntry(x, y + 2 * SHORTLINEOFFSET, _lastDraw_nextSettingName, _lastDraw_nextSettingValue, false, true, isfullUpdate);
-
   // Get previous, current and next settings
   MixerSetting currentSetting = Statemachine.GetMixerSetting();
   MixerSetting previousSetting = (uint16_t)currentSetting - 1 < 0 ? (MixerSetting)(MixerSettingMax - 1) : (MixerSetting)(currentSetting - 1);
   MixerSetting nextSetting = (uint16_t)currentSetting + 1 >= MixerSettingMax ? ePWM : (MixerSetting)(currentSetting + 1);
+  MixerSetting settings[3] = { previousSetting, currentSetting, nextSetting };
+  bool settingSelected = Statemachine.GetSettingSelected();
 
-  // Update names
-  _lastDraw_previousSettingName = GetSettingsName(previousSetting);
-  _lastDraw_currentSettingName = GetSettingsName(currentSetting);
-  _lastDraw_nextSettingName = GetSettingsName(nextSetting);
-
-  // Update values
-  _lastDraw_previousSettingValue = GetSettingsValue(previousSetting);
-  _lastDraw_currentSettingValue = GetSettingsValue(currentSetting);
-  _lastDraw_nextSettingValue = GetSettingsValue(nextSetting);
+  if (isfullUpdate)
+  {
+    _settingsTree.InvalidateAll();
+  }
 
-  // Update selected
-  _lastDraw_settingSelected = Statemachine.GetSettingSelected();
+  for (uint8_t index = 0; index < 3; index++)
+  {
+    const char* name = GetSettingsName(settings[index]);
+    char buffer[WIDGET_MAXTEXTLENGTH];
+    const char* value = GetSettingsValue(settings[index], buffer, sizeof(buffer));
+    bool selected = index == 1 && settingSelected;
+
+    // Value follows directly behind the name
+    uint16_t w, h;
+    _glyphCache.GetTextBounds(name, &w, &h);
+
+    _settingNames[index].SetText(name);
+    _settingNames[index].SetColors(Config.tftColorTextBody, Config.tftColorBackground);
+    _settingValues[index].SetPosition(x + w + 5, y + index * SHORTLINEOFFSET);
+    _settingValues[index].SetText(value);
+    _settingValues[index].SetColors(selected ? Config.tftColorTextHeader : Config.tftColorTextBody, Config.tftColorBackground);
+  }
 
-  // Draw new settings text
-  DrawSettingsEntry(x, y + 0 * SHORTLINEOFFSET, _lastDraw_previousSettingName, _lastDraw_previousSettingValue, false, false, isfullUpdate);
-  DrawSettingsEntry(x, y + 1 * SHORTLINEOFFSET, _lastDraw_currentSettingName, _lastDraw_currentSettingValue, _lastDraw_settingSelected, false, isfullUpdate);
-  DrawSettingsEntry(x, y + 2 * SHORTLINEOFFSET, _lastDraw_nextSettingName, _lastDraw_nextSettingValue, false, false, isfullUpdate);
+  // Render only changed names and values (Opaque fields overwrite the old text)
+  _settingsTree.Render(_tft);
 
   // Draw Cursor
   if (isfullUpdate)
@@ -962,276 +996,61 @@ void DisplayDriver::DrawSettings(bool isfullUpdate)
 }
 
 //===============================================================
-// Draws screen saver
+// Draws the next screen saver frame immediately
 //===============================================================
 void DisplayDriver::DrawScreenSaver()
 {
-  int16_t logoWidth = _imageLogo.IsValid() ? _imageLogo.Width() : 0;
-  int16_t logoHeight = _imageLogo.IsValid() ? _imageLogo.Height() : 0;
-  
-  // Move logo indexes
-  int16_t logo_x = _lastLogo_x + _xDir;
-  int16_t logo_y = _lastLogo_y + _yDir;
-
-  // Move logo if image is available
-  _imageLogo.Move(_lastLogo_x, _lastLogo_y, logo_x, logo_y, _tft, Config.tftColorBackground);
-  
-  // Impact collision with the left or right edge
-  if (logo_x <= -logoWidth / 2 || logo_x >= TFT_WIDTH - logoWidth / 2)
-  {
-    _xDir = -_xDir;
-  }
-
-  // Impact collision with the top or bottom edge
-  if (logo_y <= -logoHeight / 2 || logo_y >= TFT_HEIGHT - logoHeight / 2)
-  {
-    _yDir = -_yDir;
-  }
-
-  // Draw stars
-  for (uint8_t index = 0; index < SCREENSAVER_STARCOUNT; index++)
-  {
-    // Init new star, if star animation finished
-    if (_stars[index].Size >= _stars[index].MaxSize)
-    {
-      // Clear old star only outside of the non-transparent part of the logo
-      if (!_imageLogo.IsValid() ||
-        !(_stars[index].X > logo_x && _stars[index].X < logo_x + logoWidth &&
-        _stars[index].Y > logo_y && _stars[index].Y < logo_y + logoHeight &&
-        _imageLogo.GetPixel(_stars[index].X - logo_x, _stars[index].Y - logo_y) != _imageLogo.TransparencyColor()))
-      {
-        DrawStar(_stars[index].X, _stars[index].Y, _stars[index].FullStars, Config.tftColorBackground, _stars[index].Size);
-      }
-
-      _stars[index].X = random(0, TFT_WIDTH);
-      _stars[index].Y = random(0, TFT_HEIGHT);
-      _stars[index].MaxSize = random(1, 6);
-      _stars[index].FullStars = random(0, 12) < 6 ? true : false;
-      _stars[index].Size = 0;
-    }
-
-    // Draw new star only outside of the non-transparent part of the logo
-    if (!_imageLogo.IsValid() || 
-      !(_stars[index].X > logo_x && _stars[index].X < logo_x + logoWidth &&
-      _stars[index].Y > logo_y && _stars[index].Y < logo_y + logoHeight &&
-      _imageLogo.GetPixel(_stars[index].X - logo_x, _stars[index].Y - logo_y) != _imageLogo.TransparencyColor()))
-    {
-      DrawStar(_stars[index].X, _stars[index].Y, _stars[index].FullStars, Config.tftColorForeground, _stars[index].Size);
-    }
-
-    // Increment star size
-    _stars[index].Size++;
-  }
-
-  _lastLogo_x = logo_x;
-  _lastLogo_y = logo_y;
+  _screenSaver.DrawFrame(_tft);
 }
 
 //===============================================================
-// Draws a star
+// Draws the screen saver with fixed frame rate and returns the
+// time until the next frame in ms
 //===============================================================
-void DisplayDriver::DrawStar(int16_t x0, int16_t y0, bool fullStars, uint16_t color, int16_t size)
+uint32_t DisplayDriver::UpdateScreenSaver()
 {
-  _tft->writePixel(x0, y0, color);
-
-  if (size > 0)
-  {
-    DrawStarTail(x0, y0, 1, 2, fullStars, color);
-  }
-  if (size > 1)
-  {
-    DrawStarTail(x0, y0, 4, 5, fullStars, color);
-  }
-  if (size > 2)
-  {
-    DrawStarTail(x0, y0, 7, 8, fullStars, color);
-  }
-  if (size > 3)
-  {
-    DrawStarTail(x0, y0, 10, 11, fullStars, color);
-  }
-  if (size > 4)
-  {
-    DrawStarTail(x0, y0, 13, 14, fullStars, color);
-  }
+  return _screenSaver.Update(_tft);
 }
 
 //===============================================================
-// Draws a star tail
+// Returns the CPU load of the screen saver in percent
 //===============================================================
-void DisplayDriver::DrawStarTail(int16_t x0, int16_t y0, int16_t start, int16_t end, bool fullStars, uint16_t color)
+double DisplayDriver::GetScreenSaverCpuLoad()
 {
-  // Nach oben
-  _tft->writeLine(x0, y0 - start, x0, y0 - end, color);
-
-  // Nach unten
-  _tft->writeLine(x0, y0 + start, x0, y0 + end, color);
-
-  // Nach rechts
-  _tft->writeLine(x0 + start, y0, x0 + end, y0, color);
-
-  // Nach links
-  _tft->writeLine(x0 - start, y0, x0 - end, y0, color);
-
-  if (fullStars)
-  {
-    // Nach rechts oben
-    _tft->writeLine(x0 + start, y0 - start, x0 + end, y0 - end, color);
-
-    // Nach links oben
-    _tft->writeLine(x0 - start, y0 - start, x0 - end, y0 - end, color);
-
-    // Nach rechts unten
-    _tft->writeLine(x0 + start, y0 + start, x0 + end, y0 + end, color);
-
-    // Nach links unten
-    _tft->writeLine(x0 - start, y0 + start, x0 - end, y0 + end, color);
-  }
+  return _screenSaver.GetCpuLoad();
 }
 
 //===============================================================
-// Draws a part of the bar
+// Returns the name of a liquid
 //===============================================================
-void DisplayDriver::DrawBarPart(int16_t x0, int16_t y, MixtureLiquid liquid, BarBottle barBottle, BarBottle lastDraw_barBottle, int16_t liquidPercentage, int16_t lastDraw_liquidPercentage, String name, uint16_t color, bool isDashboard, bool isfullUpdate)
+const char* DisplayDriver::GetLiquidName(uint8_t index)
 {
-  int16_t namesOffsetX = 15;
-  int16_t namesOffsetY = 175;
-
-  MixtureLiquid dashboardLiquid = Statemachine.GetDashboardLiquid();
-  BarBottle barBottle1 = Statemachine.GetBarBottle(0);
-  BarBottle barBottle2 = Statemachine.GetBarBottle(1);
-  BarBottle barBottle3 = Statemachine.GetBarBottle(2);
-  
-  bool isEmpty = barBottle == eEmpty;
-  bool selectedChanged = dashboardLiquid != _lastDraw_SelectedLiquid;
-  bool bottleChanged = barBottle != lastDraw_barBottle;
-  bool sparklingWaterChanged = liquidPercentage != lastDraw_liquidPercentage;
-  bool isSelected = dashboardLiquid == liquid;
-  bool wasSelected = _lastDraw_SelectedLiquid == liquid;
-  bool hasSparklingWater = barBottle1 == eSparklingWater || barBottle2 == eSparklingWater || barBottle3 == eSparklingWater;
-
-  // Reset old bottle type selection -> only if bottle type changed
-  if (bottleChanged)
-  {
-    SelectBarBottle(lastDraw_barBottle, x0, y, Config.tftColorBackground);
-  }
-
-  // Reset current bottle type selection -> only if selection changed and was selected
-  if (selectedChanged && wasSelected)
+  switch (index)
   {
-    SelectBarBottle(barBottle, x0, y, Config.tftColorBackground);
-  }
-
-  // Clear current bottle type -> only if bottle type changed
-  if (bottleChanged)
-  {
-    ClearBarBottle(lastDraw_barBottle, barBottle, x0, y, Config.tftColorBackground);
-  }
-  
-  // Draw current bottle selection -> only if selected AND (full update OR bottle changed OR selected changed)
-  if (isSelected &&
-    (isfullUpdate || bottleChanged || selectedChanged))
-  {
-    SelectBarBottle(barBottle, x0, y, Config.tftColorForeground);
-  }
-  
-  // Draw current bottle and checkbox -> only if full update or bottle type changed
-  if (isfullUpdate || bottleChanged)
-  {
-    // Draw bottle image
-    DrawBarBottle(barBottle, x0, y);
-  }
-
-  // Draw liquid name -> only if full update, bottle type changed or selected changed
-  if (isfullUpdate || bottleChanged || selectedChanged)
-  {
-    // Draw liquid name
-    _tft->setTextColor(color);
-    _tft->fillRect(x0 - namesOffsetX - 17, y + namesOffsetY - 15, 54, 30, Config.tftColorBackground);
-    DrawCenteredString(name, x0 - namesOffsetX, y + namesOffsetY);
-  }
-
-  // Draw sparkling water percentage -> only if any sparkling water is present and not beside itself
-  if (isDashboard &&
-    !isEmpty &&
-    hasSparklingWater &&
-    barBottle != eSparklingWater &&
-    (isfullUpdate || sparklingWaterChanged))
-  {
-    int16_t x = x0 - 37;
-    int16_t yTop = y + namesOffsetY - 120;
-
-    // Draw bar graph
-    _tft->fillRect(x, yTop, 3, 100 - liquidPercentage, color);
-    _tft->fillRect(x, yTop + 100 - liquidPercentage, 3, liquidPercentage, Config.tftColorForeground);
-
-    // Draw percentage
-    _tft->fillRect(x - 10, yTop - 15, 27, 20, Config.tftColorBackground);
-    _tft->setTextColor(color);
-    DrawCenteredString(String(liquidPercentage), x + 3, yTop - 5);
-  }
-}
-
-//===============================================================
-// Clears the difference from a bar bottle to the next bottle
-//===============================================================
-void DisplayDriver::ClearBarBottle(BarBottle lastDraw_barBottle, BarBottle barBottle, int16_t x0, int16_t y, uint16_t clearColor)
-{
-  if (lastDraw_barBottle == eEmpty)
-  {
-    return;
-  }
-
-  // Determine image pointers
-  SPIFFSBMPImage* barBottlePointerLast = GetBarBottlePointer(lastDraw_barBottle);
-  SPIFFSBMPImage* barBottlePointerNew = GetBarBottlePointer(barBottle);
-
-  if (barBottlePointerLast &&
-    barBottlePointerNew &&
-    barBottlePointerLast->IsValid() &&
-    barBottlePointerNew->IsValid())
-  {
-    // Clear difference from last to new image
-    int16_t xLast = x0 - barBottlePointerLast->Width() / 2;
-    int16_t xNew = x0 - barBottlePointerNew->Width() / 2;
-    barBottlePointerLast->ClearDiff(xLast, y, xNew, y, barBottlePointerNew, _tft, clearColor);
-  }
-}
-
-//===============================================================
-// Draws a bar bottle
-//===============================================================
-void DisplayDriver::DrawBarBottle(BarBottle barBottle, int16_t x0, int16_t y)
-{  
-  // Determine correct pointer
-  SPIFFSBMPImage* barBottlePointer = GetBarBottlePointer(barBottle);
-
-  if (barBottlePointer &&
-    barBottlePointer->IsValid())
-  {
-    // Draw bottle
-    int16_t x = x0 - barBottlePointer->Width() / 2;
-    barBottlePointer->Draw(x, y, _tft, Config.tftColorBackground, barBottle == eEmpty); // Use red wine bottle for empty selection (draw as shadow -> black)
+    case eLiquid2:
+      return Config.liquidName2;
+    case eLiquid3:
+      return Config.liquidName3;
+    case eLiquid1:
+    default:
+      return Config.liquidName1;
   }
 }
 
 //===============================================================
-// Draws a selection around a bar bottle
+// Returns the color of a liquid
 //===============================================================
-void DisplayDriver::SelectBarBottle(BarBottle barBottle, int16_t x0, int16_t y, uint16_t color)
+uint16_t DisplayDriver::GetLiquidColor(uint8_t index)
 {
-  // Determine correct pointer
-  SPIFFSBMPImage* barBottlePointer = GetBarBottlePointer(barBottle);
-
-  if (barBottlePointer &&
-    barBottlePointer->IsValid())
+  switch (index)
   {
-    // Draw selection shadow with move function
-    int16_t selectionWidth = 3;
-    int16_t x = x0 - barBottlePointer->Width() / 2;
-    barBottlePointer->Move(x - selectionWidth, y, x, y, _tft, color, true);
-    barBottlePointer->Move(x + selectionWidth, y, x, y, _tft, color, true);
-    barBottlePointer->Move(x, y - selectionWidth, x, y, _tft, color, true);
+    case eLiquid2:
+      return Config.tftColorLiquid2;
+    case eLiquid3:
+      return Config.tftColorLiquid3;
+    case eLiquid1:
+    default:
+      return Config.tftColorLiquid1;
   }
 }
 
@@ -1256,9 +1075,9 @@ SPIFFSBMPImage* DisplayDriver::GetBarBottlePointer(BarBottle barBottle)
 }
 
 //===============================================================
-// Returns the settings name as string
+// Returns the settings name
 //===============================================================
-String DisplayDriver::GetSettingsName(MixerSetting setting)
+const char* DisplayDriver::GetSettingsName(MixerSetting setting)
 {
   switch (setting)
   {
@@ -1282,18 +1101,40 @@ String DisplayDriver::GetSettingsName(MixerSetting setting)
 }
 
 //===============================================================
-// Returns the settings value as string
+// Returns the settings value
+// Fixed texts are returned directly, formatted values are
+// written to the buffer
 //===============================================================
-String DisplayDriver::GetSettingsValue(MixerSetting setting)
+const char* DisplayDriver::GetSettingsValue(MixerSetting setting, char* buffer, size_t length)
 {
   switch (setting)
   {
     case ePWM:
-      return String(Pumps.GetCycleTimespan()) + "ms";
+      snprintf(buffer, length, "%dms", (int)Pumps.GetCycleTimespan());
+      return buffer;
     case eWLAN:
       return Wifihandler.GetWifiMode() == WIFI_MODE_AP ? "AP" : "OFF";
     case eConfig:
-      return Config.GetCurrent();
+      {
+        // Name without extension and catalogue position
+        char name[THEMEINDEX_MAXNAMELENGTH];
+        Config.GetCurrent(name, sizeof(name));
+        char* extension = strrchr(name, '.');
+        if (extension &&
+          (strcmp(extension, ".json") == 0 || strcmp(extension, THEMEBUNDLE_EXTENSION) == 0))
+        {
+          *extension = '\0';
+        }
+        if (Config.GetCurrentIndex() >= 0)
+        {
+          snprintf(buffer, length, "%s %d / %d", name, Config.GetCurrentIndex() + 1, Config.GetCount());
+        }
+        else
+        {
+          strlcpy(buffer, name, length);
+        }
+        return buffer;
+      }
     case eLEDIdle:
     case eLEDDispensing:
       switch (setting == eLEDIdle ? Config.ledModeIdle : Config.ledModeDispensing)
@@ -1336,34 +1177,10 @@ String DisplayDriver::GetSettingsValue(MixerSetting setting)
   return "???";
 }
 
-//===============================================================
-// Draws a single setting
-//===============================================================
-void DisplayDriver::DrawSettingsEntry(int16_t x, int16_t y, const String &name, const String &value, bool selected, bool clear, bool isfullUpdate)
-{
-  if (isfullUpdate)
-  {
-    // Draw settings name
-    _tft->setTextColor(clear ? Config.tftColorBackground : Config.tftColorTextBody);
-    _tft->setCursor(x, y);
-    _tft->print(name);
-  }
-
-  // Get text bounds
-  int16_t x1, y1;
-  uint16_t w, h;
-  _tft->getTextBounds(name, x, y, &x1, &y1, &w, &h);
-
-  // Draw settings value
-  _tft->setCursor(x + w + 5, y);
-  _tft->setTextColor(clear ? Config.tftColorBackground : selected ? Config.tftColorTextHeader : Config.tftColorTextBody);
-  _tft->print(value);
-}
-
 //===============================================================
 // Draws a string centered
 //===============================================================
-void DisplayDriver::DrawCenteredString(const String& text, int16_t x, int16_t y, bool underlined, uint16_t lineColor, bool backGround, uint16_t backGroundColor)
+void DisplayDriver::DrawCenteredString(const char* text, int16_t x, int16_t y, bool underlined, uint16_t lineColor)
 {
   // Get text bounds
   int16_t x1, y1;
@@ -1375,12 +1192,6 @@ void DisplayDriver::DrawCenteredString(const String& text, int16_t x, int16_t y,
   int16_t y_text = y + h / 2;
   _tft->setCursor(x_text, y_text);
 
-  // Draw background if active
-  if (backGround)
-  {
-    _tft->fillRect(x_text - 2, y - h /2, w + 4, h + 4, backGroundColor);
-  }
-
   // Print text
   _tft->print(text);
 
@@ -1392,14 +1203,10 @@ void DisplayDriver::DrawCenteredString(const String& text, int16_t x, int16_t y,
 }
 
 //===============================================================
-// Formats double value
+// Formats double value (Valid until the next call)
 //===============================================================
-String DisplayDriver::FormatValue(double value, int16_t mainPlaces, uint16_t decimalPlaces)
+const char* DisplayDriver::FormatValue(double value, int16_t mainPlaces, uint16_t decimalPlaces)
 {
-  String returnValue = "";
-
   dtostrf(value, mainPlaces, decimalPlaces, _output);
-  returnValue += String(_output);
-
-  return returnValue;
+  return _output;
 }
@@ -15,21 +15,24 @@
 #include <Arduino.h>
 #include <SPI.h>
 #include <WiFi.h>
-#include <SPIFFS.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h>
 #include <Fonts/FreeSans9pt7b.h>
 #include <esp_log.h>
+#include "FileSystem.h"
 #include "Config.h"
 #include "StateMachine.h"
 #include "SPIFFSBMPImage.h"
+#include "AssetStore.h"
+#include "GlyphCache.h"
+#include "Widgets.h"
+#include "ScreenSaver.h"
 #include "AngleHelper.h"
 #include "FlowMeterDriver.h"
 
 //===============================================================
 // Defines
 //===============================================================
-#define TFT_DEG2RAD                 0.017453292519943295769236907684886F
 #define TFT_WIDTH                   240
 #define TFT_HEIGHT                  240
 
@@ -58,9 +61,14 @@
 #define SHORTLINEOFFSET             20
 #define LONGLINEOFFSET              30
 #define LOONGLINEOFFSET             50
+#define BAR_BOTTLECOUNT             3
+#define BAR_SPACING                 78
+#define BAR_NAMESOFFSET_X           15
+#define BAR_NAMESOFFSET_Y           175
+#define CHECKBOX_SIZE               30
 #define SPACERANGLE_DEGREES         1  // Angle which will be displayed as spacer between pie elements (will be multiplied by 2, left and right of the setting angle)
+#define VALUE_MAXLENGTH             8  // Percentage values like "100%" including zero terminator
 
-#define SCREENSAVER_STARCOUNT       30
 
 //===============================================================
 // Icons
@@ -162,19 +170,6 @@ const unsigned char icon_copyright [] PROGMEM = {
 	0x18, 0x80, 0x01, 0x70, 0xe0, 0x00, 0xe0, 0x7f, 0x00, 0x80, 0x1f, 0x00
 };
 
-//===============================================================
-// Class for screen saver stars
-//===============================================================
-class Star
-{
-  public:
-    int16_t X = 0;
-    int16_t Y = 0;
-    int16_t Size = 5;
-    int16_t MaxSize = 0;
-    bool FullStars = false;
-};
-
 //===============================================================
 // Class for handling display functions
 //===============================================================
@@ -190,6 +185,12 @@ class DisplayDriver
     // Loads the images from spiffs
     void LoadImages();
 
+    // Swaps in prefetched images (Order: Logo, glass, bottle 1 to 4)
+    void SwapImages(SPIFFSBMPImage* images);
+
+    // Loads an image and checks for deallocation before loading
+    static void LoadImage(SPIFFSBMPImage* _image, const char* fileName, ThemeBundle* bundle, ThemeBundleSection section);
+
     // Shows intro page
     void ShowIntroPage();
     
@@ -218,7 +219,7 @@ class DisplayDriver
     void DrawWifiIcons(bool isfullUpdate = false);
     
     // Draws the info box
-    void DrawInfoBox(const String &line1, const String &line2);
+    void DrawInfoBox(const char* line1, const char* line2);
 
     // Draws the menu partially
     void DrawMenu(bool isfullUpdate = false);
@@ -227,7 +228,7 @@ class DisplayDriver
     void DrawBar(bool isDashboard, bool isfullUpdate = false);
 
     // Draw checkboxes
-    void DrawCheckBoxes(MixtureLiquid liquid);
+    void DrawCheckBoxes(MixtureLiquid liquid, bool isfullUpdate = false);
     
     // Draws the legend
     void DrawLegend();
@@ -244,14 +245,23 @@ class DisplayDriver
     // Draws settings partially
     void DrawSettings(bool isfullUpdate = false);
 
-    // Draws screen saver
+    // Draws the next screen saver frame immediately
     void DrawScreenSaver();
 
+    // Draws the screen saver with fixed frame rate and returns the time until the next frame in ms
+    uint32_t UpdateScreenSaver();
+
+    // Returns the CPU load of the screen saver in percent
+    double GetScreenSaverCpuLoad();
+
   private:
     // Display variable
     Adafruit_ST7789* _tft;
     char _output[30];
 
+    // Pre-rendered glyphs for partial text updates
+    GlyphCache _glyphCache;
+
     // Image pointer
     SPIFFSBMPImage _imageLogo;
     SPIFFSBMPImage _imageGlass;
@@ -262,85 +272,59 @@ class DisplayDriver
 
     // Last draw values
     MixerState _lastDraw_MenuState = eDashboard;
-    MixtureLiquid _lastDraw_SelectedLiquid = eLiquidNone;
-    int16_t _lastDraw_liquidAngle1 = 0;
-    int16_t _lastDraw_liquidAngle2 = 0;
-    int16_t _lastDraw_liquidAngle3 = 0;
-    double _lastDraw_liquidPercentage1 = 0.0;
-    double _lastDraw_liquidPercentage2 = 0.0;
-    double _lastDraw_liquidPercentage3 = 0.0;
-    String _lastDraw_liquidPercentage1_String = "";
-    String _lastDraw_liquidPercentage2_String = "";
-    String _lastDraw_liquidPercentage3_String = "";
-    BarBottle _lastDraw_barBottle1 = eEmpty;
-    BarBottle _lastDraw_barBottle2 = eEmpty;
-    BarBottle _lastDraw_barBottle3 = eEmpty;
-    bool _lastDraw_settingSelected = false;
-    String _lastDraw_previousSettingName = "";
-    String _lastDraw_currentSettingName = "";
-    String _lastDraw_nextSettingName = "";
-    String _lastDraw_previousSettingValue = "";
-    String _lastDraw_currentSettingValue = "";
-    String _lastDraw_nextSettingValue = "";
+    char _lastDraw_liquidPercentage1_Text[VALUE_MAXLENGTH] = "";
+    char _lastDraw_liquidPercentage2_Text[VALUE_MAXLENGTH] = "";
+    char _lastDraw_liquidPercentage3_Text[VALUE_MAXLENGTH] = "";
     uint16_t _lastDraw_ConnectedClients = 0;
 
+    // Retained widgets (Keep their last rendered state)
+    WidgetTree _barTree;
+    BottleWidget _barBottles[BAR_BOTTLECOUNT];
+    BarGaugeWidget _barGauges[BAR_BOTTLECOUNT];
+    LabelWidget _barPercentages[BAR_BOTTLECOUNT];
+    LabelWidget _barNames[BAR_BOTTLECOUNT];
+    LabelWidget _barBanner;
+    WidgetTree _checkBoxTree;
+    CheckBoxWidget _checkBoxes[BAR_BOTTLECOUNT];
+    LabelWidget _checkBoxNames[BAR_BOTTLECOUNT];
+    WidgetTree _settingsTree;
+    LabelWidget _settingNames[3];
+    LabelWidget _settingValues[3];
+    DoughnutWidget _doughnut;
+    IconWidget _wifiIcon;
+
     // Screen saver variables
-    Star _stars[SCREENSAVER_STARCOUNT];
-    int16_t _lastLogo_x = 10;
-    int16_t _lastLogo_y = TFT_HEIGHT / 2;
-    int16_t _xDir = 1;
-    int16_t _yDir = 1;
-    
-    // Loads an image and checks for deallocation before loading
-    void LoadImage(SPIFFSBMPImage* _image, String fileName);
+    ScreenSaver _screenSaver;
+
+    // Initializes the layout of all retained widgets
+    void BeginWidgets();
 
     // Draws default header Text
     void DrawHeader();
     
     // Draws header Text
-    void DrawHeader(const String &text, bool withIcons = true);
-    
-    // Draws only partial update of arcs
-    void DrawPartial(int16_t angle, int16_t lastAngle,  uint16_t colorAfter, uint16_t colorBefore, bool clockwise);
-    
-    // Draws an arc with a defined thickness
-    void FillArc(int16_t start_angle, int16_t distance_Degrees, uint16_t color);
+    void DrawHeader(const char* text, bool withIcons = true);
     
-    // Draws a part of the bar
-    void DrawBarPart(int16_t x0, int16_t y, MixtureLiquid liquid, BarBottle barBottle, BarBottle lastDraw_barBottle, int16_t liquidPercentage, int16_t lastDraw_liquidPercentage, String name, uint16_t color, bool isDashboard, bool isfullUpdate);
-    
-    // Clears the difference from a bar bottle to the next bottle
-    void ClearBarBottle(BarBottle lastDraw_barBottle, BarBottle barBottle, int16_t x0, int16_t y, uint16_t clearColor);
-
-    // Draws a bar bottle
-    void DrawBarBottle(BarBottle barBottle, int16_t x0, int16_t y);
+    // Returns the name of a liquid
+    const char* GetLiquidName(uint8_t index);
 
-    // Draws a selection around a bar bottle
-    void SelectBarBottle(BarBottle barBottle, int16_t x0, int16_t y, uint16_t color);
+    // Returns the color of a liquid
+    uint16_t GetLiquidColor(uint8_t index);
 
     // Returns a pointer to the requested bar bottle image
     SPIFFSBMPImage* GetBarBottlePointer(BarBottle barBottle);
 
-    // Returns the settings name as string
-    String GetSettingsName(MixerSetting setting);
+    // Returns the settings name
+    const char* GetSettingsName(MixerSetting setting);
 
-    // Returns the settings value as string
-    String GetSettingsValue(MixerSetting setting);
+    // Returns the settings value (Formatted values are written to the buffer)
+    const char* GetSettingsValue(MixerSetting setting, char* buffer, size_t length);
 
-    // Draws a single setting
-    void DrawSettingsEntry(int16_t x, int16_t y, const String &name, const String &value, bool selected, bool clear, bool isfullUpdate);
-    
     // Draws a string centered
-    void DrawCenteredString(const String &text, int16_t x, int16_t y, bool underlined = false, uint16_t lineColor = 0, bool backGround = false, uint16_t backGroundColor = 0);
-    
-    // Formats double value
-    String FormatValue(double value, int16_t mainPlaces, uint16_t decimalPlaces);
-
-    // Draws a star
-    void DrawStar(int16_t x0, int16_t y0, bool fullStars, uint16_t color, int16_t size = 0);
+    void DrawCenteredString(const char* text, int16_t x, int16_t y, bool underlined = false, uint16_t lineColor = 0);
     
-    // Draws a star tail
-    void DrawStarTail(int16_t x0, int16_t y0, int16_t start, int16_t end, bool fullStars, uint16_t color);
+    // Formats double value (Valid until the next call)
+    const char* FormatValue(double value, int16_t mainPlaces, uint16_t decimalPlaces);
 };
 
 //===============================================================
@@ -16,7 +16,7 @@
  * - USB DFU On Boot: "Disabled"
  * - USB Firmware MSC On Boot: "Disabled"
  * - Flash Size: "4Mb (32Mb)"
- * - Partition Scheme: "No OTA (2MB APP/2MB SPIFFS)"
+ * - Partition Scheme: "No OTA (2MB APP/2MB SPIFFS)" (Replaced by 'partitions.csv' with asset partition)
  * - PSRAM: "Enabled"  <----------------------- Important! Otherwise you will get memory issues
  * - Upload Speed: "921600"
  * 
@@ -39,10 +39,10 @@
 //===============================================================
 #include <Arduino.h>
 #include <SPI.h>
-#include <SPIFFS.h>
 #include <WiFi.h>
 #include <Adafruit_ST7789.h>
 #include <esp_log.h>
+#include "FileSystem.h"
 #include "Config.h"
 #include "SystemHelper.h"
 #include "StateMachine.h"
@@ -51,6 +51,11 @@
 #include "DisplayDriver.h"
 #include "FlowMeterDriver.h"
 #include "WifiHandler.h"
+#include "Benchmark.h"
+#include "BootSequencer.h"
+#include "AssetStore.h"
+#include "ThemeSwitcher.h"
+#include "Maintenance.h"
 
 //===============================================================
 // Constants
@@ -118,6 +123,9 @@ int16_t fadingDirection = 1;
 const uint32_t FadingTimeSlow_ms = 5;
 const uint32_t FadingTimeFast_ms = 1;
 
+// VCC voltage measured at startup
+double vccVoltage = 0.0;
+
 // LED variables
 int16_t ledValue = 0;
 LEDMode lastLEDMode = eOff;
@@ -160,8 +168,65 @@ void IRAM_ATTR ISR_EncoderB()
   Systemhelper.SetLastUserAction();
 }
 
+//===============================================================
+// Boot task: Loads the configuration and the theme images
+//===============================================================
+bool BootTaskTheme()
+{
+  // Loading config file
+  ESP_LOGI(TAG, "Loading config file");
+  int8_t phase = Boot.BeginPhase("config");
+  bool result = Config.Begin();
+  if (!result)
+  {
+    // Reset Config (Error is shown by setup)
+    Config.ResetConfig();
+  }
+  Boot.EndPhase(phase, result);
+
+  // Loading images from SPIFFS
+  ESP_LOGI(TAG, "Loading images from SPIFFS");
+  phase = Boot.BeginPhase("images");
+  Display.LoadImages();
+  Boot.EndPhase(phase);
+
+  return result;
+}
+
+//===============================================================
+// Boot task: Loads the driver settings from NVS
+//===============================================================
+bool BootTaskSettings()
+{
+  // Initialize flow values from EEPROM
+  ESP_LOGI(TAG, "Initialize flow values from EEPROM");
+  FlowMeter.Load();
+
+  // Initialize pump driver
+  ESP_LOGI(TAG, "Initialize pump driver");
+  Pumps.Begin(PIN_PUMP_1, PIN_PUMP_2, PIN_PUMP_3, vccVoltage);
+
+  return true;
+}
+
+//===============================================================
+// Boot task: Brings up the access point (The web server is started
+// by setup, when config and settings are loaded)
+//===============================================================
+bool BootTaskWifi()
+{
+  // Initialize wifi
+  ESP_LOGI(TAG, "Initialize wifi");
+  Wifihandler.Begin();
+
+  return true;
+}
+
 //===============================================================
 // Setup function
+// Configuration, images, NVS settings and wifi are loaded by
+// concurrent boot tasks while the startup sound plays and the
+// intro page is shown
 //===============================================================
 void setup(void)
 {
@@ -172,6 +237,10 @@ void setup(void)
   // Initialize serial communication
   Serial.begin(115200);
 
+  // Initialize boot sequencer
+  Boot.Begin();
+  int8_t phase = Boot.BeginPhase("system");
+
   // Show startup log
   ESP_LOGI(TAG, "-- CocktailCube %s --", APP_VERSION);
   ESP_LOGI(TAG, "HeapSize : %d", ESP.getHeapSize());
@@ -181,52 +250,80 @@ void setup(void)
   Systemhelper.Begin();
   String resetReason = Systemhelper.GetShortResetReasonString(0);
 
+  // Initialize GPIOs
+  ESP_LOGI(TAG, "Initialize GPIOs");
+  pinMode(PIN_PUMPS_ENABLE, INPUT_PULLUP);
+  pinMode(PIN_PUMPS_ENABLE_GND, OUTPUT);
+  pinMode(PIN_LEDLIGHT, OUTPUT);
+  pinMode(PIN_LEDSTATUS, OUTPUT);
+  pinMode(PIN_BUZZER, OUTPUT);
+  pinMode(PIN_VCC, INPUT);
+
+  // Initialize outputs
+  ESP_LOGI(TAG, "Initialize outputs");
+  digitalWrite(PIN_PUMPS_ENABLE_GND, LOW); // Fixed GND value (0V, LOW)
+  digitalWrite(PIN_LEDLIGHT, LOW);
+  digitalWrite(PIN_LEDSTATUS, LOW);
+  digitalWrite(PIN_BUZZER, LOW);
+  Boot.EndPhase(phase);
+
   // Initialize hardware SPI (Force HSPI)
   ESP_LOGI(TAG, "Initialize SPI");
+  phase = Boot.BeginPhase("display");
   SPIClass *spi = new SPIClass(HSPI);
   spi->begin(PIN_TFT_SCL, -1, PIN_TFT_SDA, PIN_TFT_CS);
 
   // Initialize display
   ESP_LOGI(TAG, "Initialize display");
+#if BENCHMARK_ON_BOOT
+  tft = new CountingST7789(spi, PIN_TFT_CS, PIN_TFT_DC, PIN_TFT_RST);
+#else
   tft = new Adafruit_ST7789(spi, PIN_TFT_CS, PIN_TFT_DC, PIN_TFT_RST);
+#endif
   Display.Begin(tft);
   ESP_LOGI(TAG, "HeapSize : %d", ESP.getHeapSize());
   ESP_LOGI(TAG, "HeapFree : %d", ESP.getFreeHeap());
+  Boot.EndPhase(phase);
 
   // Show reset reason if not a normal power on reset
   if (!resetReason.equals("POWERON_RESET"))
   {
     // Debug reset information on display
-    Display.DrawInfoBox("Warning", resetReason);
+    Display.DrawInfoBox("Warning", resetReason.c_str());
     ESP_LOGE(TAG, "Warning: Unnormal reset reason");
     delay(3000);
   }
 
-  // Initialize SPIFFS
-  ESP_LOGI(TAG, "Initialize SPIFFS");
-  SPIFFS.end(); // Close first for begin with 'formatOnFail'
-  if (!SPIFFS.begin(true))
+  // Initialize file system (Migrates SPIFFS files on the first boot)
+  ESP_LOGI(TAG, "Initialize file system");
+  phase = Boot.BeginPhase("filesystem");
+  bool isFileSystemMounted = FileSystem.Begin();
+  Boot.EndPhase(phase, isFileSystemMounted);
+  if (!isFileSystemMounted)
   {
     // Debug information on display
-    Display.DrawInfoBox("Error", "Open SPIFFS failed!");
-    ESP_LOGE(TAG, "Error: Open SPIFFS failed");
+    Display.DrawInfoBox("Error", "Open file system failed!");
+    ESP_LOGE(TAG, "Error: Open file system failed");
     delay(3000);
   }
-
-  // Loading config file
-  ESP_LOGI(TAG, "Loading config file");
-  if (!Config.Begin())
+  else if (FileSystem.IsMigrationFailed())
   {
-    // Reset Config
-    Config.ResetConfig();
-
     // Debug information on display
-    Display.DrawInfoBox("Error", "Load config failed!");
-    ESP_LOGE(TAG, "Error: Load config failed");
+    Display.DrawInfoBox("Error", "File migration failed!");
+    ESP_LOGE(TAG, "Error: File migration failed");
     delay(3000);
   }
-  ESP_LOGI(TAG, "HeapSize : %d", ESP.getHeapSize());
-  ESP_LOGI(TAG, "HeapFree : %d", ESP.getFreeHeap());
+  else if (FileSystem.GetMigratedCount() > 0)
+  {
+    // Debug information on display
+    Display.DrawInfoBox("Info", (String(FileSystem.GetMigratedCount()) + " files migrated").c_str());
+    delay(1500);
+  }
+
+  // Map built-in assets (Optional, images fall back to SPIFFS)
+  ESP_LOGI(TAG, "Map asset partition");
+  phase = Boot.BeginPhase("assets");
+  Boot.EndPhase(phase, Assets.Begin());
 
   // Check if PSRAM available
   if (ESP.getPsramSize() == 0)
@@ -237,65 +334,80 @@ void setup(void)
     delay(3000);
   }
 
-  // Loading images from SPIFFS
-  ESP_LOGI(TAG, "Loading images from SPIFFS");
-  Display.LoadImages();
-  ESP_LOGI(TAG, "HeapSize : %d", ESP.getHeapSize());
-  ESP_LOGI(TAG, "HeapFree : %d", ESP.getFreeHeap());
-  
-  // Show intro page
-  ESP_LOGI(TAG, "Show intro page");
-  Display.ShowIntroPage();
-  uint32_t startupTime_ms = millis();
+  // Get VCC voltage (Only for Custom PCB)
+  vccVoltage = analogReadMilliVolts(PIN_VCC) * VCC_CONVERSION_FACTOR;
+  ESP_LOGI(TAG, "Get VCC voltage: %0.2f", vccVoltage);
 
-  // Initialize GPIOs
-  ESP_LOGI(TAG, "Initialize GPIOs");
-  pinMode(PIN_PUMPS_ENABLE, INPUT_PULLUP);
-  pinMode(PIN_PUMPS_ENABLE_GND, OUTPUT);
-  pinMode(PIN_LEDLIGHT, OUTPUT);
-  pinMode(PIN_LEDSTATUS, OUTPUT);
-  pinMode(PIN_BUZZER, OUTPUT);
-  pinMode(PIN_VCC, INPUT);
+  // Start concurrent boot tasks (The display is only used by this task)
+  int8_t themeTask = Boot.StartTask("theme", BootTaskTheme);
+  int8_t settingsTask = Boot.StartTask("settings", BootTaskSettings, 4096);
+  int8_t wifiTask = Boot.StartTask("wifi", BootTaskWifi);
 
-  // Initialize outputs
-  ESP_LOGI(TAG, "Initialize outputs");
-  digitalWrite(PIN_PUMPS_ENABLE_GND, LOW); // Fixed GND value (0V, LOW)
-  digitalWrite(PIN_LEDLIGHT, LOW);
-  digitalWrite(PIN_LEDSTATUS, LOW);
-  digitalWrite(PIN_BUZZER, LOW);
+  // Initialize encoder button
+  ESP_LOGI(TAG, "Initialize encoder button");
+  EncoderButton.Begin(PIN_ENCODER_OUTA, PIN_ENCODER_OUTB, PIN_ENCODER_BUTTON);
+  attachInterrupt(digitalPinToInterrupt(PIN_ENCODER_OUTA), ISR_EncoderA, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(PIN_ENCODER_OUTB), ISR_EncoderB, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(PIN_ENCODER_BUTTON), ISR_EncoderButton, CHANGE);
 
-  // Play startup sound
+  // Play startup sound (Boot tasks run meanwhile)
+  phase = Boot.BeginPhase("sound");
 	for (uint8_t index = 1; index <= 8; index++)
 	{
     tone(PIN_BUZZER, index * 100, 65);
     delay(85);
   }
+  Boot.EndPhase(phase);
 
-  // Initialize encoder button
-  ESP_LOGI(TAG, "Initialize encoder button");
-  EncoderButton.Begin(PIN_ENCODER_OUTA, PIN_ENCODER_OUTB, PIN_ENCODER_BUTTON);
-  attachInterrupt(digitalPinToInterrupt(PIN_ENCODER_OUTA), ISR_EncoderA, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(PIN_ENCODER_OUTB), ISR_EncoderB, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(PIN_ENCODER_BUTTON), ISR_EncoderButton, CHANGE);
+  // Wait for configuration and images
+  if (!Boot.Wait(themeTask))
+  {
+    // Debug information on display
+    Display.DrawInfoBox("Error", "Load config failed!");
+    ESP_LOGE(TAG, "Error: Load config failed");
+    delay(3000);
+  }
+  ESP_LOGI(TAG, "HeapSize : %d", ESP.getHeapSize());
+  ESP_LOGI(TAG, "HeapFree : %d", ESP.getFreeHeap());
 
-  // Initialize flow values from EEPROM
-  ESP_LOGI(TAG, "Initialize flow values from EEPROM");
-  FlowMeter.Load();
+  // Show intro page
+  ESP_LOGI(TAG, "Show intro page");
+  phase = Boot.BeginPhase("intro");
+  Display.ShowIntroPage();
+  uint32_t startupTime_ms = millis();
 
-  // Get VCC voltage (Only for Custom PCB)
-  double vccVoltage = analogReadMilliVolts(PIN_VCC) * VCC_CONVERSION_FACTOR;
-  ESP_LOGI(TAG, "Get VCC voltage: %0.2f", vccVoltage);
-  
-  // Initialize pump driver
-  ESP_LOGI(TAG, "Initialize pump driver");
-  Pumps.Begin(PIN_PUMP_1, PIN_PUMP_2, PIN_PUMP_3, vccVoltage);
+  // Wait for the remaining boot tasks
+  Boot.Wait(settingsTask);
+  Boot.Wait(wifiTask);
 
-  // Initialize state machine
+  // Initialize state machine (Needs the configuration and the pump settings)
   ESP_LOGI(TAG, "Initialize state machine");
   Statemachine.Begin(PIN_BUZZER);
+
+  // Start theme prefetch task (Settings page switches themes in background)
+  ThemeSwitch.Begin();
+
+  // Start web server (Publishes and uploads only after all boot tasks are finished)
+  ESP_LOGI(TAG, "Start web server");
+  Wifihandler.EnableWebServer();
+
+#if BENCHMARK_ON_BOOT
+  // Run on-device benchmarks (Help page will redraw the screen afterwards)
+  ESP_LOGI(TAG, "Run benchmarks");
+  Benchmark.Begin((CountingST7789*)tft);
+  Benchmark.RunAll();
+#endif
   
   // Wait for the rest of the intro time
-  while ((millis() - startupTime_ms) < INTRO_TIME_MS) { };
+  while ((millis() - startupTime_ms) < INTRO_TIME_MS)
+  {
+    // Contains yield() for ESP32
+    delay(1);
+  }
+  Boot.EndPhase(phase);
+
+  // Print boot timing report (Only user interaction is left)
+  Boot.Finish();
 
   // Allow interrupts for encoder button
   sei();
@@ -326,10 +438,6 @@ void setup(void)
     delay(1);
   }
 
-  // Initialize wifi
-  ESP_LOGI(TAG, "Initialize wifi");
-  Wifihandler.Begin();
-
   // Initial run of state machine with entry event
   ESP_LOGI(TAG, "Initial run of state machine");
   Statemachine.Execute(eEntry);
@@ -347,6 +455,9 @@ void setup(void)
 //===============================================================
 void loop()
 {
+  // Measure loop time
+  Systemhelper.UpdateLoopTime();
+
   // Show debug alive message
   if ((millis() - aliveTimestampLoop) > AliveTime_ms)
   {
@@ -354,13 +465,16 @@ void loop()
     ESP_LOGI(TAG, "Loop Alive");
     
     // Print mixture information
-    ESP_LOGI(TAG, "%s", Statemachine.GetMixtureString().c_str());
+    ESP_LOGI(TAG, "%s", Statemachine.GetMixtureString());
     
     // Print memory information
     ESP_LOGI(TAG, "%s", Systemhelper.GetMemoryInfoString().c_str());
 
-    // Save flow meter values to flash
-    FlowMeter.Save();
+    // Save flow meter values to flash (Not while pouring, NVS compacts pages inside writes)
+    if (!Pumps.IsEnabled())
+    {
+      FlowMeter.Save();
+    }
 
     // Toggle status LED
     digitalWrite(PIN_LEDSTATUS, !digitalRead(PIN_LEDSTATUS));
@@ -375,8 +489,11 @@ void loop()
   // Run statemachine with main task event
   Statemachine.Execute(eMain);
 
-  // Update wifi, webserver and clients
+  // Execute web commands and publish values for the web server
   Wifihandler.Update();
+
+  // Run file system maintenance while idle
+  Maintenance.Update();
 }
 
 //===============================================================
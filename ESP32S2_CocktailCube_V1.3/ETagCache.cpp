@@ -0,0 +1,74 @@
+/*
+ * Includes the cache of file checksums for ETags
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "ETagCache.h"
+
+//===============================================================
+// Constructor
+//===============================================================
+ETagCache::ETagCache()
+{
+  memset(_entries, 0, sizeof(_entries));
+}
+
+//===============================================================
+// Returns the checksum of the sent bytes. SPIFFS files are read
+// once and checked again after a change of length or write time
+//===============================================================
+uint32_t ETagCache::GetCrc(const char* path, bool asset, File* file, const uint8_t* data, uint32_t length)
+{
+  time_t lastWrite = file ? file->getLastWrite() : 0;
+  for (uint8_t index = 0; index < ETAGCACHE_ENTRIES; index++)
+  {
+    ETagEntry& entry = _entries[index];
+    if (entry.asset == asset &&
+      entry.length == length &&
+      entry.lastWrite == lastWrite &&
+      strcmp(entry.path, path) == 0)
+    {
+      return entry.crc;
+    }
+  }
+
+  uint32_t crc = 0;
+  if (file)
+  {
+    uint8_t buffer[ETAGCACHE_READBUFFER];
+    size_t read = 0;
+    while ((read = file->read(buffer, sizeof(buffer))) > 0)
+    {
+      crc = esp_rom_crc32_le(crc, buffer, read);
+    }
+    file->seek(0);
+  }
+  else
+  {
+    crc = esp_rom_crc32_le(crc, data, length);
+  }
+
+  // Replace the oldest entry
+  ETagEntry& entry = _entries[_nextEntry];
+  _nextEntry = (_nextEntry + 1) % ETAGCACHE_ENTRIES;
+  strlcpy(entry.path, path, sizeof(entry.path));
+  entry.asset = asset;
+  entry.length = length;
+  entry.lastWrite = lastWrite;
+  entry.crc = crc;
+  return crc;
+}
+
+//===============================================================
+// Writes the ETag of a checksum and length
+//===============================================================
+void ETagCache::Format(char* etag, size_t size, uint32_t crc, uint32_t length, bool weak)
+{
+  snprintf(etag, size, "%s\"%08lx-%lx\"", weak ? "W/" : "", (unsigned long)crc, (unsigned long)length);
+}
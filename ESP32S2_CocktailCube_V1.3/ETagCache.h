@@ -0,0 +1,61 @@
+/*
+ * Includes the cache of file checksums for ETags
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ETAGCACHE_H
+#define ETAGCACHE_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <FS.h>
+#include <esp_rom_crc.h>
+
+//===============================================================
+// Defines
+//===============================================================
+#define ETAGCACHE_MAXPATH           36          // SPIFFS object name with '.gz' extension
+#define ETAGCACHE_ENTRIES           16
+#define ETAGCACHE_READBUFFER        512
+#define ETAGCACHE_LENGTH            24          // Weak prefix, quoted checksum and length
+
+//===============================================================
+// ETag cache class
+// Strong ETags are built from the CRC32 and the length of the
+// sent bytes. SPIFFS files are read once and only read again
+// after a change of length or write time. Only used by the task
+// of the TCP stack, so no locks are needed
+//===============================================================
+class ETagCache
+{
+  public:
+    // Constructor
+    ETagCache();
+
+    // Returns the checksum of the sent bytes (File or mapped data)
+    uint32_t GetCrc(const char* path, bool asset, File* file, const uint8_t* data, uint32_t length);
+
+    // Writes the ETag of a checksum and length (Weak ETags only identify the content roughly)
+    static void Format(char* etag, size_t size, uint32_t crc, uint32_t length, bool weak = false);
+
+  private:
+    // Cached checksum of a file
+    struct ETagEntry
+    {
+      char path[ETAGCACHE_MAXPATH];
+      bool asset;
+      uint32_t length;
+      time_t lastWrite;
+      uint32_t crc;
+    };
+
+    ETagEntry _entries[ETAGCACHE_ENTRIES];
+    uint8_t _nextEntry = 0;
+};
+
+#endif
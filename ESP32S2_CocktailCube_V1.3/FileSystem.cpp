@@ -0,0 +1,395 @@
+/*
+ * Includes the file system of the user files
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include <esp_rom_crc.h>
+#include "FileSystem.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "filesystem";
+
+// Web page files of former firmwares, replaced by the bundled page (See 'WebUI.h')
+static const struct
+{
+  const char* path;
+  size_t length;
+  uint32_t crc;
+} StockWebFiles[] =
+{
+  { "/index.html", 7073, 0xB9004AD8 },
+  { "/index.css", 1774, 0x0723A75C },
+  { "/index.js", 12515, 0x11B81325 },
+  { "/index.js", 15110, 0x7DB06724 },
+  { "/index.js", 15886, 0xEDC495FA },
+  { "/draggableDoughnutChart.js", 20509, 0xB70B760B }
+};
+
+//===============================================================
+// Defines (Same mount points as the Arduino defaults)
+//===============================================================
+#define SPIFFS_BASEPATH             "/spiffs"
+#define LITTLEFS_BASEPATH           "/littlefs"
+
+//===============================================================
+// Global variables
+//===============================================================
+FileSystemHandler FileSystem;
+
+//===============================================================
+// Constructor
+//===============================================================
+FileSystemHandler::FileSystemHandler() :
+  FS(fs::FSImplPtr(new VFSImpl()))
+{
+}
+
+//===============================================================
+// Mounts the file system (Migrates or formats if needed)
+//===============================================================
+bool FileSystemHandler::Begin()
+{
+  End();
+  _migratedCount = 0;
+  _migrationFailed = false;
+
+#if FILESYSTEM_USE_LITTLEFS
+  if (LittleFS.begin(false, LITTLEFS_BASEPATH, FILESYSTEM_MAXOPENFILES, FILESYSTEM_PARTITIONLABEL))
+  {
+    Mount(eFileSystemLittleFS);
+    return true;
+  }
+
+  // Not formatted with LittleFS, check for files of a former firmware
+  if (SPIFFS.begin(false, SPIFFS_BASEPATH, FILESYSTEM_MAXOPENFILES, FILESYSTEM_PARTITIONLABEL))
+  {
+    ESP_LOGI(TAG, "SPIFFS found, migrate to LittleFS");
+    FileSystemType type = Migrate();
+    if (type != eFileSystemNone)
+    {
+      Mount(type);
+      return true;
+    }
+  }
+
+  // Neither readable, start empty
+  ESP_LOGI(TAG, "Format with LittleFS");
+  if (LittleFS.begin(true, LITTLEFS_BASEPATH, FILESYSTEM_MAXOPENFILES, FILESYSTEM_PARTITIONLABEL))
+  {
+    Mount(eFileSystemLittleFS);
+    return true;
+  }
+#else
+  if (SPIFFS.begin(true, SPIFFS_BASEPATH, FILESYSTEM_MAXOPENFILES, FILESYSTEM_PARTITIONLABEL))
+  {
+    Mount(eFileSystemSPIFFS);
+    return true;
+  }
+#endif
+
+  ESP_LOGE(TAG, "Mount failed");
+  return false;
+}
+
+//===============================================================
+// Unmounts the file system
+//===============================================================
+void FileSystemHandler::End()
+{
+  if (_type == eFileSystemLittleFS)
+  {
+    LittleFS.end();
+  }
+  else if (_type == eFileSystemSPIFFS)
+  {
+    SPIFFS.end();
+  }
+  _impl->mountpoint(NULL);
+  _type = eFileSystemNone;
+}
+
+//===============================================================
+// Formats the partition with the default file system
+//===============================================================
+bool FileSystemHandler::Format()
+{
+  End();
+#if FILESYSTEM_USE_LITTLEFS
+  // Also replaces a kept SPIFFS
+  return LittleFS.format();
+#else
+  return SPIFFS.format();
+#endif
+}
+
+//===============================================================
+// Returns the name of the mounted file system
+//===============================================================
+const char* FileSystemHandler::GetName() const
+{
+  switch (_type)
+  {
+    case eFileSystemSPIFFS:
+      return "SPIFFS";
+    case eFileSystemLittleFS:
+      return "LittleFS";
+    default:
+      return "None";
+  }
+}
+
+//===============================================================
+// Renames a file onto an existing file. LittleFS replaces the
+// target in one step. SPIFFS does not rename onto existing files,
+// so the target is kept as backup until the new file is in place
+// and restored if the rename fails
+//===============================================================
+bool FileSystemHandler::Replace(const char* fromPath, const char* toPath, const char* backupPath)
+{
+  if (_type == eFileSystemLittleFS ||
+    !exists(toPath))
+  {
+    return rename(fromPath, toPath);
+  }
+
+  if (exists(backupPath))
+  {
+    remove(backupPath);
+  }
+  if (!rename(toPath, backupPath))
+  {
+    ESP_LOGE(TAG, "Could not back up '%s'", toPath);
+    return false;
+  }
+  if (!rename(fromPath, toPath))
+  {
+    ESP_LOGE(TAG, "Could not rename '%s' to '%s'", fromPath, toPath);
+    if (!rename(backupPath, toPath))
+    {
+      ESP_LOGE(TAG, "Could not restore '%s' from '%s'", toPath, backupPath);
+    }
+    return false;
+  }
+  remove(backupPath);
+  return true;
+}
+
+//===============================================================
+// Returns the size of the file system
+//===============================================================
+size_t FileSystemHandler::TotalBytes()
+{
+  switch (_type)
+  {
+    case eFileSystemSPIFFS:
+      return SPIFFS.totalBytes();
+    case eFileSystemLittleFS:
+      return LittleFS.totalBytes();
+    default:
+      return 0;
+  }
+}
+
+//===============================================================
+// Returns the used bytes of the file system
+//===============================================================
+size_t FileSystemHandler::UsedBytes()
+{
+  switch (_type)
+  {
+    case eFileSystemSPIFFS:
+      return SPIFFS.usedBytes();
+    case eFileSystemLittleFS:
+      return LittleFS.usedBytes();
+    default:
+      return 0;
+  }
+}
+
+//===============================================================
+// Sets the mount point of the mounted file system. Both register
+// a VFS at their base path, so this 'fs::FS' only has to point
+// its own VFS implementation there
+//===============================================================
+void FileSystemHandler::Mount(FileSystemType type)
+{
+  _type = type;
+  _impl->mountpoint(type == eFileSystemSPIFFS ? SPIFFS_BASEPATH : LITTLEFS_BASEPATH);
+  ESP_LOGI(TAG, "Mounted %s (%d / %d Bytes)", GetName(), UsedBytes(), TotalBytes());
+}
+
+//===============================================================
+// Copies all SPIFFS files onto the LittleFS formatted partition.
+// Both use the same partition, so all files are read into PSRAM
+// before formatting. Returns the file system left mounted
+//===============================================================
+FileSystemType FileSystemHandler::Migrate()
+{
+  // Count files first, nothing is changed if they do not fit
+  uint16_t count = 0;
+  size_t totalLength = 0;
+  size_t requiredBlocks = FILESYSTEM_RESERVEBLOCKS;
+  File root = SPIFFS.open("/");
+  File entry = root ? root.openNextFile() : File();
+  while (entry)
+  {
+    count++;
+    totalLength += entry.size();
+
+    // Data blocks and one metadata block per file (Small files are inlined, so this is an upper bound)
+    requiredBlocks += (entry.size() + FILESYSTEM_BLOCKSIZE - 1) / FILESYSTEM_BLOCKSIZE + 1;
+    entry = root.openNextFile();
+  }
+  root.close();
+
+  const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, FILESYSTEM_PARTITIONLABEL);
+  size_t availableBlocks = partition ? partition->size / FILESYSTEM_BLOCKSIZE : 0;
+  if (requiredBlocks > availableBlocks)
+  {
+    ESP_LOGE(TAG, "%d files need %d of %d LittleFS blocks, keep SPIFFS", count, requiredBlocks, availableBlocks);
+    return eFileSystemSPIFFS;
+  }
+
+  size_t requiredLength = totalLength + count * sizeof(MigrationEntry) + FILESYSTEM_MIGRATIONRESERVE;
+  if (requiredLength > ESP.getFreePsram())
+  {
+    ESP_LOGE(TAG, "Not enough PSRAM for %d files (%d Bytes), keep SPIFFS", count, totalLength);
+    return eFileSystemSPIFFS;
+  }
+
+  MigrationEntry* entries = (MigrationEntry*)ps_calloc(max(count, (uint16_t)1), sizeof(MigrationEntry));
+  if (!entries)
+  {
+    return eFileSystemSPIFFS;
+  }
+
+  // Read all files
+  bool success = true;
+  uint16_t readCount = 0;
+  root = SPIFFS.open("/");
+  entry = root ? root.openNextFile() : File();
+  while (entry &&
+    readCount < count)
+  {
+    MigrationEntry* migrationEntry = &entries[readCount++];
+    strlcpy(migrationEntry->path, entry.path(), sizeof(migrationEntry->path));
+    migrationEntry->length = entry.size();
+    migrationEntry->data = (uint8_t*)ps_malloc(max(migrationEntry->length, (size_t)1));
+    if (!migrationEntry->data ||
+      entry.read(migrationEntry->data, migrationEntry->length) != migrationEntry->length)
+    {
+      ESP_LOGE(TAG, "Could not read '%s'", migrationEntry->path);
+      success = false;
+      break;
+    }
+
+    // Unchanged web page files of a former firmware would be served instead of the bundled page
+    if (IsStockWebFile(migrationEntry))
+    {
+      ESP_LOGI(TAG, "Remove former web page file '%s'", migrationEntry->path);
+      free(migrationEntry->data);
+      migrationEntry->data = NULL;
+      readCount--;
+    }
+    entry = root.openNextFile();
+  }
+  entry.close();
+  root.close();
+
+  FileSystemType type = eFileSystemSPIFFS;
+  if (success)
+  {
+    // From here on the files are only kept in PSRAM
+    uint32_t startTime_ms = millis();
+    SPIFFS.end();
+    if (LittleFS.begin(true, LITTLEFS_BASEPATH, FILESYSTEM_MAXOPENFILES, FILESYSTEM_PARTITIONLABEL))
+    {
+      type = eFileSystemLittleFS;
+      _migratedCount = WriteEntries(LittleFS, entries, readCount);
+      _migrationFailed = _migratedCount < readCount;
+      if (_migrationFailed)
+      {
+        ESP_LOGE(TAG, "%d of %d files migrated", _migratedCount, readCount);
+      }
+      else
+      {
+        ESP_LOGI(TAG, "Migrated %d files in %d ms", _migratedCount, millis() - startTime_ms);
+      }
+    }
+    // The failed format may have erased a part of the partition, so format with SPIFFS again and restore the files
+    else if (SPIFFS.begin(true, SPIFFS_BASEPATH, FILESYSTEM_MAXOPENFILES, FILESYSTEM_PARTITIONLABEL) &&
+      SPIFFS.format())
+    {
+      type = eFileSystemSPIFFS;
+      uint16_t restoredCount = WriteEntries(SPIFFS, entries, readCount);
+      _migrationFailed = restoredCount < readCount;
+      ESP_LOGE(TAG, "LittleFS format failed, keep SPIFFS (%d of %d files restored)", restoredCount, readCount);
+    }
+    else
+    {
+      ESP_LOGE(TAG, "LittleFS format failed, could not restore SPIFFS");
+      type = eFileSystemNone;
+    }
+  }
+
+  for (uint16_t index = 0; index < readCount; index++)
+  {
+    free(entries[index].data);
+  }
+  free(entries);
+  return type;
+}
+
+//===============================================================
+// Writes the migrated files onto a mounted file system. Continues
+// after a failed file, so only this file is lost, and returns the
+// number of written files
+//===============================================================
+uint16_t FileSystemHandler::WriteEntries(fs::FS& fileSystem, const MigrationEntry* entries, uint16_t count)
+{
+  uint16_t writtenCount = 0;
+  for (uint16_t index = 0; index < count; index++)
+  {
+    File file = fileSystem.open(entries[index].path, FILE_WRITE);
+    bool written = file &&
+      file.write(entries[index].data, entries[index].length) == entries[index].length;
+    file.close();
+    if (written)
+    {
+      writtenCount++;
+    }
+    else
+    {
+      // Remove the broken file, smaller files may still fit
+      ESP_LOGE(TAG, "Could not write '%s' (%d Bytes)", entries[index].path, entries[index].length);
+      fileSystem.remove(entries[index].path);
+    }
+  }
+  return writtenCount;
+}
+
+//===============================================================
+// Returns true if a file is an unchanged web page file of a
+// former firmware (Same path, length and CRC)
+//===============================================================
+bool FileSystemHandler::IsStockWebFile(const MigrationEntry* entry)
+{
+  for (uint8_t index = 0; index < sizeof(StockWebFiles) / sizeof(StockWebFiles[0]); index++)
+  {
+    if (strcmp(entry->path, StockWebFiles[index].path) == 0 &&
+      entry->length == StockWebFiles[index].length &&
+      esp_rom_crc32_le(0, entry->data, entry->length) == StockWebFiles[index].crc)
+    {
+      return true;
+    }
+  }
+  return false;
+}
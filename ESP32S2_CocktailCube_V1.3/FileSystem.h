@@ -0,0 +1,126 @@
+/*
+ * Includes the file system of the user files
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef FILESYSTEM_H
+#define FILESYSTEM_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <FS.h>
+#include <vfs_api.h>
+#include <SPIFFS.h>
+#include <LittleFS.h>
+#include <esp_partition.h>
+#include <esp_log.h>
+
+//===============================================================
+// Defines
+//===============================================================
+#define FILESYSTEM_USE_LITTLEFS     1           // 0: SPIFFS only (Former file system, e.g. for comparisons)
+#define FILESYSTEM_PARTITIONLABEL   "spiffs"    // Shared by both file systems (See 'partitions.csv')
+#define FILESYSTEM_MAXOPENFILES     10
+#define FILESYSTEM_MAXPATH          32          // Same as SPIFFS object names
+#define FILESYSTEM_MIGRATIONRESERVE 65536       // PSRAM left free while migrating
+#define FILESYSTEM_BLOCKSIZE        4096        // LittleFS block (One flash sector)
+#define FILESYSTEM_RESERVEBLOCKS    4           // LittleFS blocks of the superblock and the root directory
+
+//===============================================================
+// Enums
+//===============================================================
+enum FileSystemType : uint8_t
+{
+  eFileSystemNone = 0,
+  eFileSystemSPIFFS = 1,
+  eFileSystemLittleFS = 2
+};
+
+//===============================================================
+// Class for the file system of the user files
+// All modules use this instead of 'SPIFFS' or 'LittleFS'. It is
+// a 'fs::FS' on the mount point of the active file system, so it
+// is passed wherever a file system is expected. LittleFS is used
+// by default. If the partition still holds SPIFFS files of a
+// former firmware, they are copied into PSRAM, the partition is
+// formatted with LittleFS and the files are written back (Once on
+// the first boot). If the files do not fit into PSRAM or into the
+// LittleFS blocks of the partition, SPIFFS is kept and the
+// migration is tried again on the next boot
+//===============================================================
+class FileSystemHandler : public fs::FS
+{
+  public:
+    // Constructor
+    FileSystemHandler();
+
+    // Mounts the file system (Migrates or formats if needed)
+    bool Begin();
+
+    // Unmounts the file system
+    void End();
+
+    // Formats the partition with the default file system (Unmounted after)
+    bool Format();
+
+    // Returns true if a file system is mounted
+    bool IsMounted() const { return _type != eFileSystemNone; }
+
+    // Returns the type of the mounted file system
+    FileSystemType GetType() const { return _type; }
+
+    // Returns the name of the mounted file system
+    const char* GetName() const;
+
+    // Returns the amount of files migrated from SPIFFS on this boot
+    uint16_t GetMigratedCount() const { return _migratedCount; }
+
+    // Returns true if files could not be written back on this boot
+    bool IsMigrationFailed() const { return _migrationFailed; }
+
+    // Renames a file onto an existing file, the backup path is only used on SPIFFS
+    bool Replace(const char* fromPath, const char* toPath, const char* backupPath);
+
+    // Returns the size of the file system
+    size_t TotalBytes();
+
+    // Returns the used bytes of the file system
+    size_t UsedBytes();
+
+  private:
+    // File copied into PSRAM while migrating
+    struct MigrationEntry
+    {
+      char path[FILESYSTEM_MAXPATH];
+      uint8_t* data;
+      size_t length;
+    };
+
+    FileSystemType _type = eFileSystemNone;
+    uint16_t _migratedCount = 0;
+    bool _migrationFailed = false;
+
+    // Sets the mount point of the mounted file system
+    void Mount(FileSystemType type);
+
+    // Copies all SPIFFS files onto the LittleFS formatted partition, returns the mounted file system
+    FileSystemType Migrate();
+
+    // Writes the migrated files onto a mounted file system, returns the number of written files
+    static uint16_t WriteEntries(fs::FS& fileSystem, const MigrationEntry* entries, uint16_t count);
+
+    // Returns true if a file is an unchanged web page file of a former firmware
+    static bool IsStockWebFile(const MigrationEntry* entry);
+};
+
+//===============================================================
+// Global variables
+//===============================================================
+extern FileSystemHandler FileSystem;
+
+#endif
@@ -0,0 +1,400 @@
+/*
+ * Includes a pre-rendered glyph cache for opaque text drawing
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "GlyphCache.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "glyphs";
+
+// The font does not contain a degree sign, so a small ring is added (5x5px)
+static const uint8_t DegreeBitmap[] = { 0x74, 0x63, 0x17, 0x00 };
+static const GFXglyph DegreeGlyph = { 0, 5, 5, 7, 1, -13 };
+
+//===============================================================
+// Constructor
+//===============================================================
+GlyphCache::GlyphCache()
+{
+}
+
+//===============================================================
+// Destructor
+//===============================================================
+GlyphCache::~GlyphCache()
+{
+  Clear();
+
+  if (_fieldBuffer)
+  {
+    free(_fieldBuffer);
+    _fieldBuffer = NULL;
+  }
+}
+
+//===============================================================
+// Initializes the glyph cache for a font
+//===============================================================
+bool GlyphCache::Begin(const GFXfont* font)
+{
+  // Font must contain all printable ASCII characters
+  if (!font ||
+    font->first > GLYPHCACHE_FIRSTCHAR ||
+    font->last < GLYPHCACHE_LASTCHAR)
+  {
+    ESP_LOGE(TAG, "Font does not contain all printable characters");
+    return false;
+  }
+
+  Clear();
+  _font = font;
+
+  // Calculate glyph offsets and font ascent/descent
+  _ascent = 0;
+  _descent = 0;
+  _atlasSize = 0;
+  for (uint8_t glyphIndex = 0; glyphIndex < GLYPHCACHE_GLYPHCOUNT; glyphIndex++)
+  {
+    const GFXglyph* glyph = GetGlyph(glyphIndex);
+    _glyphOffsets[glyphIndex] = _atlasSize;
+    _atlasSize += glyph->width * glyph->height;
+    _ascent = max(_ascent, (int16_t)-glyph->yOffset);
+    _descent = max(_descent, (int16_t)(glyph->yOffset + glyph->height));
+  }
+
+  // Allocate buffer for composing text fields (Internal RAM for fast SPI transfers)
+  if (_fieldBuffer)
+  {
+    free(_fieldBuffer);
+  }
+  _fieldBuffer = (uint16_t*)malloc(GLYPHCACHE_MAXWIDTH * FieldHeight() * sizeof(uint16_t));
+  if (!_fieldBuffer)
+  {
+    ESP_LOGE(TAG, "Could not allocate text field buffer");
+    return false;
+  }
+
+  ESP_LOGI(TAG, "Glyph cache initialized (Atlas: %d Bytes, Field height: %d px)", _atlasSize * sizeof(uint16_t), FieldHeight());
+  return true;
+}
+
+//===============================================================
+// Frees all pre-rendered atlases (e.g. after a theme change)
+//===============================================================
+void GlyphCache::Clear()
+{
+  for (uint8_t index = 0; index < GLYPHCACHE_SLOTS; index++)
+  {
+    if (_atlases[index].pixels)
+    {
+      free(_atlases[index].pixels);
+    }
+    _atlases[index] = Atlas();
+  }
+}
+
+//===============================================================
+// Calculates the bounds of a text like Adafruit_GFX::getTextBounds
+//===============================================================
+void GlyphCache::GetTextBounds(const char* text, uint16_t* width, uint16_t* height)
+{
+  int16_t cursorX = 0;
+  int16_t minX = 0x7FFF;
+  int16_t minY = 0x7FFF;
+  int16_t maxX = -1;
+  int16_t maxY = -1;
+
+  *width = 0;
+  *height = 0;
+
+  if (!_font || !text)
+  {
+    return;
+  }
+
+  int16_t glyphIndex;
+  while ((glyphIndex = NextGlyphIndex(&text)) >= 0)
+  {
+    const GFXglyph* glyph = GetGlyph(glyphIndex);
+    int16_t x1 = cursorX + glyph->xOffset;
+    int16_t y1 = glyph->yOffset;
+    int16_t x2 = x1 + glyph->width - 1;
+    int16_t y2 = y1 + glyph->height - 1;
+    minX = min(minX, x1);
+    minY = min(minY, y1);
+    maxX = max(maxX, x2);
+    maxY = max(maxY, y2);
+    cursorX += glyph->xAdvance;
+  }
+
+  if (maxX >= minX)
+  {
+    *width = maxX - minX + 1;
+  }
+  if (maxY >= minY)
+  {
+    *height = maxY - minY + 1;
+  }
+}
+
+//===============================================================
+// Draws a text as a single opaque blit into a field with fixed
+// width. The whole field is written, so no clear is necessary
+//===============================================================
+void GlyphCache::DrawText(Adafruit_SPITFT* tft, int16_t x, int16_t y, const char* text, uint16_t color, uint16_t backgroundColor, int16_t fieldWidth, GlyphAlign align)
+{
+  if (!tft || !_font || !_fieldBuffer || !text)
+  {
+    return;
+  }
+
+  int16_t fieldHeight = FieldHeight();
+  fieldWidth = min(fieldWidth, (int16_t)GLYPHCACHE_MAXWIDTH);
+  if (fieldWidth <= 0)
+  {
+    return;
+  }
+
+  // Calculate text width for alignment
+  int16_t textWidth = 0;
+  const char* pointer = text;
+  int16_t glyphIndex;
+  while ((glyphIndex = NextGlyphIndex(&pointer)) >= 0)
+  {
+    textWidth += GetGlyph(glyphIndex)->xAdvance;
+  }
+
+  int16_t cursorX = 0;
+  if (align == eAlignCenter)
+  {
+    cursorX = (fieldWidth - textWidth) / 2;
+  }
+  else if (align == eAlignRight)
+  {
+    cursorX = fieldWidth - textWidth;
+  }
+
+  // Fill field with background color
+  uint32_t fieldSize = fieldWidth * fieldHeight;
+  for (uint32_t index = 0; index < fieldSize; index++)
+  {
+    _fieldBuffer[index] = backgroundColor;
+  }
+
+  // Copy pre-rendered glyphs into the field (Fallback to font bitmap without atlas)
+  Atlas* atlas = GetAtlas(color, backgroundColor);
+  int16_t drawnRight = 0;
+  pointer = text;
+  while ((glyphIndex = NextGlyphIndex(&pointer)) >= 0)
+  {
+    const GFXglyph* glyph = GetGlyph(glyphIndex);
+    const uint16_t* glyphPixels = atlas ? atlas->pixels + _glyphOffsets[glyphIndex] : NULL;
+    const uint8_t* bitmap = GetBitmap(glyphIndex);
+    uint16_t bitIndex = 0;
+
+    int16_t x0 = cursorX + glyph->xOffset;
+    int16_t y0 = _ascent + glyph->yOffset;
+    int16_t x1 = min((int16_t)(x0 + glyph->width), fieldWidth);
+
+    // Atlas rows are opaque, so they are copied at once if the glyph does not overlap the previous one
+    if (glyphPixels &&
+      x0 >= drawnRight)
+    {
+      for (int16_t yy = max(0, -y0); yy < glyph->height && y0 + yy < fieldHeight && x1 > x0; yy++)
+      {
+        memcpy(&_fieldBuffer[(y0 + yy) * fieldWidth + x0], &glyphPixels[yy * glyph->width], (x1 - x0) * sizeof(uint16_t));
+      }
+    }
+    else
+    {
+      // Overlapping or clipped on the left, only foreground pixels are written
+      for (int16_t yy = 0; yy < glyph->height; yy++)
+      {
+        for (int16_t xx = 0; xx < glyph->width; xx++, bitIndex++)
+        {
+          int16_t xField = x0 + xx;
+          int16_t yField = y0 + yy;
+          if (xField < 0 || xField >= fieldWidth || yField < 0 || yField >= fieldHeight)
+          {
+            continue;
+          }
+
+          if (glyphPixels)
+          {
+            uint16_t pixel = glyphPixels[bitIndex];
+            if (pixel != backgroundColor)
+            {
+              _fieldBuffer[yField * fieldWidth + xField] = pixel;
+            }
+          }
+          else if (bitmap[bitIndex >> 3] & (0x80 >> (bitIndex & 7)))
+          {
+            _fieldBuffer[yField * fieldWidth + xField] = color;
+          }
+        }
+      }
+    }
+
+    drawnRight = max(drawnRight, (int16_t)(x0 + glyph->width));
+    cursorX += glyph->xAdvance;
+  }
+
+  // Send field with a single address window
+  tft->drawRGBBitmap(x, y - _ascent, _fieldBuffer, fieldWidth, fieldHeight);
+}
+
+//===============================================================
+// Returns the glyph for an index (Printable ASCII or '°')
+//===============================================================
+const GFXglyph* GlyphCache::GetGlyph(uint8_t glyphIndex)
+{
+  if (glyphIndex == GLYPHCACHE_DEGREEINDEX)
+  {
+    return &DegreeGlyph;
+  }
+
+  return &_font->glyph[glyphIndex + GLYPHCACHE_FIRSTCHAR - _font->first];
+}
+
+//===============================================================
+// Returns the glyph bitmap for an index
+//===============================================================
+const uint8_t* GlyphCache::GetBitmap(uint8_t glyphIndex)
+{
+  if (glyphIndex == GLYPHCACHE_DEGREEINDEX)
+  {
+    return DegreeBitmap;
+  }
+
+  return &_font->bitmap[GetGlyph(glyphIndex)->bitmapOffset];
+}
+
+//===============================================================
+// Returns the glyph index of the next character and advances
+// the text pointer (UTF-8 aware for '°'). Returns -1 at the end
+//===============================================================
+int16_t GlyphCache::NextGlyphIndex(const char** text)
+{
+  uint8_t character = (uint8_t)**text;
+  if (character == 0)
+  {
+    return -1;
+  }
+
+  (*text)++;
+
+  // UTF-8 (0xC2 0xB0) or Latin-1 (0xB0) degree sign
+  if (character == 0xC2 && (uint8_t)**text == 0xB0)
+  {
+    (*text)++;
+    return GLYPHCACHE_DEGREEINDEX;
+  }
+  if (character == 0xB0)
+  {
+    return GLYPHCACHE_DEGREEINDEX;
+  }
+
+  // Replace unknown characters
+  if (character < GLYPHCACHE_FIRSTCHAR || character > GLYPHCACHE_LASTCHAR)
+  {
+    character = '?';
+  }
+
+  return character - GLYPHCACHE_FIRSTCHAR;
+}
+
+//===============================================================
+// Returns the atlas for a color combination and renders it if
+// necessary. Least recently used atlas will be replaced
+//===============================================================
+GlyphCache::Atlas* GlyphCache::GetAtlas(uint16_t color, uint16_t backgroundColor)
+{
+  Atlas* replaceAtlas = &_atlases[0];
+  _useCounter++;
+
+  for (uint8_t index = 0; index < GLYPHCACHE_SLOTS; index++)
+  {
+    Atlas* atlas = &_atlases[index];
+    if (atlas->pixels &&
+      atlas->color == color &&
+      atlas->backgroundColor == backgroundColor)
+    {
+      atlas->lastUsed = _useCounter;
+      return atlas;
+    }
+
+    if (!atlas->pixels)
+    {
+      replaceAtlas = atlas;
+      replaceAtlas->lastUsed = 0;
+    }
+    else if (replaceAtlas->pixels && atlas->lastUsed < replaceAtlas->lastUsed)
+    {
+      replaceAtlas = atlas;
+    }
+  }
+
+  // Render new atlas into free or least recently used slot
+  if (!replaceAtlas->pixels)
+  {
+    replaceAtlas->pixels = (uint16_t*)Allocate(_atlasSize * sizeof(uint16_t));
+    if (!replaceAtlas->pixels)
+    {
+      ESP_LOGE(TAG, "Could not allocate glyph atlas");
+      return NULL;
+    }
+  }
+
+  replaceAtlas->color = color;
+  replaceAtlas->backgroundColor = backgroundColor;
+  replaceAtlas->lastUsed = _useCounter;
+  RenderAtlas(replaceAtlas);
+
+  return replaceAtlas;
+}
+
+//===============================================================
+// Renders all glyphs into an atlas
+//===============================================================
+void GlyphCache::RenderAtlas(Atlas* atlas)
+{
+  uint32_t startTime_us = micros();
+
+  for (uint8_t glyphIndex = 0; glyphIndex < GLYPHCACHE_GLYPHCOUNT; glyphIndex++)
+  {
+    const GFXglyph* glyph = GetGlyph(glyphIndex);
+    const uint8_t* bitmap = GetBitmap(glyphIndex);
+    uint16_t* pixels = atlas->pixels + _glyphOffsets[glyphIndex];
+    uint16_t pixelCount = glyph->width * glyph->height;
+
+    // Glyph bitmaps are bit packed without row padding
+    for (uint16_t bitIndex = 0; bitIndex < pixelCount; bitIndex++)
+    {
+      pixels[bitIndex] = (bitmap[bitIndex >> 3] & (0x80 >> (bitIndex & 7))) ? atlas->color : atlas->backgroundColor;
+    }
+  }
+
+  ESP_LOGI(TAG, "Rendered glyph atlas 0x%04X/0x%04X in %d us", atlas->color, atlas->backgroundColor, micros() - startTime_us);
+}
+
+//===============================================================
+// Allocates a buffer in PSRAM if available, otherwise in heap
+//===============================================================
+void* GlyphCache::Allocate(size_t size)
+{
+  void* buffer = ps_malloc(size);
+  if (!buffer)
+  {
+    buffer = malloc(size);
+  }
+  return buffer;
+}
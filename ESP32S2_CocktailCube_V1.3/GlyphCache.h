@@ -0,0 +1,115 @@
+/*
+ * Includes a pre-rendered glyph cache for opaque text drawing
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef GLYPHCACHE_H
+#define GLYPHCACHE_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SPITFT.h>
+#include <esp_log.h>
+
+//===============================================================
+// Defines
+//===============================================================
+#define GLYPHCACHE_FIRSTCHAR      0x20  // ' '
+#define GLYPHCACHE_LASTCHAR       0x7E  // '~'
+#define GLYPHCACHE_DEGREEINDEX    (GLYPHCACHE_LASTCHAR - GLYPHCACHE_FIRSTCHAR + 1)
+#define GLYPHCACHE_GLYPHCOUNT     (GLYPHCACHE_DEGREEINDEX + 1)  // Printable ASCII + '°'
+#define GLYPHCACHE_SLOTS          6     // Count of cached color combinations (foreground/background)
+#define GLYPHCACHE_MAXWIDTH       240   // Maximum width of a text field in pixels
+
+//===============================================================
+// Enums
+//===============================================================
+enum GlyphAlign : int8_t
+{
+  eAlignLeft = 0,
+  eAlignCenter = 1,
+  eAlignRight = 2
+};
+
+//===============================================================
+// Glyph cache class
+//===============================================================
+class GlyphCache
+{
+  public:
+    // Constructor
+    GlyphCache();
+
+    // Destructor
+    ~GlyphCache();
+
+    // Initializes the glyph cache for a font
+    bool Begin(const GFXfont* font);
+
+    // Frees all pre-rendered atlases (e.g. after a theme change)
+    void Clear();
+
+    // Returns the height of a text field in pixels
+    int16_t FieldHeight() const { return _ascent + _descent; }
+
+    // Returns the distance from the top of a text field to the baseline
+    int16_t Ascent() const { return _ascent; }
+
+    // Calculates the bounds of a text like Adafruit_GFX::getTextBounds
+    void GetTextBounds(const char* text, uint16_t* width, uint16_t* height);
+
+    // Draws a text as a single opaque blit into a field with fixed width (y is the baseline)
+    void DrawText(Adafruit_SPITFT* tft, int16_t x, int16_t y, const char* text, uint16_t color, uint16_t backgroundColor, int16_t fieldWidth, GlyphAlign align = eAlignLeft);
+
+  private:
+    // Pre-rendered atlas for a single color combination
+    struct Atlas
+    {
+      uint16_t color = 0;
+      uint16_t backgroundColor = 0;
+      uint32_t lastUsed = 0;
+      uint16_t* pixels = NULL;
+    };
+
+    // Font variables
+    const GFXfont* _font = NULL;
+    int16_t _ascent = 0;
+    int16_t _descent = 0;
+
+    // Pixel offsets of each glyph inside an atlas
+    uint32_t _glyphOffsets[GLYPHCACHE_GLYPHCOUNT] = {};
+    uint32_t _atlasSize = 0;
+
+    // Atlas slots
+    Atlas _atlases[GLYPHCACHE_SLOTS];
+    uint32_t _useCounter = 0;
+
+    // Buffer for composing a text field
+    uint16_t* _fieldBuffer = NULL;
+
+    // Returns the glyph for an index (Printable ASCII or '°')
+    const GFXglyph* GetGlyph(uint8_t glyphIndex);
+
+    // Returns the glyph bitmap for an index
+    const uint8_t* GetBitmap(uint8_t glyphIndex);
+
+    // Returns the glyph index of the next character and advances the text pointer (UTF-8 aware for '°')
+    int16_t NextGlyphIndex(const char** text);
+
+    // Returns the atlas for a color combination and renders it if necessary
+    Atlas* GetAtlas(uint16_t color, uint16_t backgroundColor);
+
+    // Renders all glyphs into an atlas
+    void RenderAtlas(Atlas* atlas);
+
+    // Allocates a buffer in PSRAM if available, otherwise in heap
+    void* Allocate(size_t size);
+};
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Includes the streamed json file list
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "JsonFileList.h"
+
+//===============================================================
+// Constructor
+//===============================================================
+JsonFileList::JsonFileList(fs::FS& fileSystem, const char* path)
+{
+  _dir = fileSystem.open(path, FILE_READ);
+}
+
+//===============================================================
+// Fills the buffer with the next part, returns 0 at the end
+//===============================================================
+size_t JsonFileList::Read(uint8_t* buffer, size_t maxLength)
+{
+  size_t length = 0;
+  while (length < maxLength)
+  {
+    if (_entryOffset >= _entryLength)
+    {
+      if (_finished)
+      {
+        break;
+      }
+      NextEntry();
+    }
+
+    size_t copyLength = min(_entryLength - _entryOffset, maxLength - length);
+    memcpy(buffer + length, _entry + _entryOffset, copyLength);
+    _entryOffset += copyLength;
+    length += copyLength;
+  }
+  return length;
+}
+
+//===============================================================
+// Writes the next entry (Or the end of the array)
+//===============================================================
+void JsonFileList::NextEntry()
+{
+  JsonStreamWriter writer(_entry, sizeof(_entry));
+
+  File entry = _dir ? _dir.openNextFile() : File();
+  if (!entry)
+  {
+    writer.Raw(_count == 0 ? "[]" : "]");
+    _dir.close();
+    _finished = true;
+  }
+  else
+  {
+    writer.Raw(_count == 0 ? "[" : ",");
+    writer.BeginObject();
+    writer.Add("type", "file");
+    writer.Add("name", entry.name());
+    writer.Add("size", (uint32_t)entry.size());
+    writer.EndObject();
+    entry.close();
+    _count++;
+  }
+
+  _entryLength = writer.GetLength();
+  _entryOffset = 0;
+}
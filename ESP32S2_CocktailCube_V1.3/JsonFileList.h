@@ -0,0 +1,57 @@
+/*
+ * Includes the streamed json file list
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef JSONFILELIST_H
+#define JSONFILELIST_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <FS.h>
+#include "JsonStreamWriter.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define JSONFILELIST_ENTRYSIZE    256          // Single entry with a fully escaped name
+
+//===============================================================
+// Json file list class
+// Streams the files of a directory as json array, entry by entry,
+// into the buffers of a chunked response. Only a single entry is
+// kept in memory, no matter how many files are listed:
+//   [{"type":"file","name":"/index.html","size":1234},...]
+//===============================================================
+class JsonFileList
+{
+  public:
+    // Constructor
+    JsonFileList(fs::FS& fileSystem, const char* path);
+
+    // Fills the buffer with the next part, returns 0 at the end
+    size_t Read(uint8_t* buffer, size_t maxLength);
+
+    // Returns the amount of listed files
+    uint16_t GetCount() const { return _count; }
+
+  private:
+    File _dir;
+    uint16_t _count = 0;
+    bool _finished = false;
+
+    // Entry not completely copied into the last buffer
+    char _entry[JSONFILELIST_ENTRYSIZE];
+    size_t _entryLength = 0;
+    size_t _entryOffset = 0;
+
+    // Writes the next entry (Or the end of the array)
+    void NextEntry();
+};
+
+#endif
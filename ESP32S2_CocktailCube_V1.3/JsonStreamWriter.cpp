@@ -0,0 +1,244 @@
+/*
+ * Includes the streaming json writer
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "JsonStreamWriter.h"
+
+//===============================================================
+// Constructor
+//===============================================================
+JsonStreamWriter::JsonStreamWriter(char* buffer, size_t size) :
+  _buffer(buffer),
+  _size(size)
+{
+  if (_size > 0)
+  {
+    _buffer[0] = '\0';
+  }
+  else
+  {
+    _overflow = true;
+  }
+}
+
+//===============================================================
+// Begins an object (Key only inside of objects)
+//===============================================================
+void JsonStreamWriter::BeginObject(const char* key)
+{
+  BeginValue(key);
+  Write('{');
+  if (_depth < JSONWRITER_MAXDEPTH)
+  {
+    _depth++;
+    _hasValue &= ~(1 << (_depth - 1));
+  }
+}
+
+//===============================================================
+// Ends an object
+//===============================================================
+void JsonStreamWriter::EndObject()
+{
+  Write('}');
+  if (_depth > 0)
+  {
+    _depth--;
+  }
+}
+
+//===============================================================
+// Begins an array (Key only inside of objects)
+//===============================================================
+void JsonStreamWriter::BeginArray(const char* key)
+{
+  BeginValue(key);
+  Write('[');
+  if (_depth < JSONWRITER_MAXDEPTH)
+  {
+    _depth++;
+    _hasValue &= ~(1 << (_depth - 1));
+  }
+}
+
+//===============================================================
+// Ends an array
+//===============================================================
+void JsonStreamWriter::EndArray()
+{
+  Write(']');
+  if (_depth > 0)
+  {
+    _depth--;
+  }
+}
+
+//===============================================================
+// Adds an escaped string value
+//===============================================================
+void JsonStreamWriter::Add(const char* key, const char* value)
+{
+  BeginValue(key);
+  WriteEscaped(value ? value : "");
+}
+
+//===============================================================
+// Adds a boolean value
+//===============================================================
+void JsonStreamWriter::Add(const char* key, bool value)
+{
+  BeginValue(key);
+  Write(value ? '1' : '0');
+}
+
+//===============================================================
+// Adds a number value
+//===============================================================
+void JsonStreamWriter::Add(const char* key, int value)
+{
+  Add(key, (long)value);
+}
+
+//===============================================================
+// Adds an unsigned number value
+//===============================================================
+void JsonStreamWriter::Add(const char* key, unsigned int value)
+{
+  Add(key, (unsigned long)value);
+}
+
+//===============================================================
+// Adds a number value
+//===============================================================
+void JsonStreamWriter::Add(const char* key, long value)
+{
+  char number[24];
+  BeginValue(key);
+  Write(number, snprintf(number, sizeof(number), "%ld", value));
+}
+
+//===============================================================
+// Adds an unsigned number value
+//===============================================================
+void JsonStreamWriter::Add(const char* key, unsigned long value)
+{
+  char number[24];
+  BeginValue(key);
+  Write(number, snprintf(number, sizeof(number), "%lu", value));
+}
+
+//===============================================================
+// Adds unescaped text (e.g. separators between streamed parts)
+//===============================================================
+void JsonStreamWriter::Raw(const char* text)
+{
+  Write(text, strlen(text));
+}
+
+//===============================================================
+// Writes the separator and key of a new value
+//===============================================================
+void JsonStreamWriter::BeginValue(const char* key)
+{
+  if (_depth > 0)
+  {
+    uint8_t mask = 1 << (_depth - 1);
+    if (_hasValue & mask)
+    {
+      Write(',');
+    }
+    _hasValue |= mask;
+  }
+
+  if (key)
+  {
+    WriteEscaped(key);
+    Write(':');
+  }
+}
+
+//===============================================================
+// Writes a single character
+//===============================================================
+void JsonStreamWriter::Write(char character)
+{
+  Write(&character, 1);
+}
+
+//===============================================================
+// Writes characters
+//===============================================================
+void JsonStreamWriter::Write(const char* text, size_t length)
+{
+  // Keep space for the terminator
+  if (_overflow ||
+    _length + length >= _size)
+  {
+    _overflow = true;
+    return;
+  }
+
+  memcpy(_buffer + _length, text, length);
+  _length += length;
+  _buffer[_length] = '\0';
+}
+
+//===============================================================
+// Writes an escaped string with quotes
+//===============================================================
+void JsonStreamWriter::WriteEscaped(const char* text)
+{
+  Write('"');
+
+  // Write unescaped runs at once
+  const char* run = text;
+  for (const char* current = text; *current; current++)
+  {
+    uint8_t character = (uint8_t)*current;
+    if (character >= 0x20 &&
+      character != '"' &&
+      character != '\\')
+    {
+      continue;
+    }
+
+    Write(run, current - run);
+    run = current + 1;
+
+    switch (character)
+    {
+      case '"':
+        Write("\\\"", 2);
+        break;
+      case '\\':
+        Write("\\\\", 2);
+        break;
+      case '\n':
+        Write("\\n", 2);
+        break;
+      case '\r':
+        Write("\\r", 2);
+        break;
+      case '\t':
+        Write("\\t", 2);
+        break;
+      default:
+        {
+          char escaped[7];
+          snprintf(escaped, sizeof(escaped), "\\u%04X", character);
+          Write(escaped, 6);
+        }
+        break;
+    }
+  }
+  Write(run, strlen(run));
+
+  Write('"');
+}
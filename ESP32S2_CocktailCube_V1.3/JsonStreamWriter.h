@@ -0,0 +1,101 @@
+/*
+ * Includes the streaming json writer
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef JSONSTREAMWRITER_H
+#define JSONSTREAMWRITER_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+
+//===============================================================
+// Defines
+//===============================================================
+#define JSONWRITER_MAXDEPTH       8
+#define JSONWRITER_BUFFERSIZE     512          // Stack buffer for small documents (Settings, values, deltas)
+
+//===============================================================
+// Json writer class
+// Writes a json document into a fixed buffer without any heap
+// allocation. Strings are escaped. Separators are set by the
+// writer, keys are NULL inside of arrays. On overflow nothing is
+// written anymore and 'HasOverflow()' returns true
+//===============================================================
+class JsonStreamWriter
+{
+  public:
+    // Constructor
+    JsonStreamWriter(char* buffer, size_t size);
+
+    // Begins an object (Key only inside of objects)
+    void BeginObject(const char* key = NULL);
+
+    // Ends an object
+    void EndObject();
+
+    // Begins an array (Key only inside of objects)
+    void BeginArray(const char* key = NULL);
+
+    // Ends an array
+    void EndArray();
+
+    // Adds an escaped string value
+    void Add(const char* key, const char* value);
+
+    // Adds a boolean value (Written as 0 or 1 like the former responses)
+    void Add(const char* key, bool value);
+
+    // Adds a number value (Also for smaller types and enums)
+    void Add(const char* key, int value);
+
+    // Adds an unsigned number value
+    void Add(const char* key, unsigned int value);
+
+    // Adds a number value ('int32_t' on ESP-IDF)
+    void Add(const char* key, long value);
+
+    // Adds an unsigned number value ('uint32_t' on ESP-IDF)
+    void Add(const char* key, unsigned long value);
+
+    // Adds unescaped text (e.g. separators between streamed parts)
+    void Raw(const char* text);
+
+    // Returns the written document (Always null terminated)
+    const char* GetBuffer() const { return _buffer; }
+
+    // Returns the written length
+    size_t GetLength() const { return _length; }
+
+    // Returns true if the buffer was too small
+    bool HasOverflow() const { return _overflow; }
+
+  private:
+    char* _buffer;
+    size_t _size;
+    size_t _length = 0;
+    bool _overflow = false;
+
+    // Nesting state, bit set if the level already has a value
+    uint8_t _depth = 0;
+    uint8_t _hasValue = 0;
+
+    // Writes the separator and key of a new value
+    void BeginValue(const char* key);
+
+    // Writes a single character
+    void Write(char character);
+
+    // Writes characters
+    void Write(const char* text, size_t length);
+
+    // Writes an escaped string with quotes
+    void WriteEscaped(const char* text);
+};
+
+#endif
@@ -0,0 +1,155 @@
+/*
+ * Includes the idle time file system maintenance
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "Maintenance.h"
+#include "StateMachine.h"
+#include "PumpDriver.h"
+#include "WifiHandler.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "maintenance";
+
+//===============================================================
+// Global variables
+//===============================================================
+MaintenanceService Maintenance;
+
+//===============================================================
+// Constructor
+//===============================================================
+MaintenanceService::MaintenanceService()
+{
+}
+
+//===============================================================
+// Runs a maintenance slice, if idle long enough
+//===============================================================
+void MaintenanceService::Update()
+{
+  uint32_t currentTime_ms = millis();
+  if (!IsIdle())
+  {
+    _idleTimestamp_ms = currentTime_ms;
+    return;
+  }
+
+  if ((currentTime_ms - _idleTimestamp_ms) < MAINTENANCE_IDLETIME_MS ||
+    (currentTime_ms - _sliceTimestamp_ms) < MAINTENANCE_INTERVAL_MS)
+  {
+    return;
+  }
+
+  RunSlice();
+
+  // Interval starts after the slice, so the loop always gets time in between
+  _sliceTimestamp_ms = millis();
+}
+
+//===============================================================
+// Returns true if the cube is idle
+//===============================================================
+bool MaintenanceService::IsIdle()
+{
+  return Statemachine.GetCurrentState() == eScreenSaver &&
+    !Pumps.IsEnabled() &&
+    Wifihandler.GetOpenRequests() == 0;
+}
+
+//===============================================================
+// Returns the maintenance state as string
+//===============================================================
+String MaintenanceService::GetInfoString()
+{
+  String returnString;
+
+  double totalBytes = (double)FileSystem.TotalBytes();
+  double freeBytes = totalBytes - (double)FileSystem.UsedBytes();
+
+  returnString += "Idle:            " + String(IsIdle() ? "true\n" : "false\n");
+  returnString += "FS-Free:         " + String(freeBytes / (1024.0 * 1024.0), 6) + " MB\n";
+  if (FileSystem.GetType() == eFileSystemSPIFFS)
+  {
+    // Deleted pages are not part of the used bytes, SPIFFS does not report how many were erased
+    returnString += "FS-GC:           " + String(_gcFinished ? "Finished\n" : "Running\n");
+    returnString += "GC-Steps:        " + String(_gcSteps) + " (" + String(_gcTime_ms) + " ms)\n";
+  }
+  else
+  {
+    returnString += "FS-Maintenance:  Not supported (" + String(FileSystem.GetName()) + ")\n";
+  }
+  returnString += "Slice-Max:       " + String(_sliceMax_ms) + " ms\n";
+
+  // Page compaction of NVS runs in its writes, only the entries are known
+  nvs_stats_t nvsStats;
+  if (nvs_get_stats(NULL, &nvsStats) == ESP_OK)
+  {
+    double nvsUsage = nvsStats.total_entries == 0 ? 0.0 : (double)nvsStats.used_entries / nvsStats.total_entries * 100.0; // Avoid division by 0
+    returnString += "NVS-Entries:     " + String(nvsStats.used_entries) + " / " + String(nvsStats.total_entries) + " (" + nvsUsage + "%)\n";
+    returnString += "NVS-Namespaces:  " + String(nvsStats.namespace_count) + "\n";
+  }
+
+  return returnString;
+}
+
+//===============================================================
+// Runs a single time slice
+//===============================================================
+void MaintenanceService::RunSlice()
+{
+  uint32_t startTime_ms = millis();
+
+  if (FileSystem.GetType() == eFileSystemSPIFFS)
+  {
+    RunGarbageCollection(startTime_ms);
+  }
+
+  _sliceMax_ms = max(_sliceMax_ms, (uint32_t)(millis() - startTime_ms));
+}
+
+//===============================================================
+// Runs garbage collection steps until the time budget is used
+//===============================================================
+void MaintenanceService::RunGarbageCollection(uint32_t startTime_ms)
+{
+  // Writes and deletes change the used bytes, start again with the first step
+  size_t usedBytes = FileSystem.UsedBytes();
+  if (usedBytes != _usedBytes ||
+    (_gcFinished && (startTime_ms - _gcTimestamp_ms) > MAINTENANCE_RESCAN_MS))
+  {
+    _usedBytes = usedBytes;
+    _gcTargetBytes = 0;
+    _gcFinished = false;
+  }
+  _totalBytes = FileSystem.TotalBytes();
+
+  while (!_gcFinished &&
+    (millis() - startTime_ms) < MAINTENANCE_SLICE_MS)
+  {
+    size_t targetBytes = _gcTargetBytes + MAINTENANCE_GCSTEP;
+    uint32_t stepTime_ms = millis();
+    esp_err_t error = targetBytes <= _totalBytes - _usedBytes ? esp_spiffs_gc(FILESYSTEM_PARTITIONLABEL, targetBytes) : ESP_ERR_NOT_FINISHED;
+    _gcTime_ms += millis() - stepTime_ms;
+
+    if (error != ESP_OK)
+    {
+      // All deleted pages are collected (Or the file system is full)
+      _gcFinished = true;
+      _gcTimestamp_ms = millis();
+      ESP_LOGI(TAG, "Garbage collection finished (%d steps)", _gcSteps);
+      break;
+    }
+
+    _gcTargetBytes = targetBytes;
+    _gcSteps++;
+  }
+}
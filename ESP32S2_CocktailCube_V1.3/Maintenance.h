@@ -0,0 +1,86 @@
+/*
+ * Includes the idle time file system maintenance
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef MAINTENANCE_H
+#define MAINTENANCE_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <esp_spiffs.h>
+#include <nvs.h>
+#include <esp_log.h>
+#include "FileSystem.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define MAINTENANCE_IDLETIME_MS     10000       // Idle time before the first slice
+#define MAINTENANCE_INTERVAL_MS     250         // Time between two slices
+#define MAINTENANCE_SLICE_MS        20          // Time budget of a slice (A started garbage collection step is finished)
+#define MAINTENANCE_RESCAN_MS       60000       // Restart of finished garbage collection (Overwrites are not visible in the used bytes)
+#define MAINTENANCE_GCSTEP          4096        // Erased space requested per garbage collection step (One flash sector)
+
+//===============================================================
+// Class for the idle time file system maintenance
+// SPIFFS collects deleted pages inside the write that runs out
+// of erased pages, which may stall an upload or a settings save
+// for hundreds of milliseconds. While the cube is idle (Screen
+// saver active, pumps disabled, no HTTP requests), this service
+// runs the garbage collection in small steps, so foreground
+// writes find erased pages. Each step requests one more sector
+// of erased space than the last one, steps that are already met
+// return without flash access. LittleFS has no garbage collection
+// of this kind, so no maintenance runs on it
+//===============================================================
+class MaintenanceService
+{
+  public:
+    // Constructor
+    MaintenanceService();
+
+    // Runs a maintenance slice, if idle long enough (Called once per loop)
+    void Update();
+
+    // Returns true if the cube is idle
+    bool IsIdle();
+
+    // Returns the maintenance state as string
+    String GetInfoString();
+
+  private:
+    // Idle and slice timing
+    uint32_t _idleTimestamp_ms = 0;
+    uint32_t _sliceTimestamp_ms = 0;
+    uint32_t _sliceMax_ms = 0;
+
+    // File system state of the last slice
+    size_t _totalBytes = 0;
+    size_t _usedBytes = 0;
+
+    // Garbage collection progress (SPIFFS only, the target is requested, not measured)
+    size_t _gcTargetBytes = 0;
+    bool _gcFinished = false;
+    uint32_t _gcTimestamp_ms = 0;
+    uint32_t _gcSteps = 0;
+    uint32_t _gcTime_ms = 0;
+
+    // Runs a single time slice
+    void RunSlice();
+
+    // Runs garbage collection steps until the time budget is used
+    void RunGarbageCollection(uint32_t startTime_ms);
+};
+
+//===============================================================
+// Global variables
+//===============================================================
+extern MaintenanceService Maintenance;
+
+#endif
@@ -0,0 +1,111 @@
+/*
+ * Includes the counting of address windows and pixels for render benchmarks
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "RenderCounter.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "rendercounter";
+
+//===============================================================
+// Constructor
+//===============================================================
+RenderCounter::RenderCounter()
+{
+}
+
+//===============================================================
+// Destructor
+//===============================================================
+RenderCounter::~RenderCounter()
+{
+  if (_writtenMask)
+  {
+    free(_writtenMask);
+    _writtenMask = NULL;
+  }
+}
+
+//===============================================================
+// Starts counting a new frame
+//===============================================================
+void RenderCounter::BeginFrame()
+{
+  // Allocate mask on first usage only (Not needed in normal operation)
+  if (!_writtenMask)
+  {
+    _writtenMask = (uint8_t*)malloc(COUNTING_PANEL_WIDTH * COUNTING_PANEL_HEIGHT / 8);
+    if (!_writtenMask)
+    {
+      ESP_LOGE(TAG, "Could not allocate overdraw mask, overdraw will not be counted");
+    }
+  }
+
+  if (_writtenMask)
+  {
+    memset(_writtenMask, 0, COUNTING_PANEL_WIDTH * COUNTING_PANEL_HEIGHT / 8);
+  }
+
+  _stats = RenderFrameStats();
+  _countingTime_us = 0;
+  _isCounting = true;
+  _frameStart_us = micros();
+}
+
+//===============================================================
+// Stops counting and returns the statistics of the frame
+//===============================================================
+RenderFrameStats RenderCounter::EndFrame()
+{
+  // Counting itself is not part of the frame time
+  _stats.cpuTime_us = micros() - _frameStart_us - _countingTime_us;
+  _isCounting = false;
+  return _stats;
+}
+
+//===============================================================
+// Counts an address window, if a frame is started
+//===============================================================
+void RenderCounter::CountWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+  if (!_isCounting)
+  {
+    return;
+  }
+
+  uint32_t countingStart_us = micros();
+
+  _stats.windows++;
+  _stats.pixels += (uint32_t)w * h;
+
+  // Mark written pixels and count the ones already written in this frame
+  if (_writtenMask)
+  {
+    uint16_t xEnd = min((uint16_t)(x + w), (uint16_t)COUNTING_PANEL_WIDTH);
+    uint16_t yEnd = min((uint16_t)(y + h), (uint16_t)COUNTING_PANEL_HEIGHT);
+    for (uint16_t yy = y; yy < yEnd; yy++)
+    {
+      for (uint16_t xx = x; xx < xEnd; xx++)
+      {
+        uint32_t index = (uint32_t)yy * COUNTING_PANEL_WIDTH + xx;
+        uint8_t bit = 1 << (index & 7);
+        if (_writtenMask[index >> 3] & bit)
+        {
+          _stats.overdraw++;
+        }
+        _writtenMask[index >> 3] |= bit;
+      }
+    }
+  }
+
+  _countingTime_us += micros() - countingStart_us;
+}
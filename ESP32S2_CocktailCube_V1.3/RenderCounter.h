@@ -0,0 +1,78 @@
+/*
+ * Includes the counting of address windows and pixels for render benchmarks
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef RENDERCOUNTER_H
+#define RENDERCOUNTER_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <esp_log.h>
+
+//===============================================================
+// Defines
+//===============================================================
+#define COUNTING_PANEL_WIDTH        240
+#define COUNTING_PANEL_HEIGHT       240
+#define COUNTING_PANEL_SPICLOCK_HZ  40000000  // Same as in DisplayDriver::Begin()
+#define COUNTING_PANEL_WINDOWBYTES  11        // CASET (1+4) + RASET (1+4) + RAMWR (1)
+
+//===============================================================
+// Statistics of a single rendered frame
+//===============================================================
+struct RenderFrameStats
+{
+  uint32_t windows = 0;     // Address window commands
+  uint32_t pixels = 0;      // Pixels written
+  uint32_t overdraw = 0;    // Pixels written more than once in this frame
+  uint32_t cpuTime_us = 0;  // Time spent between begin and end of the frame (without counting overhead)
+
+  // Returns the estimated time on the SPI bus in microseconds
+  double BusTime_us() const
+  {
+    return ((double)windows * COUNTING_PANEL_WINDOWBYTES + (double)pixels * 2.0) * 8.0 * 1000000.0 / COUNTING_PANEL_SPICLOCK_HZ;
+  }
+};
+
+//===============================================================
+// Class for counting the address windows of a frame
+// Keeps one bit per panel pixel to count the pixels written more
+// than once. Independent of the panel, so the counting also runs
+// in the host tests
+//===============================================================
+class RenderCounter
+{
+  public:
+    // Constructor
+    RenderCounter();
+
+    // Destructor
+    ~RenderCounter();
+
+    // Starts counting a new frame
+    void BeginFrame();
+
+    // Stops counting and returns the statistics of the frame
+    RenderFrameStats EndFrame();
+
+    // Counts an address window, if a frame is started
+    void CountWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+  private:
+    // Counting variables
+    bool _isCounting = false;
+    uint32_t _frameStart_us = 0;
+    uint32_t _countingTime_us = 0;
+    RenderFrameStats _stats;
+
+    // One bit per pixel, set if the pixel was written in the current frame
+    uint8_t* _writtenMask = NULL;
+};
+
+#endif
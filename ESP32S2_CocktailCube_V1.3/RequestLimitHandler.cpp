@@ -0,0 +1,45 @@
+/*
+ * Includes the web handler limiting concurrent requests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "RequestLimitHandler.h"
+#include "WifiHandler.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "RequestLimitHandler";
+
+//===============================================================
+// Constructor
+//===============================================================
+RequestLimitHandler::RequestLimitHandler()
+{
+}
+
+//===============================================================
+// Returns true, if the request has to be rejected
+//===============================================================
+bool RequestLimitHandler::canHandle(AsyncWebServerRequest* request) const
+{
+  return !Wifihandler.OpenRequest(request);
+}
+
+//===============================================================
+// Rejects the request
+//===============================================================
+void RequestLimitHandler::handleRequest(AsyncWebServerRequest* request)
+{
+  ESP_LOGE(TAG, "Request limit of %d reached, rejecting '%s'", WEBSERVER_MAXREQUESTS, request->url().c_str());
+
+  AsyncWebServerResponse* response = request->beginResponse(503, "text/plain; charset=utf-8", "Server busy, try again.");
+  response->addHeader("Retry-After", "1");
+  request->send(response);
+}
@@ -0,0 +1,37 @@
+/*
+ * Includes the web handler limiting concurrent requests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef REQUESTLIMITHANDLER_H
+#define REQUESTLIMITHANDLER_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+//===============================================================
+// Request limit handler class
+// Added as first handler, so every request passes it. Counts the
+// request and only takes it over if the limit is reached, to
+// answer with 503. All other requests go to the next handlers
+//===============================================================
+class RequestLimitHandler: public AsyncWebHandler
+{
+  public:
+    // Constructor
+    RequestLimitHandler();
+
+    // Returns true, if the request has to be rejected
+    bool canHandle(AsyncWebServerRequest* request) const override final;
+
+    // Rejects the request
+    void handleRequest(AsyncWebServerRequest* request) override final;
+};
+
+#endif
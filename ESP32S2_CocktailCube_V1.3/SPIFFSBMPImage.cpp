@@ -34,28 +34,33 @@ SPIFFSBMPImage::~SPIFFSBMPImage()
 //===============================================================
 // Allocates the internal buffer
 //===============================================================
-ImageReturnCode SPIFFSBMPImage::Allocate(String fileName)
+ImageReturnCode SPIFFSBMPImage::Allocate(const char* fileName)
 {
-  ESP_LOGI(TAG, "Allocating new SPIFFS image '%s'", fileName.c_str());
+  ESP_LOGI(TAG, "Allocating new SPIFFS image '%s'", fileName);
   
   // Check file name
-  if (fileName.isEmpty())
+  if (fileName[0] == '\0')
   {
     return IMAGE_ERR_FILE_NOT_FOUND;
   }
 
   // Set file name
-  _fileName = fileName;
+  strlcpy(_fileName, fileName, sizeof(_fileName));
 
   // Correct path if it does not start with "/"
-  String filePath = _fileName;
-  if (!filePath.startsWith("/"))
+  char filePath[FILESYSTEM_MAXPATH];
+  snprintf(filePath, sizeof(filePath), "%s%s", fileName[0] == '/' ? "" : "/", fileName);
+
+  // Transcoded variant is used instead of the bitmap
+  char transcodedPath[FILESYSTEM_MAXPATH];
+  if (GetTranscodedPath(filePath, transcodedPath, sizeof(transcodedPath)) &&
+    FileSystem.exists(transcodedPath))
   {
-    filePath = "/" + filePath;
+    strlcpy(filePath, transcodedPath, sizeof(filePath));
   }
 
   // Open requested file on SPIFFS
-  if (!(_file = SPIFFS.open(filePath, FILE_READ)))
+  if (!(_file = FileSystem.open(filePath, FILE_READ)))
   {
     return IMAGE_ERR_FILE_NOT_FOUND;
   }
@@ -63,147 +68,422 @@ ImageReturnCode SPIFFSBMPImage::Allocate(String fileName)
   // Check if directory
   if (_file.isDirectory())
   {
+    _file.close();
     return IMAGE_ERR_FILE_NOT_FOUND;
   }
 
+  // Read image and close file
+  size_t pathLength = strlen(filePath);
+  bool isTranscoded = pathLength > strlen(TRANSCODED_EXTENSION) &&
+    strcmp(filePath + pathLength - strlen(TRANSCODED_EXTENSION), TRANSCODED_EXTENSION) == 0;
+  ImageReturnCode result = isTranscoded ? ReadTranscoded(&_file) : Read(&_file, 0);
+  _file.close();
+
+  return result;
+}
+
+//===============================================================
+// Allocates the internal buffer from an opened file at an offset
+// (e.g. an image section of a theme bundle). The file is not
+// closed, so further sections can be read sequentially
+//===============================================================
+ImageReturnCode SPIFFSBMPImage::Allocate(File* file, uint32_t offset, const char* name)
+{
+  ESP_LOGI(TAG, "Allocating new SPIFFS image '%s' at offset %d", name, offset);
+
+  // Set file name
+  strlcpy(_fileName, name, sizeof(_fileName));
+
+  return Read(file, offset);
+}
+
+//===============================================================
+// Allocates the image directly from memory mapped data (e.g. the
+// asset partition). Pixel data is not copied, so no buffer is
+// allocated and the data must stay mapped while the image is used
+//===============================================================
+ImageReturnCode SPIFFSBMPImage::Allocate(const uint8_t* data, uint32_t length, const char* name)
+{
+  ESP_LOGI(TAG, "Mapping image '%s'", name);
+
+  // Set file name
+  strlcpy(_fileName, name, sizeof(_fileName));
+
+  // Parse header and palette
+  uint32_t pixelDataPosition = 0;
+  ImageReturnCode returnCode = ParseHeader(data, length, &pixelDataPosition);
+  if (returnCode != IMAGE_SUCCESS)
+  {
+    return returnCode;
+  }
+
+  // Check pixel data is inside the mapped data
+  if (pixelDataPosition + _rowSize * _height > length)
+  {
+    return IMAGE_ERR_PIXELDATA;
+  }
+
+  // Use mapped pixel data without copy
+  _bufferPixelData = (uint8_t*)data + pixelDataPosition;
+  _isBufferOwner = false;
+  _isValid = true;
+
+  return IMAGE_SUCCESS;
+}
+
+//===============================================================
+// Checks the header of a bitmap file without loading it. The
+// pixel data has to fit into the file
+//===============================================================
+ImageReturnCode SPIFFSBMPImage::CheckHeader(const uint8_t* data, uint32_t length, uint32_t fileLength)
+{
+  uint32_t pixelDataPosition = 0;
+  ImageReturnCode returnCode = ParseHeader(data, length, &pixelDataPosition);
+  if (returnCode != IMAGE_SUCCESS)
+  {
+    return returnCode;
+  }
+
+  if (pixelDataPosition > fileLength ||
+    (uint64_t)_rowSize * _height > fileLength - pixelDataPosition)
+  {
+    return IMAGE_ERR_PIXELDATA;
+  }
+  return IMAGE_SUCCESS;
+}
+
+//===============================================================
+// Reads the bitmap starting at an offset of an opened file
+//===============================================================
+ImageReturnCode SPIFFSBMPImage::Read(File* file, uint32_t offset)
+{
+  // Move file position to the start of the bitmap
+  if (file->position() != offset)
+  {
+    file->seek(offset);
+  }
+
+  // Read header and palette
+  uint8_t header[BITMAPHEADER_MAXLENGTH];
+  size_t headerLength = file->read(header, sizeof(header));
+
+  // Parse header and palette
+  uint32_t pixelDataPosition = 0;
+  ImageReturnCode returnCode = ParseHeader(header, headerLength, &pixelDataPosition);
+  if (returnCode != IMAGE_SUCCESS)
+  {
+    return returnCode;
+  }
+
+  // Move file position to the start of pixel data
+  if (file->position() != offset + pixelDataPosition)
+  {
+    file->seek(offset + pixelDataPosition);
+  }
+  
+  // Calculate pixel data byte size
+  size_t pixelDataByteSize = _rowSize * _height;
+
+  // Allocate buffer (PSRAM first)
+  if (!(_bufferPixelData = AllocateBuffer(pixelDataByteSize)))
+  {
+    return IMAGE_ERR_MALLOC;
+  }
+  _isBufferOwner = true;
+
+  // Set pixel data buffer to zero
+  memset(_bufferPixelData, 0, pixelDataByteSize);
+  ESP_LOGI(TAG, "New bitmap buffer allocated (Heap: %d / %d Bytes)", ESP.getFreeHeap(), ESP.getHeapSize());
+
+  // Read palette from file
+  size_t readCount = file->read(_bufferPixelData, pixelDataByteSize);
+
+  // Set valid flag
+  _isValid = readCount == pixelDataByteSize;
+
+  return IMAGE_SUCCESS;
+}
+
+//===============================================================
+// Reads a transcoded image from an opened file. Palette, row
+// order and opaque spans were prepared at upload, so the file is
+// read with two reads into the buffers
+//===============================================================
+ImageReturnCode SPIFFSBMPImage::ReadTranscoded(File* file)
+{
+  TranscodedHeader header;
+  if (file->read((uint8_t*)&header, sizeof(header)) != sizeof(header))
+  {
+    return IMAGE_ERR_HEADER;
+  }
+  if (header.magic != TRANSCODED_MAGIC ||
+    header.version != TRANSCODED_VERSION ||
+    header.width == 0 ||
+    header.width > TRANSCODED_MAXWIDTH ||
+    header.height == 0 ||
+    header.rowSize != (header.width + 1) / 2)
+  {
+    return IMAGE_ERR_FORMAT;
+  }
+
+  _width = header.width;
+  _height = header.height;
+  _rowSize = header.rowSize;
+  _isTopDown = true;
+  memcpy(_bufferPalette, header.palette, sizeof(_bufferPalette));
+
+  // Row span index and spans
+  size_t indexSize = (_height + 1) * sizeof(uint16_t);
+  size_t spansSize = indexSize + header.spanCount * sizeof(ImageSpan);
+  if (!(_bufferSpans = AllocateBuffer(spansSize)))
+  {
+    return IMAGE_ERR_MALLOC;
+  }
+  _rowSpans = (uint16_t*)_bufferSpans;
+  _spans = (ImageSpan*)(_bufferSpans + indexSize);
+  if (file->read(_bufferSpans, spansSize) != spansSize ||
+    _rowSpans[0] != 0 ||
+    _rowSpans[_height] != header.spanCount)
+  {
+    return IMAGE_ERR_PIXELDATA;
+  }
+  for (int32_t row = 0; row < _height; row++)
+  {
+    if (_rowSpans[row] > _rowSpans[row + 1])
+    {
+      return IMAGE_ERR_PIXELDATA;
+    }
+  }
+  for (uint32_t index = 0; index < header.spanCount; index++)
+  {
+    if (_spans[index].x + _spans[index].length > _width)
+    {
+      return IMAGE_ERR_PIXELDATA;
+    }
+  }
+
+  // Pixel rows
+  size_t pixelDataByteSize = _rowSize * _height;
+  if (!(_bufferPixelData = AllocateBuffer(pixelDataByteSize)))
+  {
+    return IMAGE_ERR_MALLOC;
+  }
+  _isBufferOwner = true;
+
+  _isValid = file->read(_bufferPixelData, pixelDataByteSize) == pixelDataByteSize;
+  return _isValid ? IMAGE_SUCCESS : IMAGE_ERR_PIXELDATA;
+}
+
+//===============================================================
+// Saves the loaded image as transcoded image. The file is built
+// in one buffer and written at once
+//===============================================================
+ImageReturnCode SPIFFSBMPImage::SaveTranscoded(const char* fileName)
+{
+  if (!_isValid ||
+    !_bufferPixelData)
+  {
+    return IMAGE_ERR_FILE_NOT_FOUND;
+  }
+  if (_width > TRANSCODED_MAXWIDTH ||
+    _height > UINT16_MAX)
+  {
+    return IMAGE_ERR_FORMAT;
+  }
+
+  // Count opaque spans
+  uint32_t spanCount = 0;
+  for (int16_t row = 0; row < _height; row++)
+  {
+    bool isOpaque = false;
+    for (int16_t column = 0; column < _width; column++)
+    {
+      bool isPixelOpaque = GetPixel(column, row) != TRANSPARENCY_COLOR;
+      spanCount += isPixelOpaque && !isOpaque ? 1 : 0;
+      isOpaque = isPixelOpaque;
+    }
+  }
+  if (spanCount > UINT16_MAX)
+  {
+    return IMAGE_ERR_FORMAT;
+  }
+
+  uint16_t rowSize = (_width + 1) / 2;
+  size_t indexSize = (_height + 1) * sizeof(uint16_t);
+  size_t fileSize = sizeof(TranscodedHeader) + indexSize + spanCount * sizeof(ImageSpan) + rowSize * _height;
+  uint8_t* buffer = AllocateBuffer(fileSize);
+  if (!buffer)
+  {
+    return IMAGE_ERR_MALLOC;
+  }
+
+  TranscodedHeader* header = (TranscodedHeader*)buffer;
+  header->magic = TRANSCODED_MAGIC;
+  header->version = TRANSCODED_VERSION;
+  header->width = _width;
+  header->height = _height;
+  header->rowSize = rowSize;
+  header->spanCount = spanCount;
+  memcpy(header->palette, _bufferPalette, sizeof(header->palette));
+
+  // Spans and top-down rows (Bitmap rows without padding)
+  uint16_t* rowSpans = (uint16_t*)(buffer + sizeof(TranscodedHeader));
+  ImageSpan* spans = (ImageSpan*)(buffer + sizeof(TranscodedHeader) + indexSize);
+  uint8_t* pixels = (uint8_t*)(spans + spanCount);
+  uint16_t spanIndex = 0;
+  for (int16_t row = 0; row < _height; row++)
+  {
+    rowSpans[row] = spanIndex;
+    for (int16_t column = 0; column < _width; column++)
+    {
+      if (GetPixel(column, row) == TRANSPARENCY_COLOR)
+      {
+        continue;
+      }
+      if (column == 0 ||
+        GetPixel(column - 1, row) == TRANSPARENCY_COLOR)
+      {
+        spans[spanIndex++] = { (uint16_t)column, 0 };
+      }
+      spans[spanIndex - 1].length++;
+    }
+
+    uint32_t sourceRow = _isTopDown ? row : _height - 1 - row;
+    memcpy(pixels + row * rowSize, _bufferPixelData + sourceRow * _rowSize, rowSize);
+  }
+  rowSpans[_height] = spanIndex;
+
+  File file = FileSystem.open(fileName, FILE_WRITE);
+  size_t written = file ? file.write(buffer, fileSize) : 0;
+  file.close();
+  free(buffer);
+
+  if (written != fileSize)
+  {
+    FileSystem.remove(fileName);
+    return IMAGE_ERR_PIXELDATA;
+  }
+
+  ESP_LOGI(TAG, "Transcoded '%s' to '%s' (%d spans, %d bytes)", _fileName, fileName, spanCount, fileSize);
+  return IMAGE_SUCCESS;
+}
+
+//===============================================================
+// Returns the path of the transcoded variant of a bitmap
+//===============================================================
+bool SPIFFSBMPImage::GetTranscodedPath(const char* fileName, char* path, size_t length)
+{
+  size_t nameLength = strlen(fileName);
+  if (nameLength < 4 ||
+    strcasecmp(fileName + nameLength - 4, ".bmp") != 0)
+  {
+    return false;
+  }
+
+  int pathLength = snprintf(path, length, "%s%.*s" TRANSCODED_EXTENSION, fileName[0] == '/' ? "" : "/", (int)(nameLength - 4), fileName);
+  return pathLength > 0 && (size_t)pathLength < length;
+}
+
+//===============================================================
+// Returns true, if the bitmap or its transcoded variant exists
+//===============================================================
+bool SPIFFSBMPImage::Exists(const char* fileName)
+{
+  char filePath[FILESYSTEM_MAXPATH];
+  char transcodedPath[FILESYSTEM_MAXPATH];
+  snprintf(filePath, sizeof(filePath), "%s%s", fileName[0] == '/' ? "" : "/", fileName);
+  return FileSystem.exists(filePath) ||
+    (GetTranscodedPath(fileName, transcodedPath, sizeof(transcodedPath)) && FileSystem.exists(transcodedPath));
+}
+
+//===============================================================
+// Parses the bitmap header and palette from memory
+//===============================================================
+ImageReturnCode SPIFFSBMPImage::ParseHeader(const uint8_t* data, uint32_t length, uint32_t* pixelDataPosition)
+{
+  // Check for file and DIB header
+  if (length < BITMAPFILEHEADER_LENGTH + 40)
+  {
+    return IMAGE_ERR_HEADER;
+  }
+
   // Parse BMP header. 0x4D42 (ASCII 'BM') is the Windows BMP signature.
   // There are other values possible in a .BMP file but these are super
   // esoteric (e.g. OS/2 struct bitmap array) and NOT supported here!
-  if (ReadLE16(&_file) != 0x4D42)
+  if (GetLE16(data) != 0x4D42)
   {
-    _file.close();
     return IMAGE_ERR_FORMAT;
   }
 
-  // BMP signature
-  (void)ReadLE32(&_file);                         // Read & ignore file size (unreliable)
-  (void)ReadLE32(&_file);                         // Read & ignore creator bytes
-  uint32_t pixelDataPosition = ReadLE32(&_file);  // Start of image data in file
+  // BMP signature (File size and creator bytes are ignored)
+  *pixelDataPosition = GetLE32(data + 10);        // Start of image data in file
   
   // Read DIB header
-  uint32_t headerSize = ReadLE32(&_file); // Indicates BMP version
+  uint32_t headerSize = GetLE32(data + 14); // Indicates BMP version
   
   // Check header size
   if (headerSize < 40)
   {
-    _file.close();
     return IMAGE_ERR_HEADER;
   }
   
   // Read bitmap size
-  _width = ReadLE32(&_file);              // BMP width in pixels
-  _height = ReadLE32(&_file);             // BMP height in pixels
+  _width = (int32_t)GetLE32(data + 18);   // BMP width in pixels
+  _height = (int32_t)GetLE32(data + 22);  // BMP height in pixels
 
   // Check for valid size
   if (_height <= 0 || _width <= 0)
   {
-    _file.close();
     return IMAGE_ERR_FORMAT;
   }
   
   // Read planes and depth
-  uint8_t planes = ReadLE16(&_file); // BMP planes (Should always be 1)
-  uint8_t depth = ReadLE16(&_file);  // BMP bit depth (1, 4 and 8 bpp are indexed colors with color palette)
+  uint16_t planes = GetLE16(data + 26); // BMP planes (Should always be 1)
+  uint16_t depth = GetLE16(data + 28);  // BMP bit depth (1, 4 and 8 bpp are indexed colors with color palette)
 
   // Check for correct color depth. We only accept 4 bit color palette
   if (planes != 1 || depth != 4)
   {
-    _file.close();
     return IMAGE_ERR_DEPTH;
   }
 
   // Compression mode is present in later BMP versions (default = none)
-  uint32_t compression = ReadLE32(&_file);            // Get compression
-  (void)ReadLE32(&_file);                             // Raw bitmap data size; ignore
-  (void)ReadLE32(&_file);                             // Horizontal resolution, ignore
-  (void)ReadLE32(&_file);                             // Vertical resolution, ignore
-  uint32_t paletteColorCount = ReadLE32(&_file);      // Number of colors in palette
-  (void)ReadLE32(&_file);                             // Number of colors used
+  uint32_t compression = GetLE32(data + 30);          // Get compression
+  uint32_t paletteColorCount = GetLE32(data + 46);    // Number of colors in palette (0 means all)
   
   // Only uncompressed bitmap with 16 color palettes are handled
   if (compression != 0 || paletteColorCount > PALETTE_COUNT)
   {
-    _file.close();
     return IMAGE_ERR_TABLE;
   }
+  if (paletteColorCount == 0)
+  {
+    paletteColorCount = PALETTE_COUNT;
+  }
   
-  // Move file position to the start of palette
+  // Check palette (16 colors, 4 bytes per color: Blue -> Green -> Red -> Reserved (0))
   uint32_t palettePostion = BITMAPFILEHEADER_LENGTH + headerSize;
-  if (_file.position() != palettePostion)
+  if (palettePostion + paletteColorCount * 4 > length)
   {
-    _file.seek(palettePostion);
+    return IMAGE_ERR_TABLE;
   }
-    
-  // Calculate palette data byte size (16 colors, 4 bytes per color: Blue -> Green -> Red -> Reserved (0))
-  size_t paletteByteSize = paletteColorCount * 4;
-  
-  // Read palette buffer
-  uint8_t sourceBuffer[paletteByteSize] = {}; // BMP read buf (R+G+B+Reserved/pixel)
-
-  // Read palette from file
-  _file.read(sourceBuffer, sizeof sourceBuffer);
 
   // Set palette data buffer to zero
-  memset(_bufferPalette, 0, PALETTE_COUNT);
+  memset(_bufferPalette, 0, sizeof(_bufferPalette));
 
   // For each color
-  for (int16_t colorIndex = 0; colorIndex < PALETTE_COUNT; colorIndex++)
+  const uint8_t* palette = data + palettePostion;
+  for (uint32_t colorIndex = 0; colorIndex < paletteColorCount; colorIndex++)
   {
     // Convert each pixel from BMP to 565 format, save in palette buffer
-    uint8_t b = sourceBuffer[colorIndex * 4 + 0];
-    uint8_t g = sourceBuffer[colorIndex * 4 + 1];
-    uint8_t r = sourceBuffer[colorIndex * 4 + 2];
+    uint8_t b = palette[colorIndex * 4 + 0];
+    uint8_t g = palette[colorIndex * 4 + 1];
+    uint8_t r = palette[colorIndex * 4 + 2];
     _bufferPalette[colorIndex] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
   }
-  
-  // Move file position to the start of pixel data
-  if (_file.position() != pixelDataPosition)
-  {
-    _file.seek(pixelDataPosition);
-  }
     
   // BMP rows are padded (if needed) to 4-byte boundary
   _rowSize = ((depth * _width + 31) / 32) * 4; // > width if scanline padding
-  
-  // Calculate pixel data byte size
-  size_t pixelDataByteSize = _rowSize * _height;
-
-  // Check for enough PSRAM first and allocate buffer if available
-  if (pixelDataByteSize < ESP.getMaxAllocPsram())
-  {
-    if (!(_bufferPixelData = (uint8_t*)ps_malloc(pixelDataByteSize)))
-    {
-      _file.close();
-      return IMAGE_ERR_MALLOC;
-    }
-  }
-  // Check for enough heap (RAM) second and allocate buffer if available
-  else if (pixelDataByteSize < ESP.getMaxAllocHeap())
-  {
-    if (!(_bufferPixelData = (uint8_t*)malloc(pixelDataByteSize)))
-    {
-      _file.close();
-      return IMAGE_ERR_MALLOC;
-    }
-  }
-  else
-  {
-    _file.close();
-    return IMAGE_ERR_MALLOC;
-  }
-
-  // Set pixel data buffer to zero
-  memset(_bufferPixelData, 0, pixelDataByteSize);
-  ESP_LOGI(TAG, "New bitmap buffer allocated (Heap: %d / %d Bytes)", ESP.getFreeHeap(), ESP.getHeapSize());
-
-  // Read palette from file
-  size_t readCount = _file.read(_bufferPixelData, pixelDataByteSize);
-
-  // Set valid flag
-  _isValid = readCount == pixelDataByteSize;
-  
-  // Close file
-  _file.close();
 
   return IMAGE_SUCCESS;
 }
@@ -213,7 +493,7 @@ ImageReturnCode SPIFFSBMPImage::Allocate(String fileName)
 //===============================================================
 void SPIFFSBMPImage::Deallocate()
 {
-  ESP_LOGI(TAG, "Deallocating SPIFFS image '%s'", _fileName.c_str());
+  ESP_LOGI(TAG, "Deallocating SPIFFS image '%s'", _fileName);
 
   // Remove valid fag
   _isValid = false;
@@ -227,16 +507,64 @@ void SPIFFSBMPImage::Deallocate()
     _file.close();
   }
 
-  // Deallocate pixel data buffer
-  if (_bufferPixelData)
+  // Deallocate pixel data buffer (Mapped data is only released)
+  if (_bufferPixelData && _isBufferOwner)
   {
     free(_bufferPixelData);
-    _bufferPixelData = NULL;
     ESP_LOGI(TAG, "Bitmap image buffer is free");
   }
+  _bufferPixelData = NULL;
+  _isBufferOwner = false;
+
+  // Deallocate spans of transcoded images
+  if (_bufferSpans)
+  {
+    free(_bufferSpans);
+  }
+  _bufferSpans = NULL;
+  _rowSpans = NULL;
+  _spans = NULL;
+  _isTopDown = false;
   
-  ESP_LOGI(TAG, "Image '%s' deleted (Heap: %d / %d Bytes)", _fileName.c_str(), ESP.getFreeHeap(), ESP.getHeapSize());
-  _fileName = "";
+  ESP_LOGI(TAG, "Image '%s' deleted (Heap: %d / %d Bytes)", _fileName, ESP.getFreeHeap(), ESP.getHeapSize());
+  _fileName[0] = '\0';
+}
+
+//===============================================================
+// Exchanges the loaded image with another one
+// Only buffer pointers and header values are swapped, so a new
+// image appears at once without copying pixel data
+//===============================================================
+void SPIFFSBMPImage::Swap(SPIFFSBMPImage* otherImage)
+{
+  if (!otherImage ||
+    otherImage == this)
+  {
+    return;
+  }
+
+  // Files are only open while reading
+  if (_file)
+  {
+    _file.close();
+  }
+  if (otherImage->_file)
+  {
+    otherImage->_file.close();
+  }
+
+  std::swap(_fileName, otherImage->_fileName);
+  std::swap(_width, otherImage->_width);
+  std::swap(_height, otherImage->_height);
+  std::swap(_rowSize, otherImage->_rowSize);
+  std::swap(_bufferPalette, otherImage->_bufferPalette);
+  std::swap(_bufferPixelData, otherImage->_bufferPixelData);
+  std::swap(_isBufferOwner, otherImage->_isBufferOwner);
+  std::swap(_isTopDown, otherImage->_isTopDown);
+  std::swap(_bufferSpans, otherImage->_bufferSpans);
+  std::swap(_rowSpans, otherImage->_rowSpans);
+  std::swap(_spans, otherImage->_spans);
+  std::swap(_isValid, otherImage->_isValid);
 }
 
 //===============================================================
@@ -249,8 +577,8 @@ uint16_t SPIFFSBMPImage::GetPixel(int16_t x, int16_t y)
     return 0;
   }
   
-  // Calculate pixel byte index
-  uint32_t pixelByteIndex = (_height - 1 - y) * _rowSize + x / 2;
+  // Calculate pixel byte index (Bitmap rows are stored bottom-up)
+  uint32_t pixelByteIndex = (_isTopDown ? y : _height - 1 - y) * _rowSize + x / 2;
   
   // Check range
   if (pixelByteIndex >= _rowSize * _height)
@@ -287,6 +615,13 @@ void SPIFFSBMPImage::Draw(int16_t x, int16_t y, Adafruit_SPITFT* tft, uint16_t s
     }
     return;
   }
+
+  // Transcoded images write whole spans
+  if (_spans)
+  {
+    DrawSpans(x, y, tft, shadowColor, asShadow);
+    return;
+  }
   
   // Write pixels
   tft->startWrite();
@@ -306,6 +641,55 @@ void SPIFFSBMPImage::Draw(int16_t x, int16_t y, Adafruit_SPITFT* tft, uint16_t s
   tft->endWrite();
 }
 
+//===============================================================
+// Draws the opaque spans of a transcoded image. Each span is
+// converted into a line buffer and written with one address
+// window (Clipped to the screen)
+//===============================================================
+void SPIFFSBMPImage::DrawSpans(int16_t x, int16_t y, Adafruit_SPITFT* tft, uint16_t shadowColor, bool asShadow)
+{
+  uint16_t line[TRANSCODED_MAXWIDTH];
+  int16_t screenWidth = tft->width();
+  int16_t screenHeight = tft->height();
+
+  tft->startWrite();
+  for (int16_t row = 0; row < _height; row++)
+  {
+    int16_t screenY = y + row;
+    if (screenY < 0 ||
+      screenY >= screenHeight)
+    {
+      continue;
+    }
+
+    const uint8_t* pixels = _bufferPixelData + row * _rowSize;
+    for (uint16_t index = _rowSpans[row]; index < _rowSpans[row + 1]; index++)
+    {
+      int16_t start = max(_spans[index].x, (uint16_t)max(0, -x));
+      int16_t end = min(_spans[index].x + _spans[index].length, screenWidth - x);
+      if (start >= end)
+      {
+        continue;
+      }
+
+      if (asShadow)
+      {
+        tft->writeFastHLine(x + start, screenY, end - start, shadowColor);
+        continue;
+      }
+
+      for (int16_t column = start; column < end; column++)
+      {
+        uint8_t pixelByte = pixels[column / 2];
+        line[column - start] = _bufferPalette[(column % 2 == 0) ? pixelByte >> 4 : pixelByte & 0x0F];
+      }
+      tft->setAddrWindow(x + start, screenY, end - start, 1);
+      tft->writePixels(line, end - start);
+    }
+  }
+  tft->endWrite();
+}
+
 //===============================================================
 // Clears the difference between two images
 //===============================================================
@@ -406,62 +790,76 @@ void SPIFFSBMPImage::Move(int16_t x0, int16_t y0, int16_t x1, int16_t y1, Adafru
 //===============================================================
 // Print error code string to stream
 //===============================================================
-String SPIFFSBMPImage::PrintStatus(ImageReturnCode stat)
+const char* SPIFFSBMPImage::PrintStatus(ImageReturnCode stat)
 {
   if (stat == IMAGE_SUCCESS)
   {
-    return String("Success!");
+    return "Success!";
   }
   else if (stat == IMAGE_ERR_FILE_NOT_FOUND)
   {
-    return String("File not found.");
+    return "File not found.";
   }
   else if (stat == IMAGE_ERR_FORMAT)
   {
-    return String("Not a supported image format.");
+    return "Not a supported image format.";
   }
   else if (stat == IMAGE_ERR_HEADER)
   {
-    return String("Does not contain header.");
+    return "Does not contain header.";
   }
   else if (stat == IMAGE_ERR_DEPTH)
   {
-    return String("Not supported color depth.");
+    return "Not supported color depth.";
   }
   else if (stat == IMAGE_ERR_TABLE)
   {
-    return String("Does not contain color table.");
+    return "Does not contain color table.";
   }
   else if (stat == IMAGE_ERR_MALLOC)
   {
-    return String("Malloc failed (insufficient RAM).");
+    return "Malloc failed (insufficient RAM).";
   }
   else if (stat == IMAGE_ERR_PIXELDATA)
   {
-    return String("Not enough pixel data read.");
+    return "Not enough pixel data read.";
   }
 
   return "Unknown";
 }
 
 //===============================================================
-// Reads a little-endian 16-bit unsigned value from currently-
-// open File, converting if necessary to the microcontroller's
-// native endianism. (BMP files use little-endian values.)
+// Allocates a buffer, PSRAM first and heap second
+//===============================================================
+uint8_t* SPIFFSBMPImage::AllocateBuffer(size_t size)
+{
+  // Check for enough PSRAM first and allocate buffer if available
+  if (size < ESP.getMaxAllocPsram())
+  {
+    return (uint8_t*)ps_malloc(size);
+  }
+  // Check for enough heap (RAM) second and allocate buffer if available
+  else if (size < ESP.getMaxAllocHeap())
+  {
+    return (uint8_t*)malloc(size);
+  }
+  return NULL;
+}
+
+//===============================================================
+// Returns a little-endian 16-bit unsigned value from memory
+// (BMP files use little-endian values)
 //===============================================================
-uint16_t SPIFFSBMPImage::ReadLE16(File* file)
+uint16_t SPIFFSBMPImage::GetLE16(const uint8_t* data)
 {
-  // Big-endian or unknown. Byte-by-byte read will perform reversal if needed.
-  return file->read() | ((uint16_t)file->read() << 8);
+  return data[0] | ((uint16_t)data[1] << 8);
 }
 
 //===============================================================
-// Reads a little-endian 32-bit unsigned value from currently-
-// open File, converting if necessary to the microcontroller's
-// native endianism. (BMP files use little-endian values.)
+// Returns a little-endian 32-bit unsigned value from memory
+// (BMP files use little-endian values)
 //===============================================================
-uint32_t SPIFFSBMPImage::ReadLE32(File* file)
+uint32_t SPIFFSBMPImage::GetLE32(const uint8_t* data)
 {
-  // Big-endian or unknown. Byte-by-byte read will perform reversal if needed.
-  return file->read() | ((uint32_t)file->read() << 8) | ((uint32_t)file->read() << 16) | ((uint32_t)file->read() << 24);
+  return data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
 }
@@ -14,15 +14,21 @@
 //===============================================================
 #include <Arduino.h>
 #include <cmath>
-#include <SPIFFS.h>
+#include <utility>
 #include <Adafruit_ST7789.h>
+#include "FileSystem.h"
 
 //===============================================================
 // Defines
 //===============================================================
 #define BITMAPFILEHEADER_LENGTH   14
+#define BITMAPHEADER_MAXLENGTH    (BITMAPFILEHEADER_LENGTH + 124 + PALETTE_COUNT * 4) // File, V5 DIB header and palette
 #define PALETTE_COUNT             16
 #define TRANSPARENCY_COLOR        0x07E0  // 100% green in 565 format means transparent
+#define TRANSCODED_EXTENSION      ".cci"  // Transcoded image, used instead of the bitmap with the same name
+#define TRANSCODED_MAGIC          0x31494343  // "CCI1"
+#define TRANSCODED_VERSION        1
+#define TRANSCODED_MAXWIDTH       320     // Line buffer for drawing spans
 
 //===============================================================
 // Enums
@@ -41,6 +47,11 @@ enum ImageReturnCode
 
 //===============================================================
 // SPIFFS bitmap image class
+// Loads 4 bit bitmaps or their transcoded variant (.cci), which
+// is written once at upload: Top-down rows without padding, the
+// palette in 565 format and the opaque spans of each row, so
+// drawing writes whole spans instead of single pixels:
+//   Header | Row span index[height + 1] | Spans | Pixel rows
 //===============================================================
 class SPIFFSBMPImage
 {
@@ -52,11 +63,32 @@ class SPIFFSBMPImage
     ~SPIFFSBMPImage();
 
     // Allocates the internal buffer
-    ImageReturnCode Allocate(String fileName);
+    ImageReturnCode Allocate(const char* fileName);
+
+    // Allocates the internal buffer from an opened file at an offset (File is kept open)
+    ImageReturnCode Allocate(File* file, uint32_t offset, const char* name);
+
+    // Uses memory mapped image data without copying the pixel data
+    ImageReturnCode Allocate(const uint8_t* data, uint32_t length, const char* name);
 
     // Deallocates the internal buffer
     void Deallocate();
 
+    // Checks the header of a bitmap file without loading it (Header from the start of the file)
+    ImageReturnCode CheckHeader(const uint8_t* data, uint32_t length, uint32_t fileLength);
+
+    // Saves the loaded image as transcoded image
+    ImageReturnCode SaveTranscoded(const char* fileName);
+
+    // Copies the path of the transcoded variant of a bitmap into a buffer (False if not a bitmap name)
+    static bool GetTranscodedPath(const char* fileName, char* path, size_t length);
+
+    // Returns true, if the bitmap or its transcoded variant exists on SPIFFS
+    static bool Exists(const char* fileName);
+
+    // Exchanges the loaded image with another one (Only pointers are swapped)
+    void Swap(SPIFFSBMPImage* otherImage);
+
     // Return the height of the image
     int16_t Height() const { return _height; }
 
@@ -82,11 +114,30 @@ class SPIFFSBMPImage
     void Move(int16_t x0, int16_t y0, int16_t x1, int16_t y1, Adafruit_SPITFT* tft, uint16_t clearColor, bool onlyClear = false);
 
     // Print error code string to stream
-    String PrintStatus(ImageReturnCode stat);
+    static const char* PrintStatus(ImageReturnCode stat);
 
   private:
+    // Header of a transcoded image (Little endian)
+    struct TranscodedHeader
+    {
+      uint32_t magic;
+      uint16_t version;
+      uint16_t width;
+      uint16_t height;
+      uint16_t rowSize;
+      uint32_t spanCount;
+      uint16_t palette[PALETTE_COUNT];
+    };
+
+    // Opaque pixels of a row
+    struct ImageSpan
+    {
+      uint16_t x;
+      uint16_t length;
+    };
+
     // File object for reading image data
-    String _fileName;
+    char _fileName[FILESYSTEM_MAXPATH] = "";
     File _file;
 
     // Image size
@@ -102,14 +153,40 @@ class SPIFFSBMPImage
     // Buffer which stores the pixel data
     uint8_t* _bufferPixelData = NULL;
 
+    // False if the pixel data is memory mapped and not allocated
+    bool _isBufferOwner = false;
+
+    // True if the rows are stored top-down (Transcoded images)
+    bool _isTopDown = false;
+
+    // Opaque spans of transcoded images (One allocation, NULL for bitmaps)
+    uint8_t* _bufferSpans = NULL;
+    uint16_t* _rowSpans = NULL;
+    ImageSpan* _spans = NULL;
+
     // True if the image is valid loaded
     bool _isValid = false;
 
-    // Reads a little-endian 16-bit
-    uint16_t ReadLE16(File* file);
+    // Reads the bitmap starting at an offset of an opened file
+    ImageReturnCode Read(File* file, uint32_t offset);
+
+    // Reads a transcoded image from an opened file
+    ImageReturnCode ReadTranscoded(File* file);
+
+    // Draws the opaque spans of a transcoded image
+    void DrawSpans(int16_t x, int16_t y, Adafruit_SPITFT* tft, uint16_t shadowColor, bool asShadow);
+
+    // Allocates a buffer, PSRAM first and heap second (NULL if not possible)
+    static uint8_t* AllocateBuffer(size_t size);
+
+    // Parses the bitmap header and palette from memory
+    ImageReturnCode ParseHeader(const uint8_t* data, uint32_t length, uint32_t* pixelDataPosition);
+
+    // Returns a little-endian 16-bit
+    uint16_t GetLE16(const uint8_t* data);
 
-    // Reads a little-endian 32-bit
-    uint32_t ReadLE32(File* file);
+    // Returns a little-endian 32-bit
+    uint32_t GetLE32(const uint8_t* data);
 };
 
 #endif
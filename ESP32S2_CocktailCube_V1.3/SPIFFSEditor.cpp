@@ -10,6 +10,7 @@
 // Includes
 //===============================================================
 #include "SPIFFSEditor.h"
+#include "WifiHandler.h"
 
 //===============================================================
 // Constants
@@ -511,219 +512,746 @@ const uint8_t edit_html_gz[] PROGMEM =
   0x18, 0x61, 0x4B, 0x00, 0x00
 };
 
+//===============================================================
+// Static variables
+//===============================================================
+AsyncWebServerRequest* SPIFFSEditor::_uploads[SPIFFSEDITOR_MAXUPLOADS] = { NULL };
+uint8_t SPIFFSEditor::_tempCounter = 0;
+
 //===============================================================
 // Constructor
 //===============================================================
 SPIFFSEditor::SPIFFSEditor()
 {
+  RemoveTempFiles();
 }
 
 //===============================================================
 // Returns true, if the handler can handle the request
 //===============================================================
-bool SPIFFSEditor::canHandle(WebServer &server, HTTPMethod method, const String &uri)
+bool SPIFFSEditor::canHandle(AsyncWebServerRequest* request) const
 {
   // Check for URL '/edit'
-  bool canHandle = uri.equalsIgnoreCase("/edit");
+  bool canHandle = request->url().equalsIgnoreCase("/edit");
   ESP_LOGE(TAG, "Can handle request from '/edit'? %s", canHandle ? "✓" : "✖");
   return canHandle;
 }
 
-//===============================================================
-// Returns true if the handler can upload the file
-//===============================================================
-bool SPIFFSEditor::canUpload(WebServer &server, const String &uri)
-{
-  // Check for URL '/edit'
-  bool canUpload = uri.equalsIgnoreCase("/edit");
-  ESP_LOGE(TAG, "Can handle upload from '/edit'? %s", canUpload ? "✓" : "✖");
-  return canUpload;
-}
-
 //===============================================================
 // Handles the request
 //===============================================================
-bool SPIFFSEditor::handle(WebServer &server, HTTPMethod method, const String &requestUri)
+void SPIFFSEditor::handleRequest(AsyncWebServerRequest* request)
 {
-  ESP_LOGI(TAG, "Handle: request=%s", requestUri.c_str());
+  ESP_LOGI(TAG, "Handle: request=%s", request->url().c_str());
 
-  if (method == HTTP_GET)
+  if (request->method() == HTTP_GET)
   {
-    if (server.argName(0) == "list")
+    if (request->argName(0) == "list")
     {
       ESP_LOGI(TAG, "Handle GET 'list'");
 
-      // Open directory
-      File dir = SPIFFS.open(server.arg(0), FILE_READ);
-      String output = "[";
-
-      // Open first file
-      File entry = dir.openNextFile();
-
-      // Iterate through all files
-      while (entry)
+      // Stream the list entry by entry, freed together with the response
+      std::shared_ptr<JsonFileList> list = std::make_shared<JsonFileList>(FileSystem, request->arg((size_t)0).c_str());
+      request->send(request->beginChunkedResponse("application/json", [request, list](uint8_t* buffer, size_t maxLength, size_t index)
       {
-        if (output != "[")
-        {
-          output += ',';
-        }
-        output += "{\"type\":\"file\",\"name\":\"";
-        output += String(entry.name());
-        output += "\",\"size\":";
-        output += String(entry.size());
-        output += "}";
-
-        entry = dir.openNextFile();
-      }
-
-      dir.close();
-
-      output += "]";
-      server.send(200, "application/json", output);
-      output = String();
+        size_t length = list->Read(buffer, maxLength);
+        Wifihandler.AddBytesOut(request, length);
+        return length;
+      }));
 
-      ESP_LOGI(TAG, "GET: Retrieving file list successful");
-      return true;
+      ESP_LOGI(TAG, "GET: Retrieving file list started");
+      return;
     }
-    else if (server.argName(0) == "download")
+    else if (request->argName(0) == "download")
     {
       ESP_LOGI(TAG, "Handle GET 'download'");
-
-      // Check if file exists
-      if (!SPIFFS.exists(server.arg(0)))
-      {
-        ESP_LOGE(TAG, "GET: Error downloading file, file missing");
-        server.send(404, "text/plain; charset=utf-8", "GET: Error downloading file, file missing");
-        return false;
-      }
-
-      // Open file
-      File file = SPIFFS.open(server.arg(0), FILE_READ);
-
-      // Get file name with extension and send as header
-      String fileName = server.arg(0);
-      int16_t lastSlashIndex = fileName.lastIndexOf('/');
-      if (lastSlashIndex != -1)
-      {
-        fileName = fileName.substring(lastSlashIndex + 1);
-      }
-      server.sendHeader("Content-Disposition", "attachment; filename=\"" + fileName + "\"");
-
-      // Stream file
-      server.streamFile(file, "application/octet-stream");
-      file.close();
-
-      ESP_LOGI(TAG, "GET: Downloading file successful");
-      return true;
+      SendDownload(request, request->arg((size_t)0));
+      return;
     }
     
     // Send '/edit.html'
     ESP_LOGI(TAG, "Handle GET edit page");
-    server.sendHeader("Content-Encoding", "gzip");
-    server.send_P(200, "text/html", (const char*)edit_html_gz, edit_html_gz_len);
-    return true;
+    Wifihandler.AddBytesOut(request, edit_html_gz_len);
+    AsyncWebServerResponse* response = request->beginResponse(200, "text/html", edit_html_gz, edit_html_gz_len);
+    response->addHeader("Content-Encoding", "gzip");
+    request->send(response);
+    return;
   }
-  else if (method == HTTP_DELETE)
+  else if (request->method() == HTTP_DELETE)
   {
     ESP_LOGI(TAG, "Handle DELETE");
 
     // Check for path param
-    if (server.argName(0) != "path")
+    if (request->argName(0) != "path")
     {
       ESP_LOGE(TAG, "DELETE: Error deleting file, path parameter missing");
-      server.send(404, "text/plain; charset=utf-8", "DELETE: Error deleting file, path parameter missing");
-      return false;
+      request->send(404, "text/plain; charset=utf-8", "DELETE: Error deleting file, path parameter missing");
+      return;
     }
 
     // Delete file from file system
-    if (!SPIFFS.remove(server.arg(0)))
+    if (!FileSystem.remove(request->arg((size_t)0)))
     {
       ESP_LOGE(TAG, "DELETE: Error deleting file, SPIFFS error");
-      server.send(404, "text/plain; charset=utf-8", "DELETE: Error deleting file, SPIFFS error");
-      return false;
+      request->send(404, "text/plain; charset=utf-8", "DELETE: Error deleting file, SPIFFS error");
+      return;
     }
 
-    ESP_LOGI(TAG, "DELETE: %s successful.", server.arg("path").c_str());
-    server.send(200, "text/plain; charset=utf-8", "DELETE: " + server.arg("path") + " successful.");
-    return true;
+    // Theme index has to parse the file again
+    ThemeIndex::Invalidate(request->arg((size_t)0));
+
+    // Gzip variant would be served instead of the deleted file
+    RemoveGzipVariant(request->arg((size_t)0).c_str());
+
+    // Transcoded image would be drawn instead of the deleted bitmap
+    char transcodedPath[SPIFFSEDITOR_MAXFILENAME];
+    if (SPIFFSBMPImage::GetTranscodedPath(request->arg((size_t)0).c_str(), transcodedPath, sizeof(transcodedPath)) &&
+      FileSystem.exists(transcodedPath))
+    {
+      FileSystem.remove(transcodedPath);
+    }
+
+    ESP_LOGI(TAG, "DELETE: %s successful.", request->arg("path").c_str());
+    request->send(200, "text/plain; charset=utf-8", "DELETE: " + request->arg("path") + " successful.");
+    return;
   }
-  else if (method == HTTP_POST)
+  else if (request->method() == HTTP_POST)
   {
     // Check for upload success
-    if (_uploadSuccess == false)
+    UploadState* state = (UploadState*)request->_tempObject;
+    if (!state || !state->success)
     {
-      ESP_LOGE(TAG, "UPLOAD: Error uploading file '%s'!", _fileName.c_str());
-      server.send(500, "text/plain; charset=utf-8", "UPLOAD: Error uploading file '" + _fileName + "'!");
-      _fileName = String();
-      return false;
+      String fileName = state ? state->fileName : "";
+      String error = state && state->error ? state->error : "Upload incomplete";
+      ESP_LOGE(TAG, "UPLOAD: Error uploading file '%s': %s", fileName.c_str(), error.c_str());
+      request->send(state && state->errorCode ? state->errorCode : 500, "text/plain; charset=utf-8", "UPLOAD: Error uploading file '" + fileName + "': " + error);
+      return;
     }
 
+    // Theme archives were installed and invalidated on completion
+    if (ThemeArchive::IsArchive(state->fileName))
+    {
+      ESP_LOGI(TAG, "UPLOAD: Installing '%s' successful.", state->fileName);
+      request->send(200, "text/plain", "UPLOAD: " + String(state->fileName) + " installed.");
+      return;
+    }
+
+    // Theme index has to parse the file again
+    ThemeIndex::Invalidate(state->fileName);
+
+    // Gzip variant of the former file would be served instead of the upload
+    // (Upload the gzip variant after the file)
+    RemoveGzipVariant(state->fileName);
+
     // Was all done in upload function
-    ESP_LOGI(TAG, "UPLOAD: Uploading '%s' successful.", _fileName.c_str());
-    server.send(200, "text/plain", "UPLOAD: " + _fileName + " successful.");
-    _uploadSuccess = false;
-    _fileName = String();
-    return true;
+    ESP_LOGI(TAG, "UPLOAD: Uploading '%s' successful.", state->fileName);
+    request->send(200, "text/plain", "UPLOAD: " + String(state->fileName) + " successful.");
+    return;
   }
   
   ESP_LOGE(TAG, "Unknown HTTP method!");
-  server.send(404, "text/plain; charset=utf-8", "Unknown HTTP method!");
-  return false;
+  request->send(404, "text/plain; charset=utf-8", "Unknown HTTP method!");
 }
 
 //===============================================================
 // Handles the upload
 //===============================================================
-void SPIFFSEditor::upload(WebServer &server, const String &requestUri, HTTPUpload &upload)
+void SPIFFSEditor::handleUpload(AsyncWebServerRequest* request, const String& fileName, size_t index, uint8_t* data, size_t length, bool final)
 {
-  if (upload.status == UPLOAD_FILE_START)
+  if (index == 0)
   {
-    _fileName = upload.filename;
-    ESP_LOGI(TAG, "Start uploading file '%s'", _fileName.c_str());
+    // Only one file per request
+    if (request->_tempObject)
+    {
+      return;
+    }
+
+    ESP_LOGI(TAG, "Start uploading file '%s'", fileName.c_str());
 
-    // Remove file if existing
-    if (SPIFFS.exists(_fileName))
+    // Create upload state, freed together with the request
+    UploadState* state = (UploadState*)malloc(sizeof(UploadState));
+    if (!state)
     {
-      ESP_LOGI(TAG, "Remove existing file");
-      SPIFFS.remove(_fileName);
+      ESP_LOGE(TAG, "Error uploading file, out of memory!");
+      return;
     }
+    memset(state, 0, sizeof(UploadState));
+    strlcpy(state->fileName, fileName.c_str(), sizeof(state->fileName));
+    request->_tempObject = state;
 
-    // Open the file for writing
-    ESP_LOGI(TAG, "Open the file for writing");
-    _fsUploadFile = SPIFFS.open(_fileName, FILE_WRITE);
-    _uploadSuccess = false;
+    if (!StartUpload(request, state))
+    {
+      return;
+    }
+  }
+
+  UploadState* state = (UploadState*)request->_tempObject;
+  if (!state ||
+    state->finished)
+  {
+    return;
   }
-  else if (upload.status == UPLOAD_FILE_WRITE)
+
+  // Checksums are calculated on the received bytes, flash is written in blocks
+  state->crc = esp_rom_crc32_le(state->crc, data, length);
+  if (state->checkSha)
+  {
+    mbedtls_sha256_update(&state->sha, data, length);
+  }
+  state->length += length;
+
+  while (length > 0)
   {
-    size_t written = 0;
-    if (_fsUploadFile)
+    size_t copyLength = min(length, (size_t)SPIFFSEDITOR_WRITEBUFFER - state->bufferLength);
+    memcpy(state->buffer + state->bufferLength, data, copyLength);
+    state->bufferLength += copyLength;
+    data += copyLength;
+    length -= copyLength;
+
+    if (state->bufferLength == SPIFFSEDITOR_WRITEBUFFER &&
+      !FlushUpload(request, state))
     {
-      // Write received bytes
-      written = _fsUploadFile.write(upload.buf, upload.currentSize);
-      if (written < upload.currentSize)
-      {
-        // Upload failed
-        _fsUploadFile.close();
-        ESP_LOGE(TAG, "Error uploading file!");
+      return;
+    }
+  }
+
+  if (final)
+  {
+    FinishUpload(request, state);
+  }
+}
+
+//===============================================================
+// Removes the temporary file of an unfinished upload
+//===============================================================
+void SPIFFSEditor::AbortUpload(AsyncWebServerRequest* request)
+{
+  UploadState* state = (UploadState*)request->_tempObject;
+  if (!TrackUpload(request, false) ||
+    !state ||
+    state->finished)
+  {
+    return;
+  }
+
+  ESP_LOGE(TAG, "Upload of '%s' aborted after %d bytes", state->fileName, state->length);
+  DiscardUpload(request, state, 500, "Connection lost");
+}
+
+//===============================================================
+// Starts an upload into a temporary file, returns false on errors
+//===============================================================
+bool SPIFFSEditor::StartUpload(AsyncWebServerRequest* request, UploadState* state)
+{
+  state->start_ms = millis();
+  state->keepOriginal = request->hasArg(SPIFFSEDITOR_KEEPARG);
+
+  // Temporary file is removed, when the client has gone
+  if (!TrackUpload(request, true))
+  {
+    DiscardUpload(request, state, 503, "Too many uploads");
+    return false;
+  }
+
+  // Optional checksums of the client
+  if (request->hasHeader(SPIFFSEDITOR_CRCHEADER))
+  {
+    uint8_t crc[4];
+    if (!ParseHex(request->header(SPIFFSEDITOR_CRCHEADER), crc, sizeof(crc)))
+    {
+      DiscardUpload(request, state, 400, "Invalid CRC32");
+      return false;
+    }
+    state->checkCrc = true;
+    state->expectedCrc = ((uint32_t)crc[0] << 24) | ((uint32_t)crc[1] << 16) | ((uint32_t)crc[2] << 8) | crc[3];
+  }
+  if (request->hasHeader(SPIFFSEDITOR_SHAHEADER))
+  {
+    if (!ParseHex(request->header(SPIFFSEDITOR_SHAHEADER), state->expectedSha, sizeof(state->expectedSha)))
+    {
+      DiscardUpload(request, state, 400, "Invalid SHA256");
+      return false;
+    }
+    state->checkSha = true;
+    mbedtls_sha256_init(&state->sha);
+    mbedtls_sha256_starts(&state->sha, 0);
+  }
+
+  // Write-behind buffer, so flash is written in large blocks instead of network segments
+  state->buffer = (uint8_t*)ps_malloc(SPIFFSEDITOR_WRITEBUFFER);
+  if (!state->buffer)
+  {
+    DiscardUpload(request, state, 500, "Out of memory");
+    return false;
+  }
+
+  // Theme archives are extracted into temporary files, without storing the archive
+  if (ThemeArchive::IsArchive(state->fileName))
+  {
+    char tempPrefix[THEMEARCHIVE_MAXPREFIX];
+    snprintf(tempPrefix, sizeof(tempPrefix), SPIFFSEDITOR_TEMPPREFIX "%u_", _tempCounter++);
+    state->archive = new ThemeArchive(tempPrefix);
+    return true;
+  }
+
+  // The existing file stays valid until the upload is complete
+  snprintf(state->tempName, sizeof(state->tempName), SPIFFSEDITOR_TEMPPREFIX "%u.tmp", _tempCounter++);
+  if (FileSystem.exists(state->tempName))
+  {
+    FileSystem.remove(state->tempName);
+  }
+  request->_tempFile = FileSystem.open(state->tempName, FILE_WRITE);
+  if (!request->_tempFile)
+  {
+    DiscardUpload(request, state, 500, "Could not create file");
+    return false;
+  }
+  return true;
+}
+
+//===============================================================
+// Writes the write-behind buffer to the temporary file
+//===============================================================
+bool SPIFFSEditor::FlushUpload(AsyncWebServerRequest* request, UploadState* state)
+{
+  if (state->bufferLength == 0)
+  {
+    return true;
+  }
+
+  if (state->archive)
+  {
+    if (!state->archive->Write(state->buffer, state->bufferLength))
+    {
+      DiscardUpload(request, state, 400, state->archive->GetError());
+      return false;
+    }
+    state->bufferLength = 0;
+    return true;
+  }
+
+  size_t written = request->_tempFile.write(state->buffer, state->bufferLength);
+  if (written < state->bufferLength)
+  {
+    // Delete file to free up space in filesystem
+    DiscardUpload(request, state, 507, "Not enough space");
+    return false;
+  }
+  state->bufferLength = 0;
+  return true;
+}
+
+//===============================================================
+// Verifies the upload and renames it into place
+//===============================================================
+bool SPIFFSEditor::FinishUpload(AsyncWebServerRequest* request, UploadState* state)
+{
+  if (!FlushUpload(request, state))
+  {
+    return false;
+  }
+  request->_tempFile.close();
+
+  // Verify the checksums of the client
+  if (state->checkCrc &&
+    state->crc != state->expectedCrc)
+  {
+    ESP_LOGE(TAG, "CRC32 mismatch: %08lx, expected %08lx", (unsigned long)state->crc, (unsigned long)state->expectedCrc);
+    DiscardUpload(request, state, 400, "Checksum mismatch");
+    return false;
+  }
+  if (state->checkSha)
+  {
+    uint8_t sha[32];
+    mbedtls_sha256_finish(&state->sha, sha);
+    if (memcmp(sha, state->expectedSha, sizeof(sha)) != 0)
+    {
+      ESP_LOGE(TAG, "SHA256 mismatch");
+      DiscardUpload(request, state, 400, "Checksum mismatch");
+      return false;
+    }
+  }
+
+  if (state->archive)
+  {
+    // Theme archive is installed, when all files are extracted and valid
+    if (!state->archive->Commit())
+    {
+      DiscardUpload(request, state, 400, state->archive->GetError());
+      return false;
+    }
+    for (uint8_t index = 0; index < state->archive->GetCount(); index++)
+    {
+      ThemeIndex::Invalidate(state->archive->GetFileName(index));
+      RemoveGzipVariant(state->archive->GetFileName(index));
+      TranscodeImage(state->archive->GetFileName(index), state->keepOriginal);
+    }
+  }
+  else
+  {
+    // The former file stays in place until the new one replaces it
+    char backupName[SPIFFSEDITOR_MAXFILENAME];
+    snprintf(backupName, sizeof(backupName), "%s.bak", state->tempName);
+    if (!FileSystem.Replace(state->tempName, state->fileName, backupName))
+    {
+      DiscardUpload(request, state, 500, "Could not rename file");
+      return false;
+    }
+    TranscodeImage(state->fileName, state->keepOriginal);
+  }
+
+  uint32_t elapsed_ms = max((uint32_t)1, (uint32_t)(millis() - state->start_ms));
+  ESP_LOGI(TAG, "Upload finished: %d bytes in %d ms (%d KB/s)%s", state->length, elapsed_ms, state->length * 1000 / 1024 / elapsed_ms,
+    state->checkCrc || state->checkSha ? ", checksum verified" : "");
+
+  DiscardUpload(request, state, 0, NULL);
+  state->success = true;
+  return true;
+}
+
+//===============================================================
+// Closes and removes the temporary file and frees the buffer
+//===============================================================
+void SPIFFSEditor::DiscardUpload(AsyncWebServerRequest* request, UploadState* state, uint16_t errorCode, const char* error)
+{
+  if (request->_tempFile)
+  {
+    request->_tempFile.close();
+  }
+  if (error &&
+    state->tempName[0] != '\0' &&
+    FileSystem.exists(state->tempName))
+  {
+    FileSystem.remove(state->tempName);
+  }
+  if (state->archive)
+  {
+    delete state->archive;
+    state->archive = NULL;
+  }
+  if (state->checkSha)
+  {
+    mbedtls_sha256_free(&state->sha);
+    state->checkSha = false;
+  }
+  if (state->buffer)
+  {
+    free(state->buffer);
+    state->buffer = NULL;
+  }
+  if (error)
+  {
+    ESP_LOGE(TAG, "Error uploading file '%s': %s", state->fileName, error);
+  }
+
+  state->errorCode = errorCode;
+  state->error = error;
+  state->finished = true;
+  TrackUpload(request, false);
+}
+
+//===============================================================
+// Sets or clears the entry of a request in the upload table
+//===============================================================
+bool SPIFFSEditor::TrackUpload(AsyncWebServerRequest* request, bool track)
+{
+  for (uint8_t index = 0; index < SPIFFSEDITOR_MAXUPLOADS; index++)
+  {
+    if (_uploads[index] == (track ? NULL : request))
+    {
+      _uploads[index] = track ? request : NULL;
+      return true;
+    }
+  }
+  return false;
+}
 
-        // Delete file to free up space in filesystem
-        SPIFFS.remove(_fileName);
-        return;
+//===============================================================
+// Removes temporary files of uploads interrupted by a reset
+//===============================================================
+void SPIFFSEditor::RemoveTempFiles()
+{
+  // Directory is read again after each removal
+  bool removed = true;
+  while (removed)
+  {
+    removed = false;
+    char path[SPIFFSEDITOR_MAXFILENAME] = "";
+
+    File root = FileSystem.open("/");
+    File entry = root ? root.openNextFile() : File();
+    while (entry)
+    {
+      if (strncmp(entry.path(), SPIFFSEDITOR_TEMPPREFIX, strlen(SPIFFSEDITOR_TEMPPREFIX)) == 0)
+      {
+        strlcpy(path, entry.path(), sizeof(path));
+        entry.close();
+        break;
       }
+      entry = root.openNextFile();
+    }
+    root.close();
+
+    if (path[0] != '\0')
+    {
+      ESP_LOGI(TAG, "Remove temporary file '%s'", path);
+      removed = FileSystem.remove(path);
+    }
+  }
+}
+
+//===============================================================
+// Parses a hex string into bytes, returns false on invalid strings
+//===============================================================
+bool SPIFFSEditor::ParseHex(const String& text, uint8_t* bytes, size_t length)
+{
+  if (text.length() != length * 2)
+  {
+    return false;
+  }
+
+  for (size_t index = 0; index < length * 2; index++)
+  {
+    char character = text[index];
+    uint8_t nibble = 0;
+    if (character >= '0' && character <= '9')
+    {
+      nibble = character - '0';
+    }
+    else if (character >= 'a' && character <= 'f')
+    {
+      nibble = character - 'a' + 10;
+    }
+    else if (character >= 'A' && character <= 'F')
+    {
+      nibble = character - 'A' + 10;
+    }
+    else
+    {
+      return false;
+    }
+    bytes[index / 2] = (index % 2) ? (bytes[index / 2] | nibble) : (nibble << 4);
+  }
+  return true;
+}
+
+//===============================================================
+// Sends a file or the requested range of it as attachment. The
+// response reads the file in limited parts while the client
+// acknowledges, so the task of the TCP stack is only busy for
+// one part at a time
+//===============================================================
+void SPIFFSEditor::SendDownload(AsyncWebServerRequest* request, const String& path)
+{
+  // Check if file exists
+  if (!FileSystem.exists(path))
+  {
+    ESP_LOGE(TAG, "GET: Error downloading file, file missing");
+    request->send(404, "text/plain; charset=utf-8", "GET: Error downloading file, file missing");
+    return;
+  }
+
+  std::shared_ptr<DownloadState> download = std::make_shared<DownloadState>();
+  download->file = FileSystem.open(path, FILE_READ);
+  if (!download->file ||
+    download->file.isDirectory())
+  {
+    ESP_LOGE(TAG, "GET: Error downloading file, SPIFFS error");
+    request->send(404, "text/plain; charset=utf-8", "GET: Error downloading file, SPIFFS error");
+    return;
+  }
+  uint32_t size = download->file.size();
+
+  // Large files are identified by their write time, so they are never read at once. The
+  // write time has a resolution of seconds, so their ETag is weak
+  char etag[ETAGCACHE_LENGTH];
+  bool weak = size > SPIFFSEDITOR_HASHMAXSIZE;
+  uint32_t crc = weak ?
+    (uint32_t)download->file.getLastWrite() :
+    _etags.GetCrc(path.c_str(), false, &download->file, NULL, size);
+  ETagCache::Format(etag, sizeof(etag), crc, size, weak);
+
+  // Range is ignored, if the file has changed since the first part ('If-Range', only strong ETags match)
+  uint32_t start = 0;
+  uint32_t end = size > 0 ? size - 1 : 0;
+  RangeResult range = eRangeNone;
+  const AsyncWebHeader* rangeHeader = request->getHeader("Range");
+  const AsyncWebHeader* ifRangeHeader = request->getHeader("If-Range");
+  if (rangeHeader &&
+    (!ifRangeHeader || (!weak && ifRangeHeader->value() == etag)))
+  {
+    range = ParseRange(rangeHeader->value(), size, &start, &end);
+  }
+
+  char contentRange[48];
+  if (range == eRangeNotSatisfiable)
+  {
+    ESP_LOGE(TAG, "GET: Range '%s' not satisfiable (%d bytes)", rangeHeader->value().c_str(), size);
+    snprintf(contentRange, sizeof(contentRange), "bytes */%lu", (unsigned long)size);
+    AsyncWebServerResponse* response = request->beginResponse(416);
+    response->addHeader("Content-Range", contentRange);
+    response->addHeader("ETag", etag);
+    request->send(response);
+    return;
+  }
+
+  download->start = start;
+  download->length = size > 0 ? end - start + 1 : 0;
+  download->file.seek(start);
+  AsyncWebServerResponse* response = request->beginResponse("application/octet-stream", download->length, [request, download](uint8_t* buffer, size_t maxLength, size_t index)
+  {
+    if (index >= download->length)
+    {
+      return (size_t)0;
+    }
+    if (download->file.position() != download->start + index)
+    {
+      download->file.seek(download->start + index);
     }
+    size_t length = min(min(maxLength, (size_t)SPIFFSEDITOR_DOWNLOADCHUNK), (size_t)(download->length - index));
+    length = download->file.read(buffer, length);
+    Wifihandler.AddBytesOut(request, length);
+    return length;
+  });
 
-    ESP_LOGI(TAG, "SPIFFS free: %d of %d", SPIFFS.usedBytes(), SPIFFS.totalBytes());
-    ESP_LOGI(TAG, "SPIFFS written: %d of %d", written, upload.currentSize);
-    ESP_LOGI(TAG, "SPIFFS totalSize: %d", upload.currentSize + upload.totalSize);
+  // Sends the file name as header
+  String fileName = path.substring(path.lastIndexOf('/') + 1);
+  response->addHeader("Content-Disposition", "attachment; filename=\"" + fileName + "\"");
+  response->addHeader("Accept-Ranges", "bytes");
+  response->addHeader("ETag", etag);
+  if (range == eRangeValid)
+  {
+    snprintf(contentRange, sizeof(contentRange), "bytes %lu-%lu/%lu", (unsigned long)start, (unsigned long)end, (unsigned long)size);
+    response->setCode(206);
+    response->addHeader("Content-Range", contentRange);
+  }
+  request->send(response);
+
+  ESP_LOGI(TAG, "GET: Downloading '%s' started (%d of %d bytes from %d)", path.c_str(), download->length, size, start);
+}
+
+//===============================================================
+// Parses a single byte range. Invalid or multiple ranges are
+// ignored, so the whole file is sent (RFC 9110)
+//===============================================================
+SPIFFSEditor::RangeResult SPIFFSEditor::ParseRange(const String& header, uint32_t size, uint32_t* start, uint32_t* end)
+{
+  if (!header.startsWith("bytes=") ||
+    header.indexOf(',') >= 0)
+  {
+    return eRangeNone;
   }
-  else if (upload.status == UPLOAD_FILE_END)
+
+  const char* text = header.c_str() + 6;
+  const char* dash = strchr(text, '-');
+  if (!dash)
   {
-    // Close the file
-    if (_fsUploadFile)
+    return eRangeNone;
+  }
+
+  char* parseEnd = NULL;
+  if (dash == text)
+  {
+    // Suffix range: Last bytes of the file
+    unsigned long suffix = strtoul(dash + 1, &parseEnd, 10);
+    if (parseEnd == dash + 1 ||
+      *parseEnd != '\0')
     {
-      _fsUploadFile.close();
-      _uploadSuccess = true;
-      ESP_LOGI(TAG, "Upload finished: %d bytes uploaded", upload.totalSize);
+      return eRangeNone;
     }
+    if (suffix == 0 ||
+      size == 0)
+    {
+      return eRangeNotSatisfiable;
+    }
+    *start = size - min((uint32_t)suffix, size);
+    *end = size - 1;
+    return eRangeValid;
+  }
+
+  unsigned long first = strtoul(text, &parseEnd, 10);
+  if (parseEnd != dash)
+  {
+    return eRangeNone;
+  }
+  unsigned long last = size > 0 ? size - 1 : 0;
+  if (dash[1] != '\0')
+  {
+    last = strtoul(dash + 1, &parseEnd, 10);
+    if (*parseEnd != '\0' ||
+      last < first)
+    {
+      return eRangeNone;
+    }
+  }
+  if (first >= size)
+  {
+    return eRangeNotSatisfiable;
+  }
+
+  *start = first;
+  *end = min((uint32_t)last, size - 1);
+  return eRangeValid;
+}
+
+//===============================================================
+// Removes the gzip variant of a file (Not for gzip files)
+//===============================================================
+void SPIFFSEditor::RemoveGzipVariant(const char* fileName)
+{
+  size_t length = strlen(fileName);
+  if (length >= 3 &&
+    strcmp(fileName + length - 3, ".gz") == 0)
+  {
+    return;
+  }
+
+  char gzipPath[SPIFFSEDITOR_MAXFILENAME + 3];
+  snprintf(gzipPath, sizeof(gzipPath), "%s.gz", fileName);
+  if (FileSystem.exists(gzipPath))
+  {
+    ESP_LOGI(TAG, "Remove gzip variant '%s'", gzipPath);
+    FileSystem.remove(gzipPath);
+  }
+}
+
+//===============================================================
+// Transcodes an uploaded bitmap into the format of the display,
+// so images are not converted again at each load. Bitmaps which
+// can not be transcoded are kept and loaded as before
+//===============================================================
+void SPIFFSEditor::TranscodeImage(const char* fileName, bool keepOriginal)
+{
+  char transcodedPath[SPIFFSEDITOR_MAXFILENAME];
+  if (!SPIFFSBMPImage::GetTranscodedPath(fileName, transcodedPath, sizeof(transcodedPath)))
+  {
+    return;
+  }
+
+  // Former transcoded image would be drawn instead of the new bitmap
+  if (FileSystem.exists(transcodedPath))
+  {
+    FileSystem.remove(transcodedPath);
+  }
+
+  uint32_t startTime_ms = millis();
+  SPIFFSBMPImage image;
+  File file = FileSystem.open(fileName, FILE_READ);
+  ImageReturnCode returnCode = file ? image.Allocate(&file, 0, fileName) : IMAGE_ERR_FILE_NOT_FOUND;
+  file.close();
+  if (returnCode == IMAGE_SUCCESS)
+  {
+    returnCode = image.SaveTranscoded(transcodedPath);
+  }
+  if (returnCode != IMAGE_SUCCESS)
+  {
+    ESP_LOGE(TAG, "Could not transcode '%s', kept as bitmap: %s", fileName, SPIFFSBMPImage::PrintStatus(returnCode));
+    return;
+  }
+
+  ESP_LOGI(TAG, "Transcoded '%s' in %d ms", fileName, millis() - startTime_ms);
+  if (!keepOriginal)
+  {
+    FileSystem.remove(fileName);
   }
 }
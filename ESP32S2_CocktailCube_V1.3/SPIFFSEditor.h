@@ -13,35 +13,146 @@
 // Includes
 //===============================================================
 #include <Arduino.h>
-#include <SPIFFS.h>
-#include <WebServer.h>
+#include <memory>
+#include <ESPAsyncWebServer.h>
+#include <esp_rom_crc.h>
+#include <mbedtls/sha256.h>
+#include "FileSystem.h"
 #include "SystemHelper.h"
+#include "ThemeIndex.h"
+#include "JsonFileList.h"
+#include "ThemeArchive.h"
+#include "SPIFFSBMPImage.h"
+#include "ETagCache.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define SPIFFSEDITOR_MAXFILENAME      32          // Same as SPIFFS object names
+#define SPIFFSEDITOR_WRITEBUFFER      8192        // Write-behind buffer of an upload (PSRAM)
+#define SPIFFSEDITOR_MAXUPLOADS       4           // Uploads at the same time
+#define SPIFFSEDITOR_TEMPPREFIX       "/~upload"  // Temporary files of uploads, renamed into place when verified
+#define SPIFFSEDITOR_CRCHEADER        "X-Upload-CRC32"
+#define SPIFFSEDITOR_SHAHEADER        "X-Upload-SHA256"
+#define SPIFFSEDITOR_KEEPARG          "keepbmp"   // Upload argument to keep bitmaps next to the transcoded image
+#define SPIFFSEDITOR_DOWNLOADCHUNK    4096        // Maximum file read per response buffer
+#define SPIFFSEDITOR_HASHMAXSIZE      65536       // Larger downloads get a weak ETag of the write time instead of the checksum
 
 //===============================================================
 // SPIFFS editor class
+// Uploads keep their state in the request, so several clients
+// can use the editor at the same time. Received chunks are
+// collected in a write-behind buffer and written in large blocks
+// to a temporary file. The file is renamed into place, when the
+// upload is complete and matches the optional checksum of the
+// client (Headers 'X-Upload-CRC32' or 'X-Upload-SHA256' in hex),
+// so a dropped connection never leaves a half-written file.
+// Theme archives (.tar) are extracted while they are received and
+// only installed, if all files are valid. Bitmaps are transcoded
+// once at upload, the bitmap is only kept with '?keepbmp'.
+// Downloads support single byte ranges ('Range', 'If-Range'), so
+// interrupted downloads are resumed instead of restarted
 //===============================================================
-class SPIFFSEditor: public RequestHandler
+class SPIFFSEditor: public AsyncWebHandler
 {
   public:
     // Constructor
     SPIFFSEditor();
 
     // Returns true, if the handler can handle the request
-    bool canHandle(WebServer &server, HTTPMethod method, const String &uri) override final;
-
-    // Returns true if the handler can upload the file
-    bool canUpload(WebServer &server, const String &uri) override final;
+    bool canHandle(AsyncWebServerRequest* request) const override final;
 
     // Handles the request
-    bool handle(WebServer &server, HTTPMethod method, const String &requestUri) override final;
+    void handleRequest(AsyncWebServerRequest* request) override final;
 
     // Handles the upload
-    void upload(WebServer &server, const String &requestUri, HTTPUpload &upload) override final;
+    void handleUpload(AsyncWebServerRequest* request, const String& fileName, size_t index, uint8_t* data, size_t length, bool final) override final;
+
+    // Returns false, the handler needs the request body
+    bool isRequestHandlerTrivial() const override final { return false; }
+
+    // Removes the temporary file of an unfinished upload (Client has gone)
+    static void AbortUpload(AsyncWebServerRequest* request);
   
   private:
-    File _fsUploadFile;
-    String _fileName = String();
-    bool _uploadSuccess = false;
+    // Result of the range header
+    enum RangeResult : uint8_t
+    {
+      eRangeNone = 0,           // No or ignored range, whole file is sent
+      eRangeValid = 1,          // Part of the file is sent
+      eRangeNotSatisfiable = 2  // Range outside of the file
+    };
+
+    // Download of a request (Freed together with the response)
+    struct DownloadState
+    {
+      File file;
+      uint32_t start;
+      uint32_t length;
+    };
+
+    // Checksums of downloaded files
+    ETagCache _etags;
+
+    // Upload state of a request (Freed together with the request)
+    struct UploadState
+    {
+      bool success;
+      bool finished;
+      uint16_t errorCode;
+      const char* error;
+      char fileName[SPIFFSEDITOR_MAXFILENAME];
+      char tempName[SPIFFSEDITOR_MAXFILENAME];
+      uint8_t* buffer;
+      size_t bufferLength;
+      uint32_t length;
+      uint32_t start_ms;
+      uint32_t crc;
+      bool checkCrc;
+      uint32_t expectedCrc;
+      bool checkSha;
+      uint8_t expectedSha[32];
+      mbedtls_sha256_context sha;
+      ThemeArchive* archive;
+      bool keepOriginal;
+    };
+
+    // Requests with unfinished uploads (Only changed in the task of the TCP stack)
+    static AsyncWebServerRequest* _uploads[SPIFFSEDITOR_MAXUPLOADS];
+    static uint8_t _tempCounter;
+
+    // Starts an upload into a temporary file, returns false on errors
+    static bool StartUpload(AsyncWebServerRequest* request, UploadState* state);
+
+    // Writes the write-behind buffer to the temporary file, returns false on errors
+    static bool FlushUpload(AsyncWebServerRequest* request, UploadState* state);
+
+    // Verifies the upload and renames it into place, returns false on errors
+    static bool FinishUpload(AsyncWebServerRequest* request, UploadState* state);
+
+    // Closes and removes the temporary file and frees the buffer
+    static void DiscardUpload(AsyncWebServerRequest* request, UploadState* state, uint16_t errorCode, const char* error);
+
+    // Sets or clears the entry of a request in the upload table
+    static bool TrackUpload(AsyncWebServerRequest* request, bool track);
+
+    // Removes temporary files of uploads interrupted by a reset
+    static void RemoveTempFiles();
+
+    // Parses a hex string into bytes, returns false on invalid strings
+    static bool ParseHex(const String& text, uint8_t* bytes, size_t length);
+
+    // Sends a file or the requested range of it as attachment
+    void SendDownload(AsyncWebServerRequest* request, const String& path);
+
+    // Parses a single byte range ('bytes=first-last', 'bytes=first-' or 'bytes=-suffix')
+    static RangeResult ParseRange(const String& header, uint32_t size, uint32_t* start, uint32_t* end);
+
+    // Removes the gzip variant of a file (Not for gzip files)
+    static void RemoveGzipVariant(const char* fileName);
+
+    // Transcodes an uploaded bitmap, the bitmap is removed unless it should be kept
+    static void TranscodeImage(const char* fileName, bool keepOriginal);
 };
 
 #endif
@@ -0,0 +1,451 @@
+/*
+ * Includes the screen saver engine
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "ScreenSaver.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "screensaver";
+
+// Start distance of each star ring (Every ring is two pixels long)
+static const int8_t StarRingStarts[SCREENSAVER_STARRINGS] = { 1, 4, 7, 10, 13 };
+
+// Directions of the star tails (Orthogonal first, diagonal for full stars)
+static const int8_t StarDirections[8][2] =
+{
+  {  0, -1 }, {  0,  1 }, {  1,  0 }, { -1,  0 },
+  {  1, -1 }, { -1, -1 }, {  1,  1 }, { -1,  1 }
+};
+
+//===============================================================
+// Constructor
+//===============================================================
+ScreenSaver::ScreenSaver()
+{
+  // Precalculate the pixel offsets of all star rings
+  for (uint8_t ring = 0; ring < SCREENSAVER_STARRINGS; ring++)
+  {
+    for (uint8_t direction = 0; direction < 8; direction++)
+    {
+      for (uint8_t step = 0; step < 2; step++)
+      {
+        int8_t distance = StarRingStarts[ring] + step;
+        _starOffsets[ring][direction * 2 + step][0] = StarDirections[direction][0] * distance;
+        _starOffsets[ring][direction * 2 + step][1] = StarDirections[direction][1] * distance;
+      }
+    }
+  }
+}
+
+//===============================================================
+// Destructor
+//===============================================================
+ScreenSaver::~ScreenSaver()
+{
+  FreeLogo();
+}
+
+//===============================================================
+// Initializes the screen saver for a logo
+// Copies the logo to a RGB565 buffer and builds an occlusion
+// mask, so no palette lookups are needed while animating
+//===============================================================
+void ScreenSaver::Begin(SPIFFSBMPImage* logo, uint16_t foregroundColor, uint16_t backgroundColor)
+{
+  FreeLogo();
+
+  _logo = logo;
+  _foregroundColor = foregroundColor;
+  _backgroundColor = backgroundColor;
+  _isLogoDrawn = false;
+
+  if (_logo && _logo->IsValid())
+  {
+    _logoWidth = _logo->Width();
+    _logoHeight = _logo->Height();
+
+    uint32_t pixelCount = (uint32_t)_logoWidth * _logoHeight;
+    _logoPixels = (uint16_t*)ps_malloc(pixelCount * sizeof(uint16_t));
+    if (!_logoPixels)
+    {
+      _logoPixels = (uint16_t*)malloc(pixelCount * sizeof(uint16_t));
+    }
+    _logoMask = (uint8_t*)calloc((pixelCount + 7) / 8, sizeof(uint8_t));
+
+    if (_logoPixels && _logoMask)
+    {
+      for (int16_t y = 0; y < _logoHeight; y++)
+      {
+        for (int16_t x = 0; x < _logoWidth; x++)
+        {
+          uint32_t index = (uint32_t)y * _logoWidth + x;
+          uint16_t color = _logo->GetPixel(x, y);
+          _logoPixels[index] = color;
+          if (color != _logo->TransparencyColor())
+          {
+            _logoMask[index >> 3] |= 1 << (index & 7);
+          }
+        }
+      }
+    }
+    else
+    {
+      // Without buffers the logo is moved by the image itself
+      ESP_LOGE(TAG, "Failed to allocate logo buffers (%dx%d), using image fallback", _logoWidth, _logoHeight);
+      FreeLogo();
+      _logo = logo;
+      _logoWidth = _logo->Width();
+      _logoHeight = _logo->Height();
+    }
+  }
+  else
+  {
+    _logoWidth = 0;
+    _logoHeight = 0;
+  }
+
+  // Start all stars from scratch (Screen was cleared)
+  for (uint8_t index = 0; index < SCREENSAVER_STARCOUNT; index++)
+  {
+    ResetStar(&_stars[index]);
+  }
+  _nextStarIndex = 0;
+
+  // Reset timing and statistics
+  _nextFrame_ms = millis();
+  _statsStart_ms = millis();
+  _busyTime_us = 0;
+  _frameCount = 0;
+  _budgetOverruns = 0;
+}
+
+//===============================================================
+// Draws a frame if due and returns the time until the next frame
+//===============================================================
+uint32_t ScreenSaver::Update(Adafruit_SPITFT* tft)
+{
+  const uint32_t framePeriod_ms = 1000 / SCREENSAVER_FRAMERATE;
+
+  uint32_t now = millis();
+  if ((int32_t)(_nextFrame_ms - now) > 0)
+  {
+    return _nextFrame_ms - now;
+  }
+
+  // Keep the frame rate, but do not catch up on frames missed by other tasks
+  _nextFrame_ms += framePeriod_ms;
+  if ((int32_t)(now - _nextFrame_ms) >= 0)
+  {
+    _nextFrame_ms = now + framePeriod_ms;
+  }
+
+  DrawFrame(tft);
+
+  now = millis();
+  return (int32_t)(_nextFrame_ms - now) > 0 ? _nextFrame_ms - now : 0;
+}
+
+//===============================================================
+// Draws the next frame immediately
+// Stars are animated round robin until the frame budget is used,
+// remaining stars continue in the next frame
+//===============================================================
+void ScreenSaver::DrawFrame(Adafruit_SPITFT* tft)
+{
+  uint32_t startTime_us = micros();
+
+  // Move logo
+  int16_t lastLogoX = _logoX;
+  int16_t lastLogoY = _logoY;
+  int16_t logoX = _logoX + _xDir;
+  int16_t logoY = _logoY + _yDir;
+  MoveLogo(tft, logoX, logoY);
+
+  // Impact collision with the left or right edge
+  if (logoX <= -_logoWidth / 2 || logoX >= SCREENSAVER_WIDTH - _logoWidth / 2)
+  {
+    _xDir = -_xDir;
+  }
+
+  // Impact collision with the top or bottom edge
+  if (logoY <= -_logoHeight / 2 || logoY >= SCREENSAVER_HEIGHT - _logoHeight / 2)
+  {
+    _yDir = -_yDir;
+  }
+
+  // Area written by the logo move (Stars inside have to be drawn completely)
+  int16_t movedX0 = min(lastLogoX, logoX);
+  int16_t movedY0 = min(lastLogoY, logoY);
+  int16_t movedX1 = max(lastLogoX, logoX) + _logoWidth;
+  int16_t movedY1 = max(lastLogoY, logoY) + _logoHeight;
+
+  // Draw stars
+  tft->startWrite();
+  for (uint8_t count = 0; count < SCREENSAVER_STARCOUNT; count++)
+  {
+    if (count > 0 && micros() - startTime_us > SCREENSAVER_FRAMEBUDGET_US)
+    {
+      _budgetOverruns++;
+      break;
+    }
+
+    Star& star = _stars[_nextStarIndex];
+    _nextStarIndex = (_nextStarIndex + 1) % SCREENSAVER_STARCOUNT;
+
+    // Init new star, if star animation finished
+    if (star.Size >= star.MaxSize)
+    {
+      DrawStar(tft, star, _backgroundColor, true);
+      ResetStar(&star);
+    }
+
+    // Draw only the newest ring, unless the logo wrote over the star
+    bool isTouched = _logoWidth > 0 &&
+      star.X + SCREENSAVER_STARRADIUS >= movedX0 && star.X - SCREENSAVER_STARRADIUS < movedX1 &&
+      star.Y + SCREENSAVER_STARRADIUS >= movedY0 && star.Y - SCREENSAVER_STARRADIUS < movedY1;
+    DrawStar(tft, star, _foregroundColor, isTouched);
+
+    // Increment star size
+    star.Size++;
+  }
+  tft->endWrite();
+
+  // Update statistics
+  _busyTime_us += micros() - startTime_us;
+  _frameCount++;
+
+  uint32_t elapsed_ms = millis() - _statsStart_ms;
+  if (elapsed_ms >= SCREENSAVER_STATSINTERVAL_MS)
+  {
+    ESP_LOGI(TAG, "%.1f fps, CPU load %.1f%%, %lu us/frame, %lu budget overruns",
+      _frameCount * 1000.0 / elapsed_ms,
+      GetCpuLoad(),
+      (unsigned long)(_busyTime_us / _frameCount),
+      (unsigned long)_budgetOverruns);
+
+    _statsStart_ms = millis();
+    _busyTime_us = 0;
+    _frameCount = 0;
+    _budgetOverruns = 0;
+  }
+}
+
+//===============================================================
+// Returns the CPU load of the current statistics interval
+//===============================================================
+double ScreenSaver::GetCpuLoad()
+{
+  uint32_t elapsed_ms = millis() - _statsStart_ms;
+  if (elapsed_ms == 0)
+  {
+    return 0.0;
+  }
+  return _busyTime_us / (elapsed_ms * 10.0);
+}
+
+//===============================================================
+// Frees the logo buffers
+//===============================================================
+void ScreenSaver::FreeLogo()
+{
+  if (_logoPixels)
+  {
+    free(_logoPixels);
+    _logoPixels = NULL;
+  }
+  if (_logoMask)
+  {
+    free(_logoMask);
+    _logoMask = NULL;
+  }
+  _logo = NULL;
+}
+
+//===============================================================
+// Returns true if the logo covers a screen pixel
+//===============================================================
+bool ScreenSaver::IsLogoPixel(int16_t x, int16_t y)
+{
+  int16_t logoX = x - _logoX;
+  int16_t logoY = y - _logoY;
+  if (!_isLogoDrawn || logoX < 0 || logoY < 0 || logoX >= _logoWidth || logoY >= _logoHeight)
+  {
+    return false;
+  }
+
+  if (!_logoMask)
+  {
+    return _logo->GetPixel(logoX, logoY) != _logo->TransparencyColor();
+  }
+
+  uint32_t index = (uint32_t)logoY * _logoWidth + logoX;
+  return (_logoMask[index >> 3] & (1 << (index & 7))) != 0;
+}
+
+//===============================================================
+// Moves the logo and draws only changed pixels
+// Changed pixels of a row are merged into spans. Short gaps of
+// unchanged logo pixels are resent to save address windows, but
+// transparent pixels are never written because of the stars
+//===============================================================
+void ScreenSaver::MoveLogo(Adafruit_SPITFT* tft, int16_t x, int16_t y)
+{
+  if (_logoWidth <= 0 || _logoHeight <= 0)
+  {
+    _logoX = x;
+    _logoY = y;
+    return;
+  }
+
+  // Fallback without buffers
+  if (!_logoPixels)
+  {
+    _logo->Move(_logoX, _logoY, x, y, tft, _backgroundColor);
+    _logoX = x;
+    _logoY = y;
+    _isLogoDrawn = true;
+    return;
+  }
+
+  int16_t oldX = _logoX;
+  int16_t oldY = _logoY;
+  bool isOldDrawn = _isLogoDrawn;
+
+  int16_t x0 = max(isOldDrawn ? min(oldX, x) : x, (int16_t)0);
+  int16_t y0 = max(isOldDrawn ? min(oldY, y) : y, (int16_t)0);
+  int16_t x1 = min((int16_t)((isOldDrawn ? max(oldX, x) : x) + _logoWidth), (int16_t)SCREENSAVER_WIDTH);
+  int16_t y1 = min((int16_t)((isOldDrawn ? max(oldY, y) : y) + _logoHeight), (int16_t)SCREENSAVER_HEIGHT);
+
+  for (int16_t screenY = y0; screenY < y1; screenY++)
+  {
+    int16_t spanStart = -1;
+    int16_t spanEnd = -1;
+    int16_t gap = 0;
+
+    for (int16_t screenX = x0; screenX <= x1; screenX++)
+    {
+      bool isChanged = false;
+      bool isKnown = false;
+      uint16_t color = _backgroundColor;
+
+      if (screenX < x1)
+      {
+        // Old logo pixel
+        bool isOldOpaque = false;
+        uint16_t oldColor = 0;
+        int16_t logoX = screenX - oldX;
+        int16_t logoY = screenY - oldY;
+        if (isOldDrawn && logoX >= 0 && logoY >= 0 && logoX < _logoWidth && logoY < _logoHeight)
+        {
+          uint32_t index = (uint32_t)logoY * _logoWidth + logoX;
+          isOldOpaque = (_logoMask[index >> 3] & (1 << (index & 7))) != 0;
+          oldColor = _logoPixels[index];
+        }
+
+        // New logo pixel
+        logoX = screenX - x;
+        logoY = screenY - y;
+        if (logoX >= 0 && logoY >= 0 && logoX < _logoWidth && logoY < _logoHeight)
+        {
+          uint32_t index = (uint32_t)logoY * _logoWidth + logoX;
+          if (_logoMask[index >> 3] & (1 << (index & 7)))
+          {
+            color = _logoPixels[index];
+            isKnown = true;
+            isChanged = !isOldOpaque || oldColor != color;
+          }
+        }
+
+        // Old pixel uncovered
+        if (!isKnown && isOldOpaque)
+        {
+          color = _backgroundColor;
+          isKnown = true;
+          isChanged = true;
+        }
+      }
+
+      if (isChanged)
+      {
+        if (spanStart < 0)
+        {
+          spanStart = screenX;
+        }
+        _rowBuffer[screenX - spanStart] = color;
+        spanEnd = screenX;
+        gap = 0;
+      }
+      else if (spanStart >= 0 && isKnown && gap < SCREENSAVER_SPANGAP)
+      {
+        _rowBuffer[screenX - spanStart] = color;
+        gap++;
+      }
+      else if (spanStart >= 0)
+      {
+        tft->drawRGBBitmap(spanStart, screenY, _rowBuffer, spanEnd - spanStart + 1, 1);
+        spanStart = -1;
+        gap = 0;
+      }
+    }
+  }
+
+  _logoX = x;
+  _logoY = y;
+  _isLogoDrawn = true;
+}
+
+//===============================================================
+// Initializes a star at a random position
+//===============================================================
+void ScreenSaver::ResetStar(Star* star)
+{
+  star->X = random(0, SCREENSAVER_WIDTH);
+  star->Y = random(0, SCREENSAVER_HEIGHT);
+  star->MaxSize = random(1, 6);
+  star->FullStars = random(0, 12) < 6 ? true : false;
+  star->Size = 0;
+}
+
+//===============================================================
+// Draws a star completely or only its newest ring
+//===============================================================
+void ScreenSaver::DrawStar(Adafruit_SPITFT* tft, const Star& star, uint16_t color, bool isComplete)
+{
+  int16_t rings = min(star.Size, (int16_t)SCREENSAVER_STARRINGS);
+  int16_t firstRing = isComplete ? 0 : max(rings - 1, 0);
+  uint8_t pixelCount = star.FullStars ? 16 : 8;
+
+  if (isComplete || star.Size == 0)
+  {
+    DrawStarPixel(tft, star.X, star.Y, color);
+  }
+
+  for (int16_t ring = firstRing; ring < rings; ring++)
+  {
+    for (uint8_t index = 0; index < pixelCount; index++)
+    {
+      DrawStarPixel(tft, star.X + _starOffsets[ring][index][0], star.Y + _starOffsets[ring][index][1], color);
+    }
+  }
+}
+
+//===============================================================
+// Draws a single star pixel if not covered by the logo
+//===============================================================
+void ScreenSaver::DrawStarPixel(Adafruit_SPITFT* tft, int16_t x, int16_t y, uint16_t color)
+{
+  if (x < 0 || y < 0 || x >= SCREENSAVER_WIDTH || y >= SCREENSAVER_HEIGHT || IsLogoPixel(x, y))
+  {
+    return;
+  }
+  tft->writePixel(x, y, color);
+}
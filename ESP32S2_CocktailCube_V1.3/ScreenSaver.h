@@ -0,0 +1,121 @@
+/*
+ * Includes the screen saver engine
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef SCREENSAVER_H
+#define SCREENSAVER_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <esp_log.h>
+#include "SPIFFSBMPImage.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define SCREENSAVER_WIDTH           240
+#define SCREENSAVER_HEIGHT          240
+#define SCREENSAVER_STARCOUNT       30
+#define SCREENSAVER_STARRINGS       5     // Rings of a star with maximum size
+#define SCREENSAVER_STARRADIUS      14    // Outer pixel of the last ring
+#define SCREENSAVER_FRAMERATE       30    // Frames per second
+#define SCREENSAVER_FRAMEBUDGET_US  8000  // CPU time per frame, remaining stars are animated in the next frame
+#define SCREENSAVER_SPANGAP         8     // Unchanged logo pixels which are resent instead of opening a new address window
+#define SCREENSAVER_STATSINTERVAL_MS 10000
+
+//===============================================================
+// Class for screen saver stars
+//===============================================================
+class Star
+{
+  public:
+    int16_t X = 0;
+    int16_t Y = 0;
+    int16_t Size = 5;
+    int16_t MaxSize = 0;
+    bool FullStars = false;
+};
+
+//===============================================================
+// Class for the screen saver (Bouncing logo and star field)
+//===============================================================
+class ScreenSaver
+{
+  public:
+    // Constructor
+    ScreenSaver();
+
+    // Destructor
+    ~ScreenSaver();
+
+    // Initializes the screen saver for a logo (Screen must be cleared before)
+    void Begin(SPIFFSBMPImage* logo, uint16_t foregroundColor, uint16_t backgroundColor);
+
+    // Draws a frame if due and returns the time until the next frame in ms
+    uint32_t Update(Adafruit_SPITFT* tft);
+
+    // Draws the next frame immediately
+    void DrawFrame(Adafruit_SPITFT* tft);
+
+    // Returns the CPU load of the current statistics interval in percent
+    double GetCpuLoad();
+
+  private:
+    // Logo variables
+    SPIFFSBMPImage* _logo = NULL;
+    int16_t _logoWidth = 0;
+    int16_t _logoHeight = 0;
+    uint16_t* _logoPixels = NULL;
+    uint8_t* _logoMask = NULL;
+    bool _isLogoDrawn = false;
+    int16_t _logoX = 10;
+    int16_t _logoY = SCREENSAVER_HEIGHT / 2;
+    int16_t _xDir = 1;
+    int16_t _yDir = 1;
+
+    // Star variables
+    Star _stars[SCREENSAVER_STARCOUNT];
+    uint8_t _nextStarIndex = 0;
+    int8_t _starOffsets[SCREENSAVER_STARRINGS][16][2];
+
+    // Colors
+    uint16_t _foregroundColor = 0;
+    uint16_t _backgroundColor = 0;
+
+    // Frame timing and statistics
+    uint32_t _nextFrame_ms = 0;
+    uint32_t _statsStart_ms = 0;
+    uint32_t _busyTime_us = 0;
+    uint32_t _frameCount = 0;
+    uint32_t _budgetOverruns = 0;
+
+    // Buffer for a single row of the logo
+    uint16_t _rowBuffer[SCREENSAVER_WIDTH];
+
+    // Frees the logo buffers
+    void FreeLogo();
+
+    // Returns true if the logo covers a screen pixel
+    bool IsLogoPixel(int16_t x, int16_t y);
+
+    // Moves the logo and draws only changed pixels
+    void MoveLogo(Adafruit_SPITFT* tft, int16_t x, int16_t y);
+
+    // Initializes a star at a random position
+    void ResetStar(Star* star);
+
+    // Draws a star completely or only its newest ring
+    void DrawStar(Adafruit_SPITFT* tft, const Star& star, uint16_t color, bool isComplete);
+
+    // Draws a single star pixel if not covered by the logo
+    void DrawStarPixel(Adafruit_SPITFT* tft, int16_t x, int16_t y, uint16_t color);
+};
+
+#endif
@@ -92,78 +92,72 @@ void StateMachine::Save()
 }
 
 //===============================================================
-// Updates cycle timespan value from wifi
+// Updates all liquid values and the cycle timespan from wifi at once (0 = unchanged)
 //===============================================================
-bool StateMachine::UpdateValuesFromWifi(uint32_t cycleTimespan_ms)
+bool StateMachine::UpdateValuesFromWifi(const int16_t increments_Degrees[3], uint32_t cycleTimespan_ms)
 {
-  // Check for min and max value
-  if (cycleTimespan_ms < MIN_CYCLE_TIMESPAN_MS ||
-    cycleTimespan_ms > MAX_CYCLE_TIMESPAN_MS)
+  // Check all values before changing anything
+  for (uint8_t index = 0; index < 3; index++)
   {
-    return false;
-  }
-
-  // General new wifi cycle timespan data handler 
-  if (Pumps.SetCycleTimespan(cycleTimespan_ms))
-  {
-    // Draw new values in settings mode
-    if (_currentState == eSettings)
+    if (increments_Degrees[index] < -360 ||
+      increments_Degrees[index] > 360)
     {
-      // Draw settings in partial update mode
-      Display.DrawSettings();
+      return false;
     }
-
-    // Update pump values
-    UpdatePumpValues();
   }
-
-  return true;
-}
-
-//===============================================================
-// Updates a liquid value from wifi
-//===============================================================
-bool StateMachine::UpdateValuesFromWifi(MixtureLiquid liquid, int16_t increments_Degrees)
-{
-  // Check angle for 360 degrees increment or decrement max
-  if (increments_Degrees < -360 ||
-    increments_Degrees > 360)
+  if (cycleTimespan_ms != 0 &&
+    (cycleTimespan_ms < MIN_CYCLE_TIMESPAN_MS ||
+    cycleTimespan_ms > MAX_CYCLE_TIMESPAN_MS))
   {
     return false;
   }
 
+  // Set cycle timespan
+  bool cycleChanged = cycleTimespan_ms != 0 &&
+    cycleTimespan_ms != Pumps.GetCycleTimespan() &&
+    Pumps.SetCycleTimespan(cycleTimespan_ms);
+
+  // Increment or decrement angles
+  uint8_t anglesChanged = 0;
+  int16_t sum_Degrees = 0;
   if (Config.isMixer)
   {
-    // Increment or decrement angle
-    switch (liquid)
+    int16_t* angles[3] = { &_liquidAngle1, &_liquidAngle2, &_liquidAngle3 };
+    for (uint8_t index = 0; index < 3; index++)
     {
-      case eLiquid1:
-        IncrementAngle(&_liquidAngle1, _liquidAngle2, _liquidAngle3, increments_Degrees);
-        break;
-      case eLiquid2:
-        IncrementAngle(&_liquidAngle2, _liquidAngle3, _liquidAngle1, increments_Degrees);
-        break;
-      case eLiquid3:
-        IncrementAngle(&_liquidAngle3, _liquidAngle1, _liquidAngle2, increments_Degrees);
-        break;
-      default:
-        break;
+      if (increments_Degrees[index] != 0)
+      {
+        IncrementAngle(angles[index], *angles[(index + 1) % 3], *angles[(index + 2) % 3], increments_Degrees[index]);
+        sum_Degrees += increments_Degrees[index];
+        anglesChanged++;
+      }
     }
+  }
 
-    // Update pump values
-    UpdatePumpValues();
+  if (!cycleChanged &&
+    anglesChanged == 0)
+  {
+    return true;
+  }
 
-    // Draw new values in dashboard mode
-    if (_currentState == eDashboard)
-    {
-      // Draw current value string and doughnut chart in partial updating mode
-      Display.DrawCurrentValues();
-      Display.DrawDoughnutChart3(increments_Degrees > 0);
-    }
+  // Update pump values once for all changes
+  UpdatePumpValues();
+
+  // Draw new values in dashboard mode
+  if (anglesChanged > 0 &&
+    _currentState == eDashboard)
+  {
+    // Draw current value string and doughnut chart, fully if several angles moved
+    Display.DrawCurrentValues();
+    Display.DrawDoughnutChart3(sum_Degrees > 0, anglesChanged > 1);
   }
-  else
+
+  // Draw new values in settings mode
+  if (cycleChanged &&
+    _currentState == eSettings)
   {
-    // Not implemented
+    // Draw settings in partial update mode
+    Display.DrawSettings();
   }
 
   return true;
@@ -190,6 +184,14 @@ MixerState StateMachine::GetMenuState()
   return _currentMenuState;
 }
 
+//===============================================================
+// Returns the current state
+//===============================================================
+MixerState StateMachine::GetCurrentState()
+{
+  return _currentState;
+}
+
 //===============================================================
 // Returns the current dashboard liquid
 //===============================================================
@@ -295,37 +297,38 @@ double StateMachine::GetPumpPercentage(MixtureLiquid liquid)
 }
 
 //===============================================================
-// Returns the current mixture a string
+// Returns the current mixture a string (Valid until the next call)
 //===============================================================
-String StateMachine::GetMixtureString()
+const char* StateMachine::GetMixtureString()
 {
   // Build string output
-  String returnString;
-
   if (Config.isMixer)
   {
     // Calculate sum
     double sum_Percentage = _pumpPercentage1 + _pumpPercentage2 + _pumpPercentage3;
     
-    returnString += String(Config.liquidName1) + ": " + String(_pumpPercentage1) + "% (" + String(_liquidAngle1) + "°), ";
-    returnString += String(Config.liquidName2) + ": " + String(_pumpPercentage2) + "% (" + String(_liquidAngle2) + "°), ";
-    returnString += String(Config.liquidName3) + ": " + String(_pumpPercentage3) + "% (" + String(_liquidAngle3) + "°), ";
-    returnString += "Sum: " + String(sum_Percentage) + "%";
+    int length = snprintf(_mixtureString, sizeof(_mixtureString), "%s: %.2f%% (%d°), %s: %.2f%% (%d°), %s: %.2f%% (%d°), Sum: %.2f%%",
+      Config.liquidName1, _pumpPercentage1, _liquidAngle1,
+      Config.liquidName2, _pumpPercentage2, _liquidAngle2,
+      Config.liquidName3, _pumpPercentage3, _liquidAngle3,
+      sum_Percentage);
     
-    if ((sum_Percentage - 100.0) > 0.1 || (sum_Percentage - 100.0) < -0.1)
+    if (((sum_Percentage - 100.0) > 0.1 || (sum_Percentage - 100.0) < -0.1) &&
+      length > 0 && length < (int)sizeof(_mixtureString))
     {
       // Percentage error
-      returnString += " Error: Sum of all percentages must be ~100%";
+      strlcpy(_mixtureString + length, " Error: Sum of all percentages must be ~100%", sizeof(_mixtureString) - length);
     }
   }
   else
   {
-    returnString += String(Config.liquidName1) + ": " + String(_pumpPercentage1) + "%, ";
-    returnString += String(Config.liquidName2) + ": " + String(_pumpPercentage2) + "%, ";
-    returnString += String(Config.liquidName3) + ": " + String(_pumpPercentage3) + "%";
+    snprintf(_mixtureString, sizeof(_mixtureString), "%s: %.2f%%, %s: %.2f%%, %s: %.2f%%",
+      Config.liquidName1, _pumpPercentage1,
+      Config.liquidName2, _pumpPercentage2,
+      Config.liquidName3, _pumpPercentage3);
   }
 
-  return returnString;
+  return _mixtureString;
 }
     
 //===============================================================
@@ -1031,6 +1034,12 @@ void StateMachine::FctSettings(MixerEvent event)
       break;
     case eMain:
       {
+        // Swap in the prefetched configuration as soon as it is ready
+        if (UpdateTheme(false))
+        {
+          Display.ShowSettingsPage();
+        }
+
         // Read encoder increments (resets the counter value)
         int16_t currentEncoderIncrements = EncoderButton.GetEncoderIncrements();
 
@@ -1056,30 +1065,10 @@ void StateMachine::FctSettings(MixerEvent event)
                 if ((currentEncoderIncrements > 0 && Config.Increment()) ||
                   (currentEncoderIncrements < 0 && Config.Decrement()))
                 {
-                  // Load new configuration
-                  if (Config.LoadConfig(Config.GetCurrent()))
-                  {
-                    // Load new images
-                    Display.LoadImages();
-
-                    // Show intro page for a few milliseconds
-                    Display.ShowIntroPage();
-                    delay(800);
-                  }
-                  else
-                  {
-                    // Reset config if loading failed
-                    Config.ResetConfig();
-                  }
-                  
-                  // Increment need update counter fpr wifi clients
-                  _needUpdate++;
-
-                  // Reset mixture
-                  SetMixtureDefaults();
-                    
-                  // Reset to settings page
-                  Display.ShowSettingsPage();
+                  // Load new configuration in background (Swapped in when ready)
+                  char configFileName[THEMEINDEX_MAXNAMELENGTH];
+                  Config.GetCurrent(configFileName, sizeof(configFileName));
+                  ThemeSwitch.Request(configFileName);
                 }
                 break;
               case eLEDIdle:
@@ -1147,6 +1136,12 @@ void StateMachine::FctSettings(MixerEvent event)
           // Check if save values is needed (selected -> not selected)
           if (_settingSelected)
           {
+            // Wait for a pending configuration
+            if (UpdateTheme(true))
+            {
+              Display.ShowSettingsPage();
+            }
+
             Pumps.Save();
             Wifihandler.Save();
             Config.Save();
@@ -1193,6 +1188,9 @@ void StateMachine::FctSettings(MixerEvent event)
       break;
     case eExit:
       {
+        // Wait for a pending configuration
+        UpdateTheme(true);
+
         Pumps.Save();
         Wifihandler.Save();
         Config.Save();
@@ -1224,8 +1222,8 @@ void StateMachine::FctScreenSaver(MixerEvent event)
       break;
     case eMain:
       {
-        // Draw screen saver
-        Display.DrawScreenSaver();
+        // Draw screen saver with fixed frame rate
+        uint32_t idleTime_ms = Display.UpdateScreenSaver();
 
         // Reset and ignore user input
         // (Last user action timestamp will be set in interrupts)
@@ -1242,6 +1240,9 @@ void StateMachine::FctScreenSaver(MixerEvent event)
           Execute(eEntry);
           return;
         }
+
+        // Leave the remaining frame time to other tasks
+        delay(idleTime_ms);
       }
       break;
     case eExit:
@@ -1250,6 +1251,24 @@ void StateMachine::FctScreenSaver(MixerEvent event)
   }
 }
 
+//===============================================================
+// Swaps in a prefetched configuration, returns true if swapped
+//===============================================================
+bool StateMachine::UpdateTheme(bool wait)
+{
+  if (wait ? !ThemeSwitch.Finish() : !ThemeSwitch.Update())
+  {
+    return false;
+  }
+
+  // Increment need update counter for wifi clients
+  _needUpdate++;
+
+  // Reset mixture
+  SetMixtureDefaults();
+  return true;
+}
+
 //===============================================================
 // Resets the mixture to default recipe
 //===============================================================
@@ -22,6 +22,7 @@
 #include "DisplayDriver.h"
 #include "FlowMeterDriver.h"
 #include "WifiHandler.h"
+#include "ThemeSwitcher.h"
 
 //===============================================================
 // Defines
@@ -30,6 +31,8 @@
 #define KEY_BARBOTTLE2          "BarBottle2" // Key name: Maximum string length is 15 bytes, excluding a zero terminator.
 #define KEY_BARBOTTLE3          "BarBottle3" // Key name: Maximum string length is 15 bytes, excluding a zero terminator.
 
+#define MIXTURESTRING_MAXLENGTH 192          // Mixture information including error text and zero terminator
+
 //===============================================================
 // Class for state machine handling
 //===============================================================
@@ -48,11 +51,8 @@ class StateMachine
     // Save settings to flash
     void Save();
 
-    // Updates cycle timespan value from wifi
-    bool UpdateValuesFromWifi(uint32_t cycletimespan_ms);
-
-    // Updates a liquid values from wifi
-    bool UpdateValuesFromWifi(MixtureLiquid liquid, int16_t increments_Degrees);
+    // Updates all liquid values and the cycle timespan from wifi at once (0 = unchanged)
+    bool UpdateValuesFromWifi(const int16_t increments_Degrees[3], uint32_t cycleTimespan_ms);
 
     // Returns the info if pump enable is allowed
     bool CanEnablePumps();
@@ -60,6 +60,9 @@ class StateMachine
     // Returns the current menu state
     MixerState GetMenuState();
 
+    // Returns the current state
+    MixerState GetCurrentState();
+
     // Returns the current dashboard liquid
     MixtureLiquid GetDashboardLiquid();
 
@@ -84,8 +87,8 @@ class StateMachine
     // Returns the percentage for a given pump
     double GetPumpPercentage(MixtureLiquid liquid);
 
-    // Returns the current mixture a string
-    String GetMixtureString();
+    // Returns the current mixture a string (Valid until the next call)
+    const char* GetMixtureString();
     
     // Returns need update counter
     uint16_t GetNeedUpdate();
@@ -138,6 +141,9 @@ class StateMachine
     // Need Update for wifi
     uint16_t _needUpdate = 0;
 
+    // Buffer for the mixture information
+    char _mixtureString[MIXTURESTRING_MAXLENGTH] = "";
+
     // Function menu state
     void FctMenu(MixerEvent event);
 
@@ -159,6 +165,9 @@ class StateMachine
     // Function screen saver state
     void FctScreenSaver(MixerEvent event);
     
+    // Swaps in a prefetched configuration, returns true if swapped
+    bool UpdateTheme(bool wait);
+
     // Resets the mixture to default recipe
     void SetMixtureDefaults();
 
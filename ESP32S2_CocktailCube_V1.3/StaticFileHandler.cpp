@@ -0,0 +1,285 @@
+/*
+ * Includes the web handler for static files
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "StaticFileHandler.h"
+#include "WifiHandler.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "StaticFileHandler";
+
+//===============================================================
+// Constructor
+//===============================================================
+StaticFileHandler::StaticFileHandler()
+{
+}
+
+//===============================================================
+// Returns true, if the handler can handle the request
+//===============================================================
+bool StaticFileHandler::canHandle(AsyncWebServerRequest* request) const
+{
+  if (request->method() != HTTP_GET)
+  {
+    return false;
+  }
+
+  char path[STATICFILE_MAXPATH];
+  if (!GetPath(request->url(), path, sizeof(path)))
+  {
+    return false;
+  }
+
+  char gzipPath[STATICFILE_MAXPATH];
+  snprintf(gzipPath, sizeof(gzipPath), "%s.gz", path);
+
+  uint32_t length = 0;
+  return strcmp(path, "/index.html") == 0 ||
+    FileSystem.exists(path) ||
+    FileSystem.exists(gzipPath) ||
+    Assets.Find(path, &length) != NULL ||
+    Assets.Find(gzipPath, &length) != NULL;
+}
+
+//===============================================================
+// Handles the request
+//===============================================================
+void StaticFileHandler::handleRequest(AsyncWebServerRequest* request)
+{
+  char path[STATICFILE_MAXPATH];
+  if (!GetPath(request->url(), path, sizeof(path)))
+  {
+    request->send(404);
+    return;
+  }
+
+  // Uploaded files take precedence (e.g. an 'index.html' of a theme)
+  bool acceptsGzip = AcceptsGzip(request);
+  Representation representation;
+  if (!OpenFile(path, acceptsGzip, &representation) &&
+    !FindBundle(path, &representation) &&
+    !FindAsset(path, acceptsGzip, &representation))
+  {
+    request->send(404);
+    return;
+  }
+
+  bool isHtml = EndsWith(path, ".html") || EndsWith(path, ".htm");
+  const char* cacheControl = isHtml ? STATICFILE_HTMLCACHECONTROL : STATICFILE_CACHECONTROL;
+
+  AsyncWebServerResponse* response = NULL;
+  bool notModified = IsNotModified(request, representation.etag);
+  if (notModified)
+  {
+    ESP_LOGI(TAG, "Not modified '%s'", path);
+    if (representation.file)
+    {
+      representation.file.close();
+    }
+    response = request->beginResponse(304);
+  }
+  else if (representation.file)
+  {
+    ESP_LOGI(TAG, "Serving file '%s'%s (%d Bytes)", path, representation.gzip ? " gzip" : "", representation.length);
+    response = request->beginResponse(representation.file, String(path), GetContentType(path));
+    Wifihandler.AddBytesOut(request, representation.length);
+  }
+  else
+  {
+    // Send from mapped flash without copy into RAM
+    ESP_LOGI(TAG, "Serving asset '%s'%s (%d Bytes)", path, representation.gzip ? " gzip" : "", representation.length);
+    response = request->beginResponse(200, GetContentType(path), representation.data, representation.length);
+    Wifihandler.AddBytesOut(request, representation.length);
+  }
+
+  response->addHeader("ETag", representation.etag);
+  response->addHeader("Cache-Control", cacheControl);
+  response->addHeader("Vary", "Accept-Encoding");
+  if (representation.gzip &&
+    !notModified)
+  {
+    response->addHeader("Content-Encoding", "gzip");
+  }
+  request->send(response);
+}
+
+//===============================================================
+// Returns the content type of a file name
+//===============================================================
+const char* StaticFileHandler::GetContentType(const char* fileName)
+{
+  if (EndsWith(fileName, ".html") || EndsWith(fileName, ".htm"))
+  {
+    return "text/html";
+  }
+  else if (EndsWith(fileName, ".css"))
+  {
+    return "text/css";
+  }
+  else if (EndsWith(fileName, ".js"))
+  {
+    return "application/javascript";
+  }
+  else if (EndsWith(fileName, ".json"))
+  {
+    return "application/json";
+  }
+  else if (EndsWith(fileName, ".svg"))
+  {
+    return "image/svg+xml";
+  }
+  else if (EndsWith(fileName, ".bmp"))
+  {
+    return "image/bmp";
+  }
+  else if (EndsWith(fileName, ".png"))
+  {
+    return "image/png";
+  }
+  else if (EndsWith(fileName, ".ico"))
+  {
+    return "image/x-icon";
+  }
+  return "application/octet-stream";
+}
+
+//===============================================================
+// Opens the SPIFFS file or gzip variant and returns false if not
+// existing. A gzip file without the original is sent to all
+// clients (Same as the former static files handler)
+//===============================================================
+bool StaticFileHandler::OpenFile(const char* path, bool acceptsGzip, Representation* representation)
+{
+  char gzipPath[STATICFILE_MAXPATH];
+  snprintf(gzipPath, sizeof(gzipPath), "%s.gz", path);
+
+  bool hasGzip = FileSystem.exists(gzipPath);
+  bool hasFile = (!hasGzip || !acceptsGzip) && FileSystem.exists(path);
+  if (!hasFile && !hasGzip)
+  {
+    return false;
+  }
+
+  const char* filePath = hasFile ? path : gzipPath;
+  representation->file = FileSystem.open(filePath, FILE_READ);
+  if (!representation->file)
+  {
+    return false;
+  }
+  representation->data = NULL;
+  representation->length = representation->file.size();
+  representation->gzip = !hasFile;
+
+  uint32_t crc = _etags.GetCrc(filePath, false, &representation->file, NULL, representation->length);
+  ETagCache::Format(representation->etag, sizeof(representation->etag), crc, representation->length);
+  return true;
+}
+
+//===============================================================
+// Returns the bundled web page for the main page (False for other
+// paths). The bundle is sent gzip compressed to all clients (Same
+// as the edit page) and identified by its version hash
+//===============================================================
+bool StaticFileHandler::FindBundle(const char* path, Representation* representation)
+{
+  if (strcmp(path, "/index.html") != 0)
+  {
+    return false;
+  }
+
+  representation->data = webui_html_gz;
+  representation->length = webui_html_gz_len;
+  representation->gzip = true;
+  strlcpy(representation->etag, "\"" WEBUI_VERSION "\"", sizeof(representation->etag));
+  return true;
+}
+
+//===============================================================
+// Finds the asset or gzip variant and returns false if not
+// existing
+//===============================================================
+bool StaticFileHandler::FindAsset(const char* path, bool acceptsGzip, Representation* representation)
+{
+  char gzipPath[STATICFILE_MAXPATH];
+  snprintf(gzipPath, sizeof(gzipPath), "%s.gz", path);
+
+  uint32_t length = 0;
+  const uint8_t* gzipData = Assets.Find(gzipPath, &length);
+  const uint8_t* data = NULL;
+  if (!gzipData || !acceptsGzip)
+  {
+    uint32_t fileLength = 0;
+    data = Assets.Find(path, &fileLength);
+    if (data)
+    {
+      length = fileLength;
+    }
+  }
+  if (!data && !gzipData)
+  {
+    return false;
+  }
+
+  representation->data = data ? data : gzipData;
+  representation->length = length;
+  representation->gzip = data == NULL;
+
+  uint32_t crc = _etags.GetCrc(data ? path : gzipPath, true, NULL, representation->data, length);
+  ETagCache::Format(representation->etag, sizeof(representation->etag), crc, length);
+  return true;
+}
+
+//===============================================================
+// Returns the file path of an uri (False if too long)
+//===============================================================
+bool StaticFileHandler::GetPath(const String& uri, char* path, size_t size)
+{
+  // Keep space for the '.gz' extension
+  const char* index = uri.endsWith("/") ? "index.html" : "";
+  return snprintf(path, size, "%s%s", uri.c_str(), index) < (int)size - 3;
+}
+
+//===============================================================
+// Returns true, if the client accepts gzip encoding
+//===============================================================
+bool StaticFileHandler::AcceptsGzip(AsyncWebServerRequest* request)
+{
+  const AsyncWebHeader* header = request->getHeader("Accept-Encoding");
+  return header && header->value().indexOf("gzip") >= 0;
+}
+
+//===============================================================
+// Returns true, if the client has the representation already
+// (Weak comparison, so 'W/' prefixes of proxies match)
+//===============================================================
+bool StaticFileHandler::IsNotModified(AsyncWebServerRequest* request, const char* etag)
+{
+  const AsyncWebHeader* header = request->getHeader("If-None-Match");
+  if (!header)
+  {
+    return false;
+  }
+  return header->value() == "*" ||
+    strstr(header->value().c_str(), etag) != NULL;
+}
+
+//===============================================================
+// Returns true, if the text ends with the extension
+//===============================================================
+bool StaticFileHandler::EndsWith(const char* text, const char* extension)
+{
+  size_t textLength = strlen(text);
+  size_t extensionLength = strlen(extension);
+  return textLength >= extensionLength &&
+    strcasecmp(text + textLength - extensionLength, extension) == 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * Includes the web handler for static files
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef STATICFILEHANDLER_H
+#define STATICFILEHANDLER_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "FileSystem.h"
+#include "AssetStore.h"
+#include "ETagCache.h"
+#include "WebUI.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define STATICFILE_MAXPATH          36          // SPIFFS object name with '.gz' extension
+#define STATICFILE_CACHECONTROL     "max-age=3600"  // Uploaded files are visible after one hour at the latest
+#define STATICFILE_HTMLCACHECONTROL "no-cache"      // Pages are revalidated on every visit
+
+//===============================================================
+// Static file handler class
+// Serves uploaded SPIFFS files, the web page bundled into the
+// firmware and files of the asset partition in this order. A gzip variant ('[name].gz')
+// next to a file is sent to clients accepting gzip. Responses
+// carry a strong ETag (CRC32 and length of the sent bytes), so
+// revisits are answered with '304 Not Modified'
+//===============================================================
+class StaticFileHandler: public AsyncWebHandler
+{
+  public:
+    // Constructor
+    StaticFileHandler();
+
+    // Returns true, if the handler can handle the request
+    bool canHandle(AsyncWebServerRequest* request) const override final;
+
+    // Handles the request
+    void handleRequest(AsyncWebServerRequest* request) override final;
+
+    // Returns the content type of a file name
+    static const char* GetContentType(const char* fileName);
+
+  private:
+    // File to send (SPIFFS file or mapped asset)
+    struct Representation
+    {
+      File file;
+      const uint8_t* data;
+      uint32_t length;
+      bool gzip;
+      char etag[ETAGCACHE_LENGTH];
+    };
+
+    // Checksums of the sent files
+    ETagCache _etags;
+
+    // Opens the SPIFFS file or gzip variant and returns false if not existing
+    bool OpenFile(const char* path, bool acceptsGzip, Representation* representation);
+
+    // Returns the bundled web page for the main page (False for other paths)
+    bool FindBundle(const char* path, Representation* representation);
+
+    // Finds the asset or gzip variant and returns false if not existing
+    bool FindAsset(const char* path, bool acceptsGzip, Representation* representation);
+
+    // Returns the file path of an uri (False if too long)
+    static bool GetPath(const String& uri, char* path, size_t size);
+
+    // Returns true, if the client accepts gzip encoding
+    static bool AcceptsGzip(AsyncWebServerRequest* request);
+
+    // Returns true, if the client has the representation already
+    static bool IsNotModified(AsyncWebServerRequest* request, const char* etag);
+
+    // Returns true, if the text ends with the extension
+    static bool EndsWith(const char* text, const char* extension);
+};
+
+#endif
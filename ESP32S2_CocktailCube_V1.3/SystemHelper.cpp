@@ -10,6 +10,11 @@
 // Inlcudes
 //===============================================================
 #include "SystemHelper.h"
+#include "Benchmark.h"
+#include "BootSequencer.h"
+#include "AssetStore.h"
+#include "WifiHandler.h"
+#include "Maintenance.h"
 
 //===============================================================
 // Constants
@@ -83,6 +88,28 @@ String SystemHelper::GetSystemInfoString()
   returnString += GetMemoryInfoString(true);
   returnString += "\n";
 
+  // Maintenance-Information
+  returnString += "** Maintenance: **\n";
+  returnString += Maintenance.GetInfoString();
+  returnString += "\n";
+
+  // Loop-Information
+  returnString += "** Loop-Timing: **\n";
+  returnString += GetLoopInfoString();
+  returnString += "\n";
+
+  // Boot-Information
+  returnString += "** Boot-Timing: **\n";
+  returnString += Boot.GetReportString();
+  returnString += "\n";
+
+#if BENCHMARK_ON_BOOT
+  // Benchmark-Information
+  returnString += "** Benchmark-Results: **\n";
+  returnString += Benchmark.GetReportString();
+  returnString += "\n";
+#endif
+
   return returnString;
 }
 
@@ -93,8 +120,8 @@ String SystemHelper::GetMemoryInfoString(bool all)
 {
   String returnString;
 
-  double spiffsTotal = (double)SPIFFS.totalBytes();
-  double spiffsUsed = (double)SPIFFS.usedBytes();
+  double spiffsTotal = (double)FileSystem.TotalBytes();
+  double spiffsUsed = (double)FileSystem.UsedBytes();
   double spiffsUsage = spiffsTotal == 0 ? 0.0 : spiffsUsed / spiffsTotal * 100.0; // Avoid division by 0
 
   double heapTotal = (double)ESP.getHeapSize();
@@ -114,9 +141,14 @@ String SystemHelper::GetMemoryInfoString(bool all)
     returnString += "Sketch-Size:     " + String((double)ESP.getSketchSize() / (1024.0 * 1024.0), 6) + " MB\n";
     returnString += "FreeSketch-Size: " + String((double)ESP.getFreeSketchSpace() / (1024.0 * 1024.0), 6) + " MB\n";
     returnString += "\n";
-    returnString += "SPIFFS Ready:    " + String(SPIFFS.begin(false) ? "true\n" : "false\n");
-    returnString += "SPIFFS-Total:    " + String(spiffsTotal / (1024.0 * 1024.0), 6) + " MB\n";
-    returnString += "SPIFFS-Used:     " + String(spiffsUsed / (1024.0 * 1024.0), 6) + " MB (" + spiffsUsage + "%)\n";
+    returnString += "FS Ready:        " + String(FileSystem.IsMounted() ? "true\n" : "false\n");
+    returnString += "FS-Type:         " + String(FileSystem.GetName()) + "\n";
+    returnString += "FS-Total:        " + String(spiffsTotal / (1024.0 * 1024.0), 6) + " MB\n";
+    returnString += "FS-Used:         " + String(spiffsUsed / (1024.0 * 1024.0), 6) + " MB (" + spiffsUsage + "%)\n";
+    returnString += "\n";
+    returnString += "Assets Ready:    " + String(Assets.IsMounted() ? "true\n" : "false\n");
+    returnString += "Assets-Total:    " + String((double)Assets.GetPartitionSize() / (1024.0 * 1024.0), 6) + " MB\n";
+    returnString += "Assets-Used:     " + String((double)Assets.GetUsedSize() / (1024.0 * 1024.0), 6) + " MB (" + String(Assets.GetCount()) + " files)\n";
     returnString += "\n";
     returnString += "Heap-Total:      " + String(heapTotal / (1024.0 * 1024.0), 6) + " MB\n";
     returnString += "Heap-Used:       " + String(heapUsed / (1024.0 * 1024.0), 6) + " MB (" + heapUsage + "%)\n";
@@ -126,7 +158,7 @@ String SystemHelper::GetMemoryInfoString(bool all)
   }
   else
   {
-    returnString += "SPIFFS-Used: " + String(spiffsUsed / (1024.0 * 1024.0), 6) + " MB (" + spiffsUsage + "%), ";
+    returnString += "FS-Used: " + String(spiffsUsed / (1024.0 * 1024.0), 6) + " MB (" + spiffsUsage + "%), ";
     returnString += "PSRAM-Used: " + String(psramUsed / (1024.0 * 1024.0), 6) + " MB (" + psramUsage + "%), ";
     returnString += "Heap-Used: " + String(heapUsed / (1024.0 * 1024.0), 6) + " MB (" + heapUsage + "%)\n";
   }
@@ -287,3 +319,48 @@ uint32_t SystemHelper::GetLastUserAction()
 
   return lastUserAction;
 }
+
+//===============================================================
+// Measures the loop time (Called once per loop)
+//===============================================================
+void SystemHelper::UpdateLoopTime()
+{
+  uint32_t now_us = micros();
+  if (_loopTimestamp_us != 0)
+  {
+    uint32_t loopTime_us = now_us - _loopTimestamp_us;
+    _loopCount++;
+    _loopSum_us += loopTime_us;
+    _loopMax_us = max(_loopMax_us, loopTime_us);
+  }
+  _loopTimestamp_us = now_us;
+
+  // Finish window
+  uint32_t now_ms = millis();
+  if ((now_ms - _loopWindowTimestamp_ms) >= LOOPTIME_WINDOW_MS &&
+    _loopCount > 0)
+  {
+    _loopAverage_us = _loopSum_us / _loopCount;
+    _loopPeak_us = _loopMax_us;
+    _loopPeakTotal_us = max((uint32_t)_loopPeakTotal_us, _loopMax_us);
+    _loopWindowTimestamp_ms = now_ms;
+    _loopCount = 0;
+    _loopSum_us = 0;
+    _loopMax_us = 0;
+  }
+}
+
+//===============================================================
+// Returns the loop time info string
+//===============================================================
+String SystemHelper::GetLoopInfoString()
+{
+  String returnString;
+  returnString += "Loop average:    " + String(_loopAverage_us) + " us\n";
+  returnString += "Loop maximum:    " + String(_loopPeak_us) + " us\n";
+  returnString += "Loop peak:       " + String(_loopPeakTotal_us) + " us\n";
+  returnString += "Web requests:    " + String(Wifihandler.GetOpenRequests()) + " open, " + String(Wifihandler.GetRejectedRequests()) + " rejected\n";
+  returnString += "Web sockets:     " + String(Wifihandler.GetSocketClients()) + " clients\n";
+  returnString += "Web busy time:   " + String(Wifihandler.GetWebBusyTime_us()) + " us\n";
+  return returnString;
+}
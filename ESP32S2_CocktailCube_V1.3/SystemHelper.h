@@ -15,9 +15,14 @@
 #include <Arduino.h>
 #include <ESP.h>
 #include <WiFi.h>
-#include <SPIFFS.h>
 #include <esp_log.h>
 #include <esp32s2/rom/rtc.h>
+#include "FileSystem.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define LOOPTIME_WINDOW_MS        1000         // Window of the loop time statistics
 
 //===============================================================
 // Class for system handling
@@ -49,12 +54,28 @@ class SystemHelper
     // Return the timestamp of the last user action
     uint32_t GetLastUserAction();
 
+    // Measures the loop time (Called once per loop)
+    void UpdateLoopTime();
+
+    // Returns the loop time info string
+    String GetLoopInfoString();
+
   private:
     // Port mux
     portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
 
     // Timestamp of last user action
     volatile uint32_t _lastUserAction = 0;
+
+    // Loop time variables (Values of the last finished window)
+    uint32_t _loopTimestamp_us = 0;
+    uint32_t _loopWindowTimestamp_ms = 0;
+    uint32_t _loopCount = 0;
+    uint32_t _loopSum_us = 0;
+    uint32_t _loopMax_us = 0;
+    volatile uint32_t _loopAverage_us = 0;
+    volatile uint32_t _loopPeak_us = 0;
+    volatile uint32_t _loopPeakTotal_us = 0;
 };
 
 //===============================================================
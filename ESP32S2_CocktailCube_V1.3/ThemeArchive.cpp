@@ -0,0 +1,424 @@
+/*
+ * Includes the theme archive extraction
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "ThemeArchive.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "themearchive";
+
+//===============================================================
+// Defines (Offsets and lengths of the ustar header fields)
+//===============================================================
+#define TAR_NAME_OFFSET             0
+#define TAR_NAME_LENGTH             100
+#define TAR_SIZE_OFFSET             124
+#define TAR_SIZE_LENGTH             12
+#define TAR_CHECKSUM_OFFSET         148
+#define TAR_CHECKSUM_LENGTH         8
+#define TAR_TYPE_OFFSET             156
+
+//===============================================================
+// Constructor
+//===============================================================
+ThemeArchive::ThemeArchive(const char* tempPrefix)
+{
+  strlcpy(_tempPrefix, tempPrefix, sizeof(_tempPrefix));
+}
+
+//===============================================================
+// Destructor
+//===============================================================
+ThemeArchive::~ThemeArchive()
+{
+  if (!_committed)
+  {
+    Discard();
+  }
+}
+
+//===============================================================
+// Extracts the next bytes of the archive
+//===============================================================
+bool ThemeArchive::Write(const uint8_t* data, size_t length)
+{
+  while (length > 0)
+  {
+    size_t usedLength = 0;
+    switch (_state)
+    {
+      case eParseHeader:
+        usedLength = min(length, (size_t)THEMEARCHIVE_BLOCKSIZE - _headerLength);
+        memcpy(_header + _headerLength, data, usedLength);
+        _headerLength += usedLength;
+        if (_headerLength == THEMEARCHIVE_BLOCKSIZE)
+        {
+          _headerLength = 0;
+          if (!BeginEntry())
+          {
+            return false;
+          }
+        }
+        break;
+      case eParseData:
+        usedLength = min(length, (size_t)_remaining);
+        if (_extract)
+        {
+          // Keep the start of images for the header check
+          if (_entries[_count - 1].type == eArchiveImage &&
+            _imageHeaderLength < sizeof(_imageHeader))
+          {
+            size_t copyLength = min(usedLength, sizeof(_imageHeader) - _imageHeaderLength);
+            memcpy(_imageHeader + _imageHeaderLength, data, copyLength);
+            _imageHeaderLength += copyLength;
+          }
+
+          if (_file.write(data, usedLength) != usedLength)
+          {
+            return Fail("Not enough space");
+          }
+        }
+        _remaining -= usedLength;
+        if (_remaining == 0 &&
+          !EndEntry())
+        {
+          return false;
+        }
+        break;
+      case eParsePadding:
+        usedLength = min(length, (size_t)_padding);
+        _padding -= usedLength;
+        if (_padding == 0)
+        {
+          _state = eParseHeader;
+        }
+        break;
+      case eParseEnd:
+        // Zero blocks up to the record size
+        return true;
+      default:
+        return false;
+    }
+
+    data += usedLength;
+    length -= usedLength;
+  }
+  return true;
+}
+
+//===============================================================
+// Renames all files into place. Images and bundles are renamed
+// before the configs, so a theme never refers to missing images
+//===============================================================
+bool ThemeArchive::Commit()
+{
+  if (_state != eParseEnd &&
+    !(_state == eParseHeader && _headerLength == 0))
+  {
+    return Fail("Archive incomplete");
+  }
+  if (_count == 0)
+  {
+    return Fail("No theme files in archive");
+  }
+
+  bool success = true;
+  for (uint8_t pass = 0; pass < 2; pass++)
+  {
+    for (uint8_t index = 0; index < _count; index++)
+    {
+      Entry* entry = &_entries[index];
+      if ((entry->type == eArchiveConfig) != (pass == 1))
+      {
+        continue;
+      }
+
+      // The former file stays in place until the new one replaces it
+      char backupName[THEMEARCHIVE_MAXNAME];
+      snprintf(backupName, sizeof(backupName), "%s%u.bak", _tempPrefix, index);
+      if (!FileSystem.Replace(entry->tempName, entry->fileName, backupName))
+      {
+        FileSystem.remove(entry->tempName);
+        _error = "Could not rename file";
+        success = false;
+      }
+    }
+  }
+
+  _committed = true;
+  ESP_LOGI(TAG, "Installed %d files", _count);
+  return success;
+}
+
+//===============================================================
+// Removes all temporary files
+//===============================================================
+void ThemeArchive::Discard()
+{
+  if (_file)
+  {
+    _file.close();
+  }
+  for (uint8_t index = 0; index < _count; index++)
+  {
+    if (FileSystem.exists(_entries[index].tempName))
+    {
+      FileSystem.remove(_entries[index].tempName);
+    }
+  }
+  _count = 0;
+}
+
+//===============================================================
+// Returns true, if a file name is a theme archive
+//===============================================================
+bool ThemeArchive::IsArchive(const char* fileName)
+{
+  size_t length = strlen(fileName);
+  size_t extensionLength = strlen(THEMEARCHIVE_EXTENSION);
+  return length > extensionLength &&
+    strcasecmp(fileName + length - extensionLength, THEMEARCHIVE_EXTENSION) == 0;
+}
+
+//===============================================================
+// Starts the file of a complete header
+//===============================================================
+bool ThemeArchive::BeginEntry()
+{
+  // Two zero blocks end the archive
+  if (IsZeroBlock(_header))
+  {
+    _state = eParseEnd;
+    return true;
+  }
+
+  // Checksum is the sum of all header bytes, with spaces for the checksum field
+  uint32_t checksum = 0;
+  uint32_t expectedChecksum = 0;
+  for (uint16_t index = 0; index < THEMEARCHIVE_BLOCKSIZE; index++)
+  {
+    bool isChecksumField = index >= TAR_CHECKSUM_OFFSET && index < TAR_CHECKSUM_OFFSET + TAR_CHECKSUM_LENGTH;
+    checksum += isChecksumField ? ' ' : _header[index];
+  }
+  if (!ParseOctal(_header + TAR_CHECKSUM_OFFSET, TAR_CHECKSUM_LENGTH, &expectedChecksum) ||
+    checksum != expectedChecksum)
+  {
+    return Fail("Not a tar archive");
+  }
+
+  uint32_t length = 0;
+  if (!ParseOctal(_header + TAR_SIZE_OFFSET, TAR_SIZE_LENGTH, &length))
+  {
+    return Fail("Invalid file size");
+  }
+  _remaining = length;
+  _padding = (THEMEARCHIVE_BLOCKSIZE - length % THEMEARCHIVE_BLOCKSIZE) % THEMEARCHIVE_BLOCKSIZE;
+  _extract = false;
+  _imageHeaderLength = 0;
+
+  // Folders are flattened (SPIFFS has no folders)
+  char name[TAR_NAME_LENGTH + 1];
+  memcpy(name, _header + TAR_NAME_OFFSET, TAR_NAME_LENGTH);
+  name[TAR_NAME_LENGTH] = '\0';
+  const char* baseName = strrchr(name, '/') ? strrchr(name, '/') + 1 : name;
+
+  // Only regular files with theme extensions are extracted (Not folders,
+  // extended headers or resource forks like '._name')
+  char type = _header[TAR_TYPE_OFFSET];
+  String lowerName = baseName;
+  lowerName.toLowerCase();
+  ThemeArchiveFileType fileType = eArchiveConfig;
+  bool isThemeFile = true;
+  if (lowerName.endsWith(".json"))
+  {
+    fileType = eArchiveConfig;
+  }
+  else if (lowerName.endsWith(THEMEBUNDLE_EXTENSION))
+  {
+    fileType = eArchiveBundle;
+  }
+  else if (lowerName.endsWith(".bmp"))
+  {
+    fileType = eArchiveImage;
+  }
+  else
+  {
+    isThemeFile = false;
+  }
+
+  if ((type != '0' && type != '\0') ||
+    !isThemeFile ||
+    strncmp(baseName, "._", 2) == 0)
+  {
+    ESP_LOGI(TAG, "Skip '%s'", name);
+  }
+  else
+  {
+    if (strlen(baseName) + 1 >= THEMEARCHIVE_MAXNAME)
+    {
+      return Fail("File name too long");
+    }
+    if (_count >= THEMEARCHIVE_MAXENTRIES)
+    {
+      return Fail("Too many files");
+    }
+
+    Entry* entry = &_entries[_count];
+    snprintf(entry->fileName, sizeof(entry->fileName), "/%s", baseName);
+    snprintf(entry->tempName, sizeof(entry->tempName), "%s%u.tmp", _tempPrefix, _count);
+    entry->type = fileType;
+    entry->length = length;
+
+    for (uint8_t index = 0; index < _count; index++)
+    {
+      if (strcmp(_entries[index].fileName, entry->fileName) == 0)
+      {
+        return Fail("Duplicate file name");
+      }
+    }
+
+    _file = FileSystem.open(entry->tempName, FILE_WRITE);
+    if (!_file)
+    {
+      return Fail("Could not create file");
+    }
+    _count++;
+    _extract = true;
+    ESP_LOGI(TAG, "Extract '%s' (%d bytes)", entry->fileName, length);
+  }
+
+  _state = eParseData;
+  if (_remaining == 0)
+  {
+    return EndEntry();
+  }
+  return true;
+}
+
+//===============================================================
+// Validates the completed file
+//===============================================================
+bool ThemeArchive::EndEntry()
+{
+  _state = _padding > 0 ? eParsePadding : eParseHeader;
+  if (!_extract)
+  {
+    return true;
+  }
+
+  _extract = false;
+  _file.close();
+
+  Entry* entry = &_entries[_count - 1];
+  if (entry->type == eArchiveImage)
+  {
+    SPIFFSBMPImage image;
+    ImageReturnCode returnCode = image.CheckHeader(_imageHeader, _imageHeaderLength, entry->length);
+    if (returnCode != IMAGE_SUCCESS)
+    {
+      ESP_LOGE(TAG, "Invalid image '%s': %s", entry->fileName, SPIFFSBMPImage::PrintStatus(returnCode));
+      return Fail("Invalid image");
+    }
+    return true;
+  }
+
+  return CheckFile(entry);
+}
+
+//===============================================================
+// Validates an extracted config or bundle file
+//===============================================================
+bool ThemeArchive::CheckFile(Entry* entry)
+{
+  File file = FileSystem.open(entry->tempName, FILE_READ);
+  if (!file)
+  {
+    return Fail("Could not read file");
+  }
+
+  bool valid = false;
+  if (entry->type == eArchiveBundle)
+  {
+    ThemeBlob blob;
+    valid = ThemeBundle::ReadConfig(&file, &blob);
+  }
+  else
+  {
+    JsonDocument doc;
+    valid = deserializeJson(doc, file).code() == DeserializationError::Ok &&
+      Config.CheckValid(doc);
+  }
+  file.close();
+
+  if (!valid)
+  {
+    ESP_LOGE(TAG, "Invalid theme '%s'", entry->fileName);
+    return Fail("Invalid theme config");
+  }
+  return true;
+}
+
+//===============================================================
+// Sets the error and stops the extraction
+//===============================================================
+bool ThemeArchive::Fail(const char* error)
+{
+  ESP_LOGE(TAG, "Extraction failed: %s", error);
+  _error = error;
+  _state = eParseError;
+  Discard();
+  return false;
+}
+
+//===============================================================
+// Returns the value of an octal header field (Terminated by
+// space or zero, leading spaces are allowed)
+//===============================================================
+bool ThemeArchive::ParseOctal(const uint8_t* field, size_t length, uint32_t* value)
+{
+  *value = 0;
+  size_t index = 0;
+  while (index < length &&
+    field[index] == ' ')
+  {
+    index++;
+  }
+
+  bool hasDigits = false;
+  for (; index < length && field[index] >= '0' && field[index] <= '7'; index++)
+  {
+    // Files above 4 GB do not fit into SPIFFS anyway
+    if (*value > (UINT32_MAX >> 3))
+    {
+      return false;
+    }
+    *value = (*value << 3) | (field[index] - '0');
+    hasDigits = true;
+  }
+  return hasDigits &&
+    (index == length || field[index] == ' ' || field[index] == '\0');
+}
+
+//===============================================================
+// Returns true, if the header block is zero (End of archive)
+//===============================================================
+bool ThemeArchive::IsZeroBlock(const uint8_t* block)
+{
+  for (uint16_t index = 0; index < THEMEARCHIVE_BLOCKSIZE; index++)
+  {
+    if (block[index] != 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,147 @@
+/*
+ * Includes the theme archive extraction
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef THEMEARCHIVE_H
+#define THEMEARCHIVE_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <FS.h>
+#include <ArduinoJson.h>
+#include <esp_log.h>
+#include "FileSystem.h"
+#include "Config.h"
+#include "ThemeBundle.h"
+#include "SPIFFSBMPImage.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define THEMEARCHIVE_EXTENSION      ".tar"
+#define THEMEARCHIVE_BLOCKSIZE      512         // Header and data alignment of tar files
+#define THEMEARCHIVE_MAXENTRIES     16          // Files per archive (A theme has a config and up to six images)
+#define THEMEARCHIVE_MAXNAME        32          // Same as SPIFFS object names
+#define THEMEARCHIVE_MAXPREFIX      16          // Prefix of the temporary files
+
+//===============================================================
+// Enums
+//===============================================================
+enum ThemeArchiveFileType : uint8_t
+{
+  eArchiveConfig = 0,
+  eArchiveBundle = 1,
+  eArchiveImage = 2
+};
+
+//===============================================================
+// Class for a theme archive
+// Extracts an uncompressed tar file (ustar, as written by 'tar'
+// or 'Tools/theme_archiver.py') while it is received. Only the
+// current header is buffered, file data is written through into
+// temporary files. Each file is validated when complete (Config
+// with 'CheckValid()', images with the bitmap header parser,
+// bundles with their compiled config). Nothing is replaced before
+// the whole archive is valid, then all files are renamed into
+// place (A replaced file is restored, if its rename fails).
+// Folders are flattened, other files are skipped
+//===============================================================
+class ThemeArchive
+{
+  public:
+    // Constructor (Temporary files are named '<prefix><n>.tmp')
+    ThemeArchive(const char* tempPrefix);
+
+    // Destructor (Removes temporary files, if not committed)
+    ~ThemeArchive();
+
+    // Extracts the next bytes of the archive, returns false on errors
+    bool Write(const uint8_t* data, size_t length);
+
+    // Renames all files into place, returns false on errors
+    bool Commit();
+
+    // Removes all temporary files
+    void Discard();
+
+    // Returns the reason of the last error (NULL if none)
+    const char* GetError() { return _error; }
+
+    // Returns the amount of extracted files
+    uint8_t GetCount() { return _count; }
+
+    // Returns the name of an extracted file
+    const char* GetFileName(uint8_t index) { return index < _count ? _entries[index].fileName : ""; }
+
+    // Returns true, if a file name is a theme archive
+    static bool IsArchive(const char* fileName);
+
+  private:
+    // Parser state
+    enum ParserState : uint8_t
+    {
+      eParseHeader = 0,
+      eParseData,
+      eParsePadding,
+      eParseEnd,
+      eParseError
+    };
+
+    // Extracted file
+    struct Entry
+    {
+      char fileName[THEMEARCHIVE_MAXNAME];
+      char tempName[THEMEARCHIVE_MAXNAME];
+      ThemeArchiveFileType type;
+      uint32_t length;
+    };
+
+    char _tempPrefix[THEMEARCHIVE_MAXPREFIX];
+    ParserState _state = eParseHeader;
+    const char* _error = NULL;
+    bool _committed = false;
+
+    // Header of the current file
+    uint8_t _header[THEMEARCHIVE_BLOCKSIZE];
+    size_t _headerLength = 0;
+
+    // Current file (Not opened for skipped files)
+    File _file;
+    bool _extract = false;
+    uint32_t _remaining = 0;
+    uint32_t _padding = 0;
+
+    // Start of the current image for the header check
+    uint8_t _imageHeader[BITMAPHEADER_MAXLENGTH];
+    size_t _imageHeaderLength = 0;
+
+    // Extracted files
+    Entry _entries[THEMEARCHIVE_MAXENTRIES];
+    uint8_t _count = 0;
+
+    // Starts the file of a complete header, returns false on errors
+    bool BeginEntry();
+
+    // Validates the completed file, returns false on errors
+    bool EndEntry();
+
+    // Validates an extracted config or bundle file
+    bool CheckFile(Entry* entry);
+
+    // Sets the error and stops the extraction
+    bool Fail(const char* error);
+
+    // Returns the value of an octal header field
+    static bool ParseOctal(const uint8_t* field, size_t length, uint32_t* value);
+
+    // Returns true, if the header block is zero (End of archive)
+    static bool IsZeroBlock(const uint8_t* block);
+};
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Includes the binary theme blob format
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef THEMEBLOB_H
+#define THEMEBLOB_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+
+//===============================================================
+// Defines
+//===============================================================
+#define THEMEBLOB_EXTENSION         ".ctb"
+#define THEMEBLOB_MAGIC             0x31425443  // "CTB1"
+#define THEMEBLOB_VERSION           1
+#define THEMEBLOB_MAXMIXERNAME      16
+#define THEMEBLOB_MAXLIQUIDNAME     12
+#define THEMEBLOB_MAXCOLOR          8           // "#RRGGBB"
+#define THEMEBLOB_MAXIMAGENAME      32
+#define THEMEBLOB_LIQUIDS           3
+#define THEMEBLOB_TFTCOLORS         14
+#define THEMEBLOB_IMAGES            6
+#define THEMEBLOB_POSITIONS         6
+
+//===============================================================
+// Precompiled theme (Little endian, packed)
+// Created from the json theme by the firmware on first load or
+// by 'Tools/theme_compiler.py'. Both have to be kept in sync!
+//===============================================================
+struct __attribute__((packed)) ThemeBlob
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;
+  uint8_t isMixer;
+  uint8_t reserved;
+  char mixerName[THEMEBLOB_MAXMIXERNAME];
+  char liquidNames[THEMEBLOB_LIQUIDS][THEMEBLOB_MAXLIQUIDNAME];
+  int16_t liquidAngles[THEMEBLOB_LIQUIDS];
+  char liquidColors[THEMEBLOB_LIQUIDS][THEMEBLOB_MAXCOLOR];
+  uint16_t tftColors[THEMEBLOB_TFTCOLORS];    // Order of the TFT_COLOR_* keys in 'Config.h'
+  char images[THEMEBLOB_IMAGES][THEMEBLOB_MAXIMAGENAME];
+  int16_t positions[THEMEBLOB_POSITIONS];     // Logo, glass and bottle (x, y)
+  uint32_t checksum;                          // FNV-1a of all bytes before
+
+  // Returns the FNV-1a checksum of all bytes before the checksum
+  uint32_t CalculateChecksum() const
+  {
+    const uint8_t* data = (const uint8_t*)this;
+    uint32_t hash = 2166136261UL;
+    for (size_t index = 0; index < offsetof(ThemeBlob, checksum); index++)
+    {
+      hash = (hash ^ data[index]) * 16777619UL;
+    }
+    return hash;
+  }
+
+  // Returns true if header and checksum are valid
+  bool IsValid() const
+  {
+    return magic == THEMEBLOB_MAGIC &&
+      version == THEMEBLOB_VERSION &&
+      size == sizeof(ThemeBlob) &&
+      checksum == CalculateChecksum();
+  }
+};
+
+#endif
@@ -0,0 +1,240 @@
+/*
+ * Includes the single file theme bundle
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "ThemeBundle.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "themebundle";
+
+//===============================================================
+// Constructor
+//===============================================================
+ThemeBundle::ThemeBundle()
+{
+  memset(_sections, 0, sizeof(_sections));
+}
+
+//===============================================================
+// Destructor
+//===============================================================
+ThemeBundle::~ThemeBundle()
+{
+  Close();
+}
+
+//===============================================================
+// Opens a bundle and reads the offset table
+//===============================================================
+bool ThemeBundle::Open(const char* path)
+{
+  Close();
+
+  _file = FileSystem.open(path, FILE_READ);
+  if (!_file)
+  {
+    ESP_LOGE(TAG, "Failed to open bundle '%s'", path);
+    return false;
+  }
+
+  if (!ReadTable(&_file, _sections))
+  {
+    ESP_LOGE(TAG, "Bundle '%s' not valid", path);
+    Close();
+    return false;
+  }
+
+  return true;
+}
+
+//===============================================================
+// Closes the bundle handle
+//===============================================================
+void ThemeBundle::Close()
+{
+  if (_file)
+  {
+    _file.close();
+  }
+  memset(_sections, 0, sizeof(_sections));
+}
+
+//===============================================================
+// Reads the compiled config section
+//===============================================================
+bool ThemeBundle::ReadConfig(ThemeBlob* blob)
+{
+  uint32_t length = 0;
+  File* file = SeekSection(eSectionConfig, &length);
+  return file &&
+    length == sizeof(ThemeBlob) &&
+    file->read((uint8_t*)blob, sizeof(ThemeBlob)) == sizeof(ThemeBlob) &&
+    blob->IsValid();
+}
+
+//===============================================================
+// Positions the handle at the start of a section
+// Seeking is skipped if the handle is already there (Sequential)
+//===============================================================
+File* ThemeBundle::SeekSection(ThemeBundleSection section, uint32_t* length)
+{
+  *length = 0;
+  if (!_file ||
+    section >= THEMEBUNDLE_SECTIONS ||
+    _sections[section].length == 0)
+  {
+    return NULL;
+  }
+
+  if (_file.position() != _sections[section].offset &&
+    !_file.seek(_sections[section].offset))
+  {
+    return NULL;
+  }
+
+  *length = _sections[section].length;
+  return &_file;
+}
+
+//===============================================================
+// Reads the compiled config of a bundle file
+//===============================================================
+bool ThemeBundle::ReadConfig(File* file, ThemeBlob* blob)
+{
+  Section sections[THEMEBUNDLE_SECTIONS];
+  file->seek(0);
+  bool result = ReadTable(file, sections) &&
+    sections[eSectionConfig].length == sizeof(ThemeBlob) &&
+    file->seek(sections[eSectionConfig].offset) &&
+    file->read((uint8_t*)blob, sizeof(ThemeBlob)) == sizeof(ThemeBlob) &&
+    blob->IsValid();
+  file->seek(0);
+  return result;
+}
+
+//===============================================================
+// Writes a bundle from a compiled config and up to six image
+// files (Empty or NULL paths are stored as empty sections)
+//===============================================================
+bool ThemeBundle::Save(const char* path, const ThemeBlob* blob, const char* imagePaths[THEMEBUNDLE_SECTIONS - 1])
+{
+  // Build offset table
+  Section sections[THEMEBUNDLE_SECTIONS];
+  uint32_t offset = sizeof(Header) + sizeof(sections);
+  sections[eSectionConfig] = { offset, sizeof(ThemeBlob) };
+  offset += sizeof(ThemeBlob);
+  for (uint8_t index = 0; index < THEMEBUNDLE_SECTIONS - 1; index++)
+  {
+    uint32_t length = 0;
+    if (imagePaths[index] && imagePaths[index][0] != '\0')
+    {
+      char imagePath[FILESYSTEM_MAXPATH];
+      GetImagePath(imagePaths[index], imagePath, sizeof(imagePath));
+      File imageFile = FileSystem.open(imagePath, FILE_READ);
+      if (!imageFile)
+      {
+        ESP_LOGE(TAG, "Image '%s' not found", imagePath);
+        return false;
+      }
+      length = imageFile.size();
+      imageFile.close();
+    }
+    sections[index + 1] = { length > 0 ? offset : 0, length };
+    offset += length;
+  }
+
+  File file = FileSystem.open(path, FILE_WRITE);
+  if (!file)
+  {
+    ESP_LOGE(TAG, "Failed to open '%s' for writing", path);
+    return false;
+  }
+
+  // Write header, table and config
+  Header header = { THEMEBUNDLE_MAGIC, THEMEBUNDLE_VERSION, THEMEBUNDLE_SECTIONS };
+  bool result =
+    file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+    file.write((const uint8_t*)sections, sizeof(sections)) == sizeof(sections) &&
+    file.write((const uint8_t*)blob, sizeof(ThemeBlob)) == sizeof(ThemeBlob);
+
+  // Copy images
+  uint8_t buffer[512];
+  for (uint8_t index = 0; index < THEMEBUNDLE_SECTIONS - 1 && result; index++)
+  {
+    if (sections[index + 1].length == 0)
+    {
+      continue;
+    }
+
+    char imagePath[FILESYSTEM_MAXPATH];
+    GetImagePath(imagePaths[index], imagePath, sizeof(imagePath));
+    File imageFile = FileSystem.open(imagePath, FILE_READ);
+    size_t length;
+    uint32_t copied = 0;
+    while (imageFile && (length = imageFile.read(buffer, sizeof(buffer))) > 0 && result)
+    {
+      result = file.write(buffer, length) == length;
+      copied += length;
+    }
+    imageFile.close();
+    result &= copied == sections[index + 1].length;
+  }
+  file.close();
+
+  if (!result)
+  {
+    ESP_LOGE(TAG, "Failed to write '%s'", path);
+    FileSystem.remove(path);
+  }
+  return result;
+}
+
+//===============================================================
+// Copies an image name as absolute path into a buffer
+//===============================================================
+void ThemeBundle::GetImagePath(const char* name, char* path, size_t length)
+{
+  snprintf(path, length, "%s%s", name[0] == '/' ? "" : "/", name);
+}
+
+//===============================================================
+// Reads header and offset table from the start of a file
+//===============================================================
+bool ThemeBundle::ReadTable(File* file, Section* sections)
+{
+  Header header;
+  if (file->read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+    header.magic != THEMEBUNDLE_MAGIC ||
+    header.version != THEMEBUNDLE_VERSION ||
+    header.sectionCount != THEMEBUNDLE_SECTIONS)
+  {
+    return false;
+  }
+
+  size_t length = THEMEBUNDLE_SECTIONS * sizeof(Section);
+  if (file->read((uint8_t*)sections, length) != length)
+  {
+    return false;
+  }
+
+  // Check all sections are inside the file
+  for (uint8_t index = 0; index < THEMEBUNDLE_SECTIONS; index++)
+  {
+    if (sections[index].length > 0 &&
+      (uint64_t)sections[index].offset + sections[index].length > file->size())
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
@@ -0,0 +1,108 @@
+/*
+ * Includes the single file theme bundle
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef THEMEBUNDLE_H
+#define THEMEBUNDLE_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <FS.h>
+#include <esp_log.h>
+#include "FileSystem.h"
+#include "ThemeBlob.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define THEMEBUNDLE_EXTENSION       ".ctp"
+#define THEMEBUNDLE_MAGIC           0x4B505443  // "CTPK"
+#define THEMEBUNDLE_VERSION         1
+#define THEMEBUNDLE_SECTIONS        7           // Config and six images
+
+//===============================================================
+// Enums
+//===============================================================
+enum ThemeBundleSection : uint8_t
+{
+  eSectionConfig = 0,
+  eSectionLogo = 1,
+  eSectionGlass = 2,
+  eSectionBottle1 = 3,
+  eSectionBottle2 = 4,
+  eSectionBottle3 = 5,
+  eSectionBottle4 = 6
+};
+
+//===============================================================
+// Class for a theme bundle
+// A bundle holds the compiled config and all images of a theme
+// behind an offset table (Little endian):
+//   Header | Table[THEMEBUNDLE_SECTIONS] | Config | Images...
+// Sections are stored in table order, so loading config and
+// images in that order only reads forward through one handle.
+// Created by 'Tools/theme_packer.py' or ThemeBundle::Save()
+//===============================================================
+class ThemeBundle
+{
+  public:
+    // Constructor
+    ThemeBundle();
+
+    // Destructor
+    ~ThemeBundle();
+
+    // Opens a bundle and reads the offset table
+    bool Open(const char* path);
+
+    // Closes the bundle handle
+    void Close();
+
+    // Returns true if the bundle is open
+    bool IsOpen() { return _file ? true : false; }
+
+    // Reads the compiled config section
+    bool ReadConfig(ThemeBlob* blob);
+
+    // Positions the handle at the start of a section and returns it (NULL if empty)
+    File* SeekSection(ThemeBundleSection section, uint32_t* length);
+
+    // Reads the compiled config of a bundle file (e.g. for the theme index)
+    static bool ReadConfig(File* file, ThemeBlob* blob);
+
+    // Writes a bundle from a compiled config and up to six image files
+    static bool Save(const char* path, const ThemeBlob* blob, const char* imagePaths[THEMEBUNDLE_SECTIONS - 1]);
+
+  private:
+    // Header of the bundle file
+    struct Header
+    {
+      uint32_t magic;
+      uint16_t version;
+      uint16_t sectionCount;
+    };
+
+    // Single entry of the offset table
+    struct Section
+    {
+      uint32_t offset;
+      uint32_t length;
+    };
+
+    File _file;
+    Section _sections[THEMEBUNDLE_SECTIONS];
+
+    // Reads header and offset table from the start of a file
+    static bool ReadTable(File* file, Section* sections);
+
+    // Copies an image name as absolute path into a buffer
+    static void GetImagePath(const char* name, char* path, size_t length);
+};
+
+#endif
@@ -0,0 +1,221 @@
+/*
+ * Includes the paged catalogue of valid themes
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "ThemeCatalogue.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "themecatalogue";
+
+//===============================================================
+// Constructor
+//===============================================================
+ThemeCatalogue::ThemeCatalogue(const char* path) :
+  _path(path)
+{
+}
+
+//===============================================================
+// Opens the catalogue and returns false if not available
+//===============================================================
+bool ThemeCatalogue::Begin()
+{
+  _count = 0;
+  _windowStart = -1;
+  _windowCount = 0;
+
+  File file = FileSystem.open(_path, FILE_READ);
+  if (!file)
+  {
+    ESP_LOGE(TAG, "Catalogue '%s' not found", _path);
+    return false;
+  }
+
+  Header header;
+  bool result = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+    header.magic == THEMECATALOGUE_MAGIC &&
+    header.version == THEMECATALOGUE_VERSION &&
+    file.size() == sizeof(header) + header.count * THEMEINDEX_MAXNAMELENGTH;
+  file.close();
+
+  if (!result)
+  {
+    ESP_LOGE(TAG, "Catalogue '%s' invalid", _path);
+    return false;
+  }
+
+  _count = header.count;
+  ESP_LOGI(TAG, "Opened catalogue with %d themes", _count);
+  return true;
+}
+
+//===============================================================
+// Copies the name of a theme and returns false if not available
+//===============================================================
+bool ThemeCatalogue::GetName(uint16_t index, char* name, size_t length)
+{
+  if (index >= _count)
+  {
+    return false;
+  }
+
+  // Reload window if the index left it
+  if (_windowStart < 0 ||
+    index < _windowStart ||
+    index >= _windowStart + _windowCount)
+  {
+    if (!LoadWindow(index))
+    {
+      return false;
+    }
+  }
+
+  strlcpy(name, _window[index - _windowStart], length);
+  return true;
+}
+
+//===============================================================
+// Returns the index of a theme name (Binary search)
+//===============================================================
+int16_t ThemeCatalogue::Find(const char* name)
+{
+  if (_count == 0)
+  {
+    return -1;
+  }
+
+  File file = FileSystem.open(_path, FILE_READ);
+  if (!file)
+  {
+    return -1;
+  }
+
+  int32_t lower = 0;
+  int32_t upper = _count - 1;
+  int16_t result = -1;
+  char current[THEMEINDEX_MAXNAMELENGTH];
+  while (lower <= upper)
+  {
+    int32_t middle = (lower + upper) / 2;
+    if (!ReadName(&file, middle, current))
+    {
+      break;
+    }
+
+    int compare = strcmp(current, name);
+    if (compare == 0)
+    {
+      result = middle;
+      break;
+    }
+    else if (compare < 0)
+    {
+      lower = middle + 1;
+    }
+    else
+    {
+      upper = middle - 1;
+    }
+  }
+
+  file.close();
+  return result;
+}
+
+//===============================================================
+// Writes the valid entries of a sorted theme index
+//===============================================================
+bool ThemeCatalogue::Save(const char* path, const ThemeIndexEntry* entries, uint16_t count)
+{
+  File file = FileSystem.open(path, FILE_WRITE);
+  if (!file)
+  {
+    ESP_LOGE(TAG, "Failed to open '%s' for writing", path);
+    return false;
+  }
+
+  Header header = { THEMECATALOGUE_MAGIC, THEMECATALOGUE_VERSION, 0 };
+  for (uint16_t index = 0; index < count; index++)
+  {
+    header.count += entries[index].isValid ? 1 : 0;
+  }
+
+  bool result = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+  for (uint16_t index = 0; index < count && result; index++)
+  {
+    if (entries[index].isValid)
+    {
+      result = file.write((const uint8_t*)entries[index].fileName, THEMEINDEX_MAXNAMELENGTH) == THEMEINDEX_MAXNAMELENGTH;
+    }
+  }
+  file.close();
+
+  if (!result)
+  {
+    ESP_LOGE(TAG, "Failed to write '%s'", path);
+    FileSystem.remove(path);
+  }
+  return result;
+}
+
+//===============================================================
+// Reads a single name from the opened catalogue
+//===============================================================
+bool ThemeCatalogue::ReadName(File* file, uint16_t index, char* name)
+{
+  if (!file->seek(sizeof(Header) + index * THEMEINDEX_MAXNAMELENGTH) ||
+    file->read((uint8_t*)name, THEMEINDEX_MAXNAMELENGTH) != THEMEINDEX_MAXNAMELENGTH)
+  {
+    return false;
+  }
+
+  name[THEMEINDEX_MAXNAMELENGTH - 1] = '\0';
+  return true;
+}
+
+//===============================================================
+// Loads the window around an index
+// The index is placed in the middle, so stepping in both
+// directions stays inside the window
+//===============================================================
+bool ThemeCatalogue::LoadWindow(uint16_t index)
+{
+  int32_t start = max((int32_t)index - THEMECATALOGUE_WINDOW / 2, (int32_t)0);
+  start = max(min(start, (int32_t)_count - THEMECATALOGUE_WINDOW), (int32_t)0);
+  uint8_t count = min((int32_t)THEMECATALOGUE_WINDOW, (int32_t)_count - start);
+
+  File file = FileSystem.open(_path, FILE_READ);
+  if (!file)
+  {
+    _windowStart = -1;
+    return false;
+  }
+
+  size_t length = count * THEMEINDEX_MAXNAMELENGTH;
+  bool result = file.seek(sizeof(Header) + start * THEMEINDEX_MAXNAMELENGTH) &&
+    file.read((uint8_t*)_window, length) == length;
+  file.close();
+
+  if (!result)
+  {
+    _windowStart = -1;
+    return false;
+  }
+
+  for (uint8_t position = 0; position < count; position++)
+  {
+    _window[position][THEMEINDEX_MAXNAMELENGTH - 1] = '\0';
+  }
+  _windowStart = start;
+  _windowCount = count;
+  return true;
+}
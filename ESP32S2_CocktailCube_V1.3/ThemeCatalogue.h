@@ -0,0 +1,79 @@
+/*
+ * Includes the paged catalogue of valid themes
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef THEMECATALOGUE_H
+#define THEMECATALOGUE_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <FS.h>
+#include <esp_log.h>
+#include "FileSystem.h"
+#include "ThemeIndex.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define THEMECATALOGUE_MAGIC        0x41435443  // "CTCA"
+#define THEMECATALOGUE_VERSION      1
+#define THEMECATALOGUE_WINDOW       8           // Names kept in RAM around the selection
+
+//===============================================================
+// Class for the theme catalogue
+// The catalogue is a sorted list of fixed size names on SPIFFS.
+// Only a small window of names is kept in RAM, so the memory
+// usage does not depend on the theme count
+//===============================================================
+class ThemeCatalogue
+{
+  public:
+    // Constructor
+    ThemeCatalogue(const char* path = THEMECATALOGUE_PATH);
+
+    // Opens the catalogue and returns false if not available
+    bool Begin();
+
+    // Returns the theme count
+    uint16_t GetCount() const { return _count; }
+
+    // Copies the name of a theme and returns false if not available
+    bool GetName(uint16_t index, char* name, size_t length);
+
+    // Returns the index of a theme name (Binary search, -1 if not found)
+    int16_t Find(const char* name);
+
+    // Writes the valid entries of a sorted theme index
+    static bool Save(const char* path, const ThemeIndexEntry* entries, uint16_t count);
+
+  private:
+    // Header of the catalogue file
+    struct Header
+    {
+      uint32_t magic;
+      uint16_t version;
+      uint16_t count;
+    };
+
+    const char* _path;
+    uint16_t _count = 0;
+
+    // Window variables
+    int32_t _windowStart = -1;
+    uint8_t _windowCount = 0;
+    char _window[THEMECATALOGUE_WINDOW][THEMEINDEX_MAXNAMELENGTH];
+
+    // Reads a single name from the opened catalogue
+    bool ReadName(File* file, uint16_t index, char* name);
+
+    // Loads the window around an index
+    bool LoadWindow(uint16_t index);
+};
+
+#endif
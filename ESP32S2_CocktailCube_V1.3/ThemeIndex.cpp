@@ -0,0 +1,412 @@
+/*
+ * Includes the persistent index of theme (config) files
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "ThemeIndex.h"
+#include "ThemeCatalogue.h"
+#include "ThemeBlob.h"
+#include "ThemeBundle.h"
+#include "Config.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "themeindex";
+
+// Image keys in the order of the entry image references
+static const char* ImageKeys[THEMEINDEX_IMAGECOUNT] =
+{
+  IMAGE_LOGO, IMAGE_GLASS, IMAGE_BOTTLE1, IMAGE_BOTTLE2, IMAGE_BOTTLE3, IMAGE_BOTTLE4
+};
+
+//===============================================================
+// Constructor
+//===============================================================
+ThemeIndex::ThemeIndex(const char* indexPath, const char* cataloguePath) :
+  _indexPath(indexPath),
+  _cataloguePath(cataloguePath)
+{
+}
+
+//===============================================================
+// Destructor
+//===============================================================
+ThemeIndex::~ThemeIndex()
+{
+  if (_entries)
+  {
+    free(_entries);
+    _entries = NULL;
+  }
+}
+
+//===============================================================
+// Loads the index, parses changed files and saves the index if
+// needed. Unchanged files are only hashed, not parsed
+//===============================================================
+bool ThemeIndex::Update()
+{
+  // Allocate entry buffer
+  if (!_entries)
+  {
+    uint32_t bufferSize = THEMEINDEX_MAXENTRIES * sizeof(ThemeIndexEntry);
+    _entries = (ThemeIndexEntry*)ps_malloc(bufferSize);
+    if (!_entries)
+    {
+      _entries = (ThemeIndexEntry*)malloc(bufferSize);
+    }
+    if (!_entries)
+    {
+      ESP_LOGE(TAG, "Failed to allocate index buffer");
+      return false;
+    }
+  }
+
+  // Load last saved index (Sorted by file name)
+  uint16_t savedCount = 0;
+  ThemeIndexEntry* savedEntries = Load(&savedCount);
+  _count = 0;
+  _parsedCount = 0;
+
+  // Open root directory
+  File rootDirectory = FileSystem.open("/", FILE_READ);
+  if (!rootDirectory)
+  {
+    ESP_LOGI(TAG, "No root directory found");
+    if (savedEntries)
+    {
+      free(savedEntries);
+    }
+    return false;
+  }
+
+  // Iterate through all json files and bundles
+  bool isChanged = false;
+  File entry = rootDirectory.openNextFile();
+  while (entry)
+  {
+    const char* fileName = StripSlash(entry.name());
+    if (!entry.isDirectory() &&
+      IsThemeFile(fileName) &&
+      strlen(fileName) < THEMEINDEX_MAXNAMELENGTH)
+    {
+      if (_count >= THEMEINDEX_MAXENTRIES)
+      {
+        ESP_LOGE(TAG, "Index full, ignoring '%s'", fileName);
+        break;
+      }
+
+      // Find saved entry with same name
+      ThemeIndexEntry key;
+      strlcpy(key.fileName, fileName, sizeof(key.fileName));
+      ThemeIndexEntry* savedEntry = savedEntries ?
+        (ThemeIndexEntry*)bsearch(&key, savedEntries, savedCount, sizeof(ThemeIndexEntry), CompareEntries) :
+        NULL;
+
+      ThemeIndexEntry* currentEntry = &_entries[_count++];
+      uint32_t hash = 0;
+      if (savedEntry &&
+        savedEntry->size == entry.size() &&
+        (hash = HashFile(&entry)) == savedEntry->hash)
+      {
+        // Unchanged file
+        *currentEntry = *savedEntry;
+      }
+      else
+      {
+        // New or changed file
+        memset(currentEntry, 0, sizeof(ThemeIndexEntry));
+        strlcpy(currentEntry->fileName, fileName, sizeof(currentEntry->fileName));
+        currentEntry->size = entry.size();
+        currentEntry->hash = hash != 0 ? hash : HashFile(&entry);
+        Parse(&entry, currentEntry);
+        _parsedCount++;
+
+        // Compiled theme of a changed file is outdated
+        if (savedEntry)
+        {
+          RemoveBlob(fileName);
+        }
+        isChanged = true;
+
+        ESP_LOGI(TAG, "Parsed '%s': %s", fileName, currentEntry->isValid ? "valid" : "invalid");
+      }
+    }
+
+    // Get next file
+    entry = rootDirectory.openNextFile();
+  }
+
+  // Close root directory
+  rootDirectory.close();
+
+  // Removed files
+  isChanged |= _count != savedCount;
+
+  if (savedEntries)
+  {
+    free(savedEntries);
+  }
+
+  // Sort by file name for binary search and the catalogue
+  qsort(_entries, _count, sizeof(ThemeIndexEntry), CompareEntries);
+
+  ESP_LOGI(TAG, "Updated index: %d files, %d parsed", _count, _parsedCount);
+
+  return isChanged || !FileSystem.exists(_cataloguePath) ? Save() : true;
+}
+
+//===============================================================
+// Returns an entry
+//===============================================================
+const ThemeIndexEntry* ThemeIndex::GetEntry(uint16_t index) const
+{
+  if (!_entries || index >= _count)
+  {
+    return NULL;
+  }
+  return &_entries[index];
+}
+
+//===============================================================
+// Invalidates the entry of a file
+//===============================================================
+void ThemeIndex::Invalidate(const String& fileName, const char* indexPath)
+{
+  if (!IsThemeFile(fileName.c_str()))
+  {
+    return;
+  }
+
+  // Remove outdated compiled theme
+  RemoveBlob(StripSlash(fileName.c_str()));
+
+  File indexFile = FileSystem.open(indexPath, "r+");
+  if (!indexFile)
+  {
+    return;
+  }
+
+  Header header;
+  if (indexFile.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+    header.magic == THEMEINDEX_MAGIC &&
+    header.version == THEMEINDEX_VERSION &&
+    header.entrySize == sizeof(ThemeIndexEntry))
+  {
+    const char* name = StripSlash(fileName.c_str());
+    char entryName[THEMEINDEX_MAXNAMELENGTH];
+    for (uint16_t index = 0; index < header.count; index++)
+    {
+      uint32_t position = sizeof(header) + index * sizeof(ThemeIndexEntry);
+      indexFile.seek(position);
+      if (indexFile.read((uint8_t*)entryName, sizeof(entryName)) != sizeof(entryName))
+      {
+        break;
+      }
+      entryName[sizeof(entryName) - 1] = '\0';
+
+      if (strcmp(entryName, name) == 0)
+      {
+        uint32_t size = THEMEINDEX_INVALIDSIZE;
+        indexFile.seek(position + offsetof(ThemeIndexEntry, size));
+        indexFile.write((const uint8_t*)&size, sizeof(size));
+        ESP_LOGI(TAG, "Invalidated '%s'", name);
+        break;
+      }
+    }
+  }
+
+  indexFile.close();
+}
+
+//===============================================================
+// Returns the FNV-1a hash of a file content
+//===============================================================
+uint32_t ThemeIndex::HashFile(File* file)
+{
+  uint8_t buffer[256];
+  uint32_t hash = 2166136261UL;
+
+  file->seek(0);
+  size_t length;
+  while ((length = file->read(buffer, sizeof(buffer))) > 0)
+  {
+    for (size_t index = 0; index < length; index++)
+    {
+      hash = (hash ^ buffer[index]) * 16777619UL;
+    }
+  }
+  file->seek(0);
+
+  return hash;
+}
+
+//===============================================================
+// Loads the entries of the index file into a new buffer
+//===============================================================
+ThemeIndexEntry* ThemeIndex::Load(uint16_t* count)
+{
+  *count = 0;
+
+  File indexFile = FileSystem.open(_indexPath, FILE_READ);
+  if (!indexFile)
+  {
+    return NULL;
+  }
+
+  ThemeIndexEntry* entries = NULL;
+  Header header;
+  if (indexFile.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+    header.magic == THEMEINDEX_MAGIC &&
+    header.version == THEMEINDEX_VERSION &&
+    header.entrySize == sizeof(ThemeIndexEntry) &&
+    header.count > 0 &&
+    header.count <= THEMEINDEX_MAXENTRIES)
+  {
+    size_t length = header.count * sizeof(ThemeIndexEntry);
+    entries = (ThemeIndexEntry*)ps_malloc(length);
+    if (!entries)
+    {
+      entries = (ThemeIndexEntry*)malloc(length);
+    }
+
+    if (entries && indexFile.read((uint8_t*)entries, length) == length)
+    {
+      *count = header.count;
+    }
+    else if (entries)
+    {
+      free(entries);
+      entries = NULL;
+    }
+  }
+  else
+  {
+    ESP_LOGI(TAG, "Index '%s' outdated, rebuilding", _indexPath);
+  }
+
+  indexFile.close();
+  return entries;
+}
+
+//===============================================================
+// Saves all entries to the index file
+//===============================================================
+bool ThemeIndex::Save()
+{
+  File indexFile = FileSystem.open(_indexPath, FILE_WRITE);
+  if (!indexFile)
+  {
+    ESP_LOGE(TAG, "Failed to open '%s' for writing", _indexPath);
+    return false;
+  }
+
+  Header header = { THEMEINDEX_MAGIC, THEMEINDEX_VERSION, _count, sizeof(ThemeIndexEntry) };
+  size_t length = _count * sizeof(ThemeIndexEntry);
+  bool result =
+    indexFile.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+    indexFile.write((const uint8_t*)_entries, length) == length;
+  indexFile.close();
+
+  if (!result)
+  {
+    ESP_LOGE(TAG, "Failed to write '%s'", _indexPath);
+    FileSystem.remove(_indexPath);
+    return false;
+  }
+
+  return ThemeCatalogue::Save(_cataloguePath, _entries, _count);
+}
+
+//===============================================================
+// Compares two entries by file name
+//===============================================================
+int ThemeIndex::CompareEntries(const void* entry1, const void* entry2)
+{
+  return strcmp(((const ThemeIndexEntry*)entry1)->fileName, ((const ThemeIndexEntry*)entry2)->fileName);
+}
+
+//===============================================================
+// Returns true for json themes and theme bundles
+//===============================================================
+bool ThemeIndex::IsThemeFile(const char* fileName)
+{
+  String name = fileName;
+  return name.endsWith(".json") || name.endsWith(THEMEBUNDLE_EXTENSION);
+}
+
+//===============================================================
+// Parses a json file or bundle into an entry
+//===============================================================
+void ThemeIndex::Parse(File* file, ThemeIndexEntry* entry)
+{
+  // Bundles contain the compiled config
+  if (String(entry->fileName).endsWith(THEMEBUNDLE_EXTENSION))
+  {
+    ThemeBlob blob;
+    entry->isValid = ThemeBundle::ReadConfig(file, &blob);
+    if (entry->isValid)
+    {
+      entry->isMixer = blob.isMixer;
+      strlcpy(entry->mixerName, blob.mixerName, sizeof(entry->mixerName));
+      for (uint8_t index = 0; index < THEMEINDEX_IMAGECOUNT; index++)
+      {
+        strlcpy(entry->images[index], blob.images[index], sizeof(entry->images[index]));
+      }
+    }
+    return;
+  }
+
+  JsonDocument doc;
+  file->seek(0);
+  if (deserializeJson(doc, *file).code() != DeserializationError::Ok)
+  {
+    entry->isValid = false;
+    return;
+  }
+
+  entry->isValid = Config.CheckValid(doc);
+  entry->isMixer = doc[IS_MIXER].as<bool>();
+  strlcpy(entry->mixerName, doc[MIXER_NAME].as<String>().c_str(), sizeof(entry->mixerName));
+  for (uint8_t index = 0; index < THEMEINDEX_IMAGECOUNT; index++)
+  {
+    strlcpy(entry->images[index], doc[ImageKeys[index]].as<String>().c_str(), sizeof(entry->images[index]));
+  }
+
+  // Clear json document
+  doc.clear();
+}
+
+//===============================================================
+// Removes the compiled theme of a json file
+//===============================================================
+void ThemeIndex::RemoveBlob(const char* fileName)
+{
+  if (!String(fileName).endsWith(".json"))
+  {
+    return;
+  }
+
+  String blobPath = String("/") + fileName;
+  blobPath.replace(".json", THEMEBLOB_EXTENSION);
+  if (FileSystem.exists(blobPath))
+  {
+    FileSystem.remove(blobPath);
+    ESP_LOGI(TAG, "Removed '%s'", blobPath.c_str());
+  }
+}
+
+//===============================================================
+// Returns the file name without leading slash
+//===============================================================
+const char* ThemeIndex::StripSlash(const char* fileName)
+{
+  return fileName[0] == '/' ? fileName + 1 : fileName;
+}
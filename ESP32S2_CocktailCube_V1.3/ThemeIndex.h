@@ -0,0 +1,119 @@
+/*
+ * Includes the persistent index of theme (config) files
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef THEMEINDEX_H
+#define THEMEINDEX_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <FS.h>
+#include <ArduinoJson.h>
+#include <esp_log.h>
+#include "FileSystem.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define THEMEINDEX_PATH             "/themes.idx"
+#define THEMEINDEX_MAGIC            0x58495443  // "CTIX"
+#define THEMEINDEX_VERSION          2           // Entries sorted by file name
+#define THEMEINDEX_MAXENTRIES       1000
+#define THEMEINDEX_MAXNAMELENGTH    32          // SPIFFS object name length
+#define THEMEINDEX_MAXMIXERNAME     16
+#define THEMEINDEX_IMAGECOUNT       6
+#define THEMEINDEX_INVALIDSIZE      0xFFFFFFFF  // Forces a re-parse of the entry
+#define THEMECATALOGUE_PATH         "/themes.cat"
+
+//===============================================================
+// Metadata of a single theme file
+//===============================================================
+struct ThemeIndexEntry
+{
+  char fileName[THEMEINDEX_MAXNAMELENGTH];
+  uint32_t size;
+  uint32_t hash;
+  uint8_t isValid;
+  uint8_t isMixer;
+  char mixerName[THEMEINDEX_MAXMIXERNAME];
+  char images[THEMEINDEX_IMAGECOUNT][THEMEINDEX_MAXNAMELENGTH];
+};
+
+//===============================================================
+// Class for the theme index
+// The index is stored as binary file on SPIFFS, sorted by file
+// name. On update only json files and bundles with changed size
+// or content hash are parsed again
+//===============================================================
+class ThemeIndex
+{
+  public:
+    // Constructor
+    ThemeIndex(const char* indexPath = THEMEINDEX_PATH, const char* cataloguePath = THEMECATALOGUE_PATH);
+
+    // Destructor
+    ~ThemeIndex();
+
+    // Loads the index, parses changed files and saves the index if needed
+    bool Update();
+
+    // Returns the entry count
+    uint16_t GetCount() const { return _count; }
+
+    // Returns an entry
+    const ThemeIndexEntry* GetEntry(uint16_t index) const;
+
+    // Returns the count of files parsed by the last update
+    uint16_t GetParsedCount() const { return _parsedCount; }
+
+    // Invalidates the entry and the compiled theme of a file (e.g. after upload or delete)
+    static void Invalidate(const String& fileName, const char* indexPath = THEMEINDEX_PATH);
+
+    // Returns the FNV-1a hash of a file content
+    static uint32_t HashFile(File* file);
+
+  private:
+    // Header of the index file
+    struct Header
+    {
+      uint32_t magic;
+      uint16_t version;
+      uint16_t count;
+      uint32_t entrySize;
+    };
+
+    const char* _indexPath;
+    const char* _cataloguePath;
+    ThemeIndexEntry* _entries = NULL;
+    uint16_t _count = 0;
+    uint16_t _parsedCount = 0;
+
+    // Loads the entries of the index file into a new buffer (Must be freed by the caller)
+    ThemeIndexEntry* Load(uint16_t* count);
+
+    // Saves all entries to the index file and the valid themes to the catalogue
+    bool Save();
+
+    // Compares two entries by file name
+    static int CompareEntries(const void* entry1, const void* entry2);
+
+    // Returns true for json themes and theme bundles
+    static bool IsThemeFile(const char* fileName);
+
+    // Parses a json file or bundle into an entry
+    void Parse(File* file, ThemeIndexEntry* entry);
+
+    // Removes the compiled theme of a json file
+    static void RemoveBlob(const char* fileName);
+
+    // Returns the file name without leading slash
+    static const char* StripSlash(const char* fileName);
+};
+
+#endif
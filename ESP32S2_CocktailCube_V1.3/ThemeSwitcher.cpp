@@ -0,0 +1,280 @@
+/*
+ * Includes the background prefetch and swap of themes
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "ThemeSwitcher.h"
+#include "DisplayDriver.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "themeswitch";
+
+//===============================================================
+// Global variables
+//===============================================================
+ThemeSwitcher ThemeSwitch;
+
+//===============================================================
+// Constructor
+//===============================================================
+ThemeSwitcher::ThemeSwitcher()
+{
+}
+
+//===============================================================
+// Starts the prefetch task
+//===============================================================
+bool ThemeSwitcher::Begin()
+{
+  _mutex = xSemaphoreCreateMutex();
+  if (!_mutex ||
+    xTaskCreate(TaskEntry, "themeswitch", THEMESWITCH_TASKSTACKSIZE, this, THEMESWITCH_TASKPRIORITY, &_task) != pdPASS)
+  {
+    ESP_LOGE(TAG, "Failed to create prefetch task, loading themes inline");
+    _task = NULL;
+    return false;
+  }
+
+  return true;
+}
+
+//===============================================================
+// Requests a theme to be prefetched in the background
+//===============================================================
+void ThemeSwitcher::Request(const char* configFileName)
+{
+  // Time the switch from the first step the user made
+  if (!IsPending())
+  {
+    _requestTime_ms = millis();
+  }
+
+  if (!_task)
+  {
+    // Load inline, swapped in by the next update
+    _requestCount++;
+    strlcpy(_requestName, configFileName, sizeof(_requestName));
+    uint32_t startTime_ms = millis();
+    _readyResult = Load(_requestName, _requestCount);
+    _prefetchTime_ms = millis() - startTime_ms;
+    _readyCount = _requestCount;
+    return;
+  }
+
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  _requestCount++;
+  strlcpy(_requestName, configFileName, sizeof(_requestName));
+  xSemaphoreGive(_mutex);
+
+  xTaskNotifyGive(_task);
+}
+
+//===============================================================
+// Swaps in the prefetched theme if ready
+//===============================================================
+bool ThemeSwitcher::Update()
+{
+  if (!IsPending())
+  {
+    return false;
+  }
+
+  // The task is idle while the newest request is ready
+  bool isReady = false;
+  if (_mutex)
+  {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    isReady = _readyCount == _requestCount;
+    xSemaphoreGive(_mutex);
+  }
+  else
+  {
+    isReady = _readyCount == _requestCount;
+  }
+
+  if (!isReady)
+  {
+    return false;
+  }
+
+  Apply();
+  return true;
+}
+
+//===============================================================
+// Waits for a pending request and swaps it in
+//===============================================================
+bool ThemeSwitcher::Finish()
+{
+  if (!IsPending())
+  {
+    return false;
+  }
+
+  while (!Update())
+  {
+    delay(5);
+  }
+  return true;
+}
+
+//===============================================================
+// Returns true if a requested theme is not swapped in yet
+// Request counters are only changed by the main loop
+//===============================================================
+bool ThemeSwitcher::IsPending()
+{
+  return _appliedCount != _requestCount;
+}
+
+//===============================================================
+// Task entry function
+//===============================================================
+void ThemeSwitcher::TaskEntry(void* parameter)
+{
+  ThemeSwitcher* switcher = (ThemeSwitcher*)parameter;
+  while (true)
+  {
+    // Wait for requests
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    switcher->Prefetch();
+  }
+}
+
+//===============================================================
+// Loads the latest requests until no newer request is available
+//===============================================================
+void ThemeSwitcher::Prefetch()
+{
+  while (true)
+  {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    uint32_t requestCount = _requestCount;
+    char requestName[THEMEINDEX_MAXNAMELENGTH];
+    strlcpy(requestName, _requestName, sizeof(requestName));
+    bool isLoaded = _readyCount == requestCount;
+    xSemaphoreGive(_mutex);
+
+    if (isLoaded)
+    {
+      return;
+    }
+
+    uint32_t startTime_ms = millis();
+    bool result = Load(requestName, requestCount);
+
+    // Only publish the newest request, replaced ones are reloaded
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    if (_requestCount == requestCount)
+    {
+      _readyResult = result;
+      _prefetchTime_ms = millis() - startTime_ms;
+      _readyCount = requestCount;
+    }
+    xSemaphoreGive(_mutex);
+  }
+}
+
+//===============================================================
+// Loads config and images into the staging theme
+// Returns early if a newer request replaced this one
+//===============================================================
+bool ThemeSwitcher::Load(const char* configFileName, uint32_t requestCount)
+{
+  ESP_LOGI(TAG, "Prefetching theme '%s'", configFileName);
+
+  // Failed themes are swapped in with defaults and without images
+  _staging.ResetConfig();
+  bool result = _staging.LoadConfig(configFileName);
+  if (!result ||
+    IsReplaced(requestCount))
+  {
+    _staging.CloseBundle();
+    for (uint8_t index = 0; index < THEMESWITCH_IMAGES; index++)
+    {
+      _images[index].Deallocate();
+    }
+    return false;
+  }
+
+  // Bundled themes are read through one handle in section order
+  ThemeBundle* bundle = _staging.GetBundle();
+  DisplayDriver::LoadImage(&_images[0], _staging.imageLogo, bundle, eSectionLogo);
+  DisplayDriver::LoadImage(&_images[1], _staging.imageGlass, bundle, eSectionGlass);
+  DisplayDriver::LoadImage(&_images[2], _staging.imageBottle1, bundle, eSectionBottle1);
+  if (_staging.isMixer)
+  {
+    _images[3].Deallocate();
+    _images[4].Deallocate();
+    _images[5].Deallocate();
+  }
+  else
+  {
+    DisplayDriver::LoadImage(&_images[3], _staging.imageBottle2, bundle, eSectionBottle2);
+    DisplayDriver::LoadImage(&_images[4], _staging.imageBottle3, bundle, eSectionBottle3);
+    DisplayDriver::LoadImage(&_images[5], _staging.imageBottle4, bundle, eSectionBottle4);
+  }
+  _staging.CloseBundle();
+
+  return true;
+}
+
+//===============================================================
+// Returns true if a newer request replaced the given one
+//===============================================================
+bool ThemeSwitcher::IsReplaced(uint32_t requestCount)
+{
+  if (!_mutex)
+  {
+    return false;
+  }
+
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  bool isReplaced = _requestCount != requestCount;
+  xSemaphoreGive(_mutex);
+  return isReplaced;
+}
+
+//===============================================================
+// Swaps the staging theme with the current theme
+//===============================================================
+void ThemeSwitcher::Apply()
+{
+  uint32_t startTime_us = micros();
+
+  // Copy values and exchange image buffers
+  if (_readyResult)
+  {
+    Config.CopyTheme(&_staging);
+  }
+  else
+  {
+    Config.ResetConfig();
+  }
+  Display.SwapImages(_images);
+
+  _lastSwapTime_us = micros() - startTime_us;
+  _lastSwitchTime_ms = millis() - _requestTime_ms;
+  _lastPrefetchTime_ms = _prefetchTime_ms;
+  _appliedCount = _readyCount;
+
+  // Release the images of the previous theme
+  for (uint8_t index = 0; index < THEMESWITCH_IMAGES; index++)
+  {
+    _images[index].Deallocate();
+  }
+
+  if (!_readyResult)
+  {
+    ESP_LOGE(TAG, "Failed to load theme '%s', switched to defaults", _requestName);
+  }
+  ESP_LOGI(TAG, "Switched to theme '%s' after %d ms (Prefetch: %d ms, Swap: %d us)", _requestName, _lastSwitchTime_ms, _lastPrefetchTime_ms, _lastSwapTime_us);
+}
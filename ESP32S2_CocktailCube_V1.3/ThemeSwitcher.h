@@ -0,0 +1,112 @@
+/*
+ * Includes the background prefetch and swap of themes
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef THEMESWITCHER_H
+#define THEMESWITCHER_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <esp_log.h>
+#include "Config.h"
+#include "SPIFFSBMPImage.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define THEMESWITCH_TASKSTACKSIZE   8192
+#define THEMESWITCH_TASKPRIORITY    1     // Same as the loop task
+#define THEMESWITCH_IMAGES          6     // Logo, glass and bottle 1 to 4
+
+//===============================================================
+// Class for switching themes without blocking the user interface
+// A background task loads the requested theme into a staging
+// configuration and image set. The main loop swaps them in at
+// once, so colors, names and images never mix between themes.
+// Newer requests replace older ones, so only the theme the user
+// stops at is swapped in while scrolling
+//===============================================================
+class ThemeSwitcher
+{
+  public:
+    // Constructor
+    ThemeSwitcher();
+
+    // Starts the prefetch task (Requests are loaded inline on failure)
+    bool Begin();
+
+    // Requests a theme to be prefetched in the background
+    void Request(const char* configFileName);
+
+    // Swaps in the prefetched theme if ready, returns true if swapped
+    bool Update();
+
+    // Waits for a pending request and swaps it in, returns true if swapped
+    bool Finish();
+
+    // Returns true if a requested theme is not swapped in yet
+    bool IsPending();
+
+    // Returns the time from the request to the swap of the last switch
+    uint32_t GetLastSwitchTime_ms() { return _lastSwitchTime_ms; }
+
+    // Returns the background load time of the last switch
+    uint32_t GetLastPrefetchTime_ms() { return _lastPrefetchTime_ms; }
+
+    // Returns the time the main loop was blocked by the last swap
+    uint32_t GetLastSwapTime_us() { return _lastSwapTime_us; }
+
+  private:
+    // Task and lock for the request variables
+    TaskHandle_t _task = NULL;
+    SemaphoreHandle_t _mutex = NULL;
+
+    // Request variables (Shared with the task)
+    char _requestName[THEMEINDEX_MAXNAMELENGTH] = "";
+    uint32_t _requestCount = 0;
+    uint32_t _readyCount = 0;
+    bool _readyResult = false;
+    uint32_t _prefetchTime_ms = 0;
+
+    // Main loop variables
+    uint32_t _appliedCount = 0;
+    uint32_t _requestTime_ms = 0;
+    uint32_t _lastSwitchTime_ms = 0;
+    uint32_t _lastPrefetchTime_ms = 0;
+    uint32_t _lastSwapTime_us = 0;
+
+    // Staging theme (Owned by the task until ready)
+    Configuration _staging;
+    SPIFFSBMPImage _images[THEMESWITCH_IMAGES];
+
+    // Task entry function
+    static void TaskEntry(void* parameter);
+
+    // Loads the latest requests until no newer request is available
+    void Prefetch();
+
+    // Loads config and images into the staging theme
+    bool Load(const char* configFileName, uint32_t requestCount);
+
+    // Returns true if a newer request replaced the given one
+    bool IsReplaced(uint32_t requestCount);
+
+    // Swaps the staging theme with the current theme
+    void Apply();
+};
+
+//===============================================================
+// Global variables
+//===============================================================
+extern ThemeSwitcher ThemeSwitch;
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * Includes the commands of the web server and their coalescing
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "WebCommandBatch.h"
+
+//===============================================================
+// Constructor
+//===============================================================
+WebCommandBatch::WebCommandBatch(uint32_t window_ms) :
+  _window_ms(window_ms)
+{
+}
+
+//===============================================================
+// Adds the values of a command, the first one starts the window
+//===============================================================
+void WebCommandBatch::Add(const WebCommand& command, uint32_t time_ms)
+{
+  // Start coalescing window with the first update
+  if (!_isPending)
+  {
+    _isPending = true;
+    _timestamp_ms = time_ms;
+  }
+
+  // Sum up increments of all clients, the last cycle timespan wins
+  for (uint8_t index = 0; index < 3; index++)
+  {
+    int16_t sum_Degrees = _values.increments_Degrees[index] + command.increments_Degrees[index];
+    _values.increments_Degrees[index] = constrain(sum_Degrees, -360, 360);
+  }
+  if (command.cycleTimespan_ms != 0)
+  {
+    _values.cycleTimespan_ms = command.cycleTimespan_ms;
+  }
+}
+
+//===============================================================
+// Returns true, if values are pending and the window has passed
+//===============================================================
+bool WebCommandBatch::IsDue(uint32_t time_ms) const
+{
+  return _isPending &&
+    (time_ms - _timestamp_ms) >= _window_ms;
+}
+
+//===============================================================
+// Removes the pending values
+//===============================================================
+void WebCommandBatch::Clear()
+{
+  _values = { eWebValues, { 0, 0, 0 }, 0 };
+  _isPending = false;
+}
@@ -0,0 +1,71 @@
+/*
+ * Includes the commands of the web server and their coalescing
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef WEBCOMMANDBATCH_H
+#define WEBCOMMANDBATCH_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+
+//===============================================================
+// Enums
+//===============================================================
+enum WebCommandType : int8_t
+{
+  eWebValues = 0,
+  eWebFormat = 1
+};
+
+//===============================================================
+// Command from the web server, executed in the loop
+//===============================================================
+struct WebCommand
+{
+  WebCommandType type;
+  int16_t increments_Degrees[3];   // Liquid angle increments (0 = unchanged)
+  uint32_t cycleTimespan_ms;       // Cycle timespan (0 = unchanged)
+};
+
+//===============================================================
+// Class for coalescing value commands
+// The first value command starts a time window, all following
+// ones are added until the window has passed. Increments of all
+// clients are summed up (Limited to one turn), the last cycle
+// timespan wins. The loop then applies the batch as one change
+//===============================================================
+class WebCommandBatch
+{
+  public:
+    // Constructor (Window in which value commands are coalesced)
+    WebCommandBatch(uint32_t window_ms);
+
+    // Adds the values of a command, the first one starts the window
+    void Add(const WebCommand& command, uint32_t time_ms);
+
+    // Returns true, if values are pending
+    bool IsPending() const { return _isPending; }
+
+    // Returns true, if values are pending and the window has passed
+    bool IsDue(uint32_t time_ms) const;
+
+    // Returns the coalesced values
+    const WebCommand& GetValues() const { return _values; }
+
+    // Removes the pending values
+    void Clear();
+
+  private:
+    uint32_t _window_ms;
+    WebCommand _values = { eWebValues, { 0, 0, 0 }, 0 };
+    bool _isPending = false;
+    uint32_t _timestamp_ms = 0;
+};
+
+#endif
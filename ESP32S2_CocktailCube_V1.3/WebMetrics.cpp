@@ -0,0 +1,467 @@
+/*
+ * Includes the request metrics of the web server
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "WebMetrics.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "WebMetrics";
+
+// Upper bounds of the histogram buckets (Last bucket is '+Inf')
+static const uint32_t BucketBounds_ms[WEBMETRICS_BUCKETS - 1] = { 5, 10, 25, 50, 100, 250, 500, 1000, 2500 };
+
+// Prometheus metric families
+static const uint8_t FamilyCount = 6;
+static const char* FamilyNames[FamilyCount] =
+{
+  "cocktailcube_http_requests_total",
+  "cocktailcube_http_errors_total",
+  "cocktailcube_http_request_bytes_total",
+  "cocktailcube_http_response_bytes_total",
+  "cocktailcube_http_first_byte_seconds",
+  "cocktailcube_http_duration_seconds"
+};
+static const char* FamilyHelps[FamilyCount] =
+{
+  "Finished requests",
+  "Requests answered with status 400 or above or without response",
+  "Received request body bytes",
+  "Sent response body bytes (Pages, files and data)",
+  "Time from received headers to created response",
+  "Time from received headers until the client has gone"
+};
+
+//===============================================================
+// Constructor
+//===============================================================
+WebMetrics::WebMetrics()
+{
+  memset(_routes, 0, sizeof(_routes));
+  memset(_requests, 0, sizeof(_requests));
+}
+
+//===============================================================
+// Starts the measurement of a request (Headers received)
+//===============================================================
+void WebMetrics::Begin(AsyncWebServerRequest* request)
+{
+  for (uint8_t index = 0; index < WEBMETRICS_MAXREQUESTS; index++)
+  {
+    if (_requests[index].request == NULL)
+    {
+      _requests[index].request = request;
+      _requests[index].route = GetRoute(request);
+      _requests[index].start_us = micros();
+      _requests[index].firstByte_us = 0;
+      _requests[index].bytesOut = 0;
+      return;
+    }
+  }
+
+  ESP_LOGE(TAG, "No free measurement for '%s'", request->url().c_str());
+  _untracked++;
+}
+
+//===============================================================
+// Ends the measurement of a request (Client has gone)
+//===============================================================
+void WebMetrics::End(AsyncWebServerRequest* request)
+{
+  OpenRequest* openRequest = FindRequest(request);
+  if (!openRequest)
+  {
+    return;
+  }
+
+  uint32_t total_us = micros() - openRequest->start_us;
+  uint32_t firstByte_us = openRequest->firstByte_us != 0 ? openRequest->firstByte_us - openRequest->start_us : total_us;
+
+  RouteMetrics& route = _routes[openRequest->route];
+  const AsyncWebServerResponse* response = request->getResponse();
+  route.requests++;
+  route.bytesIn += request->contentLength();
+  route.bytesOut += openRequest->bytesOut;
+  if (!response || response->code() >= 400)
+  {
+    route.errors++;
+  }
+  AddTime(route.firstByte, firstByte_us);
+  AddTime(route.total, total_us);
+
+  openRequest->request = NULL;
+}
+
+//===============================================================
+// Counts body bytes of the response of a request
+//===============================================================
+void WebMetrics::AddBytesOut(AsyncWebServerRequest* request, size_t length)
+{
+  OpenRequest* openRequest = FindRequest(request);
+  if (openRequest)
+  {
+    openRequest->bytesOut += length;
+  }
+}
+
+//===============================================================
+// Measures the time to first byte around the handler
+//===============================================================
+void WebMetrics::run(AsyncWebServerRequest* request, ArMiddlewareNext next)
+{
+  next();
+
+  OpenRequest* openRequest = FindRequest(request);
+  if (openRequest &&
+    openRequest->firstByte_us == 0)
+  {
+    openRequest->firstByte_us = micros();
+  }
+}
+
+//===============================================================
+// Sends the metrics (Prometheus text, Json with '?format=json')
+//===============================================================
+void WebMetrics::HandleRequest(AsyncWebServerRequest* request)
+{
+  bool json = request->hasArg("format") && request->arg("format") == "json";
+
+  // Stream line by line, freed together with the response
+  std::shared_ptr<WebMetricsWriter> writer = std::make_shared<WebMetricsWriter>(*this, json);
+  AsyncWebServerResponse* response = request->beginChunkedResponse(json ? "application/json" : "text/plain; version=0.0.4; charset=utf-8", [this, request, writer](uint8_t* buffer, size_t maxLength, size_t index)
+  {
+    size_t length = writer->Read(buffer, maxLength);
+    AddBytesOut(request, length);
+    return length;
+  });
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+//===============================================================
+// Returns the name of a route
+//===============================================================
+const char* WebMetrics::GetRouteName(WebRoute route)
+{
+  switch (route)
+  {
+    case eRouteRoot:
+      return "root";
+    case eRouteControlGet:
+      return "control_get";
+    case eRouteControlPost:
+      return "control_post";
+    case eRouteEditPage:
+      return "edit_page";
+    case eRouteEditList:
+      return "edit_list";
+    case eRouteEditDownload:
+      return "edit_download";
+    case eRouteEditUpload:
+      return "edit_upload";
+    case eRouteEditDelete:
+      return "edit_delete";
+    case eRouteStatic:
+      return "static";
+    case eRouteSystemInfo:
+      return "systeminfo";
+    case eRouteMetrics:
+      return "metrics";
+    case eRouteFormat:
+      return "format";
+    default:
+      return "other";
+  }
+}
+
+//===============================================================
+// Returns the open request (NULL if not measured)
+//===============================================================
+WebMetrics::OpenRequest* WebMetrics::FindRequest(AsyncWebServerRequest* request)
+{
+  for (uint8_t index = 0; index < WEBMETRICS_MAXREQUESTS; index++)
+  {
+    if (_requests[index].request == request)
+    {
+      return &_requests[index];
+    }
+  }
+  return NULL;
+}
+
+//===============================================================
+// Returns the route of a request (Query arguments are already
+// parsed with the headers)
+//===============================================================
+WebRoute WebMetrics::GetRoute(AsyncWebServerRequest* request)
+{
+  const String& url = request->url();
+  WebRequestMethodComposite method = request->method();
+
+  if (url == "/" || url == "/index.html")
+  {
+    return eRouteRoot;
+  }
+  else if (url == "/control")
+  {
+    return method == HTTP_GET ? eRouteControlGet : eRouteControlPost;
+  }
+  else if (url.equalsIgnoreCase("/edit"))
+  {
+    if (method == HTTP_GET)
+    {
+      String argument = request->args() > 0 ? request->argName(0) : String();
+      return argument == "list" ? eRouteEditList :
+        argument == "download" ? eRouteEditDownload :
+        eRouteEditPage;
+    }
+    return method == HTTP_POST ? eRouteEditUpload :
+      method == HTTP_DELETE ? eRouteEditDelete :
+      eRouteOther;
+  }
+  else if (url == "/systeminfo")
+  {
+    return eRouteSystemInfo;
+  }
+  else if (url == WEBMETRICS_PATH)
+  {
+    return eRouteMetrics;
+  }
+  else if (url == "/format")
+  {
+    return eRouteFormat;
+  }
+  return method == HTTP_GET ? eRouteStatic : eRouteOther;
+}
+
+//===============================================================
+// Adds a time to a histogram
+//===============================================================
+void WebMetrics::AddTime(Histogram& histogram, uint32_t time_us)
+{
+  uint8_t bucket = 0;
+  while (bucket < WEBMETRICS_BUCKETS - 1 &&
+    time_us > BucketBounds_ms[bucket] * 1000)
+  {
+    bucket++;
+  }
+  histogram.counts[bucket]++;
+  histogram.sum_us += time_us;
+}
+
+//===============================================================
+// Constructor
+//===============================================================
+WebMetricsWriter::WebMetricsWriter(const WebMetrics& metrics, bool json) :
+  _metrics(metrics),
+  _json(json)
+{
+}
+
+//===============================================================
+// Fills the buffer with the next part, returns 0 at the end
+//===============================================================
+size_t WebMetricsWriter::Read(uint8_t* buffer, size_t maxLength)
+{
+  size_t length = 0;
+  while (length < maxLength)
+  {
+    if (_textOffset >= _textLength)
+    {
+      if (_finished)
+      {
+        break;
+      }
+      if (_json)
+      {
+        NextRoute();
+      }
+      else
+      {
+        NextLine();
+        _textLength = min(_textLength, sizeof(_text) - 1);
+      }
+      continue;
+    }
+
+    size_t copyLength = min(_textLength - _textOffset, maxLength - length);
+    memcpy(buffer + length, _text + _textOffset, copyLength);
+    _textOffset += copyLength;
+    length += copyLength;
+  }
+  return length;
+}
+
+//===============================================================
+// Writes the next Prometheus line (Or nothing at the end)
+//===============================================================
+void WebMetricsWriter::NextLine()
+{
+  _textLength = 0;
+  _textOffset = 0;
+
+  // Untracked requests at the end
+  if (_family >= FamilyCount)
+  {
+    _textLength = snprintf(_text, sizeof(_text),
+      "# HELP cocktailcube_http_untracked_total Requests not measured (All measurements in use)\n"
+      "# TYPE cocktailcube_http_untracked_total counter\n"
+      "cocktailcube_http_untracked_total %lu\n", (unsigned long)_metrics._untracked);
+    _finished = true;
+    return;
+  }
+
+  const char* name = FamilyNames[_family];
+  bool histogram = _family >= 4;
+  if (!_headerWritten)
+  {
+    _textLength = snprintf(_text, sizeof(_text), "# HELP %s %s\n# TYPE %s %s\n", name, FamilyHelps[_family], name, histogram ? "histogram" : "counter");
+    _headerWritten = true;
+    return;
+  }
+
+  // Next family after the last route
+  if (!SkipEmptyRoutes())
+  {
+    _family++;
+    _route = 0;
+    _line = 0;
+    _headerWritten = false;
+    return;
+  }
+
+  const WebMetrics::RouteMetrics& route = _metrics._routes[_route];
+  const char* routeName = WebMetrics::GetRouteName((WebRoute)_route);
+  if (!histogram)
+  {
+    uint32_t value = _family == 0 ? route.requests :
+      _family == 1 ? route.errors :
+      _family == 2 ? route.bytesIn :
+      route.bytesOut;
+    _textLength = snprintf(_text, sizeof(_text), "%s{route=\"%s\"} %lu\n", name, routeName, (unsigned long)value);
+    _route++;
+    return;
+  }
+
+  // Histogram lines: Cumulative buckets, sum and count
+  const WebMetrics::Histogram& values = _family == 4 ? route.firstByte : route.total;
+  uint32_t count = 0;
+  for (uint8_t bucket = 0; bucket <= min(_line, (uint8_t)(WEBMETRICS_BUCKETS - 1)); bucket++)
+  {
+    count += values.counts[bucket];
+  }
+
+  if (_line < WEBMETRICS_BUCKETS)
+  {
+
+    char bound[12];
+    if (_line < WEBMETRICS_BUCKETS - 1)
+    {
+      snprintf(bound, sizeof(bound), "%.3f", BucketBounds_ms[_line] / 1000.0);
+    }
+    else
+    {
+      strlcpy(bound, "+Inf", sizeof(bound));
+    }
+    _textLength = snprintf(_text, sizeof(_text), "%s_bucket{route=\"%s\",le=\"%s\"} %lu\n", name, routeName, bound, (unsigned long)count);
+  }
+  else if (_line == WEBMETRICS_BUCKETS)
+  {
+    _textLength = snprintf(_text, sizeof(_text), "%s_sum{route=\"%s\"} %.6f\n", name, routeName, values.sum_us / 1000000.0);
+  }
+  else
+  {
+    _textLength = snprintf(_text, sizeof(_text), "%s_count{route=\"%s\"} %lu\n", name, routeName, (unsigned long)count);
+  }
+
+  _line++;
+  if (_line > WEBMETRICS_BUCKETS + 1)
+  {
+    _line = 0;
+    _route++;
+  }
+}
+
+//===============================================================
+// Writes the next Json route (Or the end of the document):
+//   {"untracked":0,"buckets_ms":[5,...],"routes":[{"route":"root",
+//   "requests":1,...,"first_byte":[1,0,...],"total":[...]},...]}
+//===============================================================
+void WebMetricsWriter::NextRoute()
+{
+  JsonStreamWriter writer(_text, sizeof(_text));
+
+  if (!_headerWritten)
+  {
+    writer.BeginObject();
+    writer.Add("untracked", _metrics._untracked);
+    writer.BeginArray("buckets_ms");
+    for (uint8_t bucket = 0; bucket < WEBMETRICS_BUCKETS - 1; bucket++)
+    {
+      writer.Add(NULL, BucketBounds_ms[bucket]);
+    }
+    writer.EndArray();
+    writer.Raw(",\"routes\":[");
+    _headerWritten = true;
+  }
+  else if (!SkipEmptyRoutes())
+  {
+    writer.Raw("]}");
+    _finished = true;
+  }
+  else
+  {
+    const WebMetrics::RouteMetrics& route = _metrics._routes[_route];
+    writer.Raw(_line == 0 ? "" : ",");
+    writer.BeginObject();
+    writer.Add("route", WebMetrics::GetRouteName((WebRoute)_route));
+    writer.Add("requests", route.requests);
+    writer.Add("errors", route.errors);
+    writer.Add("bytes_in", route.bytesIn);
+    writer.Add("bytes_out", route.bytesOut);
+    writer.Add("first_byte_ms", (uint32_t)(route.firstByte.sum_us / 1000));
+    writer.Add("total_ms", (uint32_t)(route.total.sum_us / 1000));
+    writer.BeginArray("first_byte");
+    for (uint8_t bucket = 0; bucket < WEBMETRICS_BUCKETS; bucket++)
+    {
+      writer.Add(NULL, route.firstByte.counts[bucket]);
+    }
+    writer.EndArray();
+    writer.BeginArray("total");
+    for (uint8_t bucket = 0; bucket < WEBMETRICS_BUCKETS; bucket++)
+    {
+      writer.Add(NULL, route.total.counts[bucket]);
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    // Line counts the written routes for the separator
+    _line++;
+    _route++;
+  }
+
+  _textLength = writer.GetLength();
+  _textOffset = 0;
+}
+
+//===============================================================
+// Skips to the next route with requests, returns false at the
+// end of the routes
+//===============================================================
+bool WebMetricsWriter::SkipEmptyRoutes()
+{
+  while (_route < eRouteCount &&
+    _metrics._routes[_route].requests == 0)
+  {
+    _route++;
+  }
+  return _route < eRouteCount;
+}
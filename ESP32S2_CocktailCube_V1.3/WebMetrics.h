@@ -0,0 +1,169 @@
+/*
+ * Includes the request metrics of the web server
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef WEBMETRICS_H
+#define WEBMETRICS_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <memory>
+#include <ESPAsyncWebServer.h>
+#include "JsonStreamWriter.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define WEBMETRICS_PATH             "/metrics"
+#define WEBMETRICS_MAXREQUESTS      12          // Open and rejected requests measured at the same time
+#define WEBMETRICS_BUCKETS          10          // Histogram buckets (Last bucket is '+Inf')
+#define WEBMETRICS_LINESIZE         320         // Single line of the Prometheus text or single Json route
+
+//===============================================================
+// Enums
+//===============================================================
+enum WebRoute : uint8_t
+{
+  eRouteRoot = 0,
+  eRouteControlGet,
+  eRouteControlPost,
+  eRouteEditPage,
+  eRouteEditList,
+  eRouteEditDownload,
+  eRouteEditUpload,
+  eRouteEditDelete,
+  eRouteStatic,
+  eRouteSystemInfo,
+  eRouteMetrics,
+  eRouteFormat,
+  eRouteOther,
+  eRouteCount
+};
+
+//===============================================================
+// Web metrics class
+// Measures each request from the received headers until the
+// client has gone. The time to first byte is taken when the
+// handler has created the response (The head is sent right
+// after). The library does not expose the sent bytes, so the
+// handlers count the body bytes they hand over to a response.
+// All counters are kept in fixed tables, only changed in the
+// task of the TCP stack, so no locks and no allocations are
+// needed per request
+//===============================================================
+class WebMetrics: public AsyncMiddleware
+{
+  public:
+    // Constructor
+    WebMetrics();
+
+    // Starts the measurement of a request (Headers received)
+    void Begin(AsyncWebServerRequest* request);
+
+    // Ends the measurement of a request (Client has gone)
+    void End(AsyncWebServerRequest* request);
+
+    // Counts body bytes of the response of a request
+    void AddBytesOut(AsyncWebServerRequest* request, size_t length);
+
+    // Measures the time to first byte around the handler
+    void run(AsyncWebServerRequest* request, ArMiddlewareNext next) override;
+
+    // Sends the metrics (Prometheus text, Json with '?format=json')
+    void HandleRequest(AsyncWebServerRequest* request);
+
+    // Returns the name of a route
+    static const char* GetRouteName(WebRoute route);
+
+  private:
+    friend class WebMetricsWriter;
+
+    // Latency histogram (Counts per bucket, not cumulative)
+    struct Histogram
+    {
+      uint32_t counts[WEBMETRICS_BUCKETS];
+      uint64_t sum_us;
+    };
+
+    // Counters of a route
+    struct RouteMetrics
+    {
+      uint32_t requests;
+      uint32_t errors;
+      uint32_t bytesIn;
+      uint32_t bytesOut;
+      Histogram firstByte;
+      Histogram total;
+    };
+
+    // Measurement of an open request
+    struct OpenRequest
+    {
+      AsyncWebServerRequest* request;
+      WebRoute route;
+      uint32_t start_us;
+      uint32_t firstByte_us;
+      uint32_t bytesOut;
+    };
+
+    RouteMetrics _routes[eRouteCount];
+    OpenRequest _requests[WEBMETRICS_MAXREQUESTS];
+    uint32_t _untracked = 0;
+
+    // Returns the open request (NULL if not measured)
+    OpenRequest* FindRequest(AsyncWebServerRequest* request);
+
+    // Returns the route of a request
+    static WebRoute GetRoute(AsyncWebServerRequest* request);
+
+    // Adds a time to a histogram
+    static void AddTime(Histogram& histogram, uint32_t time_us);
+};
+
+//===============================================================
+// Web metrics writer class
+// Streams the metrics line by line into the buffers of a chunked
+// response. Routes without requests are left out
+//===============================================================
+class WebMetricsWriter
+{
+  public:
+    // Constructor
+    WebMetricsWriter(const WebMetrics& metrics, bool json);
+
+    // Fills the buffer with the next part, returns 0 at the end
+    size_t Read(uint8_t* buffer, size_t maxLength);
+
+  private:
+    const WebMetrics& _metrics;
+    bool _json;
+    bool _finished = false;
+
+    // Position in the metrics
+    uint8_t _family = 0;
+    uint8_t _route = 0;
+    uint8_t _line = 0;
+    bool _headerWritten = false;
+
+    // Text not completely copied into the last buffer
+    char _text[WEBMETRICS_LINESIZE];
+    size_t _textLength = 0;
+    size_t _textOffset = 0;
+
+    // Writes the next Prometheus line (Or nothing at the end)
+    void NextLine();
+
+    // Writes the next Json route (Or the end of the document)
+    void NextRoute();
+
+    // Skips to the next route with requests, returns false at the end of the routes
+    bool SkipEmptyRoutes();
+};
+
+#endif
@@ -1,4 +1,3 @@
-#include "http_parser.h"
 /*
  * Includes all web page functions
  *
@@ -11,6 +10,7 @@
 // Includes
 //===============================================================
 #include "WebPageHandler.h"
+#include "WifiHandler.h"
 
 //===============================================================
 // Constants
@@ -22,17 +22,23 @@ static const char* TAG = "WebPageHandler";
 //===============================================================
 WebPageHandler::WebPageHandler()
 {
+  _socket = new AsyncWebSocket(WEBSOCKET_PATH);
+  _socket->onEvent([this](AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t length)
+  {
+    OnSocketEvent(client, type, arg, data, length);
+  });
 }
 
 //===============================================================
 // Returns true, if the handler can handle the request
 //===============================================================
-bool WebPageHandler::canHandle(WebServer &server, HTTPMethod method, const String &uri)
+bool WebPageHandler::canHandle(AsyncWebServerRequest* request) const
 {
-  // Check for URL '/control' and GET or PUT
-  bool canHandle = uri.equalsIgnoreCase("/control") &&
-    (method == HTTP_GET ||
-    method == HTTP_PUT);
+  // Check for URL '/control' and GET, PUT or POST (Batch in body)
+  bool canHandle = request->url().equalsIgnoreCase("/control") &&
+    (request->method() == HTTP_GET ||
+    request->method() == HTTP_PUT ||
+    request->method() == HTTP_POST);
 
   ESP_LOGE(TAG, "Can handle request from '/control'? %s", canHandle ? "✓" : "✖");
   return canHandle;
@@ -41,141 +47,388 @@ bool WebPageHandler::canHandle(WebServer &server, HTTPMethod method, const Strin
 //===============================================================
 // Handles the request
 //===============================================================
-bool WebPageHandler::handle(WebServer &server, HTTPMethod method, const String &requestUri)
+void WebPageHandler::handleRequest(AsyncWebServerRequest* request)
 {
-  ESP_LOGI(TAG, "Handle: request=%s", requestUri.c_str());
+  uint32_t start_us = micros();
+  HandleControl(request);
+  AddBusyTime(start_us);
+}
 
-  if (method == HTTP_GET)
+//===============================================================
+// Handles a request of '/control'
+//===============================================================
+void WebPageHandler::HandleControl(AsyncWebServerRequest* request)
+{
+  ESP_LOGI(TAG, "Handle: request=%s", request->url().c_str());
+
+  if (request->method() == HTTP_GET)
   {
     ESP_LOGI(TAG, "Handle GET");
 
-    if (server.argName(0) == "settings")
+    if (request->argName(0) == "settings")
     {
       ESP_LOGI(TAG, "Handle GET 'settings'");
       
       // Send settings
-      SendSettings(server);
+      SendSettings(request);
 
       ESP_LOGI(TAG, "GET: Retrieving settings successful");
-      return true;
+      return;
     }
-    else if (server.argName(0) == "values")
+    else if (request->argName(0) == "values")
     {
       ESP_LOGI(TAG, "Handle GET 'values'");
 
       // Send values
-      SendValues(server);
+      SendValues(request);
 
       ESP_LOGI(TAG, "GET: Retrieving values successful");
-      return true;
+      return;
     }
 
     ESP_LOGE(TAG, "Unknown GET argument!");
-    server.send(404, "text/plain; charset=utf-8", "Unknown GET argument!");
-    return false;
+    request->send(404, "text/plain; charset=utf-8", "Unknown GET argument!");
+    return;
   }
-  else if (method == HTTP_PUT)
+  else if (request->method() == HTTP_PUT ||
+    request->method() == HTTP_POST)
   {
-    ESP_LOGI(TAG, "Handle PUT");
+    ESP_LOGI(TAG, "Handle %s with %d values", request->method() == HTTP_PUT ? "PUT" : "POST", request->args());
 
-    bool result = false;
-    if (server.argName(0) == LIQUID_ANGLE_1)
+    // Check all values, the command is applied as one change in the loop
+    WebCommand command = { eWebValues, { 0, 0, 0 }, 0 };
+    bool valid = request->args() > 0;
+    for (size_t index = 0; index < request->args() && valid; index++)
     {
-      result = Statemachine.UpdateValuesFromWifi(eLiquid1, (int16_t)server.arg(0).toInt());
+      valid = ParseValue(request->argName(index).c_str(), request->arg(index).toInt(), &command);
     }
-    else if (server.argName(0) == LIQUID_ANGLE_2)
+
+    if (!valid)
     {
-      result = Statemachine.UpdateValuesFromWifi(eLiquid2, (int16_t)server.arg(0).toInt());
+      request->send(404, "text/plain; charset=utf-8", "Value not valid");
+      return;
     }
-    else if (server.argName(0) == LIQUID_ANGLE_3)
+
+    if (!Wifihandler.QueueCommand(command))
     {
-      result = Statemachine.UpdateValuesFromWifi(eLiquid3, (int16_t)server.arg(0).toInt());
+      request->send(503, "text/plain; charset=utf-8", "Value update busy");
+      return;
     }
-    else if (server.argName(0) == CYCLE_TIMESPAN)
+
+    // Send HTTP OK
+    request->send(200, "text/plain; charset=utf-8", "Value update success");
+    return;
+  }
+  
+  ESP_LOGE(TAG, "Unknown HTTP method '%d' or unknown argument '%s'!", request->method(), request->argName(0).c_str());
+  request->send(404, "text/plain; charset=utf-8", "Unknown HTTP method '" + String(request->method()) + "' or unknown argument '" + request->argName(0) + "'!");
+}
+
+//===============================================================
+// Publishes the current values and pushes changes (Called by the loop)
+//===============================================================
+void WebPageHandler::Publish()
+{
+  WebValues values = { };
+  values.needUpdate = Statemachine.GetNeedUpdate();
+  values.isMixer = Config.isMixer;
+  values.menuState = Statemachine.GetMenuState();
+  memcpy(values.mixerName, Config.mixerName, sizeof(values.mixerName));
+  memcpy(values.liquidName1, Config.liquidName1, sizeof(values.liquidName1));
+  memcpy(values.liquidName2, Config.liquidName2, sizeof(values.liquidName2));
+  memcpy(values.liquidName3, Config.liquidName3, sizeof(values.liquidName3));
+  memcpy(values.liquidColor1, Config.liquidColor1, sizeof(values.liquidColor1));
+  memcpy(values.liquidColor2, Config.liquidColor2, sizeof(values.liquidColor2));
+  memcpy(values.liquidColor3, Config.liquidColor3, sizeof(values.liquidColor3));
+  values.liquidAngle1 = Statemachine.GetAngle(eLiquid1);
+  values.liquidAngle2 = Statemachine.GetAngle(eLiquid2);
+  values.liquidAngle3 = Statemachine.GetAngle(eLiquid3);
+  values.cycleTimespan_ms = Pumps.GetCycleTimespan();
+
+  portENTER_CRITICAL(&_mux);
+  _values = values;
+  portEXIT_CRITICAL(&_mux);
+
+  // Nothing to push without clients, new clients get all values on connect
+  if (_socket->count() == 0)
+  {
+    _pushedValues = values;
+    _pushedValid = true;
+    return;
+  }
+
+  // Push changed values or heartbeat (Settings only change together with the need update counter)
+  bool changed = !_pushedValid ||
+    values.needUpdate != _pushedValues.needUpdate ||
+    values.menuState != _pushedValues.menuState ||
+    values.liquidAngle1 != _pushedValues.liquidAngle1 ||
+    values.liquidAngle2 != _pushedValues.liquidAngle2 ||
+    values.liquidAngle3 != _pushedValues.liquidAngle3 ||
+    values.cycleTimespan_ms != _pushedValues.cycleTimespan_ms;
+  if (!changed &&
+    (millis() - _lastPush_ms) < WEBSOCKET_HEARTBEAT_MS)
+  {
+    return;
+  }
+
+  uint32_t start_us = micros();
+  char buffer[JSONWRITER_BUFFERSIZE];
+  JsonStreamWriter writer(buffer, sizeof(buffer));
+  WriteDelta(writer, values, _pushedValid ? &_pushedValues : NULL);
+  _socket->cleanupClients(WEBSOCKET_MAXCLIENTS);
+  if (!writer.HasOverflow())
+  {
+    _socket->textAll(writer.GetBuffer(), writer.GetLength());
+  }
+  else
+  {
+    ESP_LOGE(TAG, "Json buffer too small!");
+  }
+  _pushedValues = values;
+  _pushedValid = true;
+  _lastPush_ms = millis();
+  AddBusyTime(start_us);
+}
+
+//===============================================================
+// Validates a value update and adds it to the command
+//===============================================================
+bool WebPageHandler::ParseValue(const char* name, int32_t value, WebCommand* command)
+{
+  if (strcmp(name, LIQUID_ANGLE_1) == 0 ||
+    strcmp(name, LIQUID_ANGLE_2) == 0 ||
+    strcmp(name, LIQUID_ANGLE_3) == 0)
+  {
+    if (value < -360 ||
+      value > 360)
+    {
+      return false;
+    }
+
+    // Last character is the liquid number
+    uint8_t index = name[strlen(name) - 1] - '1';
+    command->increments_Degrees[index] = (int16_t)value;
+    return true;
+  }
+  else if (strcmp(name, CYCLE_TIMESPAN) == 0)
+  {
+    if (value < (int32_t)MIN_CYCLE_TIMESPAN_MS ||
+      value > (int32_t)MAX_CYCLE_TIMESPAN_MS)
+    {
+      return false;
+    }
+
+    command->cycleTimespan_ms = (uint32_t)value;
+    return true;
+  }
+
+  return false;
+}
+
+//===============================================================
+// Handles the events of the web socket
+//===============================================================
+void WebPageHandler::OnSocketEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t length)
+{
+  uint32_t start_us = micros();
+
+  if (type == WS_EVT_CONNECT)
+  {
+    ESP_LOGI(TAG, "Web socket client %d connected", client->id());
+
+    // Send all values to the new client
+    char buffer[JSONWRITER_BUFFERSIZE];
+    JsonStreamWriter writer(buffer, sizeof(buffer));
+    WriteDelta(writer, GetValues(), NULL);
+    client->text(writer.GetBuffer(), writer.GetLength());
+  }
+  else if (type == WS_EVT_DISCONNECT)
+  {
+    ESP_LOGI(TAG, "Web socket client %d disconnected", client->id());
+  }
+  else if (type == WS_EVT_DATA)
+  {
+    // Only single frame text messages "NAME=value&NAME=value.."
+    AwsFrameInfo* info = (AwsFrameInfo*)arg;
+    if (!info->final ||
+      info->index != 0 ||
+      info->len != length ||
+      info->opcode != WS_TEXT ||
+      length >= WEBSOCKET_MAXMESSAGE)
     {
-      result = Statemachine.UpdateValuesFromWifi((uint32_t)server.arg(0).toInt());
+      client->text("{\"ERROR\":\"Message not valid\"}");
+      AddBusyTime(start_us);
+      return;
+    }
 
-      // Save cycle timespan value
-      if (result)
+    char message[WEBSOCKET_MAXMESSAGE];
+    memcpy(message, data, length);
+    message[length] = '\0';
+
+    // Check all values, the command is applied as one change in the loop
+    WebCommand command = { eWebValues, { 0, 0, 0 }, 0 };
+    bool valid = true;
+    char* savePointer = NULL;
+    for (char* pair = strtok_r(message, "&", &savePointer); pair && valid; pair = strtok_r(NULL, "&", &savePointer))
+    {
+      char* separator = strchr(pair, '=');
+      if (!separator)
       {
-        Pumps.Save();
+        valid = false;
+        break;
       }
+      *separator = '\0';
+      valid = ParseValue(pair, atoi(separator + 1), &command);
     }
 
-    if (result)
+    if (!valid)
+    {
+      client->text("{\"ERROR\":\"Value not valid\"}");
+    }
+    else if (!Wifihandler.QueueCommand(command))
     {
-      // Send HTTP OK
-      server.send(200, "text/plain; charset=utf-8", "Value update success");
-      return true;
+      client->text("{\"ERROR\":\"Value update busy\"}");
     }
-    
-    server.send(404, "text/plain; charset=utf-8", "Value not valid");
-    return false;
   }
-  
-  ESP_LOGE(TAG, "Unknown HTTP method '%s' or unknown argument '%s'!", method, server.argName(0));
-  server.send(404, "text/plain; charset=utf-8", "Unknown HTTP method '" + String(method) + "' or unknown argument '" + server.argName(0) + "'!");
-  return false;
+
+  AddBusyTime(start_us);
 }
 
 //===============================================================
-    // Sends all settings to the server
+// Writes the Json delta between the values and the last values (All values if NULL)
 //===============================================================
-void WebPageHandler::SendSettings(WebServer &server)
+void WebPageHandler::WriteDelta(JsonStreamWriter& writer, const WebValues& values, const WebValues* lastValues)
 {
-  int16_t liquidAngle1 = Statemachine.GetAngle(eLiquid1);
-  int16_t liquidAngle2 = Statemachine.GetAngle(eLiquid2);
-  int16_t liquidAngle3 = Statemachine.GetAngle(eLiquid3);
-  uint32_t cycleTimepan_ms = Pumps.GetCycleTimespan();
+  writer.BeginObject();
+
+  if (!lastValues || values.needUpdate != lastValues->needUpdate)
+  {
+    writer.Add("NEED_UPDATE", values.needUpdate);
+    writer.Add(IS_MIXER, values.isMixer);
+    writer.Add(MIXER_NAME, values.mixerName);
+    writer.Add(LIQUID_NAME_1, values.liquidName1);
+    writer.Add(LIQUID_NAME_2, values.liquidName2);
+    writer.Add(LIQUID_NAME_3, values.liquidName3);
+    writer.Add(LIQUID_COLOR_1, values.liquidColor1);
+    writer.Add(LIQUID_COLOR_2, values.liquidColor2);
+    writer.Add(LIQUID_COLOR_3, values.liquidColor3);
+  }
+  if (!lastValues || values.menuState != lastValues->menuState)
+  {
+    writer.Add("MENU_STATE", values.menuState);
+  }
+  if (!lastValues || values.liquidAngle1 != lastValues->liquidAngle1)
+  {
+    writer.Add(LIQUID_ANGLE_1, values.liquidAngle1);
+  }
+  if (!lastValues || values.liquidAngle2 != lastValues->liquidAngle2)
+  {
+    writer.Add(LIQUID_ANGLE_2, values.liquidAngle2);
+  }
+  if (!lastValues || values.liquidAngle3 != lastValues->liquidAngle3)
+  {
+    writer.Add(LIQUID_ANGLE_3, values.liquidAngle3);
+  }
+  if (!lastValues || values.cycleTimespan_ms != lastValues->cycleTimespan_ms)
+  {
+    writer.Add(CYCLE_TIMESPAN, values.cycleTimespan_ms);
+  }
+
+  writer.EndObject();
+}
+
+//===============================================================
+// Adds the processing time since the start timestamp
+//===============================================================
+void WebPageHandler::AddBusyTime(uint32_t start_us)
+{
+  uint32_t busyTime_us = micros() - start_us;
+  portENTER_CRITICAL(&_mux);
+  _busyTime_us += busyTime_us;
+  portEXIT_CRITICAL(&_mux);
+}
+
+//===============================================================
+// Returns a copy of the published values
+//===============================================================
+WebPageHandler::WebValues WebPageHandler::GetValues()
+{
+  portENTER_CRITICAL(&_mux);
+  WebValues values = _values;
+  portEXIT_CRITICAL(&_mux);
+  return values;
+}
+
+//===============================================================
+// Sends all settings to the server
+//===============================================================
+void WebPageHandler::SendSettings(AsyncWebServerRequest* request)
+{
+  WebValues values = GetValues();
 
   // Generate Json object
-  String output = "[{";
-  output += "\"NEED_UPDATE\":" + String(Statemachine.GetNeedUpdate()) + ","; 
-  output += "\"" + String(IS_MIXER) + "\":" + String(Config.isMixer) + ",";
-  output += "\"" + String(MIXER_NAME) + "\":\"" + Config.mixerName + "\",";
-  output += "\"" + String(LIQUID_NAME_1) + "\":\"" + Config.liquidName1 + "\",";
-  output += "\"" + String(LIQUID_NAME_2) + "\":\"" + Config.liquidName2 + "\",";
-  output += "\"" + String(LIQUID_NAME_3) + "\":\"" + Config.liquidName3 + "\",";
-  output += "\"" + String(LIQUID_COLOR_1) + "\":\"" + Config.liquidColor1 + "\",";
-  output += "\"" + String(LIQUID_COLOR_2) + "\":\"" + Config.liquidColor2 + "\",";
-  output += "\"" + String(LIQUID_COLOR_3) + "\":\"" + Config.liquidColor3 + "\",";
-  output += "\"" + String(LIQUID_ANGLE_1) + "\":" + String(liquidAngle1) + ",";
-  output += "\"" + String(LIQUID_ANGLE_2) + "\":" + String(liquidAngle2) + ",";
-  output += "\"" + String(LIQUID_ANGLE_3) + "\":" + String(liquidAngle3) + ",";
-  output += "\"" + String(CYCLE_TIMESPAN) + "\":" + String(cycleTimepan_ms);
-  output += "}]";
+  char buffer[JSONWRITER_BUFFERSIZE];
+  JsonStreamWriter writer(buffer, sizeof(buffer));
+  writer.BeginArray();
+  writer.BeginObject();
+  writer.Add("NEED_UPDATE", values.needUpdate);
+  writer.Add(IS_MIXER, values.isMixer);
+  writer.Add(MIXER_NAME, values.mixerName);
+  writer.Add(LIQUID_NAME_1, values.liquidName1);
+  writer.Add(LIQUID_NAME_2, values.liquidName2);
+  writer.Add(LIQUID_NAME_3, values.liquidName3);
+  writer.Add(LIQUID_COLOR_1, values.liquidColor1);
+  writer.Add(LIQUID_COLOR_2, values.liquidColor2);
+  writer.Add(LIQUID_COLOR_3, values.liquidColor3);
+  writer.Add(LIQUID_ANGLE_1, values.liquidAngle1);
+  writer.Add(LIQUID_ANGLE_2, values.liquidAngle2);
+  writer.Add(LIQUID_ANGLE_3, values.liquidAngle3);
+  writer.Add(CYCLE_TIMESPAN, values.cycleTimespan_ms);
+  writer.EndObject();
+  writer.EndArray();
 
   // Send settings
-  server.sendHeader("Cache-Control", "no-cache");
-  server.send(200, "application/json", output);
-
-  // Reset Json string
-  output = String();
+  SendJson(request, writer);
 }
 
 //===============================================================
-    // Sends all values to the server
+// Sends all values to the server
 //===============================================================
-void WebPageHandler::SendValues(WebServer &server)
+void WebPageHandler::SendValues(AsyncWebServerRequest* request)
 {
-  int16_t liquidAngle1 = Statemachine.GetAngle(eLiquid1);
-  int16_t liquidAngle2 = Statemachine.GetAngle(eLiquid2);
-  int16_t liquidAngle3 = Statemachine.GetAngle(eLiquid3);
-  uint32_t cycleTimepan_ms = Pumps.GetCycleTimespan();
+  WebValues values = GetValues();
 
   // Generate Json object
-  String output = "[{";
-  output += "\"NEED_UPDATE\":" + String(Statemachine.GetNeedUpdate()) + ",";
-  output += "\"" + String(LIQUID_ANGLE_1) + "\":" + String(liquidAngle1) + ",";
-  output += "\"" + String(LIQUID_ANGLE_2) + "\":" + String(liquidAngle2) + ",";
-  output += "\"" + String(LIQUID_ANGLE_3) + "\":" + String(liquidAngle3) + ",";
-  output += "\"" + String(CYCLE_TIMESPAN) + "\":" + String(cycleTimepan_ms);
-  output += "}]";
+  char buffer[JSONWRITER_BUFFERSIZE];
+  JsonStreamWriter writer(buffer, sizeof(buffer));
+  writer.BeginArray();
+  writer.BeginObject();
+  writer.Add("NEED_UPDATE", values.needUpdate);
+  writer.Add(LIQUID_ANGLE_1, values.liquidAngle1);
+  writer.Add(LIQUID_ANGLE_2, values.liquidAngle2);
+  writer.Add(LIQUID_ANGLE_3, values.liquidAngle3);
+  writer.Add(CYCLE_TIMESPAN, values.cycleTimespan_ms);
+  writer.EndObject();
+  writer.EndArray();
   
   // Send values
-  server.sendHeader("Cache-Control", "no-cache");
-  server.send(200, "application/json", output);
+  SendJson(request, writer);
+}
+
+//===============================================================
+// Sends a written Json document (Copied once into the response)
+//===============================================================
+void WebPageHandler::SendJson(AsyncWebServerRequest* request, const JsonStreamWriter& writer)
+{
+  if (writer.HasOverflow())
+  {
+    ESP_LOGE(TAG, "Json buffer too small!");
+    request->send(500, "text/plain; charset=utf-8", "Json buffer too small!");
+    return;
+  }
 
-  // Reset Json string
-  output = String();
+  Wifihandler.AddBytesOut(request, writer.GetLength());
+  AsyncWebServerResponse* response = request->beginResponse(200, "application/json", writer.GetBuffer());
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
 }
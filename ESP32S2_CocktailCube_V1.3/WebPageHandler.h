@@ -13,31 +13,116 @@
 // Includes
 //===============================================================
 #include <Arduino.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include "StateMachine.h"
 #include "PumpDriver.h"
+#include "JsonStreamWriter.h"
 
 //===============================================================
-// SPIFFS editor class
+// Defines
 //===============================================================
-class WebPageHandler: public RequestHandler
+#define WEBSOCKET_PATH            "/ws"
+#define WEBSOCKET_MAXCLIENTS      8            // Oldest clients are closed above the limit
+#define WEBSOCKET_HEARTBEAT_MS    1000         // Empty message to idle clients, keeps them online
+#define WEBSOCKET_MAXMESSAGE      96           // Maximum length of a received message (All three angles and cycle timespan)
+
+// Declared by the wifi handler
+struct WebCommand;
+
+//===============================================================
+// Web page handler class
+// Runs in the task of the TCP stack. Values are read from a copy
+// published by the loop and value updates are queued for the
+// loop, so the handler never touches the state machine directly.
+// Several values can be sent at once (Query or form body), e.g.
+// 'LIQUID_ANGLE_1=6&LIQUID_ANGLE_2=-6' and are applied together.
+// Changed values are pushed to the clients of the web socket as
+// Json delta, so the web page only polls without web socket
+//===============================================================
+class WebPageHandler: public AsyncWebHandler
 {
   public:
     // Constructor
     WebPageHandler();
 
     // Returns true, if the handler can handle the request
-    bool canHandle(WebServer &server, HTTPMethod method, const String &uri) override final;
+    bool canHandle(AsyncWebServerRequest* request) const override final;
 
     // Handles the request
-    bool handle(WebServer &server, HTTPMethod method, const String &requestUri) override final;
+    void handleRequest(AsyncWebServerRequest* request) override final;
+
+    // Returns false, batches are sent as form in the body
+    bool isRequestHandlerTrivial() const override final { return false; }
+
+    // Publishes the current values and pushes changes (Called by the loop)
+    void Publish();
+
+    // Returns the web socket (Added to the web server separately)
+    AsyncWebSocket* GetSocket() { return _socket; }
+
+    // Returns the amount of web socket clients
+    uint32_t GetSocketClients() { return _socket->count(); }
+
+    // Returns the summed up processing time of requests, messages and pushes
+    uint32_t GetBusyTime_us() { return _busyTime_us; }
 
   private:
+    // Values shown on the web page
+    struct WebValues
+    {
+      uint16_t needUpdate;
+      bool isMixer;
+      MixerState menuState;
+      char mixerName[THEMEBLOB_MAXMIXERNAME];
+      char liquidName1[THEMEBLOB_MAXLIQUIDNAME];
+      char liquidName2[THEMEBLOB_MAXLIQUIDNAME];
+      char liquidName3[THEMEBLOB_MAXLIQUIDNAME];
+      char liquidColor1[THEMEBLOB_MAXCOLOR];
+      char liquidColor2[THEMEBLOB_MAXCOLOR];
+      char liquidColor3[THEMEBLOB_MAXCOLOR];
+      int16_t liquidAngle1;
+      int16_t liquidAngle2;
+      int16_t liquidAngle3;
+      uint32_t cycleTimespan_ms;
+    };
+
+    // Published values
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+    WebValues _values = { };
+
+    // Web socket variables (Pushed values only used by the loop)
+    AsyncWebSocket* _socket;
+    WebValues _pushedValues = { };
+    bool _pushedValid = false;
+    uint32_t _lastPush_ms = 0;
+    volatile uint32_t _busyTime_us = 0;
+
+    // Returns a copy of the published values
+    WebValues GetValues();
+
+    // Handles a request of '/control'
+    void HandleControl(AsyncWebServerRequest* request);
+
+    // Validates a value update and adds it to the command
+    bool ParseValue(const char* name, int32_t value, WebCommand* command);
+
+    // Handles the events of the web socket
+    void OnSocketEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t length);
+
+    // Writes the Json delta between the values and the last values (All values if NULL)
+    void WriteDelta(JsonStreamWriter& writer, const WebValues& values, const WebValues* lastValues);
+
+    // Adds the processing time since the start timestamp
+    void AddBusyTime(uint32_t start_us);
+
     // Sends all settings to the server
-    void SendSettings(WebServer &server);
+    void SendSettings(AsyncWebServerRequest* request);
 
     // Sends all values to the server
-    void SendValues(WebServer &server);
+    void SendValues(AsyncWebServerRequest* request);
+
+    // Sends a written Json document (Copied once into the response)
+    void SendJson(AsyncWebServerRequest* request, const JsonStreamWriter& writer);
 };
 
 #endif
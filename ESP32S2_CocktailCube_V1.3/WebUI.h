@@ -0,0 +1,624 @@
+/*
+ * Includes the bundled web page (Generated by 'Tools/web_bundler.py', do not edit)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef WEBUI_H
+#define WEBUI_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+
+//===============================================================
+// Defines
+//===============================================================
+#define WEBUI_VERSION               "038d3330"  // Hash of the bundle
+#define webui_html_gz_len           9498
+
+//===============================================================
+// File: index.html (index.css, draggableDoughnutChart.js, index.js), Size: 9498 (30009 uncompressed)
+//===============================================================
+const uint8_t webui_html_gz[] PROGMEM =
+{
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xD5, 0x7C, 0xD9, 0x96, 0xE2, 0xB8,
+  0xB2, 0xE8, 0x7B, 0x7E, 0x85, 0x8B, 0xBD, 0xBA, 0x21, 0x1B, 0x12, 0x0C, 0x66, 0xCC, 0xAC, 0xAC,
+  0x5E, 0xCC, 0xF3, 0x3C, 0x53, 0xAB, 0x56, 0x2F, 0x63, 0x0B, 0x30, 0x78, 0xC2, 0x03, 0x53, 0x75,
+  0xFD, 0xCD, 0x79, 0xB9, 0x6F, 0xE7, 0x1B, 0xF6, 0xFD, 0xB1, 0x23, 0xC9, 0x36, 0xD8, 0xC6, 0x90,
+  0x99, 0xD5, 0xDD, 0xFB, 0xDC, 0xDB, 0xB5, 0x77, 0x15, 0x96, 0x14, 0xA1, 0x50, 0x28, 0x14, 0x93,
+  0x86, 0xCF, 0x9F, 0x0A, 0xED, 0xFC, 0x60, 0xDA, 0x29, 0x12, 0x2B, 0x4D, 0xE0, 0xBF, 0x3C, 0x7C,
+  0x46, 0xFF, 0x10, 0x3C, 0x2D, 0x2E, 0x5F, 0x7D, 0x40, 0xF4, 0xA1, 0x02, 0x40, 0xB3, 0xF0, 0x1F,
+  0x01, 0x68, 0x34, 0xC1, 0xAC, 0x68, 0x45, 0x05, 0xDA, 0xAB, 0x6F, 0x38, 0x28, 0x3D, 0xA5, 0x51,
+  0xAD, 0xC6, 0x69, 0x3C, 0x20, 0x38, 0xF6, 0xD5, 0x27, 0x70, 0x07, 0xA0, 0x0C, 0xD0, 0xA7, 0xEF,
+  0x4B, 0x5E, 0x62, 0x36, 0x1A, 0xCD, 0xF1, 0xB8, 0xEC, 0x73, 0x04, 0x37, 0x82, 0x8D, 0x79, 0x4E,
+  0xDC, 0x10, 0x0A, 0xE0, 0x5F, 0x7D, 0x1C, 0x23, 0x89, 0x3E, 0x62, 0xA5, 0x80, 0xC5, 0xAB, 0x8F,
+  0xA5, 0x35, 0xFA, 0x99, 0x13, 0xE8, 0x25, 0x88, 0xC8, 0xE2, 0xF2, 0x65, 0x4E, 0xAB, 0x20, 0x19,
+  0x0F, 0x71, 0xA3, 0x5C, 0xBB, 0xB7, 0x27, 0xEB, 0xE5, 0xA5, 0x94, 0x85, 0xFF, 0xB5, 0xFA, 0xC3,
+  0x55, 0x71, 0xB8, 0x84, 0xBF, 0xF2, 0x7B, 0xF4, 0xAD, 0xE6, 0xB3, 0x53, 0xF4, 0x2F, 0x58, 0x95,
+  0xA4, 0x1C, 0xFC, 0x37, 0xB7, 0x8C, 0xF1, 0x85, 0x6E, 0x34, 0x57, 0xEB, 0x92, 0xCD, 0x25, 0x53,
+  0xA9, 0xED, 0x66, 0x02, 0xAF, 0xCE, 0xBA, 0xD9, 0x6C, 0xBD, 0x56, 0xCA, 0x6C, 0x06, 0xD1, 0xEA,
+  0x9E, 0xCC, 0x32, 0x87, 0x51, 0x66, 0x20, 0xF7, 0xAB, 0xA3, 0x1C, 0xA9, 0x8E, 0x18, 0x66, 0xD5,
+  0x15, 0xC1, 0x91, 0xAB, 0x4A, 0x49, 0x9E, 0xDB, 0x8C, 0xF7, 0xC3, 0x96, 0x54, 0x57, 0x06, 0xDB,
+  0xE9, 0xA4, 0x23, 0x95, 0x06, 0xBD, 0x6D, 0xBF, 0x94, 0x63, 0x2B, 0xFB, 0xF9, 0x64, 0x19, 0x6F,
+  0xB2, 0x5C, 0x94, 0xA9, 0x94, 0xC6, 0x23, 0xA6, 0x32, 0x22, 0x8B, 0xDD, 0x48, 0x36, 0x77, 0x28,
+  0x25, 0xF6, 0xC3, 0x09, 0x3D, 0x28, 0x46, 0x8E, 0xE3, 0x52, 0x69, 0x5D, 0x04, 0x95, 0xCE, 0x62,
+  0x4D, 0xCD, 0xA9, 0x0A, 0x35, 0xD0, 0xB2, 0x74, 0x89, 0x9E, 0xD1, 0xBB, 0x79, 0x31, 0x5B, 0x1A,
+  0x9F, 0xD6, 0x95, 0x2E, 0xD7, 0xD0, 0xE7, 0xC7, 0x6D, 0xAC, 0xB1, 0x2C, 0x75, 0xEB, 0xF9, 0x72,
+  0x71, 0x0A, 0xFF, 0x13, 0x66, 0x60, 0x5D, 0x3F, 0x09, 0xD5, 0x89, 0x18, 0x6C, 0x6C, 0x2B, 0xEB,
+  0x64, 0x86, 0x1A, 0xCE, 0x52, 0xFC, 0x02, 0xA4, 0x3A, 0x4D, 0x3A, 0x3B, 0x1C, 0x64, 0xE7, 0xF1,
+  0x5E, 0xBB, 0x3A, 0x25, 0xF7, 0xB1, 0x06, 0xA8, 0xB6, 0xE2, 0xAC, 0xD6, 0xE9, 0xB7, 0x41, 0x7A,
+  0xB0, 0x8A, 0xAE, 0x66, 0x43, 0x69, 0xDD, 0xE1, 0xFA, 0x4C, 0x4B, 0xE7, 0x0A, 0x87, 0x6A, 0x86,
+  0xE5, 0xF9, 0x4C, 0x3A, 0xCE, 0x1F, 0xF6, 0x63, 0x50, 0x9E, 0x57, 0x8F, 0xF5, 0xB9, 0xC8, 0x0D,
+  0x3B, 0xC5, 0xE9, 0x56, 0x68, 0x24, 0xFA, 0x09, 0x61, 0x36, 0x6C, 0xF2, 0x22, 0x57, 0x6E, 0xD7,
+  0xEB, 0x72, 0x39, 0x38, 0x6C, 0xB4, 0x67, 0xD3, 0xC9, 0xA9, 0x24, 0x80, 0xE8, 0x58, 0x58, 0x68,
+  0x20, 0x52, 0x9D, 0xE4, 0x96, 0x3B, 0xBA, 0x2F, 0xCD, 0x95, 0x56, 0x13, 0x74, 0xF7, 0xB9, 0x7A,
+  0xBF, 0x5F, 0x2C, 0x17, 0xD7, 0x05, 0x69, 0xBB, 0x6D, 0xD6, 0xF2, 0x7C, 0x89, 0x6E, 0x95, 0x72,
+  0x2D, 0x39, 0x26, 0x65, 0x52, 0xC1, 0x22, 0xC3, 0x2E, 0xE2, 0x32, 0xD3, 0x54, 0x36, 0xDB, 0x69,
+  0xBB, 0x37, 0xED, 0x66, 0xC9, 0x6D, 0xAD, 0xC9, 0x74, 0x22, 0x70, 0xBA, 0xF4, 0xD3, 0xB8, 0x41,
+  0x46, 0x5B, 0xFA, 0x70, 0x9D, 0x6D, 0x67, 0x1A, 0xA9, 0x69, 0x46, 0x65, 0xE2, 0xC5, 0xD6, 0xB2,
+  0x34, 0x5E, 0x52, 0xF3, 0xC8, 0x3A, 0x19, 0x4B, 0xB1, 0xD3, 0x5A, 0xBC, 0x92, 0x2E, 0x2B, 0x4A,
+  0xBF, 0xBD, 0xCB, 0x4C, 0x8B, 0x89, 0x75, 0xA2, 0x36, 0xA7, 0xFA, 0xE4, 0x31, 0x57, 0xDC, 0xEB,
+  0xD9, 0x28, 0x33, 0xA9, 0x30, 0x24, 0xE8, 0x06, 0xE3, 0x54, 0xB6, 0x54, 0x16, 0xC5, 0x41, 0x6D,
+  0x93, 0x3B, 0xD5, 0x06, 0xD1, 0xA6, 0x54, 0x92, 0x2A, 0x54, 0x33, 0xB2, 0x15, 0x3A, 0x85, 0x1C,
+  0x99, 0x8F, 0xF4, 0x77, 0xFA, 0x3C, 0x16, 0xCD, 0x50, 0x95, 0x64, 0xB6, 0xDC, 0x97, 0xB7, 0xC1,
+  0xE1, 0x3C, 0xDE, 0xCE, 0x76, 0x85, 0xFC, 0xAA, 0x97, 0x51, 0x94, 0x8A, 0x1E, 0xD1, 0x93, 0x20,
+  0xB2, 0xA3, 0x06, 0x0D, 0x3D, 0x52, 0x89, 0x6F, 0xF7, 0x8C, 0x92, 0x9D, 0xEA, 0xB9, 0x09, 0x87,
+  0x84, 0x23, 0x27, 0xD4, 0x1A, 0x3D, 0xB2, 0x9B, 0x8D, 0xEC, 0x0B, 0x91, 0x6C, 0x27, 0x08, 0x47,
+  0x0C, 0x06, 0xA8, 0x3C, 0x3F, 0xC9, 0x55, 0xC7, 0x93, 0x26, 0x12, 0x23, 0xF4, 0xDD, 0x28, 0xEE,
+  0x8B, 0x59, 0x41, 0xDE, 0x63, 0x81, 0xCA, 0x51, 0xBD, 0xDA, 0x60, 0x38, 0xAC, 0x24, 0xBB, 0xD5,
+  0x66, 0xE9, 0xC0, 0xD4, 0x9B, 0xF3, 0xF9, 0x70, 0x00, 0x45, 0x2E, 0x17, 0x19, 0xD5, 0x7A, 0xC5,
+  0xD2, 0x70, 0xDC, 0xEC, 0xB4, 0x84, 0x71, 0x54, 0x1D, 0x66, 0x98, 0xD9, 0x81, 0x8A, 0x88, 0x93,
+  0x46, 0x7A, 0x20, 0xB6, 0x73, 0xD9, 0x22, 0xC7, 0xCA, 0xD5, 0x5E, 0x9E, 0xAE, 0xC9, 0xFD, 0x58,
+  0x23, 0x9F, 0x21, 0xB7, 0x7C, 0x9E, 0xDA, 0x6D, 0x96, 0xDA, 0xF0, 0xA4, 0xD7, 0xD6, 0x82, 0x98,
+  0xD2, 0x2A, 0x73, 0x6D, 0xA2, 0xF4, 0x32, 0xC9, 0xD2, 0x4C, 0xA6, 0x5B, 0x31, 0x61, 0xD0, 0xA7,
+  0x46, 0xD1, 0xA2, 0x38, 0xD7, 0x3A, 0xA3, 0xC2, 0x36, 0x53, 0xD6, 0x47, 0xF3, 0x91, 0x2E, 0x6C,
+  0xB7, 0x35, 0x69, 0xB3, 0xE5, 0x2B, 0xBD, 0x2D, 0x5B, 0xDF, 0xD0, 0xB3, 0x6A, 0x76, 0xA3, 0xAD,
+  0x06, 0xD9, 0x69, 0x31, 0xBB, 0xCC, 0x75, 0x0F, 0xFB, 0x7E, 0xEC, 0x58, 0x8E, 0xA5, 0x52, 0x93,
+  0x1D, 0x58, 0xCC, 0x73, 0x27, 0x4D, 0x2D, 0xD7, 0xE8, 0x59, 0x4C, 0xEB, 0xEC, 0x6A, 0xBB, 0x1D,
+  0x03, 0xC4, 0x4C, 0x26, 0x93, 0xDA, 0x45, 0x12, 0x62, 0x90, 0x49, 0x8C, 0xE4, 0x81, 0x92, 0x6C,
+  0xF3, 0xF2, 0x48, 0x9D, 0x65, 0x06, 0xC3, 0x4A, 0x26, 0xD5, 0x6A, 0x72, 0xA9, 0x5A, 0x3F, 0xB8,
+  0xE3, 0x28, 0x5E, 0x50, 0x67, 0x83, 0x96, 0x90, 0xEF, 0xD1, 0xDB, 0xC9, 0x90, 0xA2, 0x77, 0xF9,
+  0xB2, 0x12, 0xA9, 0x65, 0x2B, 0xD9, 0x63, 0x8A, 0x69, 0xC5, 0xBA, 0xA0, 0x10, 0x29, 0x36, 0x56,
+  0xF1, 0x5D, 0x45, 0x5C, 0x4C, 0x35, 0x7A, 0xB3, 0x5E, 0xD6, 0xF7, 0xAC, 0x96, 0xAE, 0xE7, 0xB8,
+  0x59, 0x7A, 0xB6, 0xA0, 0x32, 0xC9, 0xFD, 0x38, 0xC6, 0x96, 0x16, 0x93, 0xE9, 0x71, 0x95, 0xA8,
+  0xE4, 0x4B, 0xC3, 0x42, 0xA3, 0x12, 0xE1, 0x44, 0x66, 0x1B, 0xA5, 0xB7, 0xA9, 0xF6, 0x32, 0x3D,
+  0xE9, 0x1C, 0xB4, 0x5E, 0xA6, 0xB8, 0x03, 0x9D, 0xE2, 0x28, 0xB2, 0x88, 0x9D, 0x72, 0xCB, 0x3A,
+  0xA5, 0xA7, 0x24, 0xA6, 0x18, 0x64, 0x26, 0x75, 0xB5, 0x34, 0x1C, 0xA8, 0xAD, 0x01, 0x19, 0x5C,
+  0x6C, 0x97, 0x35, 0xE1, 0x98, 0x20, 0x33, 0x69, 0xAA, 0x21, 0x93, 0xC5, 0x74, 0xB6, 0xA5, 0xE4,
+  0xB7, 0x72, 0xEF, 0x50, 0x3E, 0x28, 0xA9, 0xF9, 0x5A, 0xAA, 0x75, 0x6B, 0x8B, 0x5D, 0x2D, 0x99,
+  0x88, 0x2E, 0x86, 0x4D, 0x52, 0x8B, 0xB1, 0x9D, 0x7D, 0x25, 0x7A, 0x6A, 0x08, 0xBB, 0x06, 0x3F,
+  0x8F, 0xCE, 0x96, 0x07, 0x66, 0x16, 0x9C, 0x71, 0x0D, 0x29, 0x5A, 0x5F, 0x47, 0xA3, 0x87, 0x49,
+  0x31, 0x3E, 0xEC, 0x9C, 0x8E, 0x41, 0xBE, 0x95, 0x6E, 0xF6, 0x7A, 0x87, 0x93, 0xD4, 0x62, 0x17,
+  0x6D, 0x90, 0x07, 0xA2, 0x30, 0xE3, 0x4F, 0x65, 0xB5, 0x5E, 0x1F, 0x6C, 0xB3, 0x63, 0x89, 0xE6,
+  0x94, 0x6D, 0xAB, 0xBC, 0x8C, 0xE9, 0x05, 0xA1, 0xC2, 0x77, 0xDA, 0x6D, 0x39, 0x5E, 0xAE, 0x14,
+  0xD5, 0x62, 0x61, 0xC3, 0x31, 0xA5, 0x32, 0x99, 0x19, 0x4C, 0x62, 0xA9, 0x43, 0x5A, 0x57, 0x8E,
+  0xFD, 0xE6, 0xB0, 0x9F, 0xED, 0xF1, 0x65, 0x85, 0x1A, 0xD7, 0xE8, 0x76, 0x54, 0x9B, 0x73, 0x19,
+  0x6A, 0x3B, 0xE3, 0xB6, 0x6A, 0x2F, 0x3B, 0x17, 0x84, 0x35, 0x80, 0xE0, 0xD5, 0x6A, 0x6E, 0x9C,
+  0x4D, 0x6E, 0x2A, 0x63, 0xB6, 0xD5, 0x29, 0x8C, 0x0F, 0xE3, 0x95, 0x7E, 0x3A, 0xE9, 0x94, 0xAE,
+  0x6C, 0xE6, 0x62, 0xA5, 0x51, 0xED, 0x27, 0x92, 0xED, 0x4E, 0x51, 0x1F, 0x77, 0x57, 0xF5, 0xBA,
+  0x92, 0xA4, 0xE8, 0x52, 0xAC, 0x27, 0x83, 0x51, 0x67, 0x5C, 0x12, 0x4F, 0x54, 0xB2, 0x9E, 0x0D,
+  0xAA, 0xBB, 0x78, 0xAB, 0x5A, 0x2B, 0x56, 0x85, 0x4D, 0xAC, 0xA4, 0xCE, 0xB3, 0x87, 0x75, 0x67,
+  0x2D, 0xD6, 0xA7, 0xFC, 0x5E, 0x17, 0x17, 0x14, 0x95, 0xE9, 0x80, 0xC8, 0x62, 0x70, 0xCA, 0x2A,
+  0x99, 0x08, 0x68, 0x2D, 0x9A, 0x64, 0x55, 0x6F, 0x73, 0xC1, 0x2A, 0x58, 0x8A, 0xC1, 0x4E, 0x76,
+  0x39, 0x89, 0x4E, 0x78, 0xD0, 0x4A, 0x4F, 0x66, 0x73, 0x40, 0x49, 0x4D, 0x2E, 0x29, 0x97, 0x6B,
+  0x6C, 0x41, 0x4A, 0x30, 0x1D, 0x89, 0x54, 0xD6, 0x95, 0x61, 0x54, 0x9B, 0xF6, 0x0B, 0xD9, 0xB9,
+  0x48, 0xB3, 0xAD, 0x53, 0x25, 0xB8, 0xCA, 0x57, 0x55, 0x81, 0xAE, 0xCB, 0x3B, 0x76, 0x32, 0x5E,
+  0x24, 0xD2, 0x8D, 0xB6, 0x18, 0xA5, 0x75, 0x6A, 0x52, 0x5D, 0x92, 0x41, 0x2D, 0x56, 0xD1, 0x6A,
+  0xCB, 0x09, 0x92, 0x8D, 0xE0, 0x7C, 0x90, 0x5D, 0xD1, 0xED, 0xDD, 0x3C, 0xDA, 0x5D, 0xB6, 0xE4,
+  0x52, 0x7B, 0x43, 0x2D, 0x58, 0x52, 0x9B, 0x8E, 0x9A, 0x51, 0xE6, 0xA4, 0x0E, 0xFB, 0xFD, 0x6A,
+  0x62, 0x91, 0xA1, 0x5A, 0xAD, 0x54, 0xF6, 0xB0, 0x4B, 0x09, 0x54, 0xA9, 0x94, 0x9E, 0x9C, 0xE6,
+  0xF9, 0x62, 0x7E, 0x5E, 0xDA, 0x01, 0x90, 0xD6, 0x04, 0xBA, 0x58, 0xD0, 0xC8, 0xB8, 0x3E, 0x68,
+  0x35, 0x82, 0xA9, 0x69, 0x97, 0x69, 0x56, 0x2A, 0x89, 0x42, 0x6D, 0xD6, 0xC9, 0x66, 0x85, 0xD3,
+  0x4C, 0xAD, 0x17, 0xC4, 0xFC, 0x72, 0x75, 0x28, 0x46, 0x9B, 0x89, 0x93, 0xA6, 0x8D, 0x83, 0x99,
+  0xD1, 0x40, 0x93, 0x45, 0x26, 0xB5, 0x22, 0xCB, 0x32, 0x5C, 0x28, 0xA4, 0x58, 0x88, 0x33, 0x6D,
+  0x6A, 0x16, 0xE3, 0xCA, 0x2D, 0x71, 0x95, 0x9C, 0x75, 0x94, 0x72, 0x62, 0x5B, 0x5F, 0x6D, 0xE2,
+  0xFC, 0x66, 0x99, 0xDF, 0xE5, 0xD3, 0xDC, 0x20, 0xD6, 0xD9, 0x44, 0xB7, 0x65, 0x95, 0x8D, 0xB6,
+  0x00, 0xB7, 0xDB, 0x70, 0x7D, 0x99, 0xE9, 0x8C, 0x9B, 0x62, 0x22, 0x16, 0x95, 0x27, 0xE9, 0xC8,
+  0x7E, 0x40, 0xC5, 0x5A, 0x32, 0x3B, 0x18, 0x66, 0x85, 0xE1, 0x41, 0xA8, 0x6C, 0x36, 0x14, 0x73,
+  0x8A, 0xCD, 0x8F, 0x89, 0x32, 0x33, 0xC8, 0x69, 0x7C, 0xB9, 0x36, 0x0E, 0xEE, 0x56, 0x27, 0x96,
+  0x1A, 0xF1, 0xB9, 0x62, 0xA9, 0xC4, 0xAB, 0xCA, 0x38, 0xA1, 0xAD, 0xAA, 0xA9, 0x52, 0x3C, 0x72,
+  0x3A, 0x6A, 0xDA, 0x6E, 0x18, 0x8D, 0x45, 0xB9, 0x6C, 0x8C, 0xA2, 0x36, 0xB3, 0xC6, 0x62, 0x41,
+  0xA6, 0x37, 0x9B, 0x94, 0x70, 0xDC, 0x54, 0x8A, 0xCD, 0x41, 0x8E, 0x4E, 0xD3, 0x93, 0x59, 0xBD,
+  0x5C, 0x5F, 0x1F, 0xFB, 0xFD, 0xDD, 0x6E, 0xA1, 0xB6, 0xB3, 0xB3, 0x60, 0x47, 0x06, 0x95, 0x2D,
+  0xE8, 0x96, 0xD6, 0x54, 0x41, 0xCC, 0xD6, 0xCB, 0xE3, 0x53, 0xB1, 0x99, 0x8F, 0x1F, 0x8A, 0xB5,
+  0x5C, 0x27, 0x96, 0x4E, 0xAB, 0x89, 0xF1, 0x98, 0xAE, 0xF4, 0xE8, 0xA2, 0xB6, 0xD8, 0x88, 0xBD,
+  0xC9, 0x6A, 0x9C, 0xAF, 0x96, 0xAA, 0xEB, 0x79, 0xFD, 0x90, 0x57, 0x3B, 0x4A, 0xAB, 0x27, 0x1D,
+  0x94, 0xF9, 0x49, 0x09, 0x46, 0x92, 0xDB, 0x23, 0xD3, 0x2F, 0x2C, 0x9B, 0xDD, 0x82, 0x44, 0xEB,
+  0xE2, 0xA4, 0x7F, 0x6A, 0x55, 0xF6, 0x87, 0x4D, 0x37, 0x5F, 0x1A, 0x0C, 0xE3, 0xE3, 0x6A, 0xB3,
+  0x36, 0xA6, 0x56, 0xF3, 0x49, 0x7F, 0x17, 0x4D, 0x64, 0x82, 0x89, 0x6A, 0xBD, 0x1F, 0x3F, 0xE8,
+  0x99, 0x64, 0x7C, 0x53, 0x5C, 0xE6, 0x8E, 0x4B, 0xBA, 0x5E, 0x9C, 0xCC, 0x76, 0x69, 0x41, 0x28,
+  0xC9, 0x74, 0x37, 0xBF, 0x2F, 0xAE, 0xDA, 0xD5, 0xC6, 0x24, 0xAA, 0x32, 0xCC, 0xBA, 0x90, 0xC9,
+  0x44, 0x47, 0xE9, 0x8D, 0x1E, 0xEF, 0xC9, 0xAB, 0x5A, 0x61, 0x98, 0x23, 0xEB, 0xDB, 0x8C, 0xB8,
+  0x2A, 0x27, 0xF5, 0x48, 0x76, 0x1B, 0x9F, 0xA7, 0xAA, 0xB5, 0x6A, 0xA2, 0x57, 0x6D, 0xD7, 0xB9,
+  0xE3, 0xAC, 0xDB, 0x69, 0x17, 0xD5, 0x76, 0x23, 0xCE, 0xC7, 0x25, 0x3E, 0xBF, 0xAE, 0x14, 0xA2,
+  0x19, 0x41, 0xEA, 0x54, 0xD6, 0x54, 0x29, 0x72, 0xA2, 0x94, 0xF4, 0x44, 0x4F, 0x8F, 0xB4, 0x89,
+  0xB6, 0x61, 0x6A, 0xD9, 0xF5, 0x21, 0x9E, 0x39, 0xCE, 0x23, 0xEA, 0xB6, 0xA6, 0x54, 0x67, 0xA9,
+  0xCA, 0x11, 0x8C, 0x93, 0xB2, 0xDA, 0xD2, 0x46, 0xAD, 0x52, 0x7E, 0xC0, 0x37, 0xD9, 0x43, 0x7F,
+  0xB6, 0xE8, 0xCC, 0xA5, 0xFE, 0x78, 0x19, 0x6D, 0x2C, 0x0F, 0x99, 0x1A, 0x7B, 0x90, 0x67, 0x4D,
+  0x86, 0xD3, 0xBB, 0xC3, 0x74, 0xBB, 0x92, 0xEB, 0xCE, 0x52, 0x8B, 0x9D, 0x1C, 0xCB, 0x35, 0x63,
+  0x6C, 0x9C, 0xD9, 0xB5, 0x27, 0x91, 0xFD, 0x22, 0x19, 0xED, 0x88, 0xA7, 0x4E, 0x67, 0x97, 0xAC,
+  0x9C, 0xB2, 0x89, 0x15, 0xB5, 0x9B, 0x8F, 0x12, 0xA5, 0xFA, 0x2C, 0x2D, 0xF2, 0x93, 0x29, 0x7D,
+  0x9C, 0xEC, 0xE2, 0x47, 0x55, 0x5C, 0x6D, 0x33, 0xFD, 0x9E, 0xD6, 0x6A, 0x83, 0x63, 0x45, 0x1D,
+  0x54, 0x5B, 0x72, 0xA3, 0xD6, 0x01, 0xC3, 0xD2, 0x4A, 0xE8, 0xA6, 0x9B, 0xDD, 0x54, 0x76, 0x49,
+  0x2D, 0xC0, 0x11, 0xAA, 0xB6, 0xC1, 0xAE, 0x31, 0xA6, 0x94, 0x58, 0x5A, 0x1F, 0x2F, 0x3A, 0xA5,
+  0x49, 0x6D, 0xA8, 0xD2, 0xF5, 0xD5, 0xB2, 0x97, 0xCE, 0x4C, 0xCA, 0xCB, 0xFD, 0x46, 0xDE, 0x34,
+  0xDB, 0x2C, 0xC3, 0xF3, 0xA3, 0x4E, 0x21, 0x7B, 0xE2, 0x17, 0x8C, 0x20, 0x6B, 0xC5, 0x13, 0xA7,
+  0x1C, 0xE6, 0x7B, 0x75, 0xD1, 0x05, 0x14, 0x9F, 0x11, 0xC7, 0x54, 0xBE, 0xB6, 0xAF, 0x32, 0xD5,
+  0x9C, 0x18, 0x4F, 0x8B, 0xBB, 0x54, 0x7F, 0xC6, 0xB3, 0x45, 0x49, 0x8F, 0xEC, 0x52, 0xC9, 0x41,
+  0x26, 0x28, 0x36, 0x76, 0xF3, 0xD8, 0x41, 0x68, 0xAE, 0x4F, 0xD5, 0x78, 0x59, 0x67, 0xE7, 0x85,
+  0x53, 0xA2, 0xCA, 0x66, 0x76, 0x2D, 0x2A, 0x97, 0x3F, 0x1E, 0x5B, 0xEA, 0x6C, 0xA8, 0x4E, 0xF2,
+  0x47, 0x3A, 0x1F, 0xEC, 0xC7, 0x22, 0xBB, 0x31, 0xD5, 0x64, 0x99, 0x43, 0x8A, 0x3D, 0x89, 0x93,
+  0x61, 0x71, 0x99, 0xE4, 0x64, 0xA9, 0x98, 0x8B, 0x14, 0xE2, 0x0B, 0x01, 0xCE, 0x71, 0xA5, 0x16,
+  0x53, 0xE6, 0xFB, 0xC6, 0x52, 0xDC, 0x4D, 0xDB, 0x63, 0x79, 0xAA, 0xE5, 0x40, 0x41, 0x29, 0xC4,
+  0x0E, 0x9B, 0x14, 0xB3, 0x1D, 0x91, 0x11, 0x46, 0x20, 0xA3, 0xFC, 0x51, 0x59, 0xAA, 0x71, 0xF9,
+  0x40, 0x6F, 0xE5, 0x4C, 0x7B, 0xAB, 0x47, 0x5A, 0xB3, 0xD5, 0x44, 0xD9, 0x92, 0xA9, 0x81, 0x72,
+  0xD8, 0x2C, 0x5B, 0x8B, 0x09, 0x55, 0x3B, 0xEE, 0xB4, 0x3D, 0x9D, 0x54, 0x27, 0xDD, 0xD4, 0x4A,
+  0xDF, 0x80, 0xF9, 0x3C, 0xB5, 0x48, 0xE6, 0x77, 0xD1, 0x64, 0x30, 0x5F, 0x86, 0x66, 0x38, 0x0E,
+  0x78, 0x26, 0x91, 0x3D, 0x31, 0x95, 0x75, 0xFF, 0x14, 0xD9, 0xD5, 0xEA, 0xAB, 0x53, 0x83, 0x5B,
+  0x66, 0x1B, 0xD9, 0xD2, 0x81, 0xAD, 0x0C, 0xB3, 0x83, 0xDD, 0x9C, 0x1A, 0xC7, 0xB7, 0x60, 0x91,
+  0x1F, 0x36, 0x40, 0x8F, 0x8F, 0x36, 0xBB, 0xAD, 0x54, 0x30, 0xD1, 0x9E, 0x9E, 0xA6, 0xE4, 0x5A,
+  0x9C, 0xB6, 0x01, 0x7F, 0x00, 0xC7, 0xC5, 0xB8, 0xDA, 0x53, 0x92, 0x95, 0xDC, 0x4A, 0x6D, 0x0F,
+  0x26, 0xE3, 0x94, 0xB4, 0x64, 0x73, 0xB9, 0xDE, 0xBA, 0x47, 0x46, 0x47, 0x5A, 0x31, 0x3A, 0xC9,
+  0xAF, 0xC7, 0xF9, 0x6E, 0xBD, 0x99, 0x38, 0x1E, 0xCB, 0x2A, 0x9F, 0x6A, 0xC7, 0x7A, 0xF1, 0xE3,
+  0x6C, 0x33, 0x3B, 0x88, 0x7A, 0xAD, 0xC9, 0xCE, 0xE3, 0xE9, 0x85, 0x40, 0x76, 0xA3, 0xD1, 0xD8,
+  0xA9, 0x99, 0x53, 0xE5, 0xF1, 0x92, 0xDD, 0xA7, 0x33, 0xE5, 0x76, 0x6D, 0x38, 0x5A, 0xB6, 0xF6,
+  0xE9, 0x2A, 0x18, 0x55, 0x54, 0x7D, 0x35, 0xE0, 0x12, 0xA0, 0x48, 0x43, 0x5B, 0x91, 0x59, 0xE5,
+  0x4F, 0xAB, 0xB5, 0x2E, 0x35, 0x07, 0x99, 0x7D, 0x7C, 0xA0, 0xA9, 0x1C, 0xF4, 0xB7, 0xE4, 0x6E,
+  0x7D, 0x7D, 0x4A, 0xEC, 0x4A, 0x4A, 0xB7, 0xD7, 0x65, 0xF3, 0xFB, 0x96, 0x1A, 0x3B, 0x56, 0x78,
+  0xB5, 0xA7, 0xD0, 0x91, 0xE3, 0x2E, 0xDF, 0x3B, 0x46, 0x52, 0xC1, 0x66, 0xAA, 0x07, 0xC4, 0x63,
+  0x0F, 0xBA, 0x4D, 0x80, 0x2D, 0x30, 0x93, 0x43, 0x7A, 0x1E, 0x8F, 0x67, 0x22, 0x8B, 0x78, 0x24,
+  0xC7, 0x57, 0x62, 0x11, 0xA6, 0xCC, 0xB5, 0xD4, 0x04, 0x3D, 0x5D, 0x57, 0x5A, 0xD9, 0xFC, 0xB6,
+  0x33, 0xE3, 0xC8, 0x8D, 0xC6, 0x43, 0xBD, 0x38, 0x3E, 0x1E, 0xEA, 0x8B, 0x0C, 0x97, 0x6E, 0x95,
+  0x4A, 0x41, 0xEA, 0x38, 0x6D, 0x56, 0x77, 0x07, 0x5D, 0xDF, 0xCF, 0x5B, 0x9B, 0x36, 0xAB, 0xC7,
+  0xE6, 0xF5, 0x72, 0x42, 0xD9, 0x26, 0xBB, 0x62, 0x9A, 0x6A, 0x45, 0x3A, 0x27, 0xAA, 0x91, 0x6A,
+  0x28, 0x43, 0x89, 0xDB, 0x45, 0x73, 0x8B, 0x63, 0x3D, 0x99, 0x2F, 0xF5, 0xF8, 0x60, 0x7B, 0x13,
+  0xE3, 0x77, 0xBD, 0xC6, 0x36, 0x55, 0x3D, 0xEC, 0xE3, 0x4C, 0x5D, 0xE0, 0xCA, 0xDA, 0xAC, 0xCC,
+  0x0E, 0xBA, 0xC5, 0x56, 0xB7, 0xD2, 0x69, 0x94, 0xB3, 0xCD, 0x0A, 0x19, 0x49, 0xD2, 0xA5, 0xE0,
+  0x41, 0xAC, 0x29, 0x25, 0x2E, 0xB9, 0xD8, 0xED, 0x26, 0x91, 0x0C, 0xF4, 0xDF, 0xF4, 0x99, 0xB6,
+  0x8E, 0x4D, 0xF5, 0xCD, 0xAC, 0xC3, 0xA6, 0x87, 0xA7, 0x6C, 0xB5, 0xB8, 0xA9, 0xAB, 0x94, 0x10,
+  0x1B, 0x16, 0x4A, 0x3A, 0x57, 0x5D, 0xAD, 0x07, 0xB9, 0xED, 0x30, 0x9A, 0xD5, 0x8E, 0xF9, 0x5A,
+  0x79, 0xDF, 0x4A, 0xAC, 0x36, 0x0B, 0x6E, 0xD6, 0xDE, 0xCF, 0xB4, 0xD3, 0x8A, 0x8C, 0x2F, 0xBB,
+  0xC1, 0xC6, 0xB0, 0x9B, 0x6E, 0xC8, 0x34, 0xDD, 0x5C, 0x50, 0x63, 0x29, 0xDB, 0xEC, 0xF6, 0xEA,
+  0xFD, 0x43, 0x9A, 0x4B, 0xAE, 0x92, 0xE5, 0x65, 0x93, 0xEE, 0xD6, 0xC6, 0xD3, 0x89, 0xCA, 0xD6,
+  0x17, 0xEB, 0x5D, 0x2B, 0x21, 0xF5, 0x0B, 0x35, 0x32, 0x71, 0xD0, 0xDA, 0xBB, 0xDD, 0xA6, 0xB1,
+  0x53, 0xC7, 0x1D, 0x95, 0x6A, 0x80, 0x4E, 0x25, 0x15, 0x24, 0xD7, 0xA3, 0xE1, 0x6A, 0x95, 0xCE,
+  0x54, 0x48, 0xE8, 0x89, 0xC4, 0x84, 0x46, 0xA6, 0xD2, 0xE8, 0xE5, 0xB6, 0xD3, 0xC2, 0x58, 0x1E,
+  0x82, 0xF8, 0x28, 0x1B, 0x9D, 0xE7, 0x35, 0x89, 0xEE, 0x6E, 0x25, 0x29, 0x3F, 0xE8, 0xB0, 0xDB,
+  0xC8, 0x68, 0x38, 0xA3, 0x78, 0x9D, 0x9D, 0xED, 0x27, 0x91, 0xD4, 0xB8, 0xD2, 0xA3, 0x76, 0x54,
+  0xF1, 0x78, 0x4C, 0x1E, 0xB2, 0x11, 0xFA, 0x20, 0xAC, 0xE6, 0x89, 0xE2, 0xBE, 0x73, 0x5A, 0x31,
+  0x6B, 0xA5, 0x56, 0xCE, 0x76, 0x87, 0xA3, 0xC6, 0x60, 0x7E, 0xEA, 0x2F, 0x5B, 0xD0, 0xE1, 0x8F,
+  0xCC, 0xB6, 0xD0, 0x21, 0x5C, 0x0D, 0xA6, 0x95, 0x49, 0xA9, 0x30, 0x62, 0xFA, 0xF5, 0x59, 0x45,
+  0xE0, 0x6B, 0xEA, 0xA4, 0x30, 0xAB, 0xD5, 0xB7, 0xC1, 0x43, 0xA9, 0xD5, 0x4B, 0x4E, 0xC6, 0xDB,
+  0x4C, 0x6A, 0x7B, 0x60, 0x99, 0xEC, 0x58, 0x2F, 0x76, 0xE8, 0x78, 0xA3, 0xD3, 0x4E, 0x44, 0x97,
+  0x93, 0x39, 0x49, 0xAE, 0x2A, 0xAB, 0x04, 0xC8, 0x65, 0x69, 0xE6, 0xB8, 0xAF, 0xCD, 0xC8, 0x5C,
+  0x3E, 0x5A, 0x9A, 0x92, 0xAB, 0x0E, 0x3F, 0x53, 0xA0, 0x3B, 0x95, 0x03, 0xB5, 0xC1, 0x20, 0x91,
+  0x3E, 0xF5, 0xD8, 0x19, 0x60, 0xA9, 0xFA, 0x26, 0x3D, 0x52, 0x0B, 0xDB, 0x6E, 0x62, 0x5A, 0x1B,
+  0x94, 0xFA, 0x51, 0xFD, 0xB4, 0xDE, 0x8C, 0xC8, 0x79, 0x6E, 0x3C, 0x12, 0x77, 0x59, 0x29, 0xC6,
+  0x4D, 0xB3, 0x9B, 0xB9, 0xA0, 0xB5, 0x23, 0x93, 0x88, 0x9C, 0x59, 0x8D, 0x36, 0x7C, 0xBF, 0xDF,
+  0xD8, 0x4B, 0x95, 0x4D, 0x70, 0x39, 0xDD, 0x6C, 0xC4, 0x62, 0x61, 0xCA, 0xC5, 0xEA, 0x09, 0xA6,
+  0xC9, 0x34, 0x4E, 0xB9, 0x1E, 0x9D, 0x5B, 0xB7, 0xA0, 0xE2, 0xAC, 0x64, 0x99, 0x6D, 0xAC, 0x56,
+  0xAB, 0xA5, 0xE5, 0xCC, 0xF4, 0xD4, 0x57, 0x76, 0xA2, 0x18, 0x69, 0x1F, 0x9A, 0xAD, 0x66, 0x72,
+  0x22, 0x73, 0xBA, 0xAE, 0x34, 0xC8, 0x91, 0xCA, 0x37, 0x8E, 0x15, 0xEA, 0x94, 0x01, 0xB1, 0xC9,
+  0x36, 0xBE, 0x0D, 0x6A, 0x60, 0x3D, 0x3E, 0xCC, 0x53, 0x4A, 0x6B, 0x1E, 0xDD, 0x49, 0x42, 0x6C,
+  0xC6, 0xD4, 0x98, 0xB4, 0x18, 0x5D, 0x64, 0x57, 0xDB, 0x43, 0x66, 0xB8, 0x18, 0x95, 0xB6, 0xA3,
+  0x74, 0xA7, 0x40, 0xEF, 0xCB, 0xFD, 0xFD, 0x58, 0x87, 0x56, 0x38, 0x0E, 0x0E, 0xEB, 0x45, 0x72,
+  0xD0, 0x6E, 0xA6, 0xA8, 0xF6, 0xA4, 0x27, 0x41, 0xB5, 0xD5, 0x60, 0x4E, 0x4A, 0x66, 0xB0, 0xDF,
+  0x94, 0x33, 0xF1, 0x64, 0x92, 0x92, 0x67, 0x41, 0x3D, 0x2E, 0xD5, 0xD4, 0x41, 0xAE, 0x3E, 0xD1,
+  0x73, 0x59, 0x8A, 0xD4, 0x26, 0x15, 0xB6, 0x33, 0xD3, 0x87, 0x92, 0xAC, 0x8D, 0x8B, 0x52, 0x29,
+  0xBA, 0xD6, 0x47, 0xD3, 0x51, 0xBE, 0x3F, 0xEC, 0x81, 0x7A, 0x6E, 0x38, 0xDE, 0xE7, 0xA5, 0x59,
+  0x3B, 0x97, 0xA0, 0xE8, 0x32, 0x74, 0x94, 0xD9, 0xB2, 0xD2, 0x58, 0x69, 0x4A, 0x27, 0x1F, 0x49,
+  0x36, 0xEB, 0xAB, 0x05, 0xB3, 0x4B, 0xA4, 0x93, 0xBA, 0x34, 0xD7, 0x1A, 0xA5, 0x83, 0xA4, 0x95,
+  0xCA, 0x63, 0xAA, 0xD7, 0x8A, 0xE9, 0x5C, 0xBC, 0x0B, 0x62, 0xBC, 0x12, 0xCC, 0x4C, 0xA2, 0xC9,
+  0xF6, 0x06, 0xFA, 0xB7, 0xD5, 0xDD, 0x76, 0xDE, 0x4D, 0x67, 0x4B, 0x9A, 0xDC, 0xC5, 0x5E, 0x6C,
+  0xAD, 0x37, 0x4C, 0x14, 0x95, 0x4D, 0x6D, 0xB9, 0x5C, 0xBE, 0xBE, 0xFA, 0x08, 0xED, 0x28, 0x03,
+  0x18, 0x75, 0x59, 0x41, 0x96, 0xCF, 0x0A, 0xE8, 0x44, 0x5A, 0x80, 0xE5, 0x2C, 0x50, 0x19, 0x85,
+  0x93, 0x35, 0x0E, 0x05, 0x65, 0x30, 0x32, 0xD3, 0x80, 0x08, 0x63, 0x3C, 0x47, 0x10, 0x47, 0xF4,
+  0x80, 0x20, 0x69, 0x80, 0xC8, 0xC3, 0x5A, 0x45, 0xE2, 0x89, 0x27, 0xF8, 0x4B, 0x3E, 0x2A, 0xDC,
+  0x72, 0xA5, 0x11, 0xFF, 0xFE, 0x3F, 0x44, 0x8C, 0x8C, 0x25, 0x88, 0x12, 0x2F, 0x29, 0x1C, 0x2D,
+  0x12, 0x7D, 0xED, 0xFF, 0xFE, 0xD7, 0x9C, 0x07, 0x9C, 0xE8, 0xEA, 0x66, 0xC7, 0x81, 0xBD, 0x2C,
+  0x29, 0x9A, 0xAD, 0x0F, 0x5D, 0x05, 0xCA, 0x93, 0xCA, 0xD0, 0x3C, 0x0D, 0x01, 0x5E, 0x45, 0x29,
+  0x44, 0x70, 0x22, 0xA7, 0x71, 0x34, 0x8F, 0x0B, 0xC1, 0x6B, 0x34, 0x44, 0x08, 0xF4, 0x81, 0x13,
+  0x74, 0xC1, 0x56, 0x00, 0x9B, 0x38, 0x0A, 0xF6, 0x1C, 0xAB, 0xAD, 0x5E, 0x59, 0xB0, 0xE3, 0x18,
+  0xF0, 0x84, 0x3F, 0x42, 0xC4, 0x0A, 0x20, 0xD2, 0xAC, 0x42, 0xE3, 0x2B, 0x44, 0x68, 0xB4, 0xB2,
+  0x04, 0xDA, 0x13, 0x0B, 0x44, 0x95, 0xD3, 0x8E, 0xAC, 0xCC, 0x59, 0x0D, 0xE0, 0x4F, 0x5F, 0x04,
+  0x52, 0xAB, 0x6A, 0x47, 0x18, 0xA9, 0xFE, 0xF6, 0x7D, 0x01, 0x09, 0x7C, 0x5A, 0xD0, 0x02, 0xC7,
+  0x1F, 0x9F, 0x89, 0x3C, 0xCD, 0x73, 0x73, 0x85, 0x0B, 0x11, 0x15, 0xC0, 0xEF, 0x80, 0xC6, 0x31,
+  0x74, 0x88, 0x50, 0x69, 0x51, 0x7D, 0x82, 0xC4, 0x73, 0x8B, 0x17, 0x01, 0x22, 0xE5, 0xC4, 0x67,
+  0xF2, 0x45, 0xA6, 0x59, 0x96, 0x13, 0x97, 0xF0, 0xD7, 0x0F, 0x14, 0x45, 0x87, 0x88, 0xB9, 0xC4,
+  0x1E, 0xBF, 0x63, 0x82, 0x9E, 0xA3, 0x24, 0xF9, 0xCB, 0x8B, 0x41, 0x86, 0xF1, 0xFB, 0xC7, 0xBF,
+  0x58, 0x49, 0x5F, 0xAE, 0x44, 0x5D, 0x43, 0x41, 0xB5, 0xF6, 0xC4, 0x18, 0x8C, 0x55, 0xBF, 0x6B,
+  0xE0, 0xA0, 0x3D, 0xC1, 0x1E, 0x97, 0xE2, 0x33, 0x01, 0x6D, 0x9F, 0x06, 0x94, 0x17, 0x03, 0x05,
+  0x81, 0xE1, 0xE0, 0xE8, 0x9F, 0xCC, 0x6F, 0x2A, 0x41, 0xCA, 0x87, 0x97, 0x1F, 0x61, 0x45, 0xD2,
+  0x45, 0x16, 0x22, 0x50, 0x44, 0xA0, 0xA8, 0xDF, 0xE7, 0x92, 0xC2, 0x02, 0x05, 0xB6, 0x96, 0x0F,
+  0x84, 0x2A, 0xF1, 0x1C, 0x4B, 0xF0, 0xA8, 0xD7, 0xA5, 0x42, 0x1F, 0x5F, 0x8C, 0xBA, 0x27, 0x85,
+  0x66, 0x39, 0x5D, 0x85, 0x4D, 0x12, 0x10, 0x5E, 0xDA, 0x01, 0x65, 0xC1, 0x4B, 0xFB, 0x67, 0x62,
+  0xC5, 0xB1, 0x90, 0x33, 0x2F, 0x2C, 0xA7, 0xCA, 0x3C, 0x0D, 0xC7, 0xCD, 0x89, 0x30, 0x60, 0x07,
+  0x4F, 0x73, 0x1E, 0x0A, 0x02, 0xA4, 0x17, 0x1C, 0x64, 0xA0, 0x68, 0x7D, 0xA0, 0x69, 0x70, 0x90,
+  0xEA, 0x93, 0x86, 0xA6, 0xEC, 0xFB, 0xB9, 0xB1, 0x28, 0x89, 0xE0, 0xE5, 0x87, 0x51, 0x68, 0x76,
+  0xA3, 0xCA, 0x34, 0x83, 0xF8, 0x41, 0x90, 0x56, 0xC7, 0x8C, 0xC4, 0xF3, 0xB4, 0xAC, 0x02, 0x38,
+  0x32, 0xF3, 0xD7, 0xCB, 0xD3, 0x1E, 0xCC, 0x37, 0x9C, 0xF6, 0xA4, 0x49, 0x3A, 0xB3, 0x7A, 0x82,
+  0x53, 0xCA, 0x4B, 0xBA, 0x66, 0xA2, 0xB3, 0xEA, 0x0C, 0x29, 0x01, 0x3C, 0x60, 0xCE, 0x35, 0x1B,
+  0xC4, 0x61, 0xAF, 0x0A, 0x41, 0x3A, 0x79, 0x16, 0xAB, 0x1E, 0xA5, 0xD7, 0x25, 0x76, 0x4E, 0x9B,
+  0xB3, 0x65, 0x7C, 0xDC, 0x60, 0x8A, 0x86, 0xA7, 0xD8, 0xBB, 0xF2, 0x26, 0xAE, 0x1F, 0x61, 0x83,
+  0x1D, 0x00, 0x4E, 0x1A, 0xE0, 0xF9, 0xBB, 0x33, 0x66, 0xC9, 0x14, 0x84, 0x84, 0x73, 0x65, 0x8A,
+  0x1A, 0x64, 0xE8, 0x8F, 0x30, 0xCD, 0xAE, 0x75, 0x55, 0x7B, 0x9A, 0xEB, 0x9A, 0x26, 0x89, 0xA6,
+  0x94, 0xC1, 0x75, 0x08, 0x5B, 0x59, 0x9D, 0xE1, 0x0F, 0x2C, 0xC9, 0x2A, 0x77, 0x02, 0xE6, 0x37,
+  0x26, 0xD0, 0xD1, 0xC2, 0x43, 0xE0, 0xBC, 0x07, 0x74, 0x4D, 0xE7, 0x52, 0x01, 0x57, 0x42, 0x95,
+  0xB0, 0xD1, 0x19, 0x45, 0xF2, 0xB9, 0xA3, 0x15, 0x8B, 0x3C, 0x0A, 0xF5, 0x77, 0x83, 0x95, 0x9F,
+  0x23, 0xC6, 0xE2, 0x83, 0x8B, 0x10, 0x2B, 0xA3, 0x2F, 0x0F, 0x81, 0x85, 0x2E, 0x32, 0x48, 0x29,
+  0x11, 0x81, 0xC7, 0x87, 0xEF, 0x0F, 0x10, 0x0F, 0x01, 0x49, 0x05, 0x22, 0x4B, 0xBC, 0x12, 0x97,
+  0x2A, 0x28, 0x2E, 0xA8, 0x16, 0xFE, 0x03, 0x8B, 0xD1, 0xDF, 0x7F, 0xFE, 0x49, 0x7C, 0xFF, 0xF1,
+  0xF2, 0xB0, 0x90, 0x14, 0x22, 0x80, 0x60, 0x38, 0x91, 0x05, 0x07, 0x58, 0x17, 0x7D, 0x31, 0x7F,
+  0x7E, 0x26, 0x20, 0x79, 0xBA, 0x00, 0x87, 0xAA, 0x86, 0x79, 0x20, 0x2E, 0xB5, 0x95, 0x59, 0x13,
+  0x0C, 0x22, 0x4C, 0xDC, 0x82, 0x08, 0x7C, 0x3A, 0xB7, 0xF8, 0x8A, 0x6B, 0xBE, 0xA1, 0x0A, 0xB4,
+  0x44, 0x39, 0x51, 0x07, 0x2F, 0x0F, 0x3F, 0x2E, 0xD8, 0x37, 0xE0, 0x08, 0x81, 0x09, 0xAF, 0xF6,
+  0x08, 0x91, 0xBB, 0x3C, 0xBC, 0xA2, 0xD5, 0xF6, 0x5E, 0xEC, 0x28, 0x12, 0x5A, 0x4C, 0xC7, 0x00,
+  0x04, 0x7F, 0x34, 0xC9, 0xFF, 0x0A, 0x7F, 0x7F, 0x83, 0x74, 0xBA, 0x41, 0x70, 0x39, 0xEA, 0x13,
+  0xFD, 0x51, 0x80, 0xA6, 0x2B, 0x22, 0x1A, 0x27, 0x2C, 0x79, 0xC1, 0x3C, 0x29, 0x28, 0xF4, 0x72,
+  0x89, 0xD6, 0x5D, 0xC1, 0xAE, 0x50, 0x1C, 0x3C, 0x42, 0x3D, 0xFC, 0x78, 0xF0, 0x6E, 0x18, 0x96,
+  0x15, 0x49, 0x93, 0x90, 0x81, 0x08, 0xC3, 0xB5, 0xAD, 0xCB, 0x0E, 0x40, 0x15, 0x95, 0x8C, 0x68,
+  0x5E, 0x07, 0xAA, 0x35, 0x05, 0xAC, 0xAB, 0x17, 0x6D, 0xC5, 0xA9, 0x2F, 0x0F, 0xB6, 0x86, 0xB0,
+  0xCC, 0x98, 0xA6, 0xC0, 0xF7, 0x1F, 0x21, 0x5C, 0x1D, 0x66, 0xC1, 0x82, 0xD6, 0x79, 0x4D, 0x85,
+  0x7A, 0xD3, 0x86, 0xF0, 0xE5, 0x01, 0x57, 0x32, 0xB4, 0xB8, 0xA3, 0x11, 0x94, 0xAD, 0xCE, 0x2C,
+  0xB4, 0x5A, 0x20, 0x73, 0x71, 0xD0, 0x3C, 0x9B, 0x84, 0xA1, 0x42, 0xCF, 0x1B, 0xF5, 0x01, 0x5F,
+  0x8C, 0xF5, 0x41, 0xAC, 0x78, 0x02, 0xED, 0x80, 0xE6, 0xE4, 0x41, 0x99, 0x05, 0x61, 0x5E, 0x5A,
+  0x06, 0xFC, 0x45, 0x45, 0x91, 0xA0, 0x20, 0xDF, 0xE0, 0x9C, 0x08, 0x00, 0xAB, 0x12, 0xD0, 0x90,
+  0x21, 0x1D, 0x93, 0x20, 0xCC, 0x7E, 0xFC, 0x10, 0xB3, 0xC1, 0x7D, 0x34, 0x17, 0xC6, 0xB0, 0x68,
+  0x68, 0xDB, 0x9C, 0x44, 0xA1, 0x22, 0x93, 0x6A, 0x16, 0x61, 0x07, 0x6C, 0x1F, 0x2C, 0xD1, 0x6C,
+  0xC2, 0x76, 0xA2, 0xCE, 0xF3, 0x66, 0xDD, 0x0A, 0x69, 0x5D, 0xC0, 0x56, 0x4D, 0xD1, 0x7C, 0x8A,
+  0x9A, 0xE5, 0x9C, 0x08, 0x75, 0x78, 0x0F, 0xAF, 0x24, 0x17, 0x62, 0x5B, 0x8D, 0xD9, 0x16, 0xCA,
+  0xC0, 0x8D, 0xB6, 0xB6, 0x1A, 0xB3, 0x2D, 0xB4, 0x1A, 0x59, 0x71, 0xC9, 0x03, 0x57, 0x43, 0xAB,
+  0xD8, 0xC2, 0x88, 0x17, 0x24, 0x12, 0x00, 0x9A, 0x57, 0x2F, 0x85, 0x90, 0x2B, 0xE2, 0xD2, 0x0D,
+  0x6A, 0x15, 0x9F, 0x5B, 0xA9, 0x2B, 0x6E, 0xA1, 0x5D, 0x35, 0xC2, 0xA5, 0xCE, 0x36, 0x80, 0xF5,
+  0x6E, 0x05, 0x58, 0x87, 0x40, 0x40, 0x05, 0xC7, 0x16, 0x77, 0x90, 0x73, 0x0D, 0x4E, 0x85, 0xD2,
+  0x04, 0x94, 0x80, 0x1F, 0xDB, 0x08, 0x15, 0x1A, 0x71, 0xCD, 0x1F, 0xB2, 0x09, 0x29, 0x40, 0xF3,
+  0x3B, 0x40, 0x75, 0x7D, 0x54, 0x07, 0xBF, 0x5F, 0x1E, 0x00, 0x14, 0x6B, 0x80, 0xA0, 0x0B, 0x86,
+  0xE8, 0x05, 0x60, 0xD9, 0x8F, 0xC7, 0x77, 0x75, 0x20, 0xC0, 0xB9, 0xB9, 0x81, 0xBF, 0x09, 0xAB,
+  0xEE, 0xA2, 0x67, 0x25, 0x06, 0xAF, 0xDD, 0x5B, 0xB8, 0xE1, 0xAA, 0xB8, 0x81, 0xBA, 0x08, 0xD7,
+  0x0B, 0x78, 0x17, 0x91, 0x82, 0x04, 0xED, 0x16, 0x2B, 0xED, 0x45, 0x88, 0xE9, 0x32, 0xEA, 0xF7,
+  0x81, 0x99, 0x63, 0x3B, 0x0F, 0xE6, 0x3E, 0xC9, 0x18, 0x44, 0x97, 0x2D, 0x00, 0x48, 0x22, 0x6C,
+  0x7F, 0x26, 0xBE, 0x0C, 0xB4, 0x26, 0x6A, 0xD0, 0x90, 0x18, 0x1A, 0x15, 0x04, 0x30, 0x43, 0x2C,
+  0x35, 0xA1, 0x40, 0xA3, 0x0A, 0xE7, 0xD9, 0xA1, 0x2D, 0x6C, 0x4B, 0x36, 0x87, 0x7C, 0x16, 0x68,
+  0xD8, 0xF2, 0x3C, 0x07, 0x81, 0x7A, 0xB0, 0x71, 0xC0, 0x5C, 0xB9, 0x18, 0x4B, 0x98, 0xC1, 0xE5,
+  0x13, 0x84, 0xCD, 0x54, 0x79, 0xDF, 0x1F, 0x0E, 0xCF, 0x84, 0xA3, 0x12, 0x3A, 0xA1, 0xA8, 0x17,
+  0xA8, 0xC3, 0x17, 0x5A, 0xE8, 0xE1, 0xE8, 0xAC, 0x9D, 0x5A, 0xB5, 0x9A, 0x24, 0x63, 0xCD, 0x09,
+  0xA0, 0x48, 0x7B, 0x62, 0x33, 0x9C, 0x42, 0x3C, 0x42, 0xA0, 0x7E, 0x25, 0xBF, 0xBD, 0x81, 0xFE,
+  0x46, 0xF3, 0xAB, 0xFE, 0x7E, 0xD8, 0x58, 0x65, 0x17, 0x4E, 0x3B, 0x93, 0x90, 0x8A, 0xB0, 0xD8,
+  0x07, 0x99, 0x75, 0x83, 0xA3, 0x68, 0x8E, 0xEC, 0x5C, 0xBC, 0x52, 0x2C, 0xCE, 0x6A, 0x88, 0x65,
+  0x80, 0x69, 0x0C, 0xD8, 0xD1, 0x9B, 0xDC, 0xBD, 0x87, 0x09, 0x51, 0xE5, 0xAC, 0x77, 0xA9, 0xA9,
+  0x7B, 0xC0, 0x61, 0x6C, 0xAC, 0x5E, 0xBC, 0x06, 0x8E, 0x44, 0xDB, 0xB2, 0x87, 0x6F, 0xF5, 0x8F,
+  0xB8, 0x62, 0x28, 0x96, 0x0F, 0xF5, 0x6A, 0x03, 0x2B, 0x40, 0xF1, 0xA5, 0x45, 0x06, 0xBC, 0x05,
+  0x49, 0x23, 0xC5, 0x87, 0x2C, 0x80, 0x05, 0x60, 0x30, 0xC8, 0x8D, 0xE5, 0xD3, 0x2B, 0x41, 0x5E,
+  0x33, 0xE6, 0xAC, 0xB2, 0x02, 0x76, 0x62, 0x43, 0x6E, 0x1A, 0xD0, 0x7A, 0x7E, 0x6B, 0xF2, 0x0C,
+  0xAB, 0xE0, 0x6C, 0x04, 0xC9, 0xDA, 0x63, 0x95, 0x72, 0xCD, 0x4C, 0x43, 0x05, 0xFD, 0x8C, 0x10,
+  0xBD, 0x97, 0xFD, 0x6F, 0x88, 0x97, 0xB3, 0xDA, 0x60, 0x3D, 0x8B, 0xE7, 0xC9, 0x46, 0x47, 0xF8,
+  0x00, 0x97, 0x83, 0x8B, 0xE1, 0x86, 0x6F, 0x39, 0x31, 0x21, 0x8E, 0x6E, 0x88, 0xE3, 0x2D, 0x88,
+  0xA9, 0x01, 0x01, 0xDD, 0xE1, 0xF9, 0x1C, 0xB0, 0x96, 0x19, 0x43, 0xEE, 0x26, 0x8C, 0xC1, 0x06,
+  0x52, 0x01, 0x40, 0x2F, 0x14, 0xA8, 0x81, 0x26, 0xAD, 0xAD, 0xC2, 0xD0, 0xFA, 0x8A, 0xB1, 0x00,
+  0x7B, 0x0C, 0x41, 0x92, 0x1E, 0x1F, 0xAF, 0x01, 0x33, 0x24, 0xE2, 0xB8, 0xA4, 0x08, 0xD0, 0xDF,
+  0x55, 0x01, 0x2E, 0x0A, 0x38, 0x10, 0x07, 0x89, 0x0C, 0x19, 0x26, 0x3D, 0x21, 0xFF, 0xE0, 0x30,
+  0x37, 0x64, 0xB4, 0x05, 0x5A, 0x15, 0xB5, 0x80, 0xB3, 0x36, 0x04, 0x3D, 0xF4, 0xAB, 0x95, 0xDA,
+  0x47, 0x42, 0xD2, 0xC7, 0x01, 0x86, 0xD9, 0x30, 0x70, 0x8D, 0xF3, 0xF1, 0xF6, 0xEC, 0x9B, 0x3A,
+  0x0B, 0xD1, 0x62, 0x2E, 0x45, 0x63, 0x65, 0x7F, 0x6C, 0xCD, 0x3B, 0x40, 0xDF, 0x5C, 0xE4, 0x8E,
+  0xD6, 0xD6, 0xFA, 0xBA, 0x47, 0x20, 0x71, 0x2D, 0x58, 0x0E, 0x94, 0x9F, 0x5E, 0x91, 0x83, 0xF3,
+  0x66, 0xBF, 0xC8, 0x07, 0xBA, 0xB9, 0x0A, 0xD0, 0x3A, 0xC0, 0xE6, 0xED, 0x5C, 0xF6, 0xF2, 0x2E,
+  0x77, 0xF6, 0xE2, 0xD1, 0x5C, 0xE2, 0x05, 0x5C, 0x64, 0xE9, 0x23, 0xBB, 0xDF, 0x03, 0x97, 0xFA,
+  0xA5, 0xD2, 0xE9, 0x10, 0x19, 0x3F, 0xDC, 0x34, 0xBC, 0x97, 0x0A, 0x94, 0xFE, 0x50, 0x1D, 0x44,
+  0xE0, 0x12, 0x07, 0x0D, 0xC8, 0x71, 0x34, 0xA3, 0x11, 0xCC, 0x31, 0xDC, 0xC2, 0x2C, 0xB8, 0x58,
+  0x41, 0x47, 0xE8, 0x61, 0x05, 0x36, 0xE4, 0x25, 0xB0, 0x71, 0xA3, 0x72, 0x04, 0x36, 0xE7, 0x4A,
+  0x2B, 0x16, 0xE1, 0xE9, 0x39, 0xE0, 0x09, 0xB3, 0x2F, 0xB3, 0xF0, 0xEC, 0xDC, 0x7E, 0x90, 0xD3,
+  0x30, 0xA0, 0x97, 0x14, 0xE7, 0x20, 0x8D, 0xA2, 0xBB, 0xA3, 0x34, 0x9A, 0xFC, 0xC3, 0xC3, 0xC4,
+  0x9D, 0x10, 0x56, 0x67, 0x7F, 0x71, 0x9C, 0xD8, 0x6C, 0x38, 0xC7, 0x69, 0x14, 0xBD, 0xD7, 0xC2,
+  0x5D, 0x46, 0x78, 0x93, 0x2B, 0x06, 0xC2, 0x7F, 0x98, 0x2B, 0xB4, 0xA9, 0x48, 0x8D, 0xCE, 0xFE,
+  0x0A, 0x57, 0xAA, 0x6A, 0xC1, 0x18, 0xA5, 0x8D, 0x2B, 0x01, 0x9B, 0xE7, 0x76, 0xD7, 0x00, 0x7E,
+  0xB2, 0x2C, 0xE0, 0x7B, 0x7A, 0x42, 0xC6, 0xCF, 0x32, 0x00, 0x17, 0xFE, 0x73, 0x86, 0xED, 0xC5,
+  0x03, 0xF9, 0xF8, 0x2C, 0x60, 0x45, 0x0F, 0x24, 0x01, 0x68, 0xCA, 0xD1, 0x0C, 0x67, 0x91, 0x3A,
+  0x2D, 0x9B, 0x45, 0x81, 0xC7, 0x1B, 0xE1, 0x1C, 0xEA, 0x08, 0x75, 0xFC, 0x6C, 0x70, 0x39, 0xF4,
+  0x60, 0xDA, 0xB7, 0xE7, 0x33, 0x36, 0xCB, 0xE2, 0x59, 0x55, 0xD3, 0xAB, 0xAA, 0x69, 0xE8, 0x01,
+  0x87, 0x33, 0xD0, 0x11, 0xC6, 0xC3, 0x52, 0x9F, 0x6D, 0x93, 0x28, 0xD0, 0x72, 0xC0, 0x1E, 0x89,
+  0xBB, 0x68, 0x27, 0x54, 0xBB, 0x23, 0x83, 0x02, 0x87, 0xD0, 0xC3, 0x95, 0x4F, 0xF3, 0x4C, 0x90,
+  0x67, 0xD5, 0xE9, 0x61, 0x8C, 0x6E, 0x08, 0x45, 0xD0, 0xE4, 0xE5, 0x3B, 0x02, 0x59, 0x4B, 0x4E,
+  0x70, 0xAE, 0x03, 0x03, 0xBF, 0xE5, 0x30, 0x39, 0x66, 0xEB, 0xBD, 0x4A, 0x14, 0x4E, 0x48, 0x9F,
+  0xE7, 0x18, 0xD0, 0xE7, 0x4E, 0xA0, 0x03, 0x14, 0xC4, 0x3D, 0x7A, 0xE9, 0x21, 0x05, 0x96, 0x0F,
+  0x43, 0x2B, 0x0C, 0x6A, 0x6A, 0x9B, 0xCF, 0xAC, 0x51, 0x62, 0x36, 0xB3, 0x42, 0x79, 0x94, 0x90,
+  0x0B, 0x93, 0xC4, 0x6F, 0x67, 0x80, 0x08, 0x41, 0x25, 0x61, 0xC9, 0xCB, 0x7B, 0xA9, 0x2A, 0x5F,
+  0x24, 0xE7, 0x3A, 0x5B, 0x65, 0xCE, 0x3F, 0xAC, 0xC3, 0xCE, 0xC9, 0x82, 0x97, 0x24, 0x25, 0x60,
+  0x8F, 0xD2, 0x70, 0x5A, 0x0C, 0xF6, 0x19, 0x33, 0x1D, 0x0E, 0x53, 0x2A, 0x6E, 0x03, 0x18, 0x89,
+  0x3B, 0x13, 0xE2, 0x1C, 0xCA, 0x9C, 0x25, 0xEF, 0x5A, 0xE0, 0xCE, 0x72, 0x66, 0xCB, 0x1F, 0x3C,
+  0x1B, 0xD8, 0x61, 0xF0, 0x1F, 0xB0, 0x00, 0xAC, 0x76, 0x8F, 0x90, 0x15, 0xEE, 0x44, 0x44, 0xE8,
+  0xC1, 0x96, 0x4F, 0x78, 0x0F, 0xAC, 0xAD, 0xF9, 0xFB, 0xA7, 0xF7, 0xEC, 0xD8, 0x5C, 0xD8, 0x68,
+  0x44, 0x5A, 0x67, 0x67, 0xC6, 0x64, 0xEA, 0x1B, 0x6B, 0x15, 0x35, 0x71, 0xAE, 0x29, 0xD8, 0xF0,
+  0xEB, 0x37, 0x93, 0xBF, 0xBC, 0xA4, 0x02, 0xD5, 0xB1, 0x78, 0x9F, 0xA2, 0xA1, 0x07, 0xF6, 0xBC,
+  0x5A, 0x32, 0xC6, 0x7F, 0xE6, 0x4A, 0x7A, 0xC6, 0x92, 0xFE, 0x60, 0x4F, 0x26, 0x9A, 0x8B, 0xAE,
+  0x7A, 0xD1, 0xBE, 0x8E, 0x12, 0x2F, 0x25, 0x6C, 0x6F, 0x60, 0xE8, 0x62, 0x27, 0x7D, 0x61, 0x59,
+  0x57, 0x57, 0xB6, 0xA5, 0x68, 0x6F, 0x6F, 0xAE, 0xC8, 0x47, 0x9B, 0x9B, 0xED, 0xE4, 0x0A, 0x76,
+  0xB4, 0xDD, 0x0A, 0xC7, 0xE6, 0x62, 0xBB, 0x5A, 0x1F, 0xAF, 0x5B, 0x9B, 0xEE, 0xB5, 0xC5, 0x83,
+  0x81, 0x94, 0xC7, 0xC5, 0x96, 0x0C, 0xAA, 0x5B, 0x18, 0xB4, 0xC2, 0x8E, 0x7F, 0xFB, 0x8D, 0x88,
+  0x41, 0xC5, 0x00, 0x91, 0xA2, 0x5F, 0x56, 0x38, 0xE1, 0x06, 0xFA, 0x7C, 0xC1, 0x6E, 0x4F, 0x65,
+  0xFD, 0xF9, 0xE7, 0x35, 0xFE, 0x2F, 0x97, 0xA6, 0x36, 0x81, 0xF1, 0xD0, 0xCD, 0xFF, 0x79, 0xBF,
+  0x9F, 0xBD, 0x84, 0x90, 0x06, 0xF6, 0xB9, 0x1A, 0x50, 0x21, 0x28, 0x9C, 0x2C, 0xAD, 0xCF, 0x2D,
+  0x45, 0x13, 0x28, 0x07, 0xB4, 0x3D, 0x00, 0xE2, 0x55, 0x20, 0x70, 0x7F, 0x2A, 0x5D, 0xAC, 0x83,
+  0x2C, 0x33, 0xA5, 0x32, 0x6C, 0x15, 0xE1, 0x74, 0xA5, 0x59, 0x66, 0x99, 0x79, 0x3B, 0xA6, 0x97,
+  0x07, 0x37, 0x04, 0x8A, 0x07, 0xCE, 0x51, 0xAC, 0x55, 0x69, 0x19, 0x78, 0x27, 0x79, 0x86, 0x3B,
+  0x8D, 0x23, 0x5D, 0x37, 0x92, 0xCF, 0x28, 0x84, 0xB1, 0xA7, 0x48, 0xCC, 0x25, 0xE2, 0xA0, 0xE5,
+  0xEF, 0xB2, 0x73, 0xCE, 0xEF, 0x5B, 0xA6, 0xEB, 0x2A, 0x6F, 0x63, 0xFA, 0x0A, 0xEF, 0xD5, 0x2A,
+  0xD9, 0xB3, 0x1D, 0xF0, 0x30, 0x14, 0x88, 0x09, 0x06, 0x7F, 0xBF, 0xBC, 0x5E, 0xAD, 0x5B, 0x1B,
+  0x23, 0xC8, 0x9B, 0xCE, 0x1A, 0xF4, 0xD5, 0xA2, 0xB6, 0x86, 0xD0, 0x74, 0x58, 0x52, 0x2B, 0x82,
+  0x83, 0x86, 0x87, 0x66, 0x69, 0x0A, 0xB3, 0xA7, 0x20, 0x04, 0x20, 0x7E, 0xB9, 0xD6, 0x12, 0x5E,
+  0x56, 0x0B, 0x8B, 0x90, 0x13, 0x91, 0x65, 0xA1, 0x9F, 0x08, 0x6F, 0xD3, 0x6D, 0x1A, 0x62, 0x13,
+  0xCF, 0x67, 0xD3, 0x14, 0x5B, 0xDF, 0xC1, 0x57, 0x8B, 0x44, 0x93, 0x60, 0xB3, 0xE2, 0x7D, 0xD6,
+  0x0E, 0x99, 0x7A, 0x4F, 0x33, 0xE7, 0xBD, 0x23, 0x80, 0xF5, 0xED, 0x39, 0x71, 0xEF, 0xCA, 0x03,
+  0x1A, 0xE5, 0x66, 0x23, 0x2B, 0xFF, 0xEF, 0x95, 0x2B, 0x7C, 0x79, 0x30, 0xDB, 0x86, 0x19, 0x1E,
+  0xD0, 0x0A, 0x4E, 0x14, 0xC2, 0x25, 0x06, 0xFF, 0x67, 0x37, 0xA1, 0xE7, 0x2F, 0xC3, 0x3E, 0x5A,
+  0x0A, 0xE0, 0xBE, 0xA5, 0xC0, 0x3A, 0xDD, 0xC3, 0x8D, 0x76, 0xB9, 0x8E, 0x37, 0xFC, 0xE9, 0xEB,
+  0x50, 0xD5, 0xF4, 0x8F, 0x02, 0x26, 0xC1, 0x21, 0x27, 0xA2, 0xD0, 0x99, 0x9C, 0x10, 0x61, 0xF9,
+  0x20, 0x3F, 0xFE, 0x76, 0x1A, 0x1A, 0x28, 0xA2, 0xFB, 0x10, 0x05, 0x3F, 0x19, 0xBC, 0xA3, 0xCE,
+  0x5A, 0x12, 0x0B, 0xDE, 0xD1, 0xD7, 0x6D, 0xEC, 0x98, 0x00, 0x6B, 0x7E, 0x55, 0x7A, 0x07, 0xD0,
+  0xB4, 0x58, 0xDF, 0x9A, 0x02, 0xD5, 0x3C, 0x4F, 0x6B, 0x50, 0x51, 0xBB, 0xF5, 0xCC, 0x95, 0x7A,
+  0x31, 0x27, 0x1C, 0xED, 0x75, 0xAA, 0xC6, 0x02, 0xB2, 0xF9, 0x4F, 0x67, 0x01, 0x72, 0xBB, 0x50,
+  0x09, 0x7B, 0x6F, 0x68, 0x99, 0xA1, 0x3D, 0x50, 0x08, 0xEB, 0x33, 0xB0, 0xFA, 0x2E, 0xB5, 0x08,
+  0x31, 0x12, 0x7D, 0x0B, 0x7F, 0x90, 0xF0, 0xC9, 0xDA, 0xE5, 0x38, 0x80, 0xBD, 0x25, 0xC7, 0xF3,
+  0x03, 0xB4, 0x17, 0xE5, 0x76, 0x7F, 0x71, 0x22, 0xE1, 0x77, 0xC2, 0xD7, 0xC6, 0xBF, 0x7C, 0xC4,
+  0x33, 0xFC, 0xB9, 0x58, 0xE0, 0xDF, 0x58, 0x9C, 0xCF, 0xB8, 0x0D, 0xDF, 0xCE, 0xC2, 0xA7, 0x40,
+  0xC5, 0x2B, 0x29, 0x98, 0x31, 0x6E, 0x8C, 0x46, 0xAE, 0xF1, 0xDD, 0xA1, 0xEB, 0x95, 0xF7, 0xEF,
+  0x4C, 0x48, 0x80, 0x7D, 0xD6, 0x8A, 0x9F, 0x6E, 0xAF, 0x69, 0xBC, 0xB3, 0xF6, 0xB1, 0xD0, 0xEA,
+  0x27, 0xB2, 0x89, 0x0E, 0xD3, 0x60, 0xA6, 0x09, 0x6D, 0x59, 0x41, 0xA7, 0xE5, 0xF8, 0xEA, 0x95,
+  0x10, 0x36, 0xDD, 0xBD, 0x2B, 0x9B, 0x82, 0x0C, 0xE9, 0x6D, 0x3B, 0x6E, 0xF1, 0x20, 0xE4, 0xA4,
+  0x00, 0xB1, 0xFE, 0x8D, 0xD4, 0xB1, 0x15, 0x46, 0x3B, 0xD3, 0xC9, 0x86, 0x1D, 0xD8, 0x9B, 0xC1,
+  0xB1, 0x35, 0x1A, 0x97, 0x17, 0xE2, 0x1C, 0x6C, 0xF0, 0x1A, 0x8F, 0x29, 0xDB, 0x68, 0xBF, 0x89,
+  0x93, 0x74, 0xD5, 0xB2, 0x27, 0x82, 0xC4, 0x06, 0xCE, 0xA9, 0x48, 0x2F, 0x1E, 0x3C, 0x42, 0x23,
+  0x11, 0x0D, 0xDD, 0xD6, 0x24, 0x2E, 0x5F, 0x07, 0x75, 0x39, 0x90, 0x3A, 0x66, 0x2F, 0xEF, 0x65,
+  0xD4, 0xFD, 0xA9, 0x71, 0xD0, 0xFC, 0xED, 0xD1, 0x36, 0x29, 0x39, 0x7C, 0x66, 0xC0, 0xD6, 0x9B,
+  0x8B, 0x2B, 0x1F, 0xC1, 0x8B, 0xBC, 0x52, 0xC7, 0x20, 0xAD, 0x5D, 0xCD, 0xC7, 0x97, 0xB3, 0x29,
+  0xFE, 0x00, 0xD7, 0x82, 0x1F, 0xE7, 0x5A, 0xCB, 0xDC, 0x9C, 0xFE, 0xEB, 0x1C, 0x3B, 0xD3, 0xEA,
+  0xC1, 0x2D, 0xB3, 0x97, 0x0F, 0x71, 0xEA, 0x82, 0x0F, 0x65, 0xD7, 0xEF, 0x71, 0x49, 0x01, 0x34,
+  0xDF, 0x37, 0x42, 0x74, 0x9B, 0x54, 0x93, 0xE6, 0x9A, 0xE7, 0x54, 0x6B, 0x24, 0x1E, 0xD3, 0x17,
+  0x72, 0x4B, 0x79, 0xC8, 0x4D, 0xF6, 0xA3, 0xA5, 0x56, 0xAC, 0x83, 0x2F, 0xD6, 0x62, 0x38, 0xBB,
+  0xD7, 0xD7, 0x0C, 0x7D, 0x84, 0x66, 0xF0, 0x46, 0xB5, 0xD5, 0xF1, 0x23, 0x54, 0xA8, 0x6E, 0x06,
+  0x3D, 0x7B, 0x09, 0x18, 0x8A, 0x95, 0xBD, 0x86, 0xE7, 0x24, 0xE7, 0xC9, 0x63, 0xDA, 0xBD, 0xD5,
+  0x8B, 0xA1, 0x01, 0x1E, 0x3E, 0xD6, 0xDC, 0xDD, 0xDF, 0x8B, 0xDD, 0xB9, 0xF5, 0xA2, 0xCE, 0xAD,
+  0x3B, 0xFE, 0x79, 0xFA, 0x5C, 0x3D, 0x5A, 0xFE, 0x81, 0x17, 0x79, 0x77, 0xD3, 0x3C, 0x9E, 0x4B,
+  0x2B, 0xE4, 0x25, 0x63, 0xEF, 0xCE, 0x00, 0xD9, 0x3C, 0x2C, 0x57, 0x92, 0xF9, 0x7D, 0xBE, 0x8E,
+  0x29, 0x80, 0x57, 0xB6, 0xE5, 0x9A, 0x45, 0x4E, 0x7F, 0x1A, 0x9F, 0x3A, 0xC2, 0x5B, 0xD5, 0xEF,
+  0x04, 0xB9, 0x52, 0x47, 0x1E, 0xC9, 0xA7, 0x2B, 0x4A, 0xBC, 0xE2, 0x53, 0x27, 0xA9, 0x4F, 0xF6,
+  0x00, 0xD5, 0x46, 0x90, 0x17, 0xA4, 0x9D, 0xDE, 0x33, 0xDC, 0x2D, 0x3F, 0x6B, 0x0E, 0x96, 0x9C,
+  0xD8, 0x81, 0x0B, 0xCD, 0x5E, 0x88, 0xCE, 0x09, 0x0C, 0xA4, 0xF7, 0x79, 0x5E, 0x16, 0x0C, 0x0C,
+  0x26, 0xDE, 0x01, 0x10, 0xF2, 0x0C, 0xFB, 0xE1, 0xF4, 0x19, 0xE1, 0xFC, 0x40, 0xEA, 0x19, 0x01,
+  0x7E, 0xC0, 0xC5, 0x9F, 0x47, 0x8F, 0x26, 0x0E, 0x36, 0xC0, 0x06, 0xF8, 0xD8, 0xCA, 0x5F, 0xA1,
+  0xC8, 0x9E, 0xF5, 0x7A, 0xBB, 0xBB, 0x77, 0x90, 0xAC, 0x29, 0xBA, 0x9D, 0x20, 0x1C, 0x49, 0xBB,
+  0x79, 0x8D, 0x5C, 0xC6, 0x3E, 0x3A, 0xFA, 0x76, 0x57, 0xB6, 0xF0, 0xE6, 0x85, 0x13, 0x28, 0xE0,
+  0xED, 0x27, 0xBE, 0x77, 0x35, 0x35, 0xCC, 0xDD, 0x9F, 0xFF, 0xEC, 0x5A, 0xFA, 0x59, 0xB1, 0xFF,
+  0x9B, 0xC2, 0x84, 0x33, 0xBF, 0x24, 0x0D, 0xC1, 0xBC, 0x39, 0x85, 0xB6, 0xC8, 0xA2, 0xFF, 0xEE,
+  0xC8, 0x82, 0x4A, 0xD8, 0x13, 0x76, 0x5E, 0xF2, 0x0E, 0xC7, 0x15, 0xB8, 0x51, 0xEE, 0x25, 0x8C,
+  0x8F, 0x28, 0x2A, 0xB0, 0x65, 0xF5, 0xDC, 0x03, 0x83, 0xD5, 0xD1, 0xD8, 0x4F, 0x04, 0x33, 0xFD,
+  0x9F, 0x0A, 0x66, 0xAE, 0xB6, 0x10, 0x51, 0xD6, 0x0D, 0xFE, 0xFF, 0xF8, 0xD7, 0xE4, 0x11, 0x85,
+  0x93, 0xFF, 0xDF, 0x88, 0x23, 0x82, 0xE5, 0xCD, 0xAC, 0x6A, 0x49, 0x91, 0x04, 0x74, 0x30, 0x40,
+  0xE2, 0x69, 0x65, 0x20, 0xE5, 0x61, 0x7B, 0xA0, 0x42, 0x61, 0x72, 0xCB, 0x92, 0xB7, 0x9E, 0x71,
+  0xE1, 0x1A, 0x48, 0x1F, 0xC3, 0x64, 0x4F, 0x9D, 0xFE, 0xED, 0x8B, 0xC4, 0xAE, 0x99, 0xFC, 0xFF,
+  0x2A, 0xE0, 0xFF, 0xFC, 0xEF, 0xB3, 0x1C, 0x76, 0xDE, 0x84, 0xA1, 0x70, 0x38, 0xBE, 0xED, 0x82,
+  0x82, 0x22, 0x60, 0x5B, 0xFB, 0x81, 0x64, 0x6F, 0x0D, 0xBF, 0xDC, 0x6D, 0xC7, 0x78, 0xCB, 0xE4,
+  0x95, 0xA0, 0x6C, 0xA3, 0xD5, 0x14, 0x69, 0xF3, 0xB6, 0x4D, 0xB3, 0x43, 0x47, 0x9D, 0x46, 0xE2,
+  0x3E, 0xB5, 0x21, 0x22, 0x89, 0x43, 0xF4, 0x18, 0xF1, 0x9B, 0xB1, 0xFA, 0x3B, 0xD5, 0x2B, 0xCD,
+  0xEE, 0xD6, 0xC7, 0x7F, 0x1F, 0x4D, 0xD7, 0x1C, 0xF9, 0x7B, 0xE8, 0xF9, 0xE0, 0x0A, 0xB5, 0x8E,
+  0xF0, 0xE2, 0xBD, 0x13, 0x7C, 0x65, 0x9F, 0xF8, 0xFA, 0xF0, 0x9D, 0xC0, 0xEB, 0xFF, 0x99, 0xF0,
+  0x5B, 0xAE, 0x59, 0xD4, 0x1F, 0x32, 0xF6, 0xD9, 0x9F, 0x09, 0xDF, 0xBF, 0x62, 0xC9, 0x64, 0x82,
+  0xA5, 0x7D, 0x66, 0x38, 0xF0, 0x4C, 0x90, 0x04, 0x41, 0xFC, 0x08, 0x79, 0x40, 0xC5, 0xEC, 0x50,
+  0x49, 0x96, 0x25, 0x63, 0xE4, 0x05, 0x2A, 0x1A, 0x23, 0xBD, 0xA1, 0x28, 0x3B, 0xD4, 0x22, 0xC3,
+  0x2E, 0xA2, 0xE9, 0x0B, 0x54, 0x2C, 0x0E, 0xA1, 0x88, 0x6F, 0xAE, 0x8D, 0x2F, 0x32, 0x9C, 0x70,
+  0x6D, 0x67, 0x91, 0xE1, 0x4C, 0xE8, 0xC1, 0x8A, 0x85, 0x9E, 0x21, 0x67, 0x1F, 0xAC, 0xCC, 0xCA,
+  0xB3, 0x3D, 0xD5, 0x49, 0x7C, 0x47, 0x34, 0x98, 0xEE, 0xED, 0xF3, 0xF5, 0xE6, 0x33, 0x27, 0x32,
+  0x0A, 0xC0, 0xA7, 0xB6, 0x9D, 0x4D, 0x01, 0xFB, 0x76, 0x63, 0xC4, 0xFF, 0x3D, 0xAC, 0x92, 0xF6,
+  0xE1, 0x9B, 0x67, 0xB9, 0xBD, 0x2B, 0x6C, 0x87, 0xC3, 0xAE, 0x2C, 0x99, 0x59, 0x60, 0x4B, 0x4F,
+  0x5B, 0x45, 0x17, 0xB1, 0x41, 0x76, 0x25, 0x9A, 0xB6, 0xF6, 0x3B, 0xCF, 0xB8, 0xAE, 0xF6, 0x58,
+  0x60, 0x81, 0x03, 0x11, 0xFA, 0x86, 0x58, 0x30, 0x28, 0xC2, 0x61, 0xA2, 0x73, 0x62, 0xB9, 0x13,
+  0x0E, 0x1B, 0xBB, 0x52, 0x21, 0x42, 0x95, 0x74, 0x85, 0x39, 0xE7, 0x9C, 0x8C, 0xD2, 0x3F, 0x20,
+  0x72, 0xA4, 0xBD, 0xDD, 0xE3, 0x31, 0x6A, 0x2D, 0xE7, 0x19, 0x03, 0xDE, 0x6A, 0x6A, 0xA2, 0x3D,
+  0xEF, 0x90, 0xDE, 0xDB, 0x33, 0x32, 0x36, 0xB9, 0x38, 0x8B, 0x26, 0x8C, 0xF2, 0xC9, 0x86, 0x1F,
+  0x3A, 0x71, 0xB8, 0x09, 0x23, 0xA9, 0x37, 0x9B, 0x3C, 0x3E, 0x3A, 0x47, 0x8E, 0xB2, 0x0C, 0x62,
+  0x88, 0x10, 0xEC, 0x2C, 0x0B, 0x88, 0xC4, 0x2F, 0xB0, 0x04, 0x5A, 0x5B, 0x01, 0x6D, 0x00, 0x08,
+  0x4E, 0x08, 0x97, 0xD1, 0x39, 0x1F, 0x65, 0x30, 0xA1, 0x11, 0x42, 0xDA, 0x88, 0xAC, 0xA9, 0x24,
+  0xE9, 0xEA, 0xED, 0xCA, 0x5A, 0x98, 0x2D, 0x15, 0xD7, 0x86, 0x9A, 0x71, 0xE6, 0xD5, 0x28, 0xB5,
+  0x44, 0x00, 0x8D, 0xEA, 0x8A, 0x7D, 0xE6, 0x3E, 0x15, 0x3E, 0xF3, 0xEA, 0x6C, 0x8E, 0xF8, 0x74,
+  0xAB, 0xB9, 0xEB, 0xB0, 0xE2, 0x25, 0x63, 0x60, 0x65, 0x6B, 0xEC, 0xA9, 0x81, 0xD0, 0x65, 0x83,
+  0xE4, 0x9C, 0x71, 0x84, 0x11, 0xE1, 0x40, 0x9A, 0x01, 0x05, 0x59, 0x40, 0x38, 0x4A, 0xC8, 0x62,
+  0x07, 0xA4, 0x31, 0xF1, 0x1A, 0x10, 0xE4, 0x8E, 0xBD, 0xF8, 0xDA, 0x62, 0x3B, 0xA0, 0x50, 0x34,
+  0x76, 0x46, 0xFC, 0x78, 0xC1, 0x71, 0x03, 0x96, 0xBE, 0x07, 0xD3, 0xB2, 0x48, 0xBE, 0x86, 0x3B,
+  0x8F, 0xC6, 0x0D, 0x6B, 0xB2, 0xFE, 0x9A, 0xEC, 0xCF, 0x36, 0x32, 0x7E, 0xFD, 0xD5, 0xF6, 0xF1,
+  0xD9, 0xD9, 0x17, 0x9E, 0xEB, 0x1F, 0x8F, 0x48, 0x4D, 0x7F, 0x8E, 0x58, 0x37, 0x63, 0x3E, 0x7F,
+  0x7A, 0x7A, 0xFA, 0x0A, 0x23, 0xF3, 0x6A, 0xF1, 0xDB, 0xF9, 0xBE, 0x0C, 0xA1, 0x2A, 0xCC, 0xAB,
+  0x6F, 0xA5, 0x69, 0xF2, 0x73, 0x24, 0x82, 0x6F, 0x2E, 0x40, 0x05, 0xB4, 0x0B, 0x2F, 0x25, 0x09,
+  0x62, 0x61, 0xA0, 0x6F, 0x05, 0x27, 0x5B, 0x88, 0xA8, 0x3B, 0x31, 0x02, 0x4D, 0x85, 0xB8, 0x31,
+  0x9A, 0x84, 0xD7, 0xAA, 0xEF, 0x8B, 0x1D, 0xEF, 0x57, 0x14, 0xE4, 0x2C, 0xBE, 0x3D, 0x3D, 0xC1,
+  0x8F, 0x88, 0xF9, 0xF4, 0x0B, 0xBA, 0xE3, 0x04, 0xFF, 0x61, 0xB9, 0x1D, 0x7E, 0xE8, 0xC5, 0xFB,
+  0xDE, 0x1A, 0xBA, 0xEB, 0x27, 0xCD, 0xD7, 0xE8, 0xD4, 0xF7, 0xF9, 0x35, 0x98, 0x16, 0x2D, 0x80,
+  0x2A, 0xBA, 0x73, 0xE8, 0xBC, 0x80, 0xA8, 0xEE, 0x96, 0xC1, 0x83, 0xC0, 0xFB, 0xCC, 0x8B, 0x7B,
+  0x3E, 0x8A, 0x24, 0x7D, 0xD6, 0x85, 0x3D, 0x5F, 0x14, 0x7E, 0xA0, 0x57, 0x67, 0xA2, 0x4E, 0x34,
+  0xBE, 0x2F, 0x4D, 0x7C, 0x0D, 0xD1, 0xBA, 0x7E, 0x06, 0x89, 0x8B, 0x22, 0x12, 0x8D, 0x2E, 0x11,
+  0x00, 0xF5, 0x65, 0xA8, 0x02, 0xC2, 0x52, 0x8F, 0x44, 0x1E, 0x2B, 0x4E, 0x4D, 0x22, 0x8C, 0x7B,
+  0x52, 0x04, 0x04, 0x87, 0x70, 0xE8, 0x88, 0x36, 0x27, 0x83, 0x4F, 0x10, 0x9C, 0x82, 0x40, 0xE6,
+  0xD6, 0xD3, 0xD5, 0xA8, 0xBC, 0x49, 0x43, 0x1F, 0x5F, 0xA6, 0x70, 0xD9, 0x13, 0x73, 0x45, 0xDA,
+  0xAB, 0x90, 0x1A, 0x4E, 0x85, 0x3D, 0x48, 0x84, 0xC4, 0xB3, 0x10, 0xA3, 0x81, 0x0C, 0xF1, 0x4B,
+  0x31, 0xB9, 0xC5, 0xF0, 0xB4, 0xAA, 0xBE, 0xFA, 0x1C, 0xF7, 0xF3, 0xF0, 0xA3, 0x39, 0x48, 0x91,
+  0xE3, 0x5E, 0xA1, 0x7D, 0x45, 0x37, 0x22, 0xE1, 0x82, 0x31, 0x2F, 0xD4, 0xE1, 0x6A, 0x04, 0x0F,
+  0x5D, 0x02, 0xD4, 0x00, 0xDB, 0xBC, 0x06, 0xB7, 0xD5, 0x39, 0x16, 0x52, 0x62, 0x22, 0x74, 0x5C,
+  0x1F, 0xF3, 0x7D, 0x31, 0xAA, 0x89, 0xE8, 0xE7, 0x88, 0xB6, 0xF2, 0x84, 0x8C, 0xBE, 0x01, 0x19,
+  0xBB, 0x09, 0x19, 0x7B, 0x03, 0x92, 0x32, 0x21, 0x23, 0x06, 0xCD, 0xF8, 0x2F, 0xF6, 0x06, 0x88,
+  0x83, 0x27, 0x8E, 0xDB, 0x6B, 0x3E, 0x02, 0x39, 0x14, 0x4F, 0xDC, 0xAB, 0x8F, 0x34, 0x7F, 0x42,
+  0x2A, 0xA2, 0xBE, 0x2F, 0xBF, 0xFE, 0x2B, 0x9D, 0x8A, 0xC5, 0x5E, 0x3E, 0x47, 0x20, 0x20, 0x04,
+  0xC7, 0xC7, 0xDE, 0x60, 0x0D, 0xFC, 0xD7, 0xE2, 0xC8, 0x17, 0xF2, 0x97, 0xCF, 0x11, 0xF8, 0xFD,
+  0x51, 0xE4, 0x4F, 0x18, 0x7B, 0x9C, 0x3A, 0xE3, 0x8E, 0x68, 0xEC, 0x5F, 0xA5, 0x3D, 0xFA, 0x21,
+  0xDA, 0xA3, 0x1F, 0xA3, 0x3D, 0xFA, 0xCF, 0xD2, 0x1E, 0xFB, 0x10, 0xED, 0xB1, 0x8F, 0xD1, 0x1E,
+  0x7B, 0x93, 0x76, 0x43, 0x7C, 0x22, 0x78, 0x05, 0xA0, 0x1F, 0x46, 0x1D, 0x5E, 0x47, 0xF8, 0x2F,
+  0x4E, 0x94, 0xE1, 0x92, 0x36, 0x74, 0x08, 0xB3, 0x02, 0xCC, 0x66, 0x2E, 0x1D, 0x7C, 0x98, 0xA6,
+  0xA2, 0xE3, 0x52, 0x2A, 0x1A, 0xAC, 0x71, 0xA8, 0x75, 0x21, 0x29, 0xD7, 0x95, 0xC6, 0xB7, 0x4D,
+  0x87, 0xE0, 0xB6, 0x8E, 0x9E, 0xDE, 0xB7, 0x6C, 0xBD, 0xAE, 0xC2, 0xDA, 0x57, 0xEE, 0xAD, 0x89,
+  0x90, 0xBF, 0x74, 0xC6, 0x4D, 0x22, 0x7F, 0x64, 0x20, 0x1E, 0x8D, 0x13, 0x80, 0x2A, 0xD3, 0xE2,
+  0xE7, 0x88, 0x8C, 0xC7, 0xBE, 0xBA, 0x0F, 0x6A, 0x23, 0x4C, 0xE5, 0x39, 0x16, 0x20, 0xBD, 0x4B,
+  0xC3, 0xE8, 0x41, 0xB9, 0x50, 0x86, 0xEF, 0x4F, 0x42, 0x9D, 0xE2, 0xB8, 0x32, 0x8A, 0xAB, 0x57,
+  0x67, 0x1E, 0x22, 0xEA, 0x31, 0xBC, 0x82, 0xA9, 0x18, 0x98, 0x44, 0x58, 0x0A, 0x5A, 0x41, 0x8E,
+  0xAF, 0xCF, 0x46, 0x8F, 0x63, 0xFA, 0x79, 0x1D, 0xB8, 0xA0, 0xCC, 0x2E, 0x8D, 0xFB, 0x9E, 0x4F,
+  0xE8, 0xA6, 0x8C, 0xD9, 0x2D, 0x61, 0x16, 0x29, 0xD6, 0xBD, 0x57, 0x4C, 0x4A, 0x82, 0x24, 0x05,
+  0xD5, 0x12, 0x1C, 0x4B, 0x73, 0x38, 0x27, 0xFD, 0x5A, 0x9F, 0xDC, 0x63, 0x67, 0xBF, 0x53, 0x2D,
+  0x95, 0xFA, 0x44, 0x89, 0x83, 0xC3, 0x2F, 0xB2, 0x1C, 0x0C, 0x68, 0xDE, 0xC3, 0x4E, 0xC2, 0xC1,
+  0x0E, 0x43, 0x5C, 0x11, 0xB4, 0xC5, 0x05, 0x4B, 0x80, 0xBD, 0x19, 0x4A, 0x60, 0x46, 0xBC, 0xFA,
+  0xDA, 0x32, 0x10, 0xCD, 0x4E, 0x7D, 0x04, 0x0C, 0x1A, 0x78, 0x8E, 0xD9, 0xBC, 0xFA, 0x4C, 0x47,
+  0xDE, 0x8A, 0xD7, 0xC2, 0xF8, 0x8D, 0x33, 0x7F, 0x04, 0xC0, 0x76, 0xFE, 0x17, 0x9F, 0x6B, 0x80,
+  0xB7, 0x25, 0x1E, 0xFF, 0x25, 0x7F, 0xF1, 0xB8, 0x64, 0x1F, 0x3E, 0x5F, 0xAF, 0x37, 0x87, 0x6A,
+  0x80, 0x5A, 0x26, 0xDC, 0x6B, 0xF3, 0xD6, 0x38, 0x34, 0x63, 0xEC, 0x85, 0x01, 0x76, 0x28, 0xC3,
+  0xD5, 0x08, 0xF2, 0x50, 0xBA, 0x8D, 0x63, 0x5E, 0xE8, 0xE0, 0x3D, 0x9E, 0x63, 0xD5, 0x30, 0xB1,
+  0xAF, 0x38, 0x96, 0x34, 0xD3, 0x12, 0xB4, 0x8A, 0x32, 0x49, 0x3B, 0x63, 0xCA, 0x35, 0x5A, 0x90,
+  0x8D, 0x5D, 0x02, 0xA2, 0x80, 0x92, 0x09, 0x56, 0x22, 0x84, 0x53, 0xFB, 0x50, 0xA4, 0x90, 0x79,
+  0x3D, 0x5F, 0x1D, 0x34, 0x9C, 0x74, 0x66, 0x03, 0x9C, 0xFD, 0x63, 0x7B, 0xDE, 0x47, 0xA9, 0x37,
+  0x58, 0xFC, 0xDD, 0xBC, 0xC0, 0x2A, 0x1B, 0x89, 0xD5, 0xEA, 0x39, 0x2A, 0x42, 0x27, 0xF6, 0x8C,
+  0x43, 0x1E, 0xE4, 0x37, 0x47, 0x13, 0x44, 0x85, 0x72, 0x46, 0x18, 0x70, 0x1C, 0x36, 0x3E, 0x7B,
+  0x9E, 0x3D, 0xE8, 0xB5, 0x1C, 0x03, 0x0B, 0xF1, 0x72, 0x14, 0xD8, 0xBA, 0xE0, 0xA6, 0x69, 0x34,
+  0xB3, 0xC2, 0x77, 0xDC, 0x88, 0xDF, 0x89, 0x73, 0xB1, 0x82, 0xDA, 0x9B, 0x34, 0xBD, 0xA2, 0x84,
+  0x99, 0x24, 0xC8, 0x3C, 0xD0, 0xF0, 0x1E, 0xBD, 0x57, 0x23, 0x74, 0x24, 0xC2, 0xC7, 0x4B, 0x34,
+  0x22, 0xC8, 0x87, 0x7B, 0x16, 0x1D, 0xB7, 0x35, 0xEE, 0x5C, 0xA8, 0x2B, 0xB4, 0x9B, 0x79, 0xE3,
+  0xE9, 0x83, 0x06, 0x84, 0x07, 0xF8, 0x2E, 0xA0, 0x68, 0xDE, 0x70, 0x30, 0xC8, 0xC6, 0x57, 0x70,
+  0x3B, 0xD0, 0x4B, 0x82, 0xA5, 0xB4, 0x7A, 0x14, 0x99, 0x4B, 0xF4, 0x78, 0xAE, 0xC2, 0xC3, 0xFD,
+  0xFA, 0x2D, 0x0C, 0x75, 0x5C, 0x11, 0x0E, 0x28, 0x8C, 0x2E, 0xCD, 0x5F, 0x46, 0x09, 0x23, 0x94,
+  0x22, 0x6F, 0xF0, 0x31, 0x77, 0xCC, 0x23, 0xF1, 0x47, 0xFE, 0x53, 0xC0, 0xEF, 0x50, 0xCE, 0xFE,
+  0x47, 0xFB, 0x2D, 0x44, 0xA3, 0x2A, 0x87, 0x6B, 0xF0, 0x79, 0x21, 0xDB, 0x77, 0xD8, 0x94, 0x6C,
+  0xC8, 0xF5, 0x2C, 0x2E, 0xCE, 0xA3, 0x2F, 0xE3, 0x9E, 0xA2, 0x71, 0xEB, 0xCA, 0x50, 0xC7, 0xA6,
+  0x6E, 0x7D, 0x25, 0x3C, 0x08, 0xC9, 0x1D, 0xAB, 0x6C, 0xC0, 0xEF, 0xD4, 0xC6, 0xE8, 0x3A, 0xAD,
+  0x13, 0xD6, 0xD6, 0x53, 0x5B, 0x1C, 0x48, 0x4B, 0xE8, 0xB6, 0x3A, 0x41, 0xAE, 0x00, 0xF0, 0xA7,
+  0x71, 0xEC, 0xDC, 0x26, 0x75, 0xD7, 0xDA, 0xED, 0x1E, 0x55, 0x1E, 0xCD, 0x11, 0x69, 0x1E, 0xC5,
+  0x90, 0x3E, 0x43, 0x69, 0x20, 0xFA, 0xAA, 0xE8, 0x97, 0xA3, 0xFA, 0x16, 0xCC, 0xF9, 0xF6, 0x6C,
+  0x5B, 0xCC, 0xE3, 0x9F, 0xEF, 0x82, 0x3A, 0x5F, 0xF2, 0x44, 0x47, 0xC7, 0x1E, 0x89, 0xD7, 0x2F,
+  0xC4, 0x77, 0xC7, 0x32, 0xC3, 0x4B, 0x94, 0xF8, 0x71, 0x0B, 0xFC, 0x72, 0x53, 0xF6, 0x67, 0xE0,
+  0x05, 0x0E, 0x75, 0x1B, 0x23, 0xC9, 0x1B, 0xD5, 0x34, 0xBE, 0x4E, 0x4F, 0xDE, 0xAA, 0x87, 0xD2,
+  0x2E, 0x63, 0x78, 0xEF, 0x6A, 0xAC, 0x3E, 0x61, 0x7D, 0x02, 0xC1, 0xBF, 0xEB, 0xF6, 0xA9, 0xD7,
+  0x00, 0x8C, 0x19, 0x27, 0xDE, 0x7F, 0xE9, 0xF6, 0x0D, 0x24, 0xC6, 0xE1, 0x5E, 0x7C, 0xFF, 0x1D,
+  0x1D, 0xBF, 0xC4, 0xBE, 0xFC, 0xF3, 0x6D, 0xB1, 0x71, 0xA8, 0x58, 0xB8, 0x9A, 0x3C, 0x52, 0x62,
+  0xF6, 0xEC, 0x54, 0x26, 0x89, 0xFE, 0xDC, 0xC9, 0x84, 0xD9, 0x1B, 0x17, 0x12, 0xE8, 0x8F, 0x2D,
+  0x01, 0x46, 0x25, 0x6E, 0x37, 0x8E, 0x67, 0xD0, 0x1F, 0x5B, 0xE3, 0x34, 0x49, 0xFC, 0xF8, 0x78,
+  0xDA, 0x2B, 0x4C, 0xDA, 0x13, 0x5F, 0x6D, 0xD1, 0x8A, 0xA3, 0x70, 0x18, 0x65, 0xC8, 0xAD, 0x2D,
+  0xFD, 0xE5, 0xAA, 0xC7, 0x7B, 0xBA, 0x8E, 0x94, 0x97, 0x57, 0x03, 0xC0, 0xA2, 0x50, 0xF6, 0xCA,
+  0x36, 0x21, 0x63, 0xE2, 0x99, 0xDC, 0xBA, 0x3E, 0xF3, 0x84, 0x35, 0xA0, 0xF1, 0x26, 0x01, 0xAC,
+  0xCB, 0xA3, 0xD5, 0x8F, 0x8D, 0x13, 0x6A, 0x09, 0x4B, 0xAB, 0xC8, 0xA0, 0x41, 0xE9, 0x0A, 0x5C,
+  0x6A, 0x42, 0x48, 0xCA, 0x50, 0x5B, 0x09, 0xB2, 0x83, 0xD1, 0xFA, 0xD8, 0x22, 0x19, 0xDA, 0xFA,
+  0xAC, 0xFE, 0x5C, 0x75, 0xD6, 0x0B, 0x10, 0xA6, 0x21, 0x1F, 0x83, 0xB9, 0x51, 0xE3, 0x3C, 0xDA,
+  0x74, 0xB1, 0x6D, 0x90, 0xFE, 0x73, 0x9B, 0x80, 0x7F, 0xAF, 0xC2, 0xE8, 0xDB, 0x8F, 0xF7, 0x80,
+  0x4D, 0xC9, 0xB9, 0x78, 0x02, 0x12, 0x0C, 0x43, 0x83, 0x84, 0x3F, 0xB2, 0xC7, 0xCA, 0xCF, 0xC0,
+  0x80, 0x96, 0x3A, 0x50, 0x55, 0xDA, 0xD4, 0x10, 0x06, 0x9A, 0xA6, 0x51, 0x62, 0x6B, 0x83, 0x37,
+  0x0E, 0xDD, 0xD7, 0x6B, 0xEC, 0x4F, 0x1A, 0xF8, 0x20, 0x0D, 0x96, 0xC1, 0xC5, 0x8D, 0xD9, 0x10,
+  0x4A, 0x0C, 0xF1, 0x48, 0xCE, 0xF1, 0x82, 0x53, 0x7D, 0xE7, 0x3E, 0xCF, 0x06, 0x14, 0xF2, 0x0C,
+  0xAD, 0x4A, 0x28, 0x18, 0x01, 0x07, 0x13, 0x30, 0xD7, 0xCC, 0x34, 0x93, 0x8D, 0x51, 0x55, 0xD5,
+  0xA8, 0x46, 0x8E, 0x8F, 0xFD, 0x7E, 0x8F, 0x89, 0xF5, 0xD7, 0x5F, 0xCD, 0x5F, 0x4E, 0x8B, 0x7A,
+  0xE1, 0x4E, 0xB8, 0xDD, 0x29, 0xB6, 0x10, 0x46, 0x97, 0x61, 0x73, 0x0D, 0xFB, 0x72, 0xBB, 0x55,
+  0x53, 0x8E, 0x56, 0x72, 0x08, 0xF0, 0xF8, 0xA9, 0x85, 0x5A, 0xBF, 0xDD, 0x0A, 0xE3, 0x03, 0x3C,
+  0xE6, 0x3D, 0x71, 0xB4, 0xEC, 0x20, 0xA1, 0x9E, 0x7E, 0x0A, 0xF2, 0x51, 0xC2, 0xA2, 0x74, 0xBE,
+  0x9F, 0x82, 0x91, 0x84, 0x8B, 0xBD, 0x5E, 0xBB, 0x77, 0x87, 0x7D, 0x70, 0x51, 0xA1, 0xE9, 0xB3,
+  0xB5, 0x7D, 0x71, 0xDD, 0xD9, 0x6A, 0xE3, 0x9C, 0x43, 0x78, 0x03, 0x8E, 0xAA, 0x81, 0xF3, 0xD1,
+  0x76, 0x1E, 0x98, 0x74, 0xCA, 0x89, 0xD9, 0x16, 0x5A, 0x61, 0x6E, 0x29, 0x06, 0x2E, 0xEE, 0x4F,
+  0xC8, 0xE8, 0xC1, 0x41, 0x59, 0xAB, 0x58, 0x2C, 0xFC, 0x31, 0xEC, 0x14, 0xB2, 0x83, 0x22, 0x76,
+  0x32, 0x60, 0xF8, 0x01, 0x16, 0xD0, 0xC5, 0x67, 0x21, 0x6B, 0x1F, 0xBC, 0x9A, 0x5C, 0xBB, 0x73,
+  0xA8, 0x73, 0x2F, 0x1F, 0xEF, 0x0A, 0x1A, 0x7A, 0x17, 0x7B, 0x9A, 0xD3, 0x88, 0x0E, 0xE2, 0x25,
+  0xF6, 0xFB, 0x2C, 0x2B, 0x6B, 0x23, 0xF2, 0x7C, 0x40, 0xF4, 0xD3, 0x45, 0x69, 0x42, 0x52, 0x3E,
+  0x39, 0xF7, 0x03, 0xD1, 0xC4, 0x3B, 0xD7, 0xE9, 0xF9, 0x42, 0x58, 0xE0, 0x11, 0x9F, 0xFC, 0x71,
+  0x77, 0x65, 0xBC, 0xFB, 0xE0, 0xEE, 0xE8, 0x07, 0xD4, 0xBA, 0x10, 0x01, 0x11, 0x00, 0xE8, 0x75,
+  0x0E, 0xFB, 0x0C, 0xE1, 0x02, 0xF3, 0xD5, 0x0E, 0x7C, 0xFF, 0x16, 0x11, 0xB2, 0xBF, 0x08, 0xBC,
+  0xB9, 0x82, 0x9E, 0xA1, 0x5E, 0x34, 0x60, 0x0D, 0x74, 0x2E, 0x31, 0x2B, 0x01, 0x88, 0xDD, 0x39,
+  0x54, 0xA7, 0x90, 0x29, 0xD0, 0x3E, 0xC1, 0x1E, 0xF1, 0x69, 0x3E, 0x4C, 0xF1, 0x02, 0x41, 0x04,
+  0xFC, 0x66, 0x4E, 0xED, 0x8D, 0x55, 0x6D, 0x26, 0xC2, 0x7E, 0x57, 0x4D, 0xE4, 0xAF, 0xA4, 0xDF,
+  0x7A, 0x8B, 0xC4, 0x42, 0x1C, 0x96, 0x36, 0x1E, 0x07, 0x24, 0x8D, 0x47, 0x44, 0x8C, 0x1E, 0xCF,
+  0x2D, 0xD7, 0xAA, 0x24, 0x5A, 0xD7, 0x59, 0x04, 0xD3, 0x2D, 0xC7, 0x5B, 0x98, 0xC8, 0x23, 0x7E,
+  0x53, 0xDA, 0xEF, 0xCF, 0xAD, 0x71, 0xEC, 0xF6, 0x3D, 0xBC, 0x5E, 0x1A, 0x70, 0x26, 0x05, 0xD6,
+  0xC8, 0xDE, 0xCD, 0x67, 0x73, 0x9E, 0xAD, 0x0C, 0x2F, 0x54, 0x95, 0xAD, 0x1B, 0xF1, 0xC7, 0xDF,
+  0x3D, 0x09, 0x86, 0xCA, 0xFB, 0xDF, 0x9C, 0x82, 0x1B, 0x83, 0xBD, 0xB7, 0x14, 0x7E, 0x76, 0x5E,
+  0x8C, 0xC1, 0x3A, 0x67, 0xC5, 0xBA, 0x2E, 0xE1, 0x41, 0x85, 0x87, 0x06, 0xBE, 0x29, 0x29, 0xE7,
+  0xF5, 0x71, 0x09, 0x0E, 0x71, 0x45, 0xB8, 0xDA, 0xFF, 0xA3, 0x59, 0x9D, 0x14, 0x7B, 0x2F, 0x4E,
+  0x35, 0x0A, 0xC1, 0x89, 0xAF, 0x56, 0x1D, 0x7A, 0xCC, 0x08, 0xE9, 0x52, 0x27, 0x84, 0xDD, 0x61,
+  0x73, 0x7B, 0x55, 0xE7, 0x74, 0xAF, 0xFF, 0xD1, 0xD8, 0x23, 0xAF, 0x0C, 0x9A, 0x8D, 0x73, 0x9F,
+  0x18, 0xFC, 0x8F, 0x56, 0xB6, 0x59, 0x7C, 0x0B, 0x05, 0x7E, 0x86, 0xFC, 0x4D, 0x1C, 0xD7, 0x94,
+  0x5F, 0x6A, 0x9D, 0xB4, 0x5F, 0xCA, 0xAD, 0x88, 0x17, 0x25, 0xB2, 0x47, 0xB4, 0x72, 0x2F, 0xB2,
+  0x70, 0xA6, 0xC0, 0xB1, 0x24, 0x9A, 0x50, 0xD6, 0xC3, 0x41, 0x30, 0x8A, 0x5C, 0x4A, 0x7F, 0x78,
+  0x75, 0x13, 0xD6, 0xA4, 0x86, 0xB4, 0x87, 0x9E, 0x33, 0x0D, 0x2D, 0x1D, 0xDA, 0x34, 0xF2, 0x85,
+  0xD5, 0xDD, 0xD2, 0xE7, 0xF1, 0x88, 0xC3, 0x79, 0x71, 0x99, 0x77, 0xCC, 0xBF, 0x9A, 0xB8, 0x1A,
+  0xD5, 0xEE, 0xB0, 0x5A, 0xC0, 0xC8, 0xFE, 0xC0, 0x8F, 0xE6, 0xB9, 0x0B, 0x63, 0x5E, 0x85, 0x14,
+  0xF1, 0xCD, 0xC3, 0xE9, 0xC2, 0xB8, 0xCD, 0x3B, 0xEB, 0x5E, 0x6C, 0xB3, 0x63, 0x98, 0x84, 0xC3,
+  0x16, 0xEF, 0x2C, 0x00, 0xE3, 0x26, 0x88, 0x79, 0x3D, 0xDC, 0x45, 0x5F, 0xBE, 0xDD, 0x68, 0xF7,
+  0xAE, 0x08, 0x34, 0x4A, 0x63, 0x9E, 0xA5, 0xDE, 0x24, 0x1A, 0xF8, 0xAD, 0x2B, 0xE7, 0x77, 0x88,
+  0x34, 0x90, 0xD8, 0xA8, 0x3C, 0x83, 0x9C, 0x03, 0x78, 0x07, 0xAC, 0x73, 0x23, 0x96, 0x53, 0xB1,
+  0xEB, 0xE4, 0xFB, 0x19, 0x83, 0xF5, 0x21, 0x25, 0x7A, 0x43, 0x43, 0xBC, 0x57, 0x93, 0xDE, 0x68,
+  0x60, 0xB0, 0xD3, 0xE1, 0x06, 0x38, 0x06, 0x5B, 0x96, 0x34, 0xEC, 0xD0, 0x7E, 0xB5, 0x35, 0x71,
+  0xAE, 0x04, 0x5B, 0xC5, 0xE3, 0x0D, 0x69, 0xC4, 0xD7, 0xAA, 0x4C, 0x75, 0x01, 0xBD, 0x05, 0xC7,
+  0x14, 0x66, 0x5B, 0xE5, 0x06, 0x94, 0x47, 0xE4, 0xBB, 0xB4, 0xE8, 0xD6, 0xCD, 0xEA, 0x2F, 0xD0,
+  0x8F, 0xBA, 0x59, 0xF9, 0xD9, 0xD8, 0x1E, 0xF4, 0xAE, 0x8E, 0xDD, 0x47, 0x1D, 0xBB, 0x87, 0x3A,
+  0x76, 0x1F, 0x35, 0x75, 0x1F, 0x35, 0x75, 0x0F, 0x35, 0x65, 0xA2, 0x3E, 0xDF, 0x4F, 0x3E, 0xDF,
+  0x4C, 0x25, 0xBC, 0xC6, 0x18, 0xF2, 0x2A, 0x8D, 0x79, 0x96, 0x7A, 0x2F, 0x07, 0x03, 0xBF, 0xF5,
+  0x32, 0xC1, 0x9D, 0xE5, 0x60, 0x20, 0xB1, 0x2D, 0x87, 0x33, 0x88, 0xED, 0x71, 0x8F, 0x4F, 0xE6,
+  0x74, 0x7A, 0x50, 0x8F, 0xDE, 0x3D, 0x89, 0xA1, 0xB3, 0x28, 0x71, 0xF2, 0xE3, 0x84, 0xB4, 0xA0,
+  0xB8, 0xA9, 0xDE, 0xC4, 0x3C, 0x7D, 0x21, 0x5A, 0x92, 0x31, 0x5E, 0xDF, 0xED, 0xB5, 0x89, 0xD4,
+  0x28, 0xBA, 0x42, 0xC5, 0x1B, 0xBB, 0x51, 0x26, 0x5D, 0x22, 0x44, 0x2B, 0xA0, 0x95, 0x89, 0x56,
+  0x5D, 0x00, 0xCD, 0x18, 0x67, 0x14, 0xA2, 0xC7, 0x25, 0xF7, 0x00, 0xB5, 0x63, 0x09, 0x01, 0x6D,
+  0x0A, 0xCE, 0x01, 0xB1, 0xE7, 0x34, 0xD8, 0x8E, 0x20, 0xFF, 0xFD, 0xDF, 0xB8, 0x18, 0xCE, 0xD1,
+  0xBF, 0xFF, 0xFB, 0xD1, 0x77, 0xF6, 0x7C, 0x0D, 0x8E, 0xE7, 0xA7, 0x79, 0x48, 0xD8, 0xA0, 0xDA,
+  0x2C, 0xF6, 0x3B, 0xD9, 0xD6, 0x95, 0x1C, 0xB8, 0xAA, 0xBF, 0xE0, 0xDC, 0xC9, 0xCD, 0xEA, 0xCF,
+  0x46, 0xEE, 0xE4, 0x1C, 0x68, 0x9E, 0x7D, 0x6B, 0x8B, 0xBD, 0x30, 0x1E, 0x33, 0xD2, 0x4C, 0xB7,
+  0x4C, 0x8B, 0x57, 0x2A, 0xFE, 0xD1, 0x9E, 0xFD, 0xBA, 0x07, 0xEB, 0x95, 0xFD, 0x87, 0xC0, 0x46,
+  0xA7, 0x1E, 0x16, 0xD3, 0x45, 0x3D, 0x34, 0x45, 0x82, 0xEA, 0xB3, 0x32, 0x3B, 0xE7, 0x64, 0x8E,
+  0x57, 0x5B, 0x2F, 0xB1, 0x73, 0xB6, 0x70, 0xEA, 0x16, 0xCF, 0x9E, 0x4C, 0xF5, 0x78, 0x77, 0xFA,
+  0x19, 0xC7, 0x86, 0xCA, 0x4F, 0xCD, 0x7F, 0x0C, 0xED, 0x4C, 0xE0, 0x0A, 0x34, 0x37, 0x82, 0x8A,
+  0x45, 0xE0, 0xE2, 0x25, 0xFE, 0x67, 0x6C, 0xC3, 0x5F, 0x77, 0xE4, 0xEC, 0x39, 0x11, 0x53, 0xBE,
+  0x9C, 0x51, 0xBB, 0xE7, 0xFB, 0x18, 0xD7, 0xE7, 0xF8, 0xCF, 0x4F, 0xE7, 0x04, 0x2E, 0x3E, 0x2D,
+  0xF1, 0xE4, 0xB5, 0x1D, 0xF0, 0x99, 0x88, 0x1A, 0x29, 0x96, 0x1F, 0xAE, 0x28, 0xF9, 0x12, 0x32,
+  0xFE, 0xF9, 0xE7, 0xC3, 0x47, 0x23, 0x46, 0xA7, 0x7F, 0x7E, 0xD7, 0x97, 0xBE, 0x0E, 0x37, 0x0C,
+  0xBB, 0xE4, 0x09, 0xF4, 0x09, 0x19, 0x49, 0xB4, 0x32, 0x6F, 0xD5, 0xBE, 0x3B, 0xA2, 0xF6, 0x9E,
+  0x10, 0x37, 0x49, 0x97, 0x48, 0xD3, 0xF3, 0xAE, 0xE5, 0xDF, 0xC4, 0x78, 0x5B, 0x8E, 0xC6, 0x33,
+  0x73, 0x17, 0x58, 0x28, 0x92, 0x30, 0x54, 0x81, 0x82, 0xB3, 0xD6, 0x21, 0x82, 0xD1, 0x15, 0xC5,
+  0xBA, 0x4C, 0x8E, 0x37, 0x30, 0xEE, 0x3C, 0x2A, 0xF3, 0xBE, 0x9B, 0xA8, 0xC6, 0x1E, 0x8D, 0xED,
+  0x5D, 0x8E, 0xAB, 0x2B, 0x10, 0x1E, 0xCF, 0x77, 0x38, 0xAE, 0x43, 0xA0, 0xB3, 0x26, 0x50, 0x2D,
+  0x01, 0x9E, 0xBF, 0xA7, 0xBC, 0x6C, 0x47, 0x13, 0x90, 0xDE, 0xB0, 0x23, 0x30, 0x74, 0xE2, 0x1B,
+  0xF0, 0xE7, 0x2D, 0xEC, 0x33, 0x34, 0x01, 0xC1, 0x2F, 0x7D, 0x87, 0xF1, 0x96, 0x5F, 0x78, 0x4E,
+  0x33, 0x9B, 0x25, 0xDE, 0xFF, 0xCD, 0x9B, 0x6F, 0x07, 0xBD, 0x79, 0x30, 0xDF, 0x86, 0xC3, 0xAE,
+  0x43, 0xDF, 0x38, 0x39, 0x8D, 0x48, 0x37, 0xC9, 0x76, 0x80, 0x05, 0x6C, 0xCC, 0x84, 0xF6, 0x22,
+  0xE0, 0x7D, 0x75, 0xCB, 0x7A, 0xAD, 0x04, 0x1D, 0xC5, 0x23, 0xF1, 0x51, 0xBC, 0xDF, 0xA1, 0x07,
+  0xF2, 0x6C, 0x9B, 0x89, 0x47, 0x18, 0x48, 0x94, 0xA0, 0x20, 0xB2, 0x01, 0x12, 0x47, 0x11, 0xBF,
+  0xF8, 0xDC, 0x49, 0x3D, 0xAF, 0x4C, 0xAD, 0xC7, 0x39, 0x45, 0xB7, 0xEA, 0xF3, 0x02, 0x23, 0x2E,
+  0x4C, 0x85, 0x5D, 0x41, 0xA9, 0x35, 0xBE, 0xCF, 0x38, 0x3C, 0x53, 0x7F, 0x5E, 0x79, 0xE2, 0x9F,
+  0xEC, 0x1F, 0x6A, 0xF6, 0x37, 0x29, 0x70, 0xBB, 0x33, 0x34, 0x0F, 0x14, 0x2D, 0xE0, 0x1B, 0xAC,
+  0x80, 0xA9, 0x83, 0xA1, 0x16, 0x87, 0xE6, 0x60, 0x8E, 0x62, 0x7E, 0x74, 0x66, 0xEA, 0xFC, 0xE0,
+  0x39, 0xB6, 0x1F, 0x3B, 0x9A, 0xC3, 0x2F, 0x95, 0xFB, 0x1E, 0x6D, 0x1A, 0xEA, 0x6A, 0xFB, 0xD2,
+  0x9C, 0x61, 0x74, 0xDD, 0x1E, 0x9F, 0x9A, 0xC3, 0x82, 0x14, 0xB8, 0x26, 0xC3, 0xBE, 0xA9, 0x89,
+  0x68, 0x71, 0x6D, 0x72, 0xDA, 0xB2, 0xB3, 0x7D, 0x58, 0xD3, 0x71, 0x77, 0x83, 0x5E, 0x9C, 0x23,
+  0xBD, 0xA3, 0x07, 0xCF, 0xF6, 0xE7, 0x3C, 0xCC, 0xCE, 0x7A, 0xA6, 0x17, 0x3D, 0x8B, 0x72, 0x6F,
+  0xED, 0x5F, 0x8D, 0xEC, 0xD6, 0x73, 0xC9, 0x37, 0x59, 0x60, 0xDD, 0x12, 0x33, 0xBA, 0x34, 0x5E,
+  0x3A, 0xF1, 0x3B, 0xBC, 0x3D, 0x94, 0xD0, 0xB1, 0xBF, 0x8D, 0x10, 0x24, 0xFC, 0xAF, 0xA8, 0xCC,
+  0x78, 0x66, 0x86, 0x3E, 0x04, 0x9E, 0xA0, 0x88, 0x87, 0x2E, 0xAF, 0xCE, 0xE0, 0xAF, 0x5B, 0xFD,
+  0x19, 0x27, 0x31, 0xBD, 0xE6, 0xC4, 0xB9, 0xA5, 0xEC, 0xB9, 0x9D, 0x8C, 0x06, 0x62, 0xD2, 0x79,
+  0x33, 0x9D, 0x6B, 0xDC, 0x61, 0xC4, 0x77, 0x30, 0xCC, 0xA6, 0x6B, 0x09, 0x12, 0xE5, 0xFF, 0xD5,
+  0x4A, 0x34, 0x5D, 0x5B, 0x5B, 0x33, 0x27, 0xAE, 0xA2, 0x07, 0x91, 0x11, 0xE8, 0xB5, 0x37, 0x2E,
+  0xB2, 0x46, 0xCE, 0x19, 0x23, 0x46, 0x72, 0x3B, 0x3F, 0xDA, 0xB2, 0x9B, 0x4E, 0x47, 0xE4, 0x6F,
+  0x4E, 0x94, 0xF9, 0x43, 0x10, 0x9B, 0x00, 0xB4, 0x95, 0x04, 0x69, 0xF0, 0x77, 0xDA, 0xFD, 0x01,
+  0x2C, 0x31, 0x54, 0x99, 0xFA, 0x4C, 0x7C, 0x27, 0xFC, 0xE6, 0x76, 0xF5, 0xD3, 0xE0, 0x28, 0x03,
+  0x3F, 0x6C, 0x42, 0xCB, 0x32, 0x54, 0xE4, 0x18, 0x59, 0xE4, 0xF0, 0xB4, 0xDF, 0xEF, 0x9F, 0xA0,
+  0x00, 0x09, 0x4F, 0xBA, 0x02, 0x59, 0x86, 0x0E, 0x19, 0xB2, 0x7E, 0xB4, 0x55, 0x85, 0x46, 0xF2,
+  0x8C, 0xC7, 0x83, 0xF7, 0x89, 0xBD, 0x32, 0x70, 0x6F, 0xF1, 0x40, 0x94, 0xD0, 0xEB, 0x11, 0x68,
+  0x4F, 0x02, 0xD1, 0x1D, 0xB6, 0xDE, 0x75, 0x86, 0x65, 0x0B, 0x4E, 0x11, 0x8C, 0x15, 0x6B, 0x0E,
+  0xC2, 0x72, 0xEF, 0xCC, 0xF6, 0x80, 0x0D, 0x13, 0x3D, 0x80, 0x36, 0xE8, 0xA1, 0x7B, 0xB5, 0x04,
+  0xBF, 0xFB, 0xF0, 0x34, 0xB8, 0xCF, 0x65, 0x28, 0xB8, 0x45, 0xC0, 0xE5, 0xB8, 0xBC, 0x45, 0x95,
+  0xAA, 0x33, 0x0C, 0x50, 0xD5, 0x85, 0x8E, 0xDD, 0xBC, 0x37, 0x93, 0x80, 0xEF, 0xF4, 0x02, 0x55,
+  0x43, 0x1C, 0x09, 0xFF, 0xA5, 0x2B, 0xBF, 0x3B, 0x3F, 0x60, 0x53, 0x99, 0x5E, 0x7B, 0xE3, 0xB6,
+  0x17, 0xD2, 0xED, 0xC5, 0x03, 0x7C, 0x30, 0xE8, 0x4E, 0x92, 0xCA, 0xEB, 0x24, 0x93, 0xDF, 0xBA,
+  0x65, 0xE8, 0xA8, 0xCB, 0x9B, 0x7B, 0xEF, 0x1F, 0xDB, 0xE2, 0xF7, 0x20, 0xC7, 0xB4, 0xB1, 0xE6,
+  0x33, 0xF0, 0xF8, 0xB5, 0x70, 0xAF, 0x7E, 0x2E, 0xBB, 0xFB, 0xC6, 0x6E, 0x35, 0xB4, 0x6D, 0x7E,
+  0xFC, 0x54, 0xBC, 0x1F, 0x5A, 0x38, 0x3F, 0x7A, 0xAD, 0xDF, 0xEF, 0x30, 0x64, 0xB6, 0xD3, 0x09,
+  0x67, 0x66, 0xB8, 0x5E, 0x6B, 0x3A, 0xDF, 0xFC, 0xC6, 0xCF, 0x81, 0x40, 0xE2, 0xB3, 0x9A, 0xA6,
+  0x70, 0x73, 0x5D, 0x03, 0x01, 0xBF, 0x71, 0x58, 0xCD, 0xFF, 0x78, 0xFD, 0x04, 0xD0, 0x9B, 0x50,
+  0xAC, 0xFF, 0xF1, 0x56, 0x2E, 0xC4, 0x69, 0xB7, 0xCF, 0xCF, 0xD7, 0x05, 0xEC, 0x84, 0x85, 0x2E,
+  0x9D, 0xFD, 0x46, 0x50, 0xDE, 0x0A, 0xDD, 0xEB, 0xC0, 0x41, 0xE0, 0xDD, 0xF1, 0xA2, 0xFF, 0x3A,
+  0x5E, 0xF4, 0xFF, 0x03, 0xF1, 0xA2, 0x23, 0x24, 0xB4, 0xE2, 0x44, 0x8F, 0xA1, 0x78, 0x1C, 0x83,
+  0xB8, 0xCC, 0xD8, 0xCF, 0xD2, 0xF3, 0xB6, 0xF2, 0xF5, 0x3B, 0xE3, 0x4B, 0x6C, 0x65, 0xEC, 0x24,
+  0x7B, 0x2B, 0x66, 0x57, 0x50, 0xFA, 0x9F, 0x53, 0xCD, 0xBF, 0xBF, 0x41, 0xAE, 0x53, 0x73, 0x0F,
+  0x07, 0xFE, 0x8F, 0xA8, 0x5A, 0xD7, 0xA8, 0xFE, 0x9F, 0x51, 0xB6, 0x2E, 0xBA, 0xFE, 0x59, 0x75,
+  0xEB, 0xEC, 0xCC, 0xAD, 0x70, 0xAF, 0xCE, 0xDC, 0x47, 0xCC, 0x73, 0xF0, 0xF8, 0xE4, 0xFC, 0x97,
+  0xFF, 0x01, 0xF3, 0x1D, 0x3A, 0x4F, 0x39, 0x75, 0x00, 0x00
+};
+
+#endif
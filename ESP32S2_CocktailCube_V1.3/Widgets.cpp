@@ -0,0 +1,848 @@
+/*
+ * Includes retained display widgets with damage tracking
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "Widgets.h"
+
+//===============================================================
+// Constants
+//===============================================================
+static const char* TAG = "widgets";
+
+//===============================================================
+// Global variables
+//===============================================================
+// Compose buffer for icons (Display is only used from one task)
+static uint16_t IconBuffer[WIDGET_MAXICONSIZE * WIDGET_MAXICONSIZE];
+
+//===============================================================
+// Forgets the last rendered state
+//===============================================================
+void Widget::Invalidate()
+{
+  _isRendered = false;
+  _isRepaint = false;
+  _isDirty = true;
+}
+
+//===============================================================
+// Draws the widget completely on the next render
+//===============================================================
+void Widget::Repaint()
+{
+  _isRepaint = true;
+  _isDirty = true;
+}
+
+//===============================================================
+// Shows or hides the widget
+//===============================================================
+void Widget::SetVisible(bool isVisible)
+{
+  if (_isVisible != isVisible)
+  {
+    _isVisible = isVisible;
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Returns the area which will be written by the next render
+//===============================================================
+DamageRect Widget::GetDamage()
+{
+  if (!_isDirty)
+  {
+    return DamageRect();
+  }
+
+  // Hidden widgets only clear their last rendered area
+  if (!_isVisible)
+  {
+    return _isRendered ? _bounds : DamageRect();
+  }
+
+  return GetDrawArea();
+}
+
+//===============================================================
+// Renders the widget if dirty
+//===============================================================
+void Widget::Render(Adafruit_SPITFT* tft)
+{
+  if (!_isDirty)
+  {
+    return;
+  }
+
+  if (_isVisible)
+  {
+    Draw(tft);
+    _isRendered = true;
+  }
+  else if (_isRendered)
+  {
+    tft->fillRect(_bounds.x, _bounds.y, _bounds.w, _bounds.h, _backgroundColor);
+    _isRendered = false;
+  }
+
+  _isRepaint = false;
+  _isDirty = false;
+}
+
+//===============================================================
+// Initializes the label
+//===============================================================
+void LabelWidget::Begin(GlyphCache* glyphCache, int16_t x, int16_t y, GlyphAlign align, int16_t minWidth, int16_t padding, bool isCenteredVertically)
+{
+  _glyphCache = glyphCache;
+  _x = x;
+  _y = y;
+  _align = align;
+  _minWidth = minWidth;
+  _padding = padding;
+  _isCenteredVertically = isCenteredVertically;
+  Invalidate();
+}
+
+//===============================================================
+// Moves the label
+//===============================================================
+void LabelWidget::SetPosition(int16_t x, int16_t y)
+{
+  if (_x != x || _y != y)
+  {
+    _x = x;
+    _y = y;
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Sets the text
+//===============================================================
+void LabelWidget::SetText(const char* text)
+{
+  if (strncmp(_text, text, WIDGET_MAXTEXTLENGTH - 1) != 0)
+  {
+    strlcpy(_text, text, WIDGET_MAXTEXTLENGTH);
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Sets the colors
+//===============================================================
+void LabelWidget::SetColors(uint16_t color, uint16_t backgroundColor)
+{
+  if (_color != color || _backgroundColor != backgroundColor)
+  {
+    _color = color;
+    _backgroundColor = backgroundColor;
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Returns the area which will be written by the next draw
+// The field of the new text is extended by the last rendered
+// field, so no separate clear is necessary
+//===============================================================
+DamageRect LabelWidget::GetDrawArea()
+{
+  if (!_glyphCache)
+  {
+    return DamageRect();
+  }
+
+  uint16_t w, h;
+  _glyphCache->GetTextBounds(_text, &w, &h);
+
+  DamageRect area;
+  area.w = max(_minWidth, (int16_t)(w + _padding));
+  area.h = _glyphCache->FieldHeight();
+  area.y = (_isCenteredVertically ? _y + h / 2 : _y) - _glyphCache->Ascent();
+  switch (_align)
+  {
+    case eAlignCenter:
+      area.x = _x - area.w / 2;
+      break;
+    case eAlignRight:
+      area.x = _x - area.w;
+      break;
+    default:
+      area.x = _x;
+      break;
+  }
+
+  if (!_isRendered || _bounds.IsEmpty())
+  {
+    return area;
+  }
+
+  // Extend only in reading direction, the other side belongs to the neighbour
+  int16_t top = min(area.y, _bounds.y);
+  int16_t bottom = max(area.y + area.h, _bounds.y + _bounds.h);
+  int16_t left = area.x;
+  int16_t right = area.x + area.w;
+  if (_align != eAlignRight)
+  {
+    right = max(right, (int16_t)(_bounds.x + _bounds.w));
+  }
+  if (_align != eAlignLeft)
+  {
+    left = min(left, _bounds.x);
+  }
+
+  area.x = left;
+  area.y = top;
+  area.w = right - left;
+  area.h = bottom - top;
+  return area;
+}
+
+//===============================================================
+// Draws the label
+//===============================================================
+void LabelWidget::Draw(Adafruit_SPITFT* tft)
+{
+  if (!_glyphCache)
+  {
+    return;
+  }
+
+  DamageRect area = GetDrawArea();
+  uint16_t w, h;
+  _glyphCache->GetTextBounds(_text, &w, &h);
+  int16_t baseline = _isCenteredVertically ? _y + h / 2 : _y;
+  int16_t fieldTop = baseline - _glyphCache->Ascent();
+  int16_t fieldBottom = fieldTop + _glyphCache->FieldHeight();
+
+  // Clear rows of the last field outside of the new field (Only if the baseline moved)
+  if (area.y < fieldTop)
+  {
+    tft->fillRect(area.x, area.y, area.w, fieldTop - area.y, _backgroundColor);
+  }
+  if (area.y + area.h > fieldBottom)
+  {
+    tft->fillRect(area.x, fieldBottom, area.w, area.y + area.h - fieldBottom, _backgroundColor);
+  }
+
+  // Draw text into the whole field width
+  _glyphCache->DrawText(tft, area.x, baseline, _text, _color, _backgroundColor, area.w, _align);
+
+  // Remember only the new field, the remaining area is background now
+  int16_t fieldWidth = max(_minWidth, (int16_t)(w + _padding));
+  _bounds.w = fieldWidth;
+  _bounds.h = fieldBottom - fieldTop;
+  _bounds.y = fieldTop;
+  _bounds.x = _align == eAlignCenter ? _x - fieldWidth / 2 : _align == eAlignRight ? _x - fieldWidth : _x;
+}
+
+//===============================================================
+// Initializes the bar gauge
+//===============================================================
+void BarGaugeWidget::Begin(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  _x = x;
+  _y = y;
+  _width = width;
+  _height = height;
+  _bounds = { x, y, width, height };
+  Invalidate();
+}
+
+//===============================================================
+// Sets the fill level in percent
+//===============================================================
+void BarGaugeWidget::SetValue(int16_t percentage)
+{
+  percentage = constrain(percentage, 0, 100);
+  if (_percentage != percentage)
+  {
+    _percentage = percentage;
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Sets the colors
+//===============================================================
+void BarGaugeWidget::SetColors(uint16_t emptyColor, uint16_t fillColor, uint16_t backgroundColor)
+{
+  if (_emptyColor != emptyColor || _fillColor != fillColor || _backgroundColor != backgroundColor)
+  {
+    _emptyColor = emptyColor;
+    _fillColor = fillColor;
+    _backgroundColor = backgroundColor;
+    Repaint();
+  }
+}
+
+//===============================================================
+// Returns the area which will be written by the next draw
+//===============================================================
+DamageRect BarGaugeWidget::GetDrawArea()
+{
+  if (IsFullDraw())
+  {
+    return _bounds;
+  }
+
+  // Only the rows between the old and the new level
+  int16_t fillOld = FillHeight(_drawnPercentage);
+  int16_t fillNew = FillHeight(_percentage);
+  DamageRect area;
+  area.x = _x;
+  area.y = _y + _height - max(fillOld, fillNew);
+  area.w = _width;
+  area.h = abs(fillNew - fillOld);
+  return area;
+}
+
+//===============================================================
+// Draws the bar gauge
+//===============================================================
+void BarGaugeWidget::Draw(Adafruit_SPITFT* tft)
+{
+  int16_t fillNew = FillHeight(_percentage);
+
+  if (IsFullDraw())
+  {
+    if (_height - fillNew > 0)
+    {
+      tft->fillRect(_x, _y, _width, _height - fillNew, _emptyColor);
+    }
+    if (fillNew > 0)
+    {
+      tft->fillRect(_x, _y + _height - fillNew, _width, fillNew, _fillColor);
+    }
+  }
+  else
+  {
+    int16_t fillOld = FillHeight(_drawnPercentage);
+    if (fillNew > fillOld)
+    {
+      tft->fillRect(_x, _y + _height - fillNew, _width, fillNew - fillOld, _fillColor);
+    }
+    else if (fillNew < fillOld)
+    {
+      tft->fillRect(_x, _y + _height - fillOld, _width, fillOld - fillNew, _emptyColor);
+    }
+  }
+
+  _drawnPercentage = _percentage;
+}
+
+//===============================================================
+// Returns the filled height for a percentage
+//===============================================================
+int16_t BarGaugeWidget::FillHeight(int16_t percentage) const
+{
+  return (int32_t)percentage * _height / 100;
+}
+
+//===============================================================
+// Initializes the bottle
+//===============================================================
+void BottleWidget::Begin(int16_t x, int16_t y, int16_t selectionWidth)
+{
+  _x = x;
+  _y = y;
+  _selectionWidth = selectionWidth;
+  Invalidate();
+}
+
+//===============================================================
+// Sets the image
+//===============================================================
+void BottleWidget::SetImage(SPIFFSBMPImage* image, bool isShadow)
+{
+  if (_image != image || _isShadow != isShadow)
+  {
+    _image = image;
+    _isShadow = isShadow;
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Sets the selection
+//===============================================================
+void BottleWidget::SetSelected(bool isSelected)
+{
+  if (_isSelected != isSelected)
+  {
+    _isSelected = isSelected;
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Sets the colors
+//===============================================================
+void BottleWidget::SetColors(uint16_t selectionColor, uint16_t backgroundColor)
+{
+  if (_selectionColor != selectionColor || _backgroundColor != backgroundColor)
+  {
+    _selectionColor = selectionColor;
+    _backgroundColor = backgroundColor;
+    Repaint();
+  }
+}
+
+//===============================================================
+// Returns the area which will be written by the next draw
+//===============================================================
+DamageRect BottleWidget::GetDrawArea()
+{
+  DamageRect area = GetImageArea(_image);
+  if (_isRendered)
+  {
+    area.Add(GetImageArea(_drawnImage));
+  }
+  return area;
+}
+
+//===============================================================
+// Draws the bottle
+//===============================================================
+void BottleWidget::Draw(Adafruit_SPITFT* tft)
+{
+  bool isValid = _image && _image->IsValid();
+  bool isImageChanged = _isRendered && (_image != _drawnImage || _isShadow != _drawnShadow);
+  bool isSelectionChanged = _isRendered && _isSelected != _drawnSelected;
+
+  if (_isRendered)
+  {
+    // Reset old selection -> only if image changed or not selected anymore
+    if (_drawnSelected &&
+      (isImageChanged || !_isSelected))
+    {
+      DrawSelection(tft, _drawnImage, _backgroundColor);
+    }
+
+    // Clear difference to the new image (Shadow images are drawn in background color, nothing to clear)
+    if (isImageChanged &&
+      !_drawnShadow &&
+      isValid &&
+      _drawnImage &&
+      _drawnImage->IsValid())
+    {
+      _drawnImage->ClearDiff(_x - _drawnImage->Width() / 2, _y, _x - _image->Width() / 2, _y, _image, tft, _backgroundColor);
+    }
+  }
+
+  if (isValid)
+  {
+    // Draw selection -> only if selected and anything changed
+    if (_isSelected &&
+      (IsFullDraw() || isImageChanged || isSelectionChanged))
+    {
+      DrawSelection(tft, _image, _selectionColor);
+    }
+
+    // Draw image -> only if image changed
+    if (IsFullDraw() || isImageChanged)
+    {
+      _image->Draw(_x - _image->Width() / 2, _y, tft, _backgroundColor, _isShadow);
+    }
+  }
+
+  _drawnImage = _image;
+  _drawnShadow = _isShadow;
+  _drawnSelected = _isSelected;
+  _bounds = GetImageArea(_image);
+}
+
+//===============================================================
+// Returns the area of an image including the selection
+//===============================================================
+DamageRect BottleWidget::GetImageArea(SPIFFSBMPImage* image)
+{
+  DamageRect area;
+  if (image &&
+    image->IsValid())
+  {
+    area.x = _x - image->Width() / 2 - _selectionWidth;
+    area.y = _y - _selectionWidth;
+    area.w = image->Width() + 2 * _selectionWidth;
+    area.h = image->Height() + _selectionWidth;
+  }
+  return area;
+}
+
+//===============================================================
+// Draws or clears the selection shadow around an image
+//===============================================================
+void BottleWidget::DrawSelection(Adafruit_SPITFT* tft, SPIFFSBMPImage* image, uint16_t color)
+{
+  if (!image ||
+    !image->IsValid())
+  {
+    return;
+  }
+
+  // Draw selection shadow with move function
+  int16_t x = _x - image->Width() / 2;
+  image->Move(x - _selectionWidth, _y, x, _y, tft, color, true);
+  image->Move(x + _selectionWidth, _y, x, _y, tft, color, true);
+  image->Move(x, _y - _selectionWidth, x, _y, tft, color, true);
+}
+
+//===============================================================
+// Initializes the check box
+//===============================================================
+void CheckBoxWidget::Begin(int16_t x, int16_t y, int16_t size)
+{
+  _x = x;
+  _y = y;
+  _size = size;
+  _bounds = { x, y, size, size };
+  Invalidate();
+}
+
+//===============================================================
+// Sets the checked state
+//===============================================================
+void CheckBoxWidget::SetChecked(bool isChecked)
+{
+  if (_isChecked != isChecked)
+  {
+    _isChecked = isChecked;
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Sets the colors
+//===============================================================
+void CheckBoxWidget::SetColors(uint16_t frameColor, uint16_t checkColor, uint16_t backgroundColor)
+{
+  if (_frameColor != frameColor || _checkColor != checkColor || _backgroundColor != backgroundColor)
+  {
+    _frameColor = frameColor;
+    _checkColor = checkColor;
+    _backgroundColor = backgroundColor;
+    Repaint();
+  }
+}
+
+//===============================================================
+// Returns the area which will be written by the next draw
+//===============================================================
+DamageRect CheckBoxWidget::GetDrawArea()
+{
+  if (IsFullDraw())
+  {
+    return _bounds;
+  }
+
+  // Only the inner box
+  return { (int16_t)(_x + 4), (int16_t)(_y + 4), (int16_t)(_size - 8), (int16_t)(_size - 8) };
+}
+
+//===============================================================
+// Draws the check box
+//===============================================================
+void CheckBoxWidget::Draw(Adafruit_SPITFT* tft)
+{
+  if (IsFullDraw())
+  {
+    tft->drawRect(_x, _y, _size, _size, _frameColor);
+  }
+
+  tft->fillRect(_x + 4, _y + 4, _size - 8, _size - 8, _isChecked ? _checkColor : _backgroundColor);
+}
+
+//===============================================================
+// Initializes the doughnut chart
+//===============================================================
+void DoughnutWidget::Begin(int16_t x0, int16_t y0, int16_t innerRadius, int16_t outerRadius, int16_t spacerAngle_Degrees)
+{
+  _x0 = x0;
+  _y0 = y0;
+  _innerRadius = innerRadius;
+  _outerRadius = outerRadius;
+  _spacerAngle_Degrees = spacerAngle_Degrees;
+  _bounds = { (int16_t)(x0 - outerRadius), (int16_t)(y0 - outerRadius), (int16_t)(2 * outerRadius + 1), (int16_t)(2 * outerRadius + 1) };
+  Invalidate();
+}
+
+//===============================================================
+// Sets the part start angles and the direction of the last change
+//===============================================================
+void DoughnutWidget::SetAngles(int16_t angle1, int16_t angle2, int16_t angle3, bool clockwise)
+{
+  if (_angles[0] != angle1 || _angles[1] != angle2 || _angles[2] != angle3)
+  {
+    _angles[0] = angle1;
+    _angles[1] = angle2;
+    _angles[2] = angle3;
+    _isDirty = true;
+  }
+  _clockwise = clockwise;
+}
+
+//===============================================================
+// Sets the selected part
+//===============================================================
+void DoughnutWidget::SetSelected(int8_t selectedIndex)
+{
+  if (_selectedIndex != selectedIndex)
+  {
+    _selectedIndex = selectedIndex;
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Sets the colors
+//===============================================================
+void DoughnutWidget::SetColors(uint16_t color1, uint16_t color2, uint16_t color3, uint16_t selectionColor, uint16_t backgroundColor)
+{
+  if (_colors[0] != color1 ||
+    _colors[1] != color2 ||
+    _colors[2] != color3 ||
+    _selectionColor != selectionColor ||
+    _backgroundColor != backgroundColor)
+  {
+    _colors[0] = color1;
+    _colors[1] = color2;
+    _colors[2] = color3;
+    _selectionColor = selectionColor;
+    _backgroundColor = backgroundColor;
+    Repaint();
+  }
+}
+
+//===============================================================
+// Returns the area which will be written by the next draw
+//===============================================================
+DamageRect DoughnutWidget::GetDrawArea()
+{
+  return _bounds;
+}
+
+//===============================================================
+// Draws the doughnut chart
+//===============================================================
+void DoughnutWidget::Draw(Adafruit_SPITFT* tft)
+{
+  for (uint8_t index = 0; index < DOUGHNUT_PARTS; index++)
+  {
+    int16_t angle = _angles[index];
+    int16_t drawnAngle = _drawnAngles[index];
+
+    if (IsFullDraw())
+    {
+      // Draw complete part up to the next part
+      FillArc(tft, angle, GetDistanceDegrees(angle, _angles[(index + 1) % DOUGHNUT_PARTS]), _colors[index]);
+    }
+    else if (angle != drawnAngle)
+    {
+      // Draw only from last angle to new angle (Color of the part before if moved clockwise)
+      int16_t startAngle = Move360(drawnAngle, _clockwise ? -_spacerAngle_Degrees : _spacerAngle_Degrees);
+      uint16_t color = _clockwise ? _colors[(index + DOUGHNUT_PARTS - 1) % DOUGHNUT_PARTS] : _colors[index];
+      int16_t distance_Degrees = _clockwise ? GetDistanceDegrees(drawnAngle, angle) : -360 + GetDistanceDegrees(drawnAngle, angle);
+      FillArc(tft, startAngle, distance_Degrees, color);
+    }
+  }
+
+  // Draw spacers and selected spacer
+  for (uint8_t index = 0; index < DOUGHNUT_PARTS; index++)
+  {
+    FillArc(tft, Move360(_angles[index], -_spacerAngle_Degrees), 2 * _spacerAngle_Degrees, index == _selectedIndex ? _selectionColor : _backgroundColor);
+    _drawnAngles[index] = _angles[index];
+  }
+}
+
+//===============================================================
+// Draws an arc with the thickness of the doughnut
+//===============================================================
+void DoughnutWidget::FillArc(Adafruit_SPITFT* tft, int16_t startAngle, int16_t distance_Degrees, uint16_t color)
+{
+  // Draw color blocks every 1°
+  int16_t drawAngle_Degrees = distance_Degrees > 0 ? 1 : - 1;
+  for (int16_t i = startAngle; i != startAngle + distance_Degrees; i += drawAngle_Degrees)
+  {
+    // Calculate pair of coordinates for segment start
+    float sx = cos((i - 90) * TFT_DEG2RAD);
+    float sy = sin((i - 90) * TFT_DEG2RAD);
+    int16_t x0 = sx * _innerRadius + _x0;
+    int16_t y0 = sy * _innerRadius + _y0;
+    int16_t x1 = sx * _outerRadius + _x0;
+    int16_t y1 = sy * _outerRadius + _y0;
+
+    // Calculate pair of coordinates for segment end
+    float sx2 = cos((i + drawAngle_Degrees - 90) * TFT_DEG2RAD);
+    float sy2 = sin((i + drawAngle_Degrees - 90) * TFT_DEG2RAD);
+    int16_t x2 = sx2 * _innerRadius + _x0;
+    int16_t y2 = sy2 * _innerRadius + _y0;
+    int16_t x3 = sx2 * _outerRadius + _x0;
+    int16_t y3 = sy2 * _outerRadius + _y0;
+
+    tft->fillTriangle(x0, y0, x1, y1, x2, y2, color);
+    tft->fillTriangle(x1, y1, x2, y2, x3, y3, color);
+  }
+}
+
+//===============================================================
+// Initializes the icon
+//===============================================================
+void IconWidget::Begin(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  if (width > WIDGET_MAXICONSIZE || height > WIDGET_MAXICONSIZE)
+  {
+    ESP_LOGE(TAG, "Icon size %dx%d exceeds maximum size", width, height);
+    width = min(width, (int16_t)WIDGET_MAXICONSIZE);
+    height = min(height, (int16_t)WIDGET_MAXICONSIZE);
+  }
+
+  _x = x;
+  _y = y;
+  _width = width;
+  _height = height;
+  _bounds = { x, y, width, height };
+  Invalidate();
+}
+
+//===============================================================
+// Sets the icon bitmap
+//===============================================================
+void IconWidget::SetIcon(const uint8_t* bitmap)
+{
+  if (_bitmap != bitmap)
+  {
+    _bitmap = bitmap;
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Sets the colors
+//===============================================================
+void IconWidget::SetColors(uint16_t color, uint16_t backgroundColor)
+{
+  if (_color != color || _backgroundColor != backgroundColor)
+  {
+    _color = color;
+    _backgroundColor = backgroundColor;
+    _isDirty = true;
+  }
+}
+
+//===============================================================
+// Returns the area which will be written by the next draw
+//===============================================================
+DamageRect IconWidget::GetDrawArea()
+{
+  return _bounds;
+}
+
+//===============================================================
+// Draws the icon
+//===============================================================
+void IconWidget::Draw(Adafruit_SPITFT* tft)
+{
+  if (!_bitmap)
+  {
+    tft->fillRect(_x, _y, _width, _height, _backgroundColor);
+    return;
+  }
+
+  // Compose opaque icon (XBM: LSB first, rows padded to full bytes)
+  int16_t byteWidth = (_width + 7) / 8;
+  for (int16_t y = 0; y < _height; y++)
+  {
+    for (int16_t x = 0; x < _width; x++)
+    {
+      uint8_t bits = pgm_read_byte(&_bitmap[y * byteWidth + x / 8]);
+      IconBuffer[y * _width + x] = (bits & (1 << (x & 7))) ? _color : _backgroundColor;
+    }
+  }
+
+  // Send icon with a single address window
+  tft->drawRGBBitmap(_x, _y, IconBuffer, _width, _height);
+}
+
+//===============================================================
+// Adds a widget
+//===============================================================
+bool WidgetTree::Add(Widget* widget)
+{
+  if (!widget ||
+    _widgetCount >= WIDGETTREE_MAXWIDGETS)
+  {
+    ESP_LOGE(TAG, "Could not add widget to tree");
+    return false;
+  }
+
+  _widgets[_widgetCount++] = widget;
+  return true;
+}
+
+//===============================================================
+// Invalidates all widgets
+//===============================================================
+void WidgetTree::InvalidateAll()
+{
+  for (uint8_t index = 0; index < _widgetCount; index++)
+  {
+    _widgets[index]->Invalidate();
+  }
+}
+
+//===============================================================
+// Renders all dirty widgets and returns the count of rendered
+// widgets
+//===============================================================
+uint16_t WidgetTree::Render(Adafruit_SPITFT* tft)
+{
+  DamageRect damages[WIDGETTREE_MAXWIDGETS];
+  uint8_t damageCount = 0;
+
+  _lastDamage = DamageRect();
+
+  for (uint8_t index = 0; index < _widgetCount; index++)
+  {
+    Widget* widget = _widgets[index];
+
+    // Repaint widget if a previous widget of this pass wrote into its bounds
+    if (widget->IsVisible() &&
+      widget->IsRendered())
+    {
+      for (uint8_t damageIndex = 0; damageIndex < damageCount; damageIndex++)
+      {
+        if (damages[damageIndex].Intersects(widget->GetBounds()))
+        {
+          widget->Repaint();
+          break;
+        }
+      }
+    }
+
+    if (!widget->IsDirty())
+    {
+      continue;
+    }
+
+    DamageRect damage = widget->GetDamage();
+    widget->Render(tft);
+
+    if (!damage.IsEmpty())
+    {
+      damages[damageCount++] = damage;
+      _lastDamage.Add(damage);
+    }
+  }
+
+  return damageCount;
+}
@@ -0,0 +1,387 @@
+/*
+ * Includes retained display widgets with damage tracking
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef WIDGETS_H
+#define WIDGETS_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <esp_log.h>
+#include "GlyphCache.h"
+#include "SPIFFSBMPImage.h"
+#include "AngleHelper.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define TFT_DEG2RAD                 0.017453292519943295769236907684886F
+#define WIDGET_MAXTEXTLENGTH        32
+#define WIDGET_MAXICONSIZE          32
+#define WIDGETTREE_MAXWIDGETS       24
+#define DOUGHNUT_PARTS              3
+
+//===============================================================
+// Rectangle on the display which has to be redrawn
+//===============================================================
+struct DamageRect
+{
+  int16_t x = 0;
+  int16_t y = 0;
+  int16_t w = 0;
+  int16_t h = 0;
+
+  // Returns true if the rectangle has no area
+  bool IsEmpty() const
+  {
+    return w <= 0 || h <= 0;
+  }
+
+  // Returns true if both rectangles overlap
+  bool Intersects(const DamageRect& other) const
+  {
+    return !IsEmpty() &&
+      !other.IsEmpty() &&
+      x < other.x + other.w &&
+      other.x < x + w &&
+      y < other.y + other.h &&
+      other.y < y + h;
+  }
+
+  // Extends the rectangle to contain the other rectangle
+  void Add(const DamageRect& other)
+  {
+    if (other.IsEmpty())
+    {
+      return;
+    }
+    if (IsEmpty())
+    {
+      *this = other;
+      return;
+    }
+    int16_t x2 = max(x + w, other.x + other.w);
+    int16_t y2 = max(y + h, other.y + other.h);
+    x = min(x, other.x);
+    y = min(y, other.y);
+    w = x2 - x;
+    h = y2 - y;
+  }
+};
+
+//===============================================================
+// Base class for retained widgets
+// A widget keeps its last rendered state and draws only if a
+// property changed or its pixels were overwritten
+//===============================================================
+class Widget
+{
+  public:
+    // Destructor
+    virtual ~Widget() {}
+
+    // Forgets the last rendered state (e.g. after the screen was cleared)
+    void Invalidate();
+
+    // Draws the widget completely on the next render (e.g. after it was overwritten)
+    void Repaint();
+
+    // Shows or hides the widget (Hiding clears the last rendered area)
+    void SetVisible(bool isVisible);
+
+    // Returns true if the widget has to be rendered
+    bool IsDirty() const { return _isDirty; }
+
+    // Returns true if the widget is visible
+    bool IsVisible() const { return _isVisible; }
+
+    // Returns true if the pixels of the last render are on the display
+    bool IsRendered() const { return _isRendered; }
+
+    // Returns the area covered by the last render
+    const DamageRect& GetBounds() const { return _bounds; }
+
+    // Returns the area which will be written by the next render
+    DamageRect GetDamage();
+
+    // Renders the widget if dirty
+    void Render(Adafruit_SPITFT* tft);
+
+  protected:
+    bool _isDirty = true;
+    bool _isVisible = true;
+    bool _isRendered = false;
+    bool _isRepaint = false;
+    DamageRect _bounds;
+    uint16_t _backgroundColor = 0;
+
+    // Returns true if the next draw has to draw everything
+    bool IsFullDraw() const { return !_isRendered || _isRepaint; }
+
+    // Returns the area which will be written by the next draw
+    virtual DamageRect GetDrawArea() = 0;
+
+    // Draws the widget and updates the bounds
+    virtual void Draw(Adafruit_SPITFT* tft) = 0;
+};
+
+//===============================================================
+// Opaque text label using the glyph cache
+// Left aligned labels own the area right of x, right aligned
+// labels left of x and centered labels around x
+//===============================================================
+class LabelWidget : public Widget
+{
+  public:
+    // Initializes the label (y is the baseline or the vertical center)
+    void Begin(GlyphCache* glyphCache, int16_t x, int16_t y, GlyphAlign align, int16_t minWidth = 0, int16_t padding = 4, bool isCenteredVertically = false);
+
+    // Moves the label
+    void SetPosition(int16_t x, int16_t y);
+
+    // Sets the text
+    void SetText(const char* text);
+
+    // Sets the colors
+    void SetColors(uint16_t color, uint16_t backgroundColor);
+
+  protected:
+    // Returns the area which will be written by the next draw
+    DamageRect GetDrawArea() override;
+
+    // Draws the label
+    void Draw(Adafruit_SPITFT* tft) override;
+
+  private:
+    GlyphCache* _glyphCache = NULL;
+    int16_t _x = 0;
+    int16_t _y = 0;
+    GlyphAlign _align = eAlignLeft;
+    int16_t _minWidth = 0;
+    int16_t _padding = 4;
+    bool _isCenteredVertically = false;
+    char _text[WIDGET_MAXTEXTLENGTH] = "";
+    uint16_t _color = 0;
+};
+
+//===============================================================
+// Vertical bar gauge (Empty part on top, filled part on bottom)
+// Value changes only draw the rows between old and new level
+//===============================================================
+class BarGaugeWidget : public Widget
+{
+  public:
+    // Initializes the bar gauge
+    void Begin(int16_t x, int16_t y, int16_t width, int16_t height);
+
+    // Sets the fill level in percent
+    void SetValue(int16_t percentage);
+
+    // Sets the colors
+    void SetColors(uint16_t emptyColor, uint16_t fillColor, uint16_t backgroundColor);
+
+  protected:
+    // Returns the area which will be written by the next draw
+    DamageRect GetDrawArea() override;
+
+    // Draws the bar gauge
+    void Draw(Adafruit_SPITFT* tft) override;
+
+  private:
+    int16_t _x = 0;
+    int16_t _y = 0;
+    int16_t _width = 0;
+    int16_t _height = 0;
+    int16_t _percentage = 0;
+    int16_t _drawnPercentage = 0;
+    uint16_t _emptyColor = 0;
+    uint16_t _fillColor = 0;
+
+    // Returns the filled height for a percentage
+    int16_t FillHeight(int16_t percentage) const;
+};
+
+//===============================================================
+// Bottle image with selection shadow
+//===============================================================
+class BottleWidget : public Widget
+{
+  public:
+    // Initializes the bottle (x is the horizontal center)
+    void Begin(int16_t x, int16_t y, int16_t selectionWidth = 3);
+
+    // Sets the image (Shadow images are drawn in background color)
+    void SetImage(SPIFFSBMPImage* image, bool isShadow);
+
+    // Sets the selection
+    void SetSelected(bool isSelected);
+
+    // Sets the colors
+    void SetColors(uint16_t selectionColor, uint16_t backgroundColor);
+
+  protected:
+    // Returns the area which will be written by the next draw
+    DamageRect GetDrawArea() override;
+
+    // Draws the bottle
+    void Draw(Adafruit_SPITFT* tft) override;
+
+  private:
+    int16_t _x = 0;
+    int16_t _y = 0;
+    int16_t _selectionWidth = 3;
+    SPIFFSBMPImage* _image = NULL;
+    SPIFFSBMPImage* _drawnImage = NULL;
+    bool _isShadow = false;
+    bool _drawnShadow = false;
+    bool _isSelected = false;
+    bool _drawnSelected = false;
+    uint16_t _selectionColor = 0;
+
+    // Returns the area of an image including the selection
+    DamageRect GetImageArea(SPIFFSBMPImage* image);
+
+    // Draws or clears the selection shadow around an image
+    void DrawSelection(Adafruit_SPITFT* tft, SPIFFSBMPImage* image, uint16_t color);
+};
+
+//===============================================================
+// Check box with frame and filled inner box
+//===============================================================
+class CheckBoxWidget : public Widget
+{
+  public:
+    // Initializes the check box
+    void Begin(int16_t x, int16_t y, int16_t size);
+
+    // Sets the checked state
+    void SetChecked(bool isChecked);
+
+    // Sets the colors
+    void SetColors(uint16_t frameColor, uint16_t checkColor, uint16_t backgroundColor);
+
+  protected:
+    // Returns the area which will be written by the next draw
+    DamageRect GetDrawArea() override;
+
+    // Draws the check box
+    void Draw(Adafruit_SPITFT* tft) override;
+
+  private:
+    int16_t _x = 0;
+    int16_t _y = 0;
+    int16_t _size = 0;
+    bool _isChecked = false;
+    uint16_t _frameColor = 0;
+    uint16_t _checkColor = 0;
+};
+
+//===============================================================
+// Doughnut chart with three parts and spacers between them
+// Angle changes only draw the arcs between old and new angle
+//===============================================================
+class DoughnutWidget : public Widget
+{
+  public:
+    // Initializes the doughnut chart
+    void Begin(int16_t x0, int16_t y0, int16_t innerRadius, int16_t outerRadius, int16_t spacerAngle_Degrees);
+
+    // Sets the part start angles and the direction of the last change
+    void SetAngles(int16_t angle1, int16_t angle2, int16_t angle3, bool clockwise);
+
+    // Sets the selected part (-1 for none)
+    void SetSelected(int8_t selectedIndex);
+
+    // Sets the colors
+    void SetColors(uint16_t color1, uint16_t color2, uint16_t color3, uint16_t selectionColor, uint16_t backgroundColor);
+
+  protected:
+    // Returns the area which will be written by the next draw
+    DamageRect GetDrawArea() override;
+
+    // Draws the doughnut chart
+    void Draw(Adafruit_SPITFT* tft) override;
+
+  private:
+    int16_t _x0 = 0;
+    int16_t _y0 = 0;
+    int16_t _innerRadius = 0;
+    int16_t _outerRadius = 0;
+    int16_t _spacerAngle_Degrees = 1;
+    int16_t _angles[DOUGHNUT_PARTS] = {};
+    int16_t _drawnAngles[DOUGHNUT_PARTS] = {};
+    uint16_t _colors[DOUGHNUT_PARTS] = {};
+    bool _clockwise = false;
+    int8_t _selectedIndex = -1;
+    uint16_t _selectionColor = 0;
+
+    // Draws an arc with the thickness of the doughnut
+    void FillArc(Adafruit_SPITFT* tft, int16_t startAngle, int16_t distance_Degrees, uint16_t color);
+};
+
+//===============================================================
+// Opaque monochrome icon (XBM format), sent as one block
+//===============================================================
+class IconWidget : public Widget
+{
+  public:
+    // Initializes the icon
+    void Begin(int16_t x, int16_t y, int16_t width, int16_t height);
+
+    // Sets the icon bitmap
+    void SetIcon(const uint8_t* bitmap);
+
+    // Sets the colors
+    void SetColors(uint16_t color, uint16_t backgroundColor);
+
+  protected:
+    // Returns the area which will be written by the next draw
+    DamageRect GetDrawArea() override;
+
+    // Draws the icon
+    void Draw(Adafruit_SPITFT* tft) override;
+
+  private:
+    int16_t _x = 0;
+    int16_t _y = 0;
+    int16_t _width = 0;
+    int16_t _height = 0;
+    const uint8_t* _bitmap = NULL;
+    uint16_t _color = 0;
+};
+
+//===============================================================
+// Ordered list of widgets which are rendered in one pass
+// Widgets are drawn in the order they were added. If a widget
+// writes into the bounds of a later widget, the later one is
+// redrawn in the same pass
+//===============================================================
+class WidgetTree
+{
+  public:
+    // Adds a widget
+    bool Add(Widget* widget);
+
+    // Invalidates all widgets (e.g. after the screen was cleared)
+    void InvalidateAll();
+
+    // Renders all dirty widgets and returns the count of rendered widgets
+    uint16_t Render(Adafruit_SPITFT* tft);
+
+    // Returns the union of all areas written by the last render
+    const DamageRect& GetLastDamage() const { return _lastDamage; }
+
+  private:
+    Widget* _widgets[WIDGETTREE_MAXWIDGETS] = {};
+    uint8_t _widgetCount = 0;
+    DamageRect _lastDamage;
+};
+
+#endif
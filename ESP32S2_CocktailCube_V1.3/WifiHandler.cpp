@@ -121,8 +121,8 @@ void WifiHandler::SetWifiMode(wifi_mode_t mode)
     WiFi.softAPConfig(local_ip, gateway, subnet);
     delay(100);
 
-    // Start web server
-    _wifiMode = StartWebServer();
+    // Start web server (Not before the boot tasks loaded config and settings)
+    _wifiMode = _webServerEnabled ? StartWebServer() : WIFI_MODE_AP;
   }
   else
   {
@@ -138,6 +138,21 @@ void WifiHandler::SetWifiMode(wifi_mode_t mode)
   }
 }
 
+//===============================================================
+// Allows the web server and starts it, if the access point is
+// active. Until then the handlers would publish and upload while
+// the boot tasks still write the config and the theme index
+//===============================================================
+void WifiHandler::EnableWebServer()
+{
+  _webServerEnabled = true;
+  if (_wifiMode == WIFI_MODE_AP &&
+    !_webserver)
+  {
+    _wifiMode = StartWebServer();
+  }
+}
+
 //===============================================================
 // Returns the amount of connected clients
 //===============================================================
@@ -147,14 +162,109 @@ uint16_t WifiHandler::GetConnectedClients()
 }
 
 //===============================================================
-// Updates the web server and clients
+// Executes queued web commands and publishes values for the web server
 //===============================================================
 void WifiHandler::Update()
 {
-  if (_webserver)
+  if (!_webserver)
+  {
+    return;
+  }
+
+  // Execute all queued commands
+  WebCommand command;
+  while (xQueueReceive(_commandQueue, &command, 0) == pdTRUE)
+  {
+    ExecuteCommand(command);
+  }
+
+  // Apply value updates after the coalescing window
+  if (_pendingValues.IsDue(millis()))
+  {
+    ApplyValues();
+  }
+
+  // Publish current values for the web page handler
+  _webPageHandler->Publish();
+}
+
+//===============================================================
+// Queues a command for the loop, returns false if the queue is full
+//===============================================================
+bool WifiHandler::QueueCommand(const WebCommand& command)
+{
+  if (!_commandQueue)
+  {
+    return false;
+  }
+
+  if (xQueueSend(_commandQueue, &command, 0) != pdTRUE)
   {
-    _webserver->handleClient();
+    ESP_LOGE(TAG, "Web command queue full, command %d dropped", command.type);
+    return false;
   }
+  return true;
+}
+
+//===============================================================
+// Counts and measures a new request, returns false if the request
+// limit is reached
+//===============================================================
+bool WifiHandler::OpenRequest(AsyncWebServerRequest* request)
+{
+  // Web socket clients are limited by the web page handler
+  if (request->url() == WEBSOCKET_PATH)
+  {
+    return true;
+  }
+
+  bool accepted = false;
+
+  portENTER_CRITICAL(&_requestMux);
+  if (_openRequests < WEBSERVER_MAXREQUESTS)
+  {
+    _openRequests++;
+    accepted = true;
+  }
+  else
+  {
+    _rejectedRequests++;
+  }
+  portEXIT_CRITICAL(&_requestMux);
+
+  // Measure accepted and rejected requests
+  _metrics.Begin(request);
+
+  // Release the request slot and unfinished uploads after the client has gone
+  request->onDisconnect([this, request, accepted]()
+  {
+    if (accepted)
+    {
+      portENTER_CRITICAL(&_requestMux);
+      _openRequests--;
+      portEXIT_CRITICAL(&_requestMux);
+    }
+    SPIFFSEditor::AbortUpload(request);
+    _metrics.End(request);
+  });
+
+  return accepted;
+}
+
+//===============================================================
+// Returns the amount of web socket clients
+//===============================================================
+uint32_t WifiHandler::GetSocketClients()
+{
+  return _webPageHandler ? _webPageHandler->GetSocketClients() : 0;
+}
+
+//===============================================================
+// Returns the processing time of the web page handler
+//===============================================================
+uint32_t WifiHandler::GetWebBusyTime_us()
+{
+  return _webPageHandler ? _webPageHandler->GetBusyTime_us() : 0;
 }
 
 //===============================================================
@@ -168,47 +278,61 @@ wifi_mode_t WifiHandler::StartWebServer()
   ESP_LOGI(TAG, "Set up mDNS responder");
   MDNS.begin(GetDNSName());
   
+  // Create command queue
+  if (!_commandQueue)
+  {
+    _commandQueue = xQueueCreate(WEBSERVER_COMMANDQUEUE, sizeof(WebCommand));
+    if (!_commandQueue)
+    {
+      return WIFI_MODE_NULL;
+    }
+  }
+
   // Create web server
   ESP_LOGI(TAG, "Create web server");
-  _webserver = new WebServer(80);
+  _webserver = new AsyncWebServer(80);
   if (!_webserver)
   {
     return WIFI_MODE_NULL;
   }
 
-  // Add root URL handler to web server
-  ESP_LOGI(TAG, "Add root URL handler");
-  _webserver->on("/", HTTP_GET, [this]()
-  {
-    // Stream index.html if existing
-    if (SPIFFS.exists("/index.html"))
-    {
-      File file = SPIFFS.open("/index.html", FILE_READ);
-      _webserver->streamFile(file, "text/html", 200);
-      file.close();
-    }
+  // Add request metrics to web server (Measures the time to first byte around all handlers)
+  ESP_LOGI(TAG, "Add request metrics");
+  _webserver->addMiddleware(&_metrics);
 
-    // Send not found message
-    _webserver->send(404, "text/plain; charset=utf-8", GetNotFoundMessage());
-  });
+  // Add request limit handler to web server (Has to be the first handler)
+  ESP_LOGI(TAG, "Add request limit handler");
+  _webserver->addHandler(new RequestLimitHandler());
 
   // Add system info handler to web server
   ESP_LOGI(TAG, "Add system info handler");
-  _webserver->on("/systeminfo", HTTP_GET, [this]()
+  _webserver->on("/systeminfo", HTTP_GET, [](AsyncWebServerRequest* request)
   {
-    _webserver->sendHeader("Cache-Control", "no-cache");
-    _webserver->send(200, "text/plain; charset=utf-8", Systemhelper.GetSystemInfoString());
+    String systemInfo = Systemhelper.GetSystemInfoString();
+    Wifihandler.AddBytesOut(request, systemInfo.length());
+    AsyncWebServerResponse* response = request->beginResponse(200, "text/plain; charset=utf-8", systemInfo);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
   });
 
-  // Add format SPIFFS handler to web server
-  ESP_LOGI(TAG, "Add format SPIFFS handler");
-  _webserver->on("/format", HTTP_GET, [this]()
+  // Add metrics handler to web server (Prometheus text, Json with '?format=json')
+  ESP_LOGI(TAG, "Add metrics handler");
+  _webserver->on(WEBMETRICS_PATH, HTTP_GET, [this](AsyncWebServerRequest* request)
   {
-    SPIFFS.end();
-    SPIFFS.format();
-    _webserver->send(200, "text/plain; charset=utf-8", "FORMAT: SPIFFS sucessfully formatted. Restarting ESP...");
-    delay(2000);
-    ESP.restart();
+    _metrics.HandleRequest(request);
+  });
+
+  // Add format file system handler to web server (Formatted in the loop)
+  ESP_LOGI(TAG, "Add format file system handler");
+  _webserver->on("/format", HTTP_GET, [this](AsyncWebServerRequest* request)
+  {
+    WebCommand command = { eWebFormat, { 0, 0, 0 }, 0 };
+    if (!QueueCommand(command))
+    {
+      request->send(503, "text/plain; charset=utf-8", "FORMAT: Busy, try again.");
+      return;
+    }
+    request->send(200, "text/plain; charset=utf-8", "FORMAT: File system sucessfully formatted. Restarting ESP...");
   });
   
   // Add SPIFFS handler to web server (http://[WIFI_SSID].local/edit or http://192.168.1.1/edit)
@@ -217,17 +341,23 @@ wifi_mode_t WifiHandler::StartWebServer()
   
   // Add web page handler to web server (http://[WIFI_SSID].local/control or http://192.168.1.1/control)
   ESP_LOGI(TAG, "Add web page handler");
-  _webserver->addHandler(new WebPageHandler());
+  _webPageHandler = new WebPageHandler();
+  _webPageHandler->Publish();
+  _webserver->addHandler(_webPageHandler);
+
+  // Add web socket handler to web server (Pushes value changes to the web page)
+  ESP_LOGI(TAG, "Add web socket handler");
+  _webserver->addHandler(_webPageHandler->GetSocket());
   
-  // Add static files handler to web server
+  // Add static files handler to web server (Uploaded files, then built-in files from the asset partition)
   ESP_LOGI(TAG, "Add static files handler");
-  _webserver->serveStatic("/", SPIFFS, "/");
+  _webserver->addHandler(new StaticFileHandler());
 
   // Add not found handler to web server
   ESP_LOGI(TAG, "Add not found handler");
-  _webserver->onNotFound([this]()
+  _webserver->onNotFound([this](AsyncWebServerRequest* request)
   {
-    _webserver->send(404, "text/plain; charset=utf-8", GetNotFoundMessage());
+    request->send(404, "text/plain; charset=utf-8", GetNotFoundMessage());
   });
 
   // Start web server
@@ -248,14 +378,56 @@ void WifiHandler::StopWebServer()
 {
   if (_webserver)
   {
-    // Stop web server
+    // Stop web server (Deletes all handlers)
     ESP_LOGI(TAG, "Stop web server");
-    _webserver->stop();
+    _webserver->end();
+    delete _webserver;
   }
 
   // Set web server to null
   ESP_LOGI(TAG, "Set web server to null");
   _webserver = NULL;
+  _webPageHandler = NULL;
+}
+
+//===============================================================
+// Executes a web command, value updates are coalesced
+//===============================================================
+void WifiHandler::ExecuteCommand(const WebCommand& command)
+{
+  switch (command.type)
+  {
+    case eWebValues:
+      _pendingValues.Add(command, millis());
+      break;
+    case eWebFormat:
+      // Give the web server time to send the response
+      ESP_LOGI(TAG, "Format file system and restart");
+      delay(500);
+      FileSystem.Format();
+      delay(2000);
+      ESP.restart();
+      break;
+    default:
+      break;
+  }
+}
+
+//===============================================================
+// Applies the coalesced value updates
+//===============================================================
+void WifiHandler::ApplyValues()
+{
+  // One pump recompute and redraw for all updates of the window
+  const WebCommand& values = _pendingValues.GetValues();
+  if (Statemachine.UpdateValuesFromWifi(values.increments_Degrees, values.cycleTimespan_ms) &&
+    values.cycleTimespan_ms != 0)
+  {
+    // Save cycle timespan value
+    Pumps.Save();
+  }
+
+  _pendingValues.Clear();
 }
 
 //===============================================================
@@ -14,23 +14,39 @@
 //===============================================================
 #include <Arduino.h>
 #include <Preferences.h>
-#include <SPIFFS.h>
 #include <WiFi.h>
 #include <ESPmDNS.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 #include <esp_log.h>
+#include "FileSystem.h"
 #include "Config.h"
 #include "SystemHelper.h"
 #include "SPIFFSEditor.h"
 #include "WebPageHandler.h"
+#include "StaticFileHandler.h"
+#include "RequestLimitHandler.h"
+#include "WebMetrics.h"
+#include "WebCommandBatch.h"
 
 //===============================================================
 // Defines
 //===============================================================
-#define KEY_WIFIMODE      "WifiMode"   // Key name: Maximum string length is 15 bytes, excluding a zero terminator.
+#define KEY_WIFIMODE              "WifiMode"   // Key name: Maximum string length is 15 bytes, excluding a zero terminator.
+#define WEBSERVER_MAXREQUESTS     8            // Concurrent requests, further requests are rejected with 503
+#define WEBSERVER_COMMANDQUEUE    16           // Commands from the web server waiting for the loop
+#define WEBSERVER_COALESCE_MS     50           // Value updates within this window are applied as one change
+
+// Included by the state machine before the web page handler is declared
+class WebPageHandler;
 
 //===============================================================
 // Class for wifi handling
+// The web server runs event driven in the task of the TCP stack,
+// so slow clients or large files never block the loop. Handlers
+// only read the published values and queue all state changes,
+// which are executed by 'Update()' in the loop
 //===============================================================
 class WifiHandler
 {
@@ -53,14 +69,38 @@ class WifiHandler
     // Sets the wifi mode
     void SetWifiMode(wifi_mode_t mode);
 
+    // Allows the web server and starts it, if the access point is active
+    void EnableWebServer();
+
     // Returns the amount of connected clients
     uint16_t GetConnectedClients();
 
-    // Updates the web server and clients
+    // Executes queued web commands and publishes values for the web server
     void Update();
 
+    // Queues a command for the loop, returns false if the queue is full
+    bool QueueCommand(const WebCommand& command);
+
+    // Counts and measures a new request, returns false if the request limit is reached
+    bool OpenRequest(AsyncWebServerRequest* request);
+
+    // Counts body bytes of the response of a request (Called by the handlers)
+    void AddBytesOut(AsyncWebServerRequest* request, size_t length) { _metrics.AddBytesOut(request, length); }
+
+    // Returns the amount of open requests
+    uint8_t GetOpenRequests() { return _openRequests; }
+
+    // Returns the amount of rejected requests
+    uint32_t GetRejectedRequests() { return _rejectedRequests; }
+
+    // Returns the amount of web socket clients
+    uint32_t GetSocketClients();
+
+    // Returns the processing time of the web page handler
+    uint32_t GetWebBusyTime_us();
+
     // Returns the internal websever (only internal use)
-    WebServer* GetWebServer() { return _webserver; }
+    AsyncWebServer* GetWebServer() { return _webserver; }
 
   private:
     // Preferences variable
@@ -69,9 +109,21 @@ class WifiHandler
     // Wifi settings
     wifi_mode_t _initWifiMode = WIFI_MODE_NULL;
     wifi_mode_t _wifiMode = WIFI_MODE_NULL;
+    bool _webServerEnabled = false;
 
     // Web server variables
-    WebServer* _webserver;
+    AsyncWebServer* _webserver = NULL;
+    WebPageHandler* _webPageHandler = NULL;
+    QueueHandle_t _commandQueue = NULL;
+    WebMetrics _metrics;
+
+    // Coalesced value updates (Only used by the loop)
+    WebCommandBatch _pendingValues = WebCommandBatch(WEBSERVER_COALESCE_MS);
+
+    // Request counter variables (Changed in the task of the TCP stack)
+    portMUX_TYPE _requestMux = portMUX_INITIALIZER_UNLOCKED;
+    volatile uint8_t _openRequests = 0;
+    volatile uint32_t _rejectedRequests = 0;
 
     // Alive counter variable
     uint32_t _lastAlive_ms = 0;
@@ -81,6 +133,12 @@ class WifiHandler
 
     // Stops the web server
     void StopWebServer();
+
+    // Executes a web command, value updates are coalesced
+    void ExecuteCommand(const WebCommand& command);
+
+    // Applies the coalesced value updates
+    void ApplyValues();
     
     // Returns the web domain for dns resolving
     String GetDNSName();
@@ -12,6 +12,10 @@ var needUpdateCounter = -1;
 var isMixer = true;
 var lastAliveTimestamp = new Date(0);
 var isSliding = false;
+var socket = null;
+var mixerState = {};
+var pendingIncrements = [0, 0, 0];
+var pendingTimer = null;
 
 (function()
 {
@@ -83,7 +87,81 @@ var isSliding = false;
     CheckAlive();
     
     // Start alive timer
-    setInterval(CheckAlive, 500);    
+    setInterval(CheckAlive, 500);
+    
+    // Connect web socket for pushed values
+    ConnectSocket();
+  }
+  
+  // Connects the web socket. Values are pushed as Json delta, without socket the values are polled
+  function ConnectSocket()
+  {
+    if (!window.WebSocket)
+    {
+      return;
+    }
+    
+    socket = new WebSocket('ws://' + document.location.host + '/ws');
+    socket.onmessage = OnSocketMessage;
+    socket.onclose = function()
+    {
+      // Fall back to polling and try again later
+      console.log("Web socket closed, polling values");
+      socket = null;
+      setTimeout(ConnectSocket, 5000);
+    };
+  }
+  
+  // Returns true, if the web socket is connected
+  function IsSocketOpen()
+  {
+    return socket && socket.readyState == WebSocket.OPEN;
+  }
+  
+  // Will be called for every pushed delta and the heartbeat of the web socket
+  async function OnSocketMessage(event)
+  {
+    try
+    {
+      var delta = JSON.parse(event.data);
+      
+      // Set alive timestamp
+      lastAliveTimestamp = Date.now();
+      
+      if (delta.ERROR)
+      {
+        console.log("Web socket: " + delta.ERROR);
+        return;
+      }
+      
+      // Heartbeat
+      if (Object.keys(delta).length == 0)
+      {
+        return;
+      }
+      
+      // Merge delta into the complete mixer state
+      Object.assign(mixerState, delta);
+      
+      // Check for new configuration
+      if (delta.NEED_UPDATE !== undefined &&
+        delta.NEED_UPDATE != needUpdateCounter)
+      {
+        needUpdateCounter = delta.NEED_UPDATE;
+        await ParseMixerSettings(mixerState);
+      }
+      
+      // Avoid setting values while using the controls
+      if (!isSliding &&
+        !(doughnutchart && doughnutchart.IsDragged()))
+      {
+        await ParseMixerValues(mixerState);
+      }
+    }
+    catch (error)
+    {
+      console.error('Error parsing web socket message:', error);
+    }
   }
   
   async function FetchMixerSettings()
@@ -278,6 +356,16 @@ var isSliding = false;
   // Function checks every 500ms if the communication is online. Timeout is 1.5s
   async function CheckAlive()
   {
+    // Values are pushed by the web socket
+    if (IsSocketOpen())
+    {
+      if (doughnutchart)
+      {
+        doughnutchart.Setonline(Date.now() - lastAliveTimestamp < 1500);
+      }
+      return;
+    }
+    
     if (isSliding ||
       (doughnutchart && doughnutchart.IsDragged()))
     {
@@ -340,17 +428,55 @@ var isSliding = false;
       return;
     }
     
+    // Collect increments of fast drag steps and send them together
+    pendingIncrements[index] += Math.round(increments);
+    if (!pendingTimer)
+    {
+      pendingTimer = setTimeout(SendPendingIncrements, 100);
+    }
+  }
+  
+  // Sends all collected increments as one batch ('LIQUID_ANGLE_1=6&LIQUID_ANGLE_2=-6')
+  async function SendPendingIncrements()
+  {
+    var values = [];
+    for (var index = 0; index < pendingIncrements.length; index++)
+    {
+      if (pendingIncrements[index] != 0)
+      {
+        values.push('LIQUID_ANGLE_' + (index + 1) + '=' + Math.max(-360, Math.min(360, pendingIncrements[index])));
+      }
+    }
+    pendingIncrements = [0, 0, 0];
+    pendingTimer = null;
+    
+    if (values.length == 0)
+    {
+      return;
+    }
+    var body = values.join('&');
+    
+    // Send by web socket, result is pushed with the next delta
+    if (IsSocketOpen())
+    {
+      socket.send(body);
+      console.log("Send: " + body + " by web socket");
+      return;
+    }
+    
     try
     {    
-      var response = await fetch('http://' + document.location.host + '/control?LIQUID_ANGLE_' + (index + 1) + '=' + increments.toFixed(0),
+      var response = await fetch('http://' + document.location.host + '/control',
       {
-        method: 'PUT'
+        method: 'POST',
+        headers: { 'Content-Type': 'application/x-www-form-urlencoded' },
+        body: body
       });
       
       // Check for response
       if (!response.ok)
       {
-        console.log("Send: LIQUID_ANGLE_" + index + " no connection..");
+        console.log("Send: " + body + " no connection..");
         if (confirm("The control is not connected. Reload page?"))
         {
           window.location.reload();
@@ -358,14 +484,14 @@ var isSliding = false;
         return;
       }
       
-      console.log("Send: LIQUID_ANGLE_" + index + " successful");
+      console.log("Send: " + body + " successful");
             
       // Set alive timestamp
       lastAliveTimestamp = Date.now();
     }
     catch (error)
     {
-      console.error('Error sending LIQUID_ANGLE_' + index + ':', error);
+      console.error('Error sending ' + body + ':', error);
     }
   }
 
@@ -404,10 +530,18 @@ var isSliding = false;
   // Will be called if new slider value is changed
   async function OnChangeCycleTimespan()
   {    
-    try
+    var slider = document.getElementById("sliderCycleTimespan");
+    
+    // Send by web socket, result is pushed with the next delta
+    if (IsSocketOpen())
     {
-      var slider = document.getElementById("sliderCycleTimespan");
+      socket.send('CYCLE_TIMESPAN=' + slider.value);
+      console.log("Send: CYCLE_TIMESPAN by web socket");
+      return;
+    }
     
+    try
+    {
       // Send CYCLE_TIMESPAN
       var response = await fetch('http://' + document.location.host + '/control?CYCLE_TIMESPAN=' + slider.value,
       {
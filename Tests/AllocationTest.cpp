@@ -0,0 +1,285 @@
+/*
+ * Counts the heap allocations of the steady state draw and update
+ * paths of the display and the state machine (Same loop as
+ * 'RunAllocations()' in 'Benchmark.cpp', plus encoder steps)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include <new>
+#include "TestHelper.h"
+#include "HostTheme.h"
+#include "DisplayDriver.h"
+#include "StateMachine.h"
+#include "EncoderButtonDriver.h"
+#include "PumpDriver.h"
+#include "CountingST7789.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define ALLOCATIONTEST_THEME        "AperolSpritz"
+#define ALLOCATIONTEST_ITERATIONS   50
+#define ALLOCATIONTEST_PINA         8           // Same pins as the sketch
+#define ALLOCATIONTEST_PINB         11
+#define ALLOCATIONTEST_PINBUTTON    10
+
+//===============================================================
+// Global variables
+//===============================================================
+static SPIClass Spi(HSPI);
+static CountingST7789 Tft(&Spi, -1, -1, -1);
+
+static bool IsCounting = false;
+static uint32_t AllocationCount = 0;
+static void* volatile HookPointer = NULL;
+
+//===============================================================
+// Allocation hooks. Arduino strings and containers allocate with
+// 'new', the sketch with 'malloc()' and 'ps_malloc()' (Only hooked
+// with the GNU C library)
+//===============================================================
+#ifdef __GLIBC__
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* pointer, size_t size);
+
+extern "C" void* malloc(size_t size)
+{
+  AllocationCount += IsCounting ? 1 : 0;
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size)
+{
+  AllocationCount += IsCounting ? 1 : 0;
+  return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* pointer, size_t size)
+{
+  AllocationCount += IsCounting ? 1 : 0;
+  return __libc_realloc(pointer, size);
+}
+#define ALLOCATIONTEST_MALLOC       __libc_malloc
+#else
+#define ALLOCATIONTEST_MALLOC       malloc
+#endif
+
+void* operator new(size_t size)
+{
+  AllocationCount += IsCounting ? 1 : 0;
+  void* pointer = ALLOCATIONTEST_MALLOC(size);
+  if (!pointer)
+  {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void* operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+  free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+  free(pointer);
+}
+
+void operator delete(void* pointer, size_t size) noexcept
+{
+  free(pointer);
+}
+
+void operator delete[](void* pointer, size_t size) noexcept
+{
+  free(pointer);
+}
+
+//===============================================================
+// Turns the encoder by one step (Quadrature edges like on the
+// device, each edge calls the interrupt function)
+//===============================================================
+static void TurnEncoder(int8_t direction)
+{
+  uint8_t firstPin = direction > 0 ? ALLOCATIONTEST_PINA : ALLOCATIONTEST_PINB;
+  uint8_t secondPin = direction > 0 ? ALLOCATIONTEST_PINB : ALLOCATIONTEST_PINA;
+  const uint8_t pins[4] = { firstPin, secondPin, firstPin, secondPin };
+  const uint8_t levels[4] = { LOW, LOW, HIGH, HIGH };
+  for (uint8_t edge = 0; edge < 4; edge++)
+  {
+    digitalWrite(pins[edge], levels[edge]);
+    if (pins[edge] == ALLOCATIONTEST_PINA)
+    {
+      EncoderButton.DoEncoderA();
+    }
+    else
+    {
+      EncoderButton.DoEncoderB();
+    }
+  }
+}
+
+//===============================================================
+// Runs one main loop of the sketch with an encoder step
+//===============================================================
+static void RunLoop(int8_t direction)
+{
+  TurnEncoder(direction);
+  Pumps.Update();
+  Statemachine.Execute(eMain);
+}
+
+//===============================================================
+// Starts counting after a first run, which may fill caches
+//===============================================================
+static void BeginCounting()
+{
+  AllocationCount = 0;
+  IsCounting = true;
+}
+
+//===============================================================
+// Stops counting and returns the allocations
+//===============================================================
+static uint32_t EndCounting()
+{
+  IsCounting = false;
+  return AllocationCount;
+}
+
+//===============================================================
+// Checks the hooks, so a zero count is meaningful
+//===============================================================
+static void TestHooks()
+{
+  BeginCounting();
+  String text = "Text longer than the small string buffer";
+  HookPointer = malloc(16);
+  uint32_t allocations = EndCounting();
+  free(HookPointer);
+
+  CHECK(text.length() > 0);
+#ifdef __GLIBC__
+  CHECK_EQUAL(2, allocations);
+#else
+  CHECK_EQUAL(1, allocations);
+#endif
+}
+
+//===============================================================
+// Partial draws of the benchmark loop
+//===============================================================
+static void TestPartialDraws()
+{
+  Display.DrawCurrentValues(false);
+  Display.DrawSettings(false);
+  Statemachine.GetMixtureString();
+
+  BeginCounting();
+  for (uint16_t index = 0; index < ALLOCATIONTEST_ITERATIONS; index++)
+  {
+    Display.DrawCurrentValues(false);
+    Display.DrawSettings(false);
+    Statemachine.GetMixtureString();
+  }
+  CHECK_EQUAL(0, EndCounting());
+}
+
+//===============================================================
+// Encoder steps on the dashboard (Values and doughnut partial)
+//===============================================================
+static void TestDashboardSteps()
+{
+  Statemachine.Execute(eEntry);
+  RunLoop(1);
+  RunLoop(-1);
+
+  int16_t angle = Statemachine.GetAngle(Statemachine.GetDashboardLiquid());
+  BeginCounting();
+  for (uint16_t index = 0; index < ALLOCATIONTEST_ITERATIONS; index++)
+  {
+    RunLoop(index % 2 == 0 ? 1 : -1);
+  }
+  uint32_t allocations = EndCounting();
+
+  // Steps were applied and drawn
+  RunLoop(1);
+  CHECK(Statemachine.GetAngle(Statemachine.GetDashboardLiquid()) != angle);
+  CHECK_EQUAL(0, allocations);
+}
+
+//===============================================================
+// Web updates of all values at once
+//===============================================================
+static void TestWebUpdates()
+{
+  int16_t forward_Degrees[3] = { STEPANGLE_DEGREES, 0, 0 };
+  int16_t backward_Degrees[3] = { -STEPANGLE_DEGREES, 0, 0 };
+  Statemachine.UpdateValuesFromWifi(forward_Degrees, 0);
+  Statemachine.UpdateValuesFromWifi(backward_Degrees, 0);
+
+  BeginCounting();
+  for (uint16_t index = 0; index < ALLOCATIONTEST_ITERATIONS; index++)
+  {
+    Statemachine.UpdateValuesFromWifi(index % 2 == 0 ? forward_Degrees : backward_Degrees, 0);
+  }
+  CHECK_EQUAL(0, EndCounting());
+}
+
+//===============================================================
+// Screen saver frames
+//===============================================================
+static void TestScreenSaver()
+{
+  Display.ShowScreenSaverPage();
+  Display.DrawScreenSaver();
+
+  BeginCounting();
+  for (uint16_t index = 0; index < ALLOCATIONTEST_ITERATIONS; index++)
+  {
+    Display.DrawScreenSaver();
+  }
+  CHECK_EQUAL(0, EndCounting());
+}
+
+//===============================================================
+// Loads the mixer theme and counts the allocations per loop
+//===============================================================
+int main()
+{
+  if (!BeginHostTheme(ALLOCATIONTEST_THEME, "ALLOCATIONTEST_ROOT", "AllocationPartition"))
+  {
+    return 1;
+  }
+
+  Display.Begin(&Tft);
+  if (!Config.Begin())
+  {
+    fprintf(stderr, "Failed to load theme '%s'\n", ALLOCATIONTEST_THEME);
+    return 1;
+  }
+  EncoderButton.Begin(ALLOCATIONTEST_PINA, ALLOCATIONTEST_PINB, ALLOCATIONTEST_PINBUTTON);
+  Statemachine.Begin(-1);
+  Display.LoadImages();
+
+  RUN_TEST(TestHooks);
+  RUN_TEST(TestPartialDraws);
+  RUN_TEST(TestDashboardSteps);
+  RUN_TEST(TestWebUpdates);
+  RUN_TEST(TestScreenSaver);
+
+  FileSystem.End();
+  return TEST_RESULT();
+}
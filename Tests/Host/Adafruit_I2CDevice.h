@@ -0,0 +1,13 @@
+/*
+ * Replaces the I2C device of the bus library for the host tests
+ * (Only included by the display library, no I2C displays are used)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ADAFRUIT_I2CDEVICE_H
+#define ADAFRUIT_I2CDEVICE_H
+
+#endif
@@ -0,0 +1,13 @@
+/*
+ * Replaces the SPI device of the bus library for the host tests
+ * (Only included by the display library, see 'Adafruit_SPITFT.h')
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ADAFRUIT_SPIDEVICE_H
+#define ADAFRUIT_SPIDEVICE_H
+
+#endif
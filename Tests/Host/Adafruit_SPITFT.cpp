@@ -0,0 +1,288 @@
+/*
+ * Replaces the SPI panel base class of the display library for the
+ * host tests with a virtual panel
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "Adafruit_SPITFT.h"
+
+//===============================================================
+// Constructors
+//===============================================================
+Adafruit_SPITFT::Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t mosi, int8_t sck, int8_t rst, int8_t miso) :
+  Adafruit_GFX(w, h),
+  _rst(rst),
+  _cs(cs),
+  _dc(dc)
+{
+}
+
+Adafruit_SPITFT::Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst) :
+  Adafruit_GFX(w, h),
+  _rst(rst),
+  _cs(cs),
+  _dc(dc)
+{
+}
+
+Adafruit_SPITFT::Adafruit_SPITFT(uint16_t w, uint16_t h, SPIClass* spiClass, int8_t cs, int8_t dc, int8_t rst) :
+  Adafruit_GFX(w, h),
+  _rst(rst),
+  _cs(cs),
+  _dc(dc)
+{
+}
+
+//===============================================================
+// Initializes the bus
+//===============================================================
+void Adafruit_SPITFT::initSPI(uint32_t freq, uint8_t spiMode)
+{
+  _freq = freq;
+}
+
+//===============================================================
+// Sends a command with its parameters
+//===============================================================
+void Adafruit_SPITFT::sendCommand(uint8_t commandByte, uint8_t* dataBytes, uint8_t numDataBytes)
+{
+  sendCommand(commandByte, (const uint8_t*)dataBytes, numDataBytes);
+}
+
+void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t* dataBytes, uint8_t numDataBytes)
+{
+  writeCommand(commandByte);
+  for (uint8_t index = 0; index < numDataBytes; index++)
+  {
+    spiWrite(dataBytes[index]);
+  }
+}
+
+//===============================================================
+// Sends a command byte, pixel data starts at the window origin
+//===============================================================
+void Adafruit_SPITFT::writeCommand(uint8_t cmd)
+{
+  _busBytes++;
+  _command = cmd;
+  _parameterCount = 0;
+  if (_command == SPITFT_RAMWR)
+  {
+    _column = _columnStart;
+    _row = _rowStart;
+  }
+}
+
+//===============================================================
+// Sends a data byte and decodes it like the panel controller
+//===============================================================
+void Adafruit_SPITFT::spiWrite(uint8_t b)
+{
+  _busBytes++;
+  switch (_command)
+  {
+    case SPITFT_CASET:
+    case SPITFT_RASET:
+      if (_parameterCount < sizeof(_parameters))
+      {
+        _parameters[_parameterCount++] = b;
+      }
+      if (_parameterCount == sizeof(_parameters))
+      {
+        uint16_t start = (_parameters[0] << 8) | _parameters[1];
+        uint16_t end = (_parameters[2] << 8) | _parameters[3];
+        (_command == SPITFT_CASET ? _columnStart : _rowStart) = start;
+        (_command == SPITFT_CASET ? _columnEnd : _rowEnd) = end;
+      }
+      break;
+
+    case SPITFT_RAMWR:
+      // Pixels are sent high byte first
+      _parameters[_parameterCount++] = b;
+      if (_parameterCount == 2)
+      {
+        WriteGramPixel((_parameters[0] << 8) | _parameters[1]);
+        _parameterCount = 0;
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+//===============================================================
+// Sends 16 and 32 bit data high byte first
+//===============================================================
+void Adafruit_SPITFT::SPI_WRITE16(uint16_t w)
+{
+  if (_command == SPITFT_RAMWR &&
+    _parameterCount == 0)
+  {
+    // Shortcut for whole pixels
+    _busBytes += 2;
+    WriteGramPixel(w);
+    return;
+  }
+  spiWrite(w >> 8);
+  spiWrite(w);
+}
+
+void Adafruit_SPITFT::SPI_WRITE32(uint32_t l)
+{
+  SPI_WRITE16(l >> 16);
+  SPI_WRITE16(l);
+}
+
+//===============================================================
+// Draws a single pixel (Clipped to the screen)
+//===============================================================
+void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t color)
+{
+  if (x >= 0 && x < _width && y >= 0 && y < _height)
+  {
+    setAddrWindow(x, y, 1, 1);
+    SPI_WRITE16(color);
+  }
+}
+
+//===============================================================
+// Sends pixels into the current address window
+//===============================================================
+void Adafruit_SPITFT::writePixels(uint16_t* colors, uint32_t len, bool block, bool bigEndian)
+{
+  for (uint32_t index = 0; index < len; index++)
+  {
+    SPI_WRITE16(bigEndian ? (uint16_t)((colors[index] << 8) | (colors[index] >> 8)) : colors[index]);
+  }
+}
+
+//===============================================================
+// Sends a color repeatedly into the current address window
+//===============================================================
+void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len)
+{
+  while (len-- > 0)
+  {
+    SPI_WRITE16(color);
+  }
+}
+
+//===============================================================
+// Fills a rectangle (Clipped to the screen like the library)
+//===============================================================
+void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if (w < 0)
+  {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0)
+  {
+    y += h + 1;
+    h = -h;
+  }
+  int16_t x2 = x + w - 1;
+  int16_t y2 = y + h - 1;
+  if (w == 0 || h == 0 || x >= _width || y >= _height || x2 < 0 || y2 < 0)
+  {
+    return;
+  }
+  if (x < 0)
+  {
+    x = 0;
+    w = x2 + 1;
+  }
+  if (y < 0)
+  {
+    y = 0;
+    h = y2 + 1;
+  }
+  w = x2 >= _width ? _width - x : w;
+  h = y2 >= _height ? _height - y : h;
+
+  setAddrWindow(x, y, w, h);
+  writeColor(color, (uint32_t)w * h);
+}
+
+//===============================================================
+// Draws a bitmap with one address window (Clipped to the screen)
+//===============================================================
+void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t* pcolors, int16_t w, int16_t h)
+{
+  int16_t x2 = x + w - 1;
+  int16_t y2 = y + h - 1;
+  if (x >= _width || y >= _height || x2 < 0 || y2 < 0)
+  {
+    return;
+  }
+
+  int16_t bitmapX = 0;
+  int16_t bitmapY = 0;
+  int16_t bitmapWidth = w;
+  if (x < 0)
+  {
+    w += x;
+    bitmapX = -x;
+    x = 0;
+  }
+  if (y < 0)
+  {
+    h += y;
+    bitmapY = -y;
+    y = 0;
+  }
+  w = x2 >= _width ? _width - x : w;
+  h = y2 >= _height ? _height - y : h;
+
+  pcolors += bitmapY * bitmapWidth + bitmapX;
+  setAddrWindow(x, y, w, h);
+  while (h-- > 0)
+  {
+    writePixels(pcolors, w);
+    pcolors += bitmapWidth;
+  }
+}
+
+//===============================================================
+// Inverts the display colors
+//===============================================================
+void Adafruit_SPITFT::invertDisplay(bool i)
+{
+  writeCommand(i ? invertOnCommand : invertOffCommand);
+}
+
+//===============================================================
+// Returns a pixel of the frame memory
+//===============================================================
+uint16_t Adafruit_SPITFT::GetGramPixel(uint16_t x, uint16_t y) const
+{
+  return x < SPITFT_GRAMSIZE && y < SPITFT_GRAMSIZE ? _gram[y * SPITFT_GRAMSIZE + x] : 0;
+}
+
+//===============================================================
+// Writes a pixel at the current address and moves to the next
+// address (Wraps inside the window like the panel controller)
+//===============================================================
+void Adafruit_SPITFT::WriteGramPixel(uint16_t color)
+{
+  if (_column < SPITFT_GRAMSIZE && _row < SPITFT_GRAMSIZE)
+  {
+    _gram[_row * SPITFT_GRAMSIZE + _column] = color;
+  }
+  if (++_column > _columnEnd)
+  {
+    _column = _columnStart;
+    if (++_row > _rowEnd)
+    {
+      _row = _rowStart;
+    }
+  }
+}
@@ -0,0 +1,116 @@
+/*
+ * Replaces the SPI panel base class of the display library for the
+ * host tests with a virtual panel
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ADAFRUIT_SPITFT_H
+#define ADAFRUIT_SPITFT_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <SPI.h>
+#include "Adafruit_GFX.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define SPITFT_GRAMSIZE             320         // Addresses of the ST7789 in any orientation (240x320 panel)
+#define SPITFT_CASET                0x2A        // Commands decoded by the virtual panel
+#define SPITFT_RASET                0x2B
+#define SPITFT_RAMWR                0x2C
+
+//===============================================================
+// Virtual SPI panel with the same interface as the library class
+// The bytes of the bus are decoded like by the panel controller:
+// CASET and RASET set the address window, RAMWR writes the
+// following pixels into the frame memory. So the real panel
+// drivers (Adafruit_ST77xx/ST7789) run unchanged on the host.
+// The orientation (MADCTL) is not decoded, the frame memory is
+// kept in addresses of the panel
+//===============================================================
+class Adafruit_SPITFT : public Adafruit_GFX
+{
+  public:
+    // Constructors (Pins and SPI class are not used)
+    Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t mosi, int8_t sck, int8_t rst = -1, int8_t miso = -1);
+    Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst = -1);
+    Adafruit_SPITFT(uint16_t w, uint16_t h, SPIClass* spiClass, int8_t cs, int8_t dc, int8_t rst = -1);
+
+    // Destructor
+    ~Adafruit_SPITFT() {}
+
+    // Functions of the panel drivers
+    virtual void begin(uint32_t freq) = 0;
+    virtual void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) = 0;
+
+    // Bus functions
+    void initSPI(uint32_t freq = 0, uint8_t spiMode = SPI_MODE0);
+    void setSPISpeed(uint32_t freq) { _freq = freq; }
+    void startWrite(void) {}
+    void endWrite(void) {}
+    void sendCommand(uint8_t commandByte, uint8_t* dataBytes, uint8_t numDataBytes);
+    void sendCommand(uint8_t commandByte, const uint8_t* dataBytes = NULL, uint8_t numDataBytes = 0);
+    void spiWrite(uint8_t b);
+    void writeCommand(uint8_t cmd);
+    void write16(uint16_t w) { SPI_WRITE16(w); }
+    void SPI_WRITE16(uint16_t w);
+    void SPI_WRITE32(uint32_t l);
+    void dmaWait(void) {}
+
+    // Drawing functions within startWrite() and endWrite()
+    void writePixel(int16_t x, int16_t y, uint16_t color);
+    void writePixels(uint16_t* colors, uint32_t len, bool block = true, bool bigEndian = false);
+    void writeColor(uint16_t color, uint32_t len);
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { writeFillRect(x, y, w, 1, color); }
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { writeFillRect(x, y, 1, h, color); }
+
+    // Drawing functions with their own transaction
+    void drawPixel(int16_t x, int16_t y, uint16_t color) { writePixel(x, y, color); }
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) { writeFillRect(x, y, w, h, color); }
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { writeFillRect(x, y, w, 1, color); }
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { writeFillRect(x, y, 1, h, color); }
+    void drawRGBBitmap(int16_t x, int16_t y, uint16_t* pcolors, int16_t w, int16_t h);
+    void invertDisplay(bool i);
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) { return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3); }
+
+    // Returns a pixel of the frame memory (Address of the panel, 0 outside)
+    uint16_t GetGramPixel(uint16_t x, uint16_t y) const;
+
+    // Returns the count of bytes sent over the bus since start
+    uint64_t GetBusBytes() const { return _busBytes; }
+
+  protected:
+    // Variables of the library class, used by the panel drivers
+    int8_t _rst = -1;
+    int8_t _cs = -1;
+    int8_t _dc = -1;
+    int16_t _xstart = 0;
+    int16_t _ystart = 0;
+    uint8_t invertOnCommand = 0;
+    uint8_t invertOffCommand = 0;
+    uint32_t _freq = 0;
+
+  private:
+    // Frame memory of the panel
+    uint16_t _gram[SPITFT_GRAMSIZE * SPITFT_GRAMSIZE] = {};
+
+    // Decoder state of the bus
+    uint8_t _command = 0;
+    uint8_t _parameters[4] = {};
+    uint8_t _parameterCount = 0;
+    uint16_t _columnStart = 0, _columnEnd = 0, _rowStart = 0, _rowEnd = 0;
+    uint16_t _column = 0, _row = 0;
+    uint64_t _busBytes = 0;
+
+    // Writes a pixel at the current address and moves to the next address
+    void WriteGramPixel(uint16_t color);
+};
+
+#endif
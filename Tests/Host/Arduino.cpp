@@ -0,0 +1,289 @@
+/*
+ * Includes the Arduino functions needed by the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "Arduino.h"
+#include <chrono>
+#include <thread>
+#include <cctype>
+
+//===============================================================
+// Global variables
+//===============================================================
+EspClass ESP;
+
+// Start of the test, the time functions count from here
+static const std::chrono::steady_clock::time_point StartTime = std::chrono::steady_clock::now();
+
+// Levels of the pins
+static uint8_t PinLevels[HOST_PINCOUNT];
+
+//===============================================================
+// Returns the milliseconds since start
+//===============================================================
+unsigned long millis()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - StartTime).count();
+}
+
+//===============================================================
+// Returns the microseconds since start
+//===============================================================
+unsigned long micros()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - StartTime).count();
+}
+
+//===============================================================
+// Waits some milliseconds
+//===============================================================
+void delay(unsigned long time_ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(time_ms));
+}
+
+//===============================================================
+// Sets the mode of a pin (Inputs with pull up are high)
+//===============================================================
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  if (mode == INPUT_PULLUP)
+  {
+    digitalWrite(pin, HIGH);
+  }
+}
+
+//===============================================================
+// Sets the level of a pin
+//===============================================================
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  if (pin < HOST_PINCOUNT)
+  {
+    PinLevels[pin] = value;
+  }
+}
+
+//===============================================================
+// Returns the level of a pin
+//===============================================================
+int digitalRead(uint8_t pin)
+{
+  return pin < HOST_PINCOUNT ? PinLevels[pin] : LOW;
+}
+
+//===============================================================
+// Returns a random number in a range (Upper limit excluded)
+//===============================================================
+long random(long maxValue)
+{
+  return maxValue > 0 ? rand() % maxValue : 0;
+}
+
+long random(long minValue, long maxValue)
+{
+  return minValue < maxValue ? minValue + random(maxValue - minValue) : minValue;
+}
+
+//===============================================================
+// Converts a floating point value into a string
+//===============================================================
+char* dtostrf(double value, signed char width, unsigned char precision, char* buffer)
+{
+  sprintf(buffer, "%*.*f", width, precision, value);
+  return buffer;
+}
+
+//===============================================================
+// Copies a string, the destination is always null terminated
+//===============================================================
+size_t strlcpy(char* destination, const char* source, size_t size)
+{
+  size_t length = strlen(source);
+  if (size > 0)
+  {
+    size_t copyLength = min(length, size - 1);
+    memcpy(destination, source, copyLength);
+    destination[copyLength] = '\0';
+  }
+  return length;
+}
+
+//===============================================================
+// Writes a buffer byte by byte
+//===============================================================
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+  size_t written = 0;
+  while (size-- > 0 &&
+    write(*buffer++) == 1)
+  {
+    written++;
+  }
+  return written;
+}
+
+//===============================================================
+// Prints strings and numbers as text
+//===============================================================
+size_t Print::print(const String& text)
+{
+  return write((const uint8_t*)text.c_str(), text.length());
+}
+
+size_t Print::print(long value, int base)
+{
+  char buffer[24];
+  snprintf(buffer, sizeof(buffer), base == HEX ? "%lX" : "%ld", value);
+  return write(buffer);
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+  char buffer[24];
+  snprintf(buffer, sizeof(buffer), base == HEX ? "%lX" : "%lu", value);
+  return write(buffer);
+}
+
+size_t Print::print(double value, int decimals)
+{
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+  return write(buffer);
+}
+
+//===============================================================
+// Reads until the length is reached or the stream is empty
+//===============================================================
+size_t Stream::readBytes(char* buffer, size_t length)
+{
+  size_t count = 0;
+  int character;
+  while (count < length &&
+    (character = read()) >= 0)
+  {
+    buffer[count++] = (char)character;
+  }
+  return count;
+}
+
+//===============================================================
+// String functions
+//===============================================================
+String::String(double value, unsigned int decimals)
+{
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+  _text = buffer;
+}
+
+bool String::equalsIgnoreCase(const String& text) const
+{
+  return _text.size() == text._text.size() &&
+    std::equal(_text.begin(), _text.end(), text._text.begin(), [](char character1, char character2)
+    {
+      return tolower(character1) == tolower(character2);
+    });
+}
+
+bool String::endsWith(const String& text) const
+{
+  return _text.size() >= text._text.size() &&
+    _text.compare(_text.size() - text._text.size(), text._text.size(), text._text) == 0;
+}
+
+int String::indexOf(char character, unsigned int from) const
+{
+  size_t position = _text.find(character, from);
+  return position == std::string::npos ? -1 : (int)position;
+}
+
+int String::indexOf(const String& text, unsigned int from) const
+{
+  size_t position = _text.find(text._text, from);
+  return position == std::string::npos ? -1 : (int)position;
+}
+
+int String::lastIndexOf(char character) const
+{
+  size_t position = _text.rfind(character);
+  return position == std::string::npos ? -1 : (int)position;
+}
+
+String String::substring(unsigned int begin, unsigned int end) const
+{
+  if (begin > end)
+  {
+    std::swap(begin, end);
+  }
+  begin = min(begin, (unsigned int)_text.size());
+  end = min(end, (unsigned int)_text.size());
+  return String(_text.substr(begin, end - begin));
+}
+
+void String::replace(const String& find, const String& replace)
+{
+  if (find._text.empty())
+  {
+    return;
+  }
+  size_t position = 0;
+  while ((position = _text.find(find._text, position)) != std::string::npos)
+  {
+    _text.replace(position, find._text.size(), replace._text);
+    position += replace._text.size();
+  }
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+  if (index < _text.size())
+  {
+    _text.erase(index, count);
+  }
+}
+
+void String::toLowerCase()
+{
+  std::transform(_text.begin(), _text.end(), _text.begin(), [](char character) { return (char)tolower(character); });
+}
+
+void String::toUpperCase()
+{
+  std::transform(_text.begin(), _text.end(), _text.begin(), [](char character) { return (char)toupper(character); });
+}
+
+void String::trim()
+{
+  size_t begin = _text.find_first_not_of(" \t\r\n");
+  size_t end = _text.find_last_not_of(" \t\r\n");
+  _text = begin == std::string::npos ? std::string() : _text.substr(begin, end - begin + 1);
+}
+
+String operator+(const String& text1, const String& text2)
+{
+  String result = text1;
+  result += text2;
+  return result;
+}
+
+String operator+(const String& text1, const char* text2)
+{
+  String result = text1;
+  result += text2;
+  return result;
+}
+
+String operator+(const char* text1, const String& text2)
+{
+  String result = text1;
+  result += text2;
+  return result;
+}
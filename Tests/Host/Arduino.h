@@ -0,0 +1,196 @@
+/*
+ * Includes the Arduino functions needed by the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+class String;
+class __FlashStringHelper;
+
+//===============================================================
+// Defines
+//===============================================================
+#define PROGMEM
+#define pgm_read_byte(addr)         (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)         (*(const uint16_t*)(addr))
+#define IRAM_ATTR
+#define F(text)                     ((const __FlashStringHelper*)(text))
+#define DEC                         10
+#define HEX                         16
+#define LOW                         0x0
+#define HIGH                        0x1
+#define INPUT                       0x01
+#define OUTPUT                      0x03
+#define INPUT_PULLUP                0x05
+#define HOST_PINCOUNT               64
+
+#ifndef constrain
+#define constrain(amt, low, high)   ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+//===============================================================
+// Functions
+//===============================================================
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long time_ms);
+
+// PSRAM is plain heap on the host
+inline void* ps_malloc(size_t size) { return malloc(size); }
+inline void* ps_calloc(size_t count, size_t size) { return calloc(count, size); }
+inline void* ps_realloc(void* pointer, size_t size) { return realloc(pointer, size); }
+
+// Random numbers (Same sequence in every run)
+long random(long maxValue);
+long random(long minValue, long maxValue);
+inline void randomSeed(unsigned long seed) { srand(seed); }
+
+// Converts a floating point value into a string
+char* dtostrf(double value, signed char width, unsigned char precision, char* buffer);
+
+// Missing in older C libraries
+size_t strlcpy(char* destination, const char* source, size_t size);
+
+// Pins only keep their level, tests drive inputs with 'digitalWrite()'
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+inline void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0) {}
+
+//===============================================================
+// Class for printing (Base of files, used by ArduinoJson)
+//===============================================================
+class Print
+{
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t value) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+    size_t print(const char* text) { return write(text); }
+    size_t print(const String& text);
+    size_t print(char character) { return write((uint8_t)character); }
+    size_t print(int value, int base = DEC) { return print((long)value, base); }
+    size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(double value, int decimals = 2);
+};
+
+//===============================================================
+// Class for streams (Base of files, used by ArduinoJson)
+//===============================================================
+class Stream : public Print
+{
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    size_t readBytes(char* buffer, size_t length);
+    size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+};
+
+//===============================================================
+// Class for strings (Subset of the Arduino 'String' on top of
+// 'std::string')
+//===============================================================
+class String
+{
+  public:
+    String(const char* text = "") : _text(text ? text : "") {}
+    String(const std::string& text) : _text(text) {}
+    String(char character) : _text(1, character) {}
+    String(int value) : _text(std::to_string(value)) {}
+    String(unsigned int value) : _text(std::to_string(value)) {}
+    String(long value) : _text(std::to_string(value)) {}
+    String(unsigned long value) : _text(std::to_string(value)) {}
+    String(double value, unsigned int decimals = 2);
+
+    String& operator=(const char* text) { _text = text ? text : ""; return *this; }
+    String& operator+=(const String& text) { _text += text._text; return *this; }
+    String& operator+=(const char* text) { _text += text; return *this; }
+    String& operator+=(char character) { _text += character; return *this; }
+    bool operator==(const String& text) const { return _text == text._text; }
+    bool operator==(const char* text) const { return _text == text; }
+    bool operator!=(const String& text) const { return _text != text._text; }
+    bool operator!=(const char* text) const { return _text != text; }
+    bool operator<(const String& text) const { return _text < text._text; }
+    char operator[](unsigned int index) const { return index < _text.size() ? _text[index] : '\0'; }
+
+    const char* c_str() const { return _text.c_str(); }
+    unsigned int length() const { return _text.size(); }
+    bool isEmpty() const { return _text.empty(); }
+    bool reserve(unsigned int size) { _text.reserve(size); return true; }
+    bool concat(const char* text) { _text += text ? text : ""; return true; }
+    bool concat(const char* text, unsigned int length) { _text.append(text, length); return true; }
+    bool equals(const String& text) const { return _text == text._text; }
+    bool equalsIgnoreCase(const String& text) const;
+    bool startsWith(const String& text) const { return _text.compare(0, text._text.size(), text._text) == 0; }
+    bool endsWith(const String& text) const;
+    int indexOf(char character, unsigned int from = 0) const;
+    int indexOf(const String& text, unsigned int from = 0) const;
+    int lastIndexOf(char character) const;
+    String substring(unsigned int begin) const { return substring(begin, _text.size()); }
+    String substring(unsigned int begin, unsigned int end) const;
+    void replace(const String& find, const String& replace);
+    void remove(unsigned int index) { remove(index, _text.size()); }
+    void remove(unsigned int index, unsigned int count);
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+    long toInt() const { return strtol(_text.c_str(), NULL, 10); }
+
+  private:
+    std::string _text;
+};
+
+String operator+(const String& text1, const String& text2);
+String operator+(const String& text1, const char* text2);
+String operator+(const char* text1, const String& text2);
+
+//===============================================================
+// Class for the chip information
+//===============================================================
+class EspClass
+{
+  public:
+    uint32_t getHeapSize() { return 320 * 1024; }
+    uint32_t getFreeHeap() { return 256 * 1024; }
+    uint32_t getMaxAllocHeap() { return 128 * 1024; }
+    uint32_t getPsramSize() { return 2 * 1024 * 1024; }
+    uint32_t getFreePsram() { return 2 * 1024 * 1024; }
+    uint32_t getMaxAllocPsram() { return 2 * 1024 * 1024; }
+    void restart() { exit(0); }
+};
+
+//===============================================================
+// Global variables
+//===============================================================
+extern EspClass ESP;
+
+#endif
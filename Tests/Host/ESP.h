@@ -0,0 +1,18 @@
+/*
+ * Includes the chip information for the host tests (Declared in
+ * 'Arduino.h')
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ESP_H
+#define ESP_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include "Arduino.h"
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * Declares the web server types used by the headers of the web
+ * modules for the host tests (The web server itself does not run
+ * on the host)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ESPASYNCWEBSERVER_H
+#define ESPASYNCWEBSERVER_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <functional>
+#include "Arduino.h"
+#include "FS.h"
+
+//===============================================================
+// Types
+//===============================================================
+class AsyncWebServer;
+class AsyncWebServerRequest;
+class AsyncWebSocketClient;
+
+typedef enum
+{
+  WS_EVT_CONNECT,
+  WS_EVT_DISCONNECT,
+  WS_EVT_PING,
+  WS_EVT_PONG,
+  WS_EVT_ERROR,
+  WS_EVT_DATA
+} AwsEventType;
+
+typedef std::function<void(void)> ArMiddlewareNext;
+
+//===============================================================
+// Web socket (Never has clients on the host)
+//===============================================================
+class AsyncWebSocket
+{
+  public:
+    size_t count() const { return 0; }
+};
+
+//===============================================================
+// Base class of the request handlers
+//===============================================================
+class AsyncWebHandler
+{
+  public:
+    virtual ~AsyncWebHandler() {}
+    virtual bool canHandle(AsyncWebServerRequest* request) const { return false; }
+    virtual void handleRequest(AsyncWebServerRequest* request) {}
+    virtual void handleUpload(AsyncWebServerRequest* request, const String& fileName, size_t index, uint8_t* data, size_t length, bool final) {}
+    virtual void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t length, size_t index, size_t total) {}
+    virtual bool isRequestHandlerTrivial() const { return true; }
+};
+
+//===============================================================
+// Base class of the middlewares
+//===============================================================
+class AsyncMiddleware
+{
+  public:
+    virtual ~AsyncMiddleware() {}
+    virtual void run(AsyncWebServerRequest* request, ArMiddlewareNext next) { next(); }
+};
+
+#endif
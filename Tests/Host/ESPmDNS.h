@@ -0,0 +1,13 @@
+/*
+ * Declares the mDNS responder for the host tests (Only included
+ * by the headers of the web modules)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ESPMDNS_H
+#define ESPMDNS_H
+
+#endif
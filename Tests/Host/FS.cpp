@@ -0,0 +1,87 @@
+/*
+ * Includes the Arduino file system classes needed by the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "FS.h"
+
+using namespace fs;
+
+//===============================================================
+// Reads a single byte (-1 at the end)
+//===============================================================
+int File::read()
+{
+  uint8_t value;
+  return read(&value, 1) == 1 ? value : -1;
+}
+
+//===============================================================
+// Returns the next byte without reading it (-1 at the end)
+//===============================================================
+int File::peek()
+{
+  if (!_impl)
+  {
+    return -1;
+  }
+  size_t position = _impl->position();
+  int value = read();
+  _impl->seek(position, SeekSet);
+  return value;
+}
+
+//===============================================================
+// Closes the file
+//===============================================================
+void File::close()
+{
+  if (_impl)
+  {
+    _impl->close();
+    _impl = NULL;
+  }
+}
+
+//===============================================================
+// File system functions (Paths must start with '/')
+//===============================================================
+File FS::open(const char* path, const char* mode, const bool create)
+{
+  if (!_impl || !path || path[0] != '/')
+  {
+    return File();
+  }
+  return File(_impl->open(path, mode, create));
+}
+
+bool FS::exists(const char* path)
+{
+  return _impl && path && _impl->exists(path);
+}
+
+bool FS::remove(const char* path)
+{
+  return _impl && path && _impl->remove(path);
+}
+
+bool FS::rename(const char* pathFrom, const char* pathTo)
+{
+  return _impl && pathFrom && pathTo && _impl->rename(pathFrom, pathTo);
+}
+
+bool FS::mkdir(const char* path)
+{
+  return _impl && path && _impl->mkdir(path);
+}
+
+bool FS::rmdir(const char* path)
+{
+  return _impl && path && _impl->rmdir(path);
+}
@@ -0,0 +1,147 @@
+/*
+ * Includes the Arduino file system classes needed by the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef FS_H
+#define FS_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <memory>
+#include "Arduino.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define FILE_READ                   "r"
+#define FILE_WRITE                  "w"
+#define FILE_APPEND                 "a"
+
+namespace fs
+{
+
+//===============================================================
+// Enums
+//===============================================================
+enum SeekMode
+{
+  SeekSet = 0,
+  SeekCur = 1,
+  SeekEnd = 2
+};
+
+//===============================================================
+// Interface of an opened file or directory
+//===============================================================
+class FileImpl;
+typedef std::shared_ptr<FileImpl> FileImplPtr;
+
+class FileImpl
+{
+  public:
+    virtual ~FileImpl() {}
+    virtual size_t write(const uint8_t* buffer, size_t size) = 0;
+    virtual size_t read(uint8_t* buffer, size_t size) = 0;
+    virtual void flush() = 0;
+    virtual bool seek(uint32_t position, SeekMode mode) = 0;
+    virtual size_t position() const = 0;
+    virtual size_t size() const = 0;
+    virtual void close() = 0;
+    virtual const char* path() const = 0;
+    virtual const char* name() const = 0;
+    virtual bool isDirectory() = 0;
+    virtual FileImplPtr openNextFile(const char* mode) = 0;
+    virtual void rewindDirectory() = 0;
+    virtual operator bool() = 0;
+};
+
+//===============================================================
+// Class for an opened file or directory
+//===============================================================
+class File : public Stream
+{
+  public:
+    File(FileImplPtr impl = FileImplPtr()) : _impl(impl) {}
+
+    size_t write(uint8_t value) override { return write(&value, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override { return _impl ? _impl->write(buffer, size) : 0; }
+    int available() override { return _impl ? (int)(_impl->size() - _impl->position()) : 0; }
+    int read() override;
+    int peek() override;
+    size_t read(uint8_t* buffer, size_t size) { return _impl ? _impl->read(buffer, size) : 0; }
+    void flush() { if (_impl) _impl->flush(); }
+    bool seek(uint32_t position, SeekMode mode = SeekSet) { return _impl && _impl->seek(position, mode); }
+    size_t position() const { return _impl ? _impl->position() : 0; }
+    size_t size() const { return _impl ? _impl->size() : 0; }
+    void close();
+    operator bool() const { return _impl && (bool)*_impl; }
+    const char* path() const { return _impl ? _impl->path() : NULL; }
+    const char* name() const { return _impl ? _impl->name() : NULL; }
+    bool isDirectory() { return _impl && _impl->isDirectory(); }
+    File openNextFile(const char* mode = FILE_READ) { return _impl ? File(_impl->openNextFile(mode)) : File(); }
+    void rewindDirectory() { if (_impl) _impl->rewindDirectory(); }
+
+  private:
+    FileImplPtr _impl;
+};
+
+//===============================================================
+// Interface of a file system
+//===============================================================
+class FSImpl
+{
+  public:
+    virtual ~FSImpl() {}
+    virtual FileImplPtr open(const char* path, const char* mode, const bool create) = 0;
+    virtual bool exists(const char* path) = 0;
+    virtual bool rename(const char* pathFrom, const char* pathTo) = 0;
+    virtual bool remove(const char* path) = 0;
+    virtual bool mkdir(const char* path) = 0;
+    virtual bool rmdir(const char* path) = 0;
+    virtual void mountpoint(const char* mountpoint) = 0;
+    virtual const char* mountpoint() = 0;
+};
+
+typedef std::shared_ptr<FSImpl> FSImplPtr;
+
+//===============================================================
+// Class for a file system
+//===============================================================
+class FS
+{
+  public:
+    FS(FSImplPtr impl) : _impl(impl) {}
+    virtual ~FS() {}
+
+    File open(const char* path, const char* mode = FILE_READ, const bool create = false);
+    File open(const String& path, const char* mode = FILE_READ, const bool create = false) { return open(path.c_str(), mode, create); }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool remove(const String& path) { return remove(path.c_str()); }
+    bool rename(const char* pathFrom, const char* pathTo);
+    bool rename(const String& pathFrom, const String& pathTo) { return rename(pathFrom.c_str(), pathTo.c_str()); }
+    bool mkdir(const char* path);
+    bool mkdir(const String& path) { return mkdir(path.c_str()); }
+    bool rmdir(const char* path);
+    bool rmdir(const String& path) { return rmdir(path.c_str()); }
+
+  protected:
+    FSImplPtr _impl;
+};
+
+}
+
+using fs::FS;
+using fs::File;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+#endif
@@ -0,0 +1,33 @@
+/*
+ * Includes the LittleFS file system for the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef LITTLEFS_H
+#define LITTLEFS_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include "vfs_api.h"
+
+namespace fs
+{
+
+//===============================================================
+// Class for LittleFS on the host partition
+//===============================================================
+class LittleFSFS : public HostPartitionFS
+{
+  public:
+    LittleFSFS() : HostPartitionFS("littlefs") {}
+};
+
+}
+
+extern fs::LittleFSFS LittleFS;
+
+#endif
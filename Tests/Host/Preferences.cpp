@@ -0,0 +1,104 @@
+/*
+ * Includes the preferences for the host tests (Kept in memory)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "Preferences.h"
+
+//===============================================================
+// Global variables
+//===============================================================
+std::map<std::string, std::string> Preferences::_values;
+
+//===============================================================
+// Opens a namespace
+//===============================================================
+bool Preferences::begin(const char* name, bool readOnly)
+{
+  _name = name;
+  _readOnly = readOnly;
+  _isOpen = true;
+  return true;
+}
+
+//===============================================================
+// Closes the namespace
+//===============================================================
+void Preferences::end()
+{
+  _isOpen = false;
+}
+
+//===============================================================
+// Returns true if the key exists
+//===============================================================
+bool Preferences::isKey(const char* key)
+{
+  return _isOpen && _values.count(GetKey(key)) > 0;
+}
+
+//===============================================================
+// Value functions (Only written in read/write mode)
+//===============================================================
+size_t Preferences::putChar(const char* key, int8_t value)
+{
+  return putString(key, String((int)value)) ? sizeof(value) : 0;
+}
+
+int8_t Preferences::getChar(const char* key, int8_t defaultValue)
+{
+  return isKey(key) ? (int8_t)atoi(_values[GetKey(key)].c_str()) : defaultValue;
+}
+
+size_t Preferences::putBool(const char* key, bool value)
+{
+  return putChar(key, value ? 1 : 0);
+}
+
+bool Preferences::getBool(const char* key, bool defaultValue)
+{
+  return getChar(key, defaultValue ? 1 : 0) != 0;
+}
+
+size_t Preferences::putLong(const char* key, int32_t value)
+{
+  return putString(key, String((long)value)) ? sizeof(value) : 0;
+}
+
+int32_t Preferences::getLong(const char* key, int32_t defaultValue)
+{
+  return isKey(key) ? (int32_t)atol(_values[GetKey(key)].c_str()) : defaultValue;
+}
+
+size_t Preferences::putDouble(const char* key, double value)
+{
+  char text[32];
+  snprintf(text, sizeof(text), "%.17g", value);
+  return putString(key, text) ? sizeof(value) : 0;
+}
+
+double Preferences::getDouble(const char* key, double defaultValue)
+{
+  return isKey(key) ? atof(_values[GetKey(key)].c_str()) : defaultValue;
+}
+
+size_t Preferences::putString(const char* key, const String& value)
+{
+  if (!_isOpen || _readOnly)
+  {
+    return 0;
+  }
+  _values[GetKey(key)] = value.c_str();
+  return value.length();
+}
+
+String Preferences::getString(const char* key, const String& defaultValue)
+{
+  return isKey(key) ? String(_values[GetKey(key)].c_str()) : defaultValue;
+}
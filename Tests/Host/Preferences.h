@@ -0,0 +1,50 @@
+/*
+ * Includes the preferences for the host tests (Kept in memory)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef PREFERENCES_H
+#define PREFERENCES_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <map>
+#include "Arduino.h"
+
+//===============================================================
+// Class for the preferences of a namespace
+//===============================================================
+class Preferences
+{
+  public:
+    bool begin(const char* name, bool readOnly = false);
+    void end();
+    bool isKey(const char* key);
+    size_t putChar(const char* key, int8_t value);
+    int8_t getChar(const char* key, int8_t defaultValue = 0);
+    size_t putBool(const char* key, bool value);
+    bool getBool(const char* key, bool defaultValue = false);
+    size_t putLong(const char* key, int32_t value);
+    int32_t getLong(const char* key, int32_t defaultValue = 0);
+    size_t putDouble(const char* key, double value);
+    double getDouble(const char* key, double defaultValue = NAN);
+    size_t putString(const char* key, const String& value);
+    String getString(const char* key, const String& defaultValue = String());
+
+  private:
+    std::string _name;
+    bool _readOnly = true;
+    bool _isOpen = false;
+
+    // Values of all namespaces
+    static std::map<std::string, std::string> _values;
+
+    // Returns the map key of a preference
+    std::string GetKey(const char* key) const { return _name + "/" + key; }
+};
+
+#endif
@@ -0,0 +1,18 @@
+/*
+ * Includes the print class of the Arduino core for the host tests
+ * (Part of 'Arduino.h', included by the display library)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef PRINT_H
+#define PRINT_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include "Arduino.h"
+
+#endif
@@ -0,0 +1,39 @@
+/*
+ * Replaces the SPI bus for the host tests (The virtual panel in
+ * 'Adafruit_SPITFT.h' decodes the bus itself)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef SPI_H
+#define SPI_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include "Arduino.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define FSPI                        0
+#define HSPI                        1
+#define SPI_MODE0                   0
+#define SPI_MODE1                   1
+#define SPI_MODE2                   2
+#define SPI_MODE3                   3
+
+//===============================================================
+// Class for a SPI bus (Nothing is sent)
+//===============================================================
+class SPIClass
+{
+  public:
+    SPIClass(uint8_t bus = HSPI) {}
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+    void end() {}
+};
+
+#endif
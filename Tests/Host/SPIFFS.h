@@ -0,0 +1,33 @@
+/*
+ * Includes the SPIFFS file system for the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef SPIFFS_H
+#define SPIFFS_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include "vfs_api.h"
+
+namespace fs
+{
+
+//===============================================================
+// Class for SPIFFS on the host partition
+//===============================================================
+class SPIFFSFS : public HostPartitionFS
+{
+  public:
+    SPIFFSFS() : HostPartitionFS("spiffs") {}
+};
+
+}
+
+extern fs::SPIFFSFS SPIFFS;
+
+#endif
@@ -0,0 +1,48 @@
+/*
+ * Includes the WiFi types needed by the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef WIFI_H
+#define WIFI_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include "Arduino.h"
+
+//===============================================================
+// Types
+//===============================================================
+typedef enum
+{
+  WIFI_MODE_NULL = 0,
+  WIFI_MODE_STA,
+  WIFI_MODE_AP,
+  WIFI_MODE_APSTA
+} wifi_mode_t;
+
+typedef enum
+{
+  WIFI_POWER_19_5dBm = 78,
+  WIFI_POWER_19dBm = 76,
+  WIFI_POWER_18_5dBm = 74,
+  WIFI_POWER_17dBm = 68,
+  WIFI_POWER_15dBm = 60,
+  WIFI_POWER_13dBm = 52,
+  WIFI_POWER_11dBm = 44,
+  WIFI_POWER_8_5dBm = 34,
+  WIFI_POWER_7dBm = 28,
+  WIFI_POWER_5dBm = 20,
+  WIFI_POWER_2dBm = 8,
+  WIFI_POWER_MINUS_1dBm = -4
+} wifi_power_t;
+
+#define WIFI_OFF                    WIFI_MODE_NULL
+#define WIFI_STA                    WIFI_MODE_STA
+#define WIFI_AP                     WIFI_MODE_AP
+
+#endif
@@ -0,0 +1,13 @@
+/*
+ * Declares the reset reasons of the ROM for the host tests (Only
+ * included by the header of the system helper)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef RTC_H
+#define RTC_H
+
+#endif
@@ -0,0 +1,29 @@
+/*
+ * Includes the ESP-IDF log macros needed by the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ESP_LOG_H
+#define ESP_LOG_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <stdio.h>
+
+//===============================================================
+// Defines (Errors to stderr, info only with 'HOST_LOG_INFO')
+//===============================================================
+#define ESP_LOGE(tag, format, ...)  fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)  fprintf(stderr, "W (%s) " format "\n", tag, ##__VA_ARGS__)
+#if HOST_LOG_INFO
+#define ESP_LOGI(tag, format, ...)  printf("I (%s) " format "\n", tag, ##__VA_ARGS__)
+#else
+#define ESP_LOGI(tag, format, ...)  do { if (0) printf("I (%s) " format "\n", tag, ##__VA_ARGS__); } while (0)
+#endif
+#define ESP_LOGD(tag, format, ...)  do { if (0) printf("D (%s) " format "\n", tag, ##__VA_ARGS__); } while (0)
+
+#endif
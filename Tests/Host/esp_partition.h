@@ -0,0 +1,87 @@
+/*
+ * Includes the flash partition table for the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ESP_PARTITION_H
+#define ESP_PARTITION_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <string.h>
+#include "vfs_api.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define ESP_OK                      0
+#define ESP_FAIL                    -1
+#define ESP_ERR_NOT_SUPPORTED       0x106
+
+//===============================================================
+// Types
+//===============================================================
+typedef int esp_err_t;
+typedef uint32_t esp_partition_mmap_handle_t;
+
+typedef enum
+{
+  ESP_PARTITION_MMAP_DATA = 0,
+  ESP_PARTITION_MMAP_INST = 1
+} esp_partition_mmap_memory_t;
+
+typedef enum
+{
+  ESP_PARTITION_TYPE_APP = 0x00,
+  ESP_PARTITION_TYPE_DATA = 0x01
+} esp_partition_type_t;
+
+typedef enum
+{
+  ESP_PARTITION_SUBTYPE_DATA_SPIFFS = 0x82,
+  ESP_PARTITION_SUBTYPE_ANY = 0xFF
+} esp_partition_subtype_t;
+
+//===============================================================
+// Partition of the flash
+//===============================================================
+typedef struct
+{
+  esp_partition_type_t type;
+  esp_partition_subtype_t subtype;
+  uint32_t address;
+  uint32_t size;
+  char label[17];
+} esp_partition_t;
+
+//===============================================================
+// Returns the host partition for the 'spiffs' label (See 'partitions.csv')
+//===============================================================
+inline const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label)
+{
+  static const esp_partition_t partition = { ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, 0x210000, HOST_PARTITIONSIZE, "spiffs" };
+  return type == ESP_PARTITION_TYPE_DATA && (!label || strcmp(label, partition.label) == 0) ? &partition : NULL;
+}
+
+//===============================================================
+// Partitions can not be mapped on the host
+//===============================================================
+inline esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size, esp_partition_mmap_memory_t memory, const void** outPointer, esp_partition_mmap_handle_t* outHandle)
+{
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+inline void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+}
+
+inline const char* esp_err_to_name(esp_err_t code)
+{
+  return code == ESP_OK ? "ESP_OK" : code == ESP_ERR_NOT_SUPPORTED ? "ESP_ERR_NOT_SUPPORTED" : "ESP_FAIL";
+}
+
+#endif
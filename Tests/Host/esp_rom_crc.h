@@ -0,0 +1,35 @@
+/*
+ * Replaces the CRC functions of the ROM for the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef ESP_ROM_CRC_H
+#define ESP_ROM_CRC_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <stdint.h>
+
+//===============================================================
+// Returns the CRC-32 (Little endian, continues a previous CRC
+// like the ROM function)
+//===============================================================
+inline uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const* buf, uint32_t len)
+{
+  crc = ~crc;
+  while (len-- > 0)
+  {
+    crc ^= *buf++;
+    for (uint8_t bit = 0; bit < 8; bit++)
+    {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * Replaces FreeRTOS for the host tests
+ * No tasks are started on the host, so the modules use their
+ * inline fallbacks and locks are never contended
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <stddef.h>
+#include <stdint.h>
+
+//===============================================================
+// Types
+//===============================================================
+typedef void* TaskHandle_t;
+typedef void* QueueHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef struct { uint32_t owner; } portMUX_TYPE;
+
+//===============================================================
+// Defines
+//===============================================================
+#define pdFALSE                     0
+#define pdTRUE                      1
+#define pdFAIL                      0
+#define pdPASS                      1
+#define portMAX_DELAY               0xFFFFFFFF
+#define portTICK_PERIOD_MS          1
+#define pdMS_TO_TICKS(time_ms)      (time_ms)
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+#define portENTER_CRITICAL(mux)     (void)(mux)
+#define portEXIT_CRITICAL(mux)      (void)(mux)
+#define portENTER_CRITICAL_ISR(mux) (void)(mux)
+#define portEXIT_CRITICAL_ISR(mux)  (void)(mux)
+
+#endif
@@ -0,0 +1,25 @@
+/*
+ * Replaces the FreeRTOS queues for the host tests (Queues are
+ * not created, see 'FreeRTOS.h')
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef QUEUE_H
+#define QUEUE_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include "FreeRTOS.h"
+
+//===============================================================
+// Functions
+//===============================================================
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) { return NULL; }
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t timeout) { return pdFAIL; }
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t timeout) { return pdFAIL; }
+
+#endif
@@ -0,0 +1,25 @@
+/*
+ * Replaces the FreeRTOS semaphores for the host tests (Never
+ * contended, see 'FreeRTOS.h')
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef SEMPHR_H
+#define SEMPHR_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include "FreeRTOS.h"
+
+//===============================================================
+// Functions
+//===============================================================
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { static int mutex; return &mutex; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t timeout) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) { return pdTRUE; }
+
+#endif
@@ -0,0 +1,27 @@
+/*
+ * Replaces the FreeRTOS tasks for the host tests (Tasks are not
+ * started, see 'FreeRTOS.h')
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef TASK_H
+#define TASK_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include "FreeRTOS.h"
+
+//===============================================================
+// Functions
+//===============================================================
+inline BaseType_t xTaskCreate(void (*function)(void*), const char* name, uint32_t stackSize, void* parameter, UBaseType_t priority, TaskHandle_t* task) { return pdFAIL; }
+inline BaseType_t xTaskCreatePinnedToCore(void (*function)(void*), const char* name, uint32_t stackSize, void* parameter, UBaseType_t priority, TaskHandle_t* task, BaseType_t core) { return pdFAIL; }
+inline void vTaskDelete(TaskHandle_t task) {}
+inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t timeout) { return 0; }
+inline BaseType_t xTaskNotifyGive(TaskHandle_t task) { return pdPASS; }
+
+#endif
@@ -0,0 +1,29 @@
+/*
+ * Declares the SHA-256 context for the host tests (Only included
+ * by the headers of the web modules)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef MBEDTLS_SHA256_H
+#define MBEDTLS_SHA256_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <stdint.h>
+
+//===============================================================
+// Types
+//===============================================================
+typedef struct
+{
+  uint32_t state[8];
+  uint32_t total[2];
+  uint8_t buffer[64];
+  int is224;
+} mbedtls_sha256_context;
+
+#endif
@@ -0,0 +1,13 @@
+/*
+ * Replaces the pin definitions of the board for the host tests
+ * (Only included by the display library)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef PINS_ARDUINO_H
+#define PINS_ARDUINO_H
+
+#endif
@@ -0,0 +1,315 @@
+/*
+ * Includes the file systems of the flash partition for the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "vfs_api.h"
+#include "SPIFFS.h"
+#include "LittleFS.h"
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace stdfs = std::filesystem;
+
+//===============================================================
+// Global variables
+//===============================================================
+static std::string HostRoot;
+
+// File systems of the partition
+fs::SPIFFSFS SPIFFS;
+fs::LittleFSFS LittleFS;
+
+//===============================================================
+// Returns the directory of the partition files
+//===============================================================
+static stdfs::path GetPartitionDirectory()
+{
+  return stdfs::path(HostRoot) / "partition";
+}
+
+//===============================================================
+// Returns the file of the format marker
+//===============================================================
+static stdfs::path GetFormatFile()
+{
+  return stdfs::path(HostRoot) / "format";
+}
+
+//===============================================================
+// Class for an opened file on the host
+//===============================================================
+class HostFileImpl : public fs::FileImpl
+{
+  public:
+    HostFileImpl(FILE* file, const std::string& path) :
+      _file(file),
+      _path(path)
+    {
+      _name = _path.substr(_path.find_last_of('/') + 1);
+    }
+
+    ~HostFileImpl() { close(); }
+
+    size_t write(const uint8_t* buffer, size_t size) override { return _file ? fwrite(buffer, 1, size, _file) : 0; }
+    size_t read(uint8_t* buffer, size_t size) override { return _file ? fread(buffer, 1, size, _file) : 0; }
+    void flush() override { if (_file) fflush(_file); }
+    size_t position() const override { return _file ? ftell(_file) : 0; }
+    const char* path() const override { return _path.c_str(); }
+    const char* name() const override { return _name.c_str(); }
+    bool isDirectory() override { return false; }
+    fs::FileImplPtr openNextFile(const char* mode) override { return fs::FileImplPtr(); }
+    void rewindDirectory() override {}
+    operator bool() override { return _file != NULL; }
+
+    bool seek(uint32_t position, fs::SeekMode mode) override
+    {
+      // Like on the device, seeking behind the end fails
+      long offset = mode == fs::SeekSet ? (long)position : mode == fs::SeekCur ? (long)this->position() + position : (long)size() + position;
+      return _file && offset <= (long)size() && fseek(_file, offset, SEEK_SET) == 0;
+    }
+
+    size_t size() const override
+    {
+      if (!_file)
+      {
+        return 0;
+      }
+      long current = ftell(_file);
+      fseek(_file, 0, SEEK_END);
+      long size = ftell(_file);
+      fseek(_file, current, SEEK_SET);
+      return size;
+    }
+
+    void close() override
+    {
+      if (_file)
+      {
+        fclose(_file);
+        _file = NULL;
+      }
+    }
+
+  private:
+    FILE* _file;
+    std::string _path;
+    std::string _name;
+};
+
+//===============================================================
+// Class for an opened directory on the host
+//===============================================================
+class HostDirectoryImpl : public fs::FileImpl
+{
+  public:
+    HostDirectoryImpl(VFSImpl* fileSystem, const std::string& hostPath, const std::string& path) :
+      _fileSystem(fileSystem),
+      _path(path)
+    {
+      _name = _path.substr(_path.find_last_of('/') + 1);
+      for (const stdfs::directory_entry& entry : stdfs::directory_iterator(hostPath))
+      {
+        _entries.push_back(entry.path().filename().string());
+      }
+    }
+
+    size_t write(const uint8_t* buffer, size_t size) override { return 0; }
+    size_t read(uint8_t* buffer, size_t size) override { return 0; }
+    void flush() override {}
+    bool seek(uint32_t position, fs::SeekMode mode) override { return false; }
+    size_t position() const override { return 0; }
+    size_t size() const override { return 0; }
+    void close() override { _isOpen = false; }
+    const char* path() const override { return _path.c_str(); }
+    const char* name() const override { return _name.c_str(); }
+    bool isDirectory() override { return true; }
+    void rewindDirectory() override { _index = 0; }
+    operator bool() override { return _isOpen; }
+
+    fs::FileImplPtr openNextFile(const char* mode) override
+    {
+      if (!_isOpen || _index >= _entries.size())
+      {
+        return fs::FileImplPtr();
+      }
+      std::string path = (_path == "/" ? "" : _path) + "/" + _entries[_index++];
+      return _fileSystem->open(path.c_str(), mode, false);
+    }
+
+  private:
+    VFSImpl* _fileSystem;
+    std::string _path;
+    std::string _name;
+    std::vector<std::string> _entries;
+    size_t _index = 0;
+    bool _isOpen = true;
+};
+
+//===============================================================
+// Sets the host directory, that holds the partition
+//===============================================================
+void SetHostPartitionRoot(const char* path)
+{
+  HostRoot = path;
+  stdfs::create_directories(HostRoot);
+}
+
+//===============================================================
+// Returns the type the partition is formatted with
+//===============================================================
+String GetHostPartitionFormat()
+{
+  std::ifstream file(GetFormatFile());
+  std::string type;
+  std::getline(file, type);
+  return String(type);
+}
+
+//===============================================================
+// Opens a file or directory
+//===============================================================
+fs::FileImplPtr VFSImpl::open(const char* path, const char* mode, const bool create)
+{
+  std::string hostPath = GetHostPath(path);
+  if (hostPath.empty())
+  {
+    return fs::FileImplPtr();
+  }
+
+  std::error_code error;
+  if (stdfs::is_directory(hostPath, error))
+  {
+    return fs::FileImplPtr(new HostDirectoryImpl(this, hostPath, path));
+  }
+
+  // Binary modes, reading needs an existing file
+  std::string hostMode = std::string(mode) + "b";
+  if (hostMode[0] == 'r' && !stdfs::exists(hostPath, error))
+  {
+    return fs::FileImplPtr();
+  }
+  FILE* file = fopen(hostPath.c_str(), hostMode.c_str());
+  return file ? fs::FileImplPtr(new HostFileImpl(file, path)) : fs::FileImplPtr();
+}
+
+//===============================================================
+// File functions
+//===============================================================
+bool VFSImpl::exists(const char* path)
+{
+  std::string hostPath = GetHostPath(path);
+  std::error_code error;
+  return !hostPath.empty() && stdfs::exists(hostPath, error);
+}
+
+bool VFSImpl::rename(const char* pathFrom, const char* pathTo)
+{
+  std::string hostPathFrom = GetHostPath(pathFrom);
+  std::string hostPathTo = GetHostPath(pathTo);
+  std::error_code error;
+  if (hostPathFrom.empty() || hostPathTo.empty() || !stdfs::exists(hostPathFrom, error))
+  {
+    return false;
+  }
+  stdfs::rename(hostPathFrom, hostPathTo, error);
+  return !error;
+}
+
+bool VFSImpl::remove(const char* path)
+{
+  std::string hostPath = GetHostPath(path);
+  std::error_code error;
+  return !hostPath.empty() && stdfs::remove(hostPath, error);
+}
+
+bool VFSImpl::mkdir(const char* path)
+{
+  std::string hostPath = GetHostPath(path);
+  std::error_code error;
+  return !hostPath.empty() && stdfs::create_directory(hostPath, error);
+}
+
+bool VFSImpl::rmdir(const char* path)
+{
+  std::string hostPath = GetHostPath(path);
+  std::error_code error;
+  return !hostPath.empty() && stdfs::is_directory(hostPath, error) && stdfs::remove(hostPath, error);
+}
+
+//===============================================================
+// Returns the host path of a file ("" if not mounted)
+//===============================================================
+std::string VFSImpl::GetHostPath(const char* path)
+{
+  if (_mountpoint.empty() || HostRoot.empty() || !path || path[0] != '/')
+  {
+    return std::string();
+  }
+  return GetPartitionDirectory().string() + path;
+}
+
+//===============================================================
+// Constructor
+//===============================================================
+HostPartitionFS::HostPartitionFS(const char* type) :
+  FS(fs::FSImplPtr(new VFSImpl())),
+  _type(type)
+{
+}
+
+//===============================================================
+// Mounts the partition, formats it on request if it has another type
+//===============================================================
+bool HostPartitionFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles, const char* partitionLabel)
+{
+  if (GetHostPartitionFormat() != _type &&
+    !(formatOnFail && format()))
+  {
+    return false;
+  }
+  _impl->mountpoint(basePath);
+  return true;
+}
+
+//===============================================================
+// Unmounts the partition
+//===============================================================
+void HostPartitionFS::end()
+{
+  _impl->mountpoint(NULL);
+}
+
+//===============================================================
+// Formats the partition with this file system
+//===============================================================
+bool HostPartitionFS::format()
+{
+  std::error_code error;
+  stdfs::remove_all(GetPartitionDirectory(), error);
+  stdfs::create_directories(GetPartitionDirectory(), error);
+  std::ofstream file(GetFormatFile());
+  file << _type << "\n";
+  return !error && file.good();
+}
+
+//===============================================================
+// Returns the size of all files
+//===============================================================
+size_t HostPartitionFS::usedBytes()
+{
+  size_t usedBytes = 0;
+  std::error_code error;
+  for (const stdfs::directory_entry& entry : stdfs::directory_iterator(GetPartitionDirectory(), error))
+  {
+    usedBytes += entry.is_regular_file() ? entry.file_size() : 0;
+  }
+  return usedBytes;
+}
@@ -0,0 +1,84 @@
+/*
+ * Includes the file systems of the flash partition for the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef VFS_API_H
+#define VFS_API_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include "FS.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define HOST_PARTITIONSIZE          0x1E0000    // Same as the 'spiffs' partition
+
+//===============================================================
+// Functions
+//===============================================================
+// Sets the host directory, that holds the partition (Must be called first)
+void SetHostPartitionRoot(const char* path);
+
+// Returns the type the partition is formatted with ("" if not formatted)
+String GetHostPartitionFormat();
+
+//===============================================================
+// Class for the virtual file system on a mount point
+// All mount points share the directory of the host partition,
+// like SPIFFS and LittleFS share the flash partition. Files are
+// only accessible while a mount point is set
+//===============================================================
+class VFSImpl : public fs::FSImpl
+{
+  public:
+    fs::FileImplPtr open(const char* path, const char* mode, const bool create) override;
+    bool exists(const char* path) override;
+    bool rename(const char* pathFrom, const char* pathTo) override;
+    bool remove(const char* path) override;
+    bool mkdir(const char* path) override;
+    bool rmdir(const char* path) override;
+    void mountpoint(const char* mountpoint) override { _mountpoint = mountpoint ? mountpoint : ""; }
+    const char* mountpoint() override { return _mountpoint.empty() ? NULL : _mountpoint.c_str(); }
+
+  private:
+    std::string _mountpoint;
+
+    // Returns the host path of a file ("" if not mounted)
+    std::string GetHostPath(const char* path);
+};
+
+//===============================================================
+// Class for a file system formatted onto the host partition
+//===============================================================
+class HostPartitionFS : public fs::FS
+{
+  public:
+    // Constructor (Type is written as format marker)
+    HostPartitionFS(const char* type);
+
+    // Mounts the partition, formats it on request if it has another type
+    bool begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles, const char* partitionLabel);
+
+    // Unmounts the partition
+    void end();
+
+    // Formats the partition with this file system (Removes all files)
+    bool format();
+
+    // Returns the size of the partition
+    size_t totalBytes() { return HOST_PARTITIONSIZE; }
+
+    // Returns the size of all files
+    size_t usedBytes();
+
+  private:
+    const char* _type;
+};
+
+#endif
@@ -0,0 +1,13 @@
+/*
+ * Replaces the private wiring functions for the host tests
+ * (Only included by the display library)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef WIRING_PRIVATE_H
+#define WIRING_PRIVATE_H
+
+#endif
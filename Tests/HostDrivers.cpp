@@ -0,0 +1,72 @@
+/*
+ * Replaces the web server and the system helper for the host tests
+ * of the display and the state machine (Only the functions called
+ * by them, the web server does not run on the host)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "WifiHandler.h"
+#include "SystemHelper.h"
+
+//===============================================================
+// Global variables
+//===============================================================
+WifiHandler Wifihandler;
+SystemHelper Systemhelper;
+
+//===============================================================
+// Wifi handler (Wifi stays off)
+//===============================================================
+WifiHandler::WifiHandler()
+{
+}
+
+void WifiHandler::Save()
+{
+}
+
+wifi_mode_t WifiHandler::GetWifiMode()
+{
+  return _wifiMode;
+}
+
+void WifiHandler::SetWifiMode(wifi_mode_t mode)
+{
+  _wifiMode = mode;
+}
+
+uint16_t WifiHandler::GetConnectedClients()
+{
+  return 0;
+}
+
+//===============================================================
+// Web metrics (Member of the wifi handler)
+//===============================================================
+WebMetrics::WebMetrics()
+{
+}
+
+void WebMetrics::run(AsyncWebServerRequest* request, ArMiddlewareNext next)
+{
+  next();
+}
+
+//===============================================================
+// System helper (Timestamp of the last user action)
+//===============================================================
+void SystemHelper::SetLastUserAction()
+{
+  _lastUserAction = millis();
+}
+
+uint32_t SystemHelper::GetLastUserAction()
+{
+  return _lastUserAction;
+}
@@ -0,0 +1,88 @@
+/*
+ * Mounts an empty partition with a theme of the sketch for the host
+ * tests of the display and the state machine
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef HOSTTHEME_H
+#define HOSTTHEME_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include "FileSystem.h"
+#include "Config.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define THEMES_DIR                  SKETCH_DIR "/themes"
+
+//===============================================================
+// Copies the configuration and the images of a theme onto the
+// mounted file system
+//===============================================================
+static bool CopyHostTheme(const char* themeName)
+{
+  std::error_code error;
+  uint8_t fileCount = 0;
+  for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(std::string(THEMES_DIR) + "/" + themeName, error))
+  {
+    std::string extension = entry.path().extension().string();
+    if (extension != ".json" &&
+      extension != ".bmp")
+    {
+      continue;
+    }
+
+    std::ifstream source(entry.path(), std::ios::binary);
+    std::stringstream content;
+    content << source.rdbuf();
+    std::string data = content.str();
+
+    File file = FileSystem.open(String("/") + entry.path().filename().string(), FILE_WRITE);
+    if (!file ||
+      file.write((const uint8_t*)data.c_str(), data.size()) != data.size())
+    {
+      return false;
+    }
+    file.close();
+    fileCount++;
+  }
+  return !error && fileCount > 0;
+}
+
+//===============================================================
+// Mounts an empty partition below the root of the environment
+// variable (Or the temp directory) and selects the theme as
+// current configuration, like after a switch on the device
+//===============================================================
+static bool BeginHostTheme(const char* themeName, const char* rootVariableName, const char* defaultRootName)
+{
+  const char* rootVariable = getenv(rootVariableName);
+  std::filesystem::path root = rootVariable ? rootVariable : std::filesystem::temp_directory_path() / defaultRootName;
+  root /= themeName;
+  std::filesystem::remove_all(root);
+  SetHostPartitionRoot(root.string().c_str());
+
+  Preferences preferences;
+  preferences.begin(SETTINGS_NAME, false);
+  preferences.putString(KEY_CONFIGFILE, String(themeName) + ".json");
+  preferences.end();
+
+  if (!FileSystem.Begin() ||
+    !CopyHostTheme(themeName))
+  {
+    fprintf(stderr, "Failed to copy theme '%s'\n", themeName);
+    return false;
+  }
+  return true;
+}
+
+#endif
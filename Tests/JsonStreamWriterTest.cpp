@@ -0,0 +1,130 @@
+/*
+ * Tests the streaming json writer
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "TestHelper.h"
+#include "JsonStreamWriter.h"
+
+//===============================================================
+// Enums
+//===============================================================
+enum TestState : uint8_t
+{
+  eTestFirst = 0,
+  eTestSecond = 2
+};
+
+//===============================================================
+// Writes nested objects and arrays with separators
+//===============================================================
+static void TestStructure()
+{
+  char buffer[JSONWRITER_BUFFERSIZE];
+  JsonStreamWriter writer(buffer, sizeof(buffer));
+  writer.BeginObject();
+  writer.Add("name", "Cube");
+  writer.BeginArray("values");
+  writer.Add(NULL, 1);
+  writer.Add(NULL, 2);
+  writer.BeginObject();
+  writer.EndObject();
+  writer.EndArray();
+  writer.BeginObject("empty");
+  writer.EndObject();
+  writer.EndObject();
+
+  CHECK_STRING("{\"name\":\"Cube\",\"values\":[1,2,{}],\"empty\":{}}", writer.GetBuffer());
+  CHECK_EQUAL(strlen(buffer), writer.GetLength());
+  CHECK(!writer.HasOverflow());
+}
+
+//===============================================================
+// Writes the value types of the web page handler
+//===============================================================
+static void TestValueTypes()
+{
+  char buffer[JSONWRITER_BUFFERSIZE];
+  JsonStreamWriter writer(buffer, sizeof(buffer));
+  writer.BeginObject();
+  writer.Add("bool", true);
+  writer.Add("int16", (int16_t)-360);
+  writer.Add("uint16", (uint16_t)65535);
+  writer.Add("int32", (int32_t)-2147483647 - 1);
+  writer.Add("uint32", (uint32_t)4294967295UL);
+  writer.Add("enum", eTestSecond);
+  writer.Add("null", (const char*)NULL);
+  writer.EndObject();
+
+  CHECK_STRING("{\"bool\":1,\"int16\":-360,\"uint16\":65535,\"int32\":-2147483648,\"uint32\":4294967295,\"enum\":2,\"null\":\"\"}", writer.GetBuffer());
+}
+
+//===============================================================
+// Escapes quotes, backslashes and control characters
+//===============================================================
+static void TestEscaping()
+{
+  char buffer[JSONWRITER_BUFFERSIZE];
+  JsonStreamWriter writer(buffer, sizeof(buffer));
+  writer.BeginObject();
+  writer.Add("text", "a\"b\\c\nd\te\x01");
+  writer.Add("key\"", "ÄÖÜ");
+  writer.EndObject();
+
+  CHECK_STRING("{\"text\":\"a\\\"b\\\\c\\nd\\te\\u0001\",\"key\\\"\":\"ÄÖÜ\"}", writer.GetBuffer());
+}
+
+//===============================================================
+// Stops writing on overflow and keeps the terminator
+//===============================================================
+static void TestOverflow()
+{
+  char buffer[16];
+  JsonStreamWriter writer(buffer, sizeof(buffer));
+  writer.BeginObject();
+  writer.Add("name", "Cocktail Cube");
+  writer.EndObject();
+
+  CHECK(writer.HasOverflow());
+  CHECK(writer.GetLength() < sizeof(buffer));
+  CHECK_EQUAL(strlen(buffer), writer.GetLength());
+  CHECK_STRING("{\"name\":\"", writer.GetBuffer());
+
+  // Nothing is written anymore, even if it would fit
+  writer.Raw("}");
+  CHECK_STRING("{\"name\":\"", writer.GetBuffer());
+}
+
+//===============================================================
+// Writes streamed parts with raw separators
+//===============================================================
+static void TestRaw()
+{
+  char buffer[JSONWRITER_BUFFERSIZE];
+  JsonStreamWriter writer(buffer, sizeof(buffer));
+  writer.Raw(",");
+  writer.BeginObject();
+  writer.Add("route", "root");
+  writer.EndObject();
+
+  CHECK_STRING(",{\"route\":\"root\"}", writer.GetBuffer());
+}
+
+//===============================================================
+// Runs all tests
+//===============================================================
+int main()
+{
+  RUN_TEST(TestStructure);
+  RUN_TEST(TestValueTypes);
+  RUN_TEST(TestEscaping);
+  RUN_TEST(TestOverflow);
+  RUN_TEST(TestRaw);
+  return TEST_RESULT();
+}
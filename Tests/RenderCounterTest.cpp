@@ -0,0 +1,123 @@
+/*
+ * Tests the counting of address windows and pixels
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "TestHelper.h"
+#include "RenderCounter.h"
+
+//===============================================================
+// Counts windows and pixels of a frame
+//===============================================================
+static void TestWindowsAndPixels()
+{
+  RenderCounter counter;
+  counter.BeginFrame();
+  counter.CountWindow(0, 0, 10, 10);
+  counter.CountWindow(20, 20, 5, 4);
+  RenderFrameStats stats = counter.EndFrame();
+
+  CHECK_EQUAL(2, stats.windows);
+  CHECK_EQUAL(120, stats.pixels);
+  CHECK_EQUAL(0, stats.overdraw);
+}
+
+//===============================================================
+// Counts pixels written twice in the same frame
+//===============================================================
+static void TestOverdraw()
+{
+  RenderCounter counter;
+  counter.BeginFrame();
+  counter.CountWindow(0, 0, 10, 10);
+  counter.CountWindow(5, 5, 10, 10);
+  counter.CountWindow(0, 0, 1, 1);
+  RenderFrameStats stats = counter.EndFrame();
+
+  CHECK_EQUAL(3, stats.windows);
+  CHECK_EQUAL(201, stats.pixels);
+  CHECK_EQUAL(26, stats.overdraw);
+}
+
+//===============================================================
+// Starts each frame without written pixels
+//===============================================================
+static void TestFrameReset()
+{
+  RenderCounter counter;
+  counter.BeginFrame();
+  counter.CountWindow(0, 0, 240, 240);
+  counter.EndFrame();
+
+  counter.BeginFrame();
+  counter.CountWindow(0, 0, 240, 240);
+  RenderFrameStats stats = counter.EndFrame();
+
+  CHECK_EQUAL(1, stats.windows);
+  CHECK_EQUAL(240 * 240, stats.pixels);
+  CHECK_EQUAL(0, stats.overdraw);
+}
+
+//===============================================================
+// Counts pixels outside of the panel, but no overdraw there
+//===============================================================
+static void TestClipping()
+{
+  RenderCounter counter;
+  counter.BeginFrame();
+  counter.CountWindow(230, 230, 20, 20);
+  counter.CountWindow(230, 230, 20, 20);
+  RenderFrameStats stats = counter.EndFrame();
+
+  CHECK_EQUAL(800, stats.pixels);
+  CHECK_EQUAL(100, stats.overdraw);
+}
+
+//===============================================================
+// Ignores windows outside of a frame
+//===============================================================
+static void TestNotCounting()
+{
+  RenderCounter counter;
+  counter.CountWindow(0, 0, 10, 10);
+  counter.BeginFrame();
+  RenderFrameStats stats = counter.EndFrame();
+  counter.CountWindow(0, 0, 10, 10);
+
+  CHECK_EQUAL(0, stats.windows);
+  CHECK_EQUAL(0, stats.pixels);
+}
+
+//===============================================================
+// Estimates the bus time from commands and 16 bit pixels
+//===============================================================
+static void TestBusTime()
+{
+  RenderFrameStats stats;
+  stats.windows = 1;
+  stats.pixels = 240 * 240;
+
+  // (11 + 115200) bytes at 40 MHz
+  double expected_us = (COUNTING_PANEL_WINDOWBYTES + 240.0 * 240.0 * 2.0) * 8.0 / 40.0;
+  CHECK(fabs(stats.BusTime_us() - expected_us) < 0.001);
+}
+
+//===============================================================
+// Runs all tests
+//===============================================================
+int main()
+{
+  RUN_TEST(TestWindowsAndPixels);
+  RUN_TEST(TestOverdraw);
+  RUN_TEST(TestFrameReset);
+  RUN_TEST(TestClipping);
+  RUN_TEST(TestNotCounting);
+  RUN_TEST(TestBusTime);
+  return TEST_RESULT();
+}
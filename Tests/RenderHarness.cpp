@@ -0,0 +1,269 @@
+/*
+ * Runs the display driver on the virtual panel and prints the render
+ * table of all pages, like the benchmark firmware (See 'RunRender()'
+ * in 'Benchmark.cpp'). Checks that the counted transfers match the
+ * bytes decoded by the panel
+ *
+ * Usage: RenderHarness [theme]   (Folder in 'themes', default mixer theme)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "TestHelper.h"
+#include "HostTheme.h"
+#include "DisplayDriver.h"
+#include "StateMachine.h"
+#include "CountingST7789.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define HARNESS_THEME               "AperolSpritz"
+#define HARNESS_MAXFRAMES           24
+#define HARNESS_SCREENSAVERFRAMES   100
+#define HARNESS_SCREENSAVERTIME_MS  1000
+
+//===============================================================
+// Single render frame result
+//===============================================================
+struct FrameResult
+{
+  const char* name;
+  uint16_t frameCount;
+  RenderFrameStats stats;
+};
+
+//===============================================================
+// Global variables
+//===============================================================
+static SPIClass Spi(HSPI);
+static CountingST7789 Tft(&Spi, -1, -1, -1);
+
+static FrameResult FrameResults[HARNESS_MAXFRAMES];
+static uint8_t FrameResultCount = 0;
+static uint64_t FrameBusBytes = 0;
+
+//===============================================================
+// Starts counting a frame
+//===============================================================
+static void BeginFrame()
+{
+  FrameBusBytes = Tft.GetBusBytes();
+  Tft.BeginFrame();
+}
+
+//===============================================================
+// Stops counting a frame and checks the counted transfers with
+// the bytes decoded by the virtual panel
+//===============================================================
+static RenderFrameStats EndFrame()
+{
+  RenderFrameStats stats = Tft.EndFrame();
+  CHECK_EQUAL(stats.windows * COUNTING_PANEL_WINDOWBYTES + stats.pixels * 2, Tft.GetBusBytes() - FrameBusBytes);
+  return stats;
+}
+
+//===============================================================
+// Adds the statistics of a frame to a multi-frame result
+//===============================================================
+static void AddStats(RenderFrameStats& sum, const RenderFrameStats& stats)
+{
+  sum.windows += stats.windows;
+  sum.pixels += stats.pixels;
+  sum.overdraw += stats.overdraw;
+  sum.cpuTime_us += stats.cpuTime_us;
+}
+
+//===============================================================
+// Adds a frame result (Averaged over the frame count)
+//===============================================================
+static void AddFrameResult(const char* name, const RenderFrameStats& stats, uint16_t frameCount = 1)
+{
+  if (FrameResultCount >= HARNESS_MAXFRAMES)
+  {
+    fprintf(stderr, "Frame table full, dropping '%s'\n", name);
+    return;
+  }
+
+  FrameResults[FrameResultCount++] = { name, frameCount, stats };
+}
+
+//===============================================================
+// Adds the result of a page frame (Pages always draw the screen)
+//===============================================================
+static void AddPageResult(const char* name, const RenderFrameStats& stats)
+{
+  CHECK(stats.pixels >= (uint32_t)Tft.width() * Tft.height());
+  AddFrameResult(name, stats);
+}
+
+//===============================================================
+// Prints the render table in the format of the benchmark
+//===============================================================
+static void PrintFrameTable()
+{
+  printf("| %-34s | %8s | %8s | %8s | %8s | %8s |\n",
+    "Frame", "Windows", "Pixels", "Overdraw", "Bus [ms]", "CPU [ms]");
+
+  for (uint8_t index = 0; index < FrameResultCount; index++)
+  {
+    const FrameResult& result = FrameResults[index];
+    double frames = max((uint16_t)1, result.frameCount);
+    printf("| %-34s | %8.0f | %8.0f | %8.0f | %8.2f | %8.2f |\n",
+      result.name,
+      result.stats.windows / frames,
+      result.stats.pixels / frames,
+      result.stats.overdraw / frames,
+      result.stats.BusTime_us() / frames / 1000.0,
+      result.stats.cpuTime_us / frames / 1000.0);
+  }
+}
+
+//===============================================================
+// Renders all pages and partial updates (Same frames as the
+// benchmark firmware)
+//===============================================================
+static void RunRender()
+{
+  // Intro page releases its images, so load them again
+  Display.LoadImages();
+  BeginFrame();
+  Display.ShowIntroPage();
+  AddPageResult("ShowIntroPage", EndFrame());
+
+  BeginFrame();
+  Display.ShowHelpPage();
+  AddPageResult("ShowHelpPage", EndFrame());
+
+  BeginFrame();
+  Display.ShowMenuPage();
+  AddPageResult("ShowMenuPage", EndFrame());
+
+  BeginFrame();
+  Display.ShowCleaningPage();
+  AddPageResult("ShowCleaningPage", EndFrame());
+
+  // Toggle a single check box (Restored by the next page)
+  BeginFrame();
+  Display.DrawCheckBoxes(Statemachine.GetCleaningLiquid() == eLiquid1 ? eLiquid2 : eLiquid1);
+  AddFrameResult("DrawCheckBoxes (partial)", EndFrame());
+
+  BeginFrame();
+  Display.ShowSettingsPage();
+  AddPageResult("ShowSettingsPage", EndFrame());
+
+  BeginFrame();
+  Display.DrawSettings(true);
+  AddFrameResult("DrawSettings (full)", EndFrame());
+
+  if (Config.isMixer)
+  {
+    BeginFrame();
+    Display.ShowDashboardPage();
+    AddPageResult("ShowDashboardPage", EndFrame());
+
+    BeginFrame();
+    Display.DrawDoughnutChart3();
+    AddFrameResult("DrawDoughnutChart3 (full)", EndFrame());
+
+    // One encoder step forth and back, like on the dashboard (Values and doughnut partial)
+    RenderFrameStats stepStats;
+    for (int8_t direction = 1; direction >= -1; direction -= 2)
+    {
+      int16_t stepIncrements_Degrees[3] = { (int16_t)(direction * STEPANGLE_DEGREES), 0, 0 };
+      BeginFrame();
+      CHECK(Statemachine.UpdateValuesFromWifi(stepIncrements_Degrees, 0));
+      AddStats(stepStats, EndFrame());
+    }
+    AddFrameResult("DrawDoughnutChart3 (partial step)", stepStats, 2);
+
+    // Burst of 5 web steps applied one by one and back as one coalesced batch
+    RenderFrameStats burstStats;
+    int16_t singleIncrements_Degrees[3] = { STEPANGLE_DEGREES, 0, 0 };
+    for (uint8_t step = 0; step < 5; step++)
+    {
+      BeginFrame();
+      CHECK(Statemachine.UpdateValuesFromWifi(singleIncrements_Degrees, 0));
+      AddStats(burstStats, EndFrame());
+    }
+    AddFrameResult("Web burst (5 single updates)", burstStats);
+
+    int16_t increments_Degrees[3] = { -5 * STEPANGLE_DEGREES, 0, 0 };
+    BeginFrame();
+    CHECK(Statemachine.UpdateValuesFromWifi(increments_Degrees, 0));
+    AddFrameResult("Web burst (1 coalesced batch)", EndFrame());
+  }
+  else
+  {
+    BeginFrame();
+    Display.ShowDashboardPage();
+    AddPageResult("ShowDashboardPage (bar)", EndFrame());
+
+    BeginFrame();
+    Display.ShowBarPage();
+    AddPageResult("ShowBarPage", EndFrame());
+
+    BeginFrame();
+    Display.DrawBar(false, true);
+    AddFrameResult("DrawBar (full)", EndFrame());
+
+    BeginFrame();
+    Display.DrawBar(false);
+    AddFrameResult("DrawBar (partial)", EndFrame());
+  }
+
+  BeginFrame();
+  Display.ShowScreenSaverPage();
+  AddPageResult("ShowScreenSaverPage", EndFrame());
+
+  // Screen saver frames are averaged
+  RenderFrameStats saverStats;
+  for (uint16_t frame = 0; frame < HARNESS_SCREENSAVERFRAMES; frame++)
+  {
+    BeginFrame();
+    Display.DrawScreenSaver();
+    AddStats(saverStats, EndFrame());
+  }
+  AddFrameResult("DrawScreenSaver (per frame)", saverStats, HARNESS_SCREENSAVERFRAMES);
+
+  // Screen saver in real time with fixed frame rate
+  Display.ShowScreenSaverPage();
+  uint32_t startTime_ms = millis();
+  while (millis() - startTime_ms < HARNESS_SCREENSAVERTIME_MS)
+  {
+    delay(Display.UpdateScreenSaver());
+  }
+  printf("Screen saver CPU load: %.2f %%\n", Display.GetScreenSaverCpuLoad());
+}
+
+//===============================================================
+// Loads a theme onto an empty partition and renders all pages
+//===============================================================
+int main(int argc, char** argv)
+{
+  const char* themeName = argc > 1 ? argv[1] : HARNESS_THEME;
+  if (!BeginHostTheme(themeName, "RENDERHARNESS_ROOT", "RenderHarnessPartition"))
+  {
+    return 1;
+  }
+
+  Display.Begin(&Tft);
+  if (!Config.Begin())
+  {
+    fprintf(stderr, "Failed to load theme '%s'\n", themeName);
+    return 1;
+  }
+  Statemachine.Begin(-1);
+
+  printf("Theme '%s' (%s)\n", themeName, Config.isMixer ? "Mixer" : "Bar");
+  RunRender();
+  PrintFrameTable();
+
+  FileSystem.End();
+  return TEST_RESULT();
+}
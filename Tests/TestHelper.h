@@ -0,0 +1,72 @@
+/*
+ * Includes the checks of the host tests
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef TESTHELPER_H
+#define TESTHELPER_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <stdio.h>
+#include <string.h>
+
+//===============================================================
+// Global variables
+//===============================================================
+static int TestFailures = 0;
+
+//===============================================================
+// Defines
+//===============================================================
+#define CHECK(condition) \
+  do \
+  { \
+    if (!(condition)) \
+    { \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+      TestFailures++; \
+    } \
+  } while (0)
+
+#define CHECK_EQUAL(expected, actual) \
+  do \
+  { \
+    long long expectedValue = (long long)(expected); \
+    long long actualValue = (long long)(actual); \
+    if (expectedValue != actualValue) \
+    { \
+      fprintf(stderr, "%s:%d: CHECK_EQUAL(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, #expected, #actual, expectedValue, actualValue); \
+      TestFailures++; \
+    } \
+  } while (0)
+
+#define CHECK_STRING(expected, actual) \
+  do \
+  { \
+    const char* expectedText = (expected); \
+    const char* actualText = (actual); \
+    if (strcmp(expectedText, actualText) != 0) \
+    { \
+      fprintf(stderr, "%s:%d: CHECK_STRING(%s, %s) failed:\n  expected '%s'\n  actual   '%s'\n", __FILE__, __LINE__, #expected, #actual, expectedText, actualText); \
+      TestFailures++; \
+    } \
+  } while (0)
+
+// Runs a test function and prints its name
+#define RUN_TEST(test) \
+  do \
+  { \
+    int failures = TestFailures; \
+    test(); \
+    printf("%-48s %s\n", #test, failures == TestFailures ? "ok" : "FAILED"); \
+  } while (0)
+
+// Returns the exit code of the test program
+#define TEST_RESULT() (TestFailures == 0 ? 0 : 1)
+
+#endif
@@ -0,0 +1,217 @@
+/*
+ * Tests the theme index and the lookup in the theme catalogue
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include "TestHelper.h"
+#include "FileSystem.h"
+#include "ThemeIndex.h"
+#include "ThemeCatalogue.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define THEMES_DIR                  SKETCH_DIR "/themes"
+
+//===============================================================
+// Returns the json file of a theme of the sketch
+//===============================================================
+static std::string ReadTheme(const char* themeName)
+{
+  std::ifstream source(std::string(THEMES_DIR) + "/" + themeName + "/" + themeName + ".json", std::ios::binary);
+  std::stringstream content;
+  content << source.rdbuf();
+  return content.str();
+}
+
+//===============================================================
+// Writes a file onto the mounted file system
+//===============================================================
+static bool WriteFile(const String& path, const std::string& content)
+{
+  File file = FileSystem.open(path, FILE_WRITE);
+  bool result = file && file.write((const uint8_t*)content.c_str(), content.size()) == content.size();
+  file.close();
+  return result;
+}
+
+//===============================================================
+// Copies a theme of the sketch onto the mounted file system
+//===============================================================
+static bool CopyTheme(const char* themeName)
+{
+  std::string content = ReadTheme(themeName);
+  return !content.empty() && WriteFile(String("/") + themeName + ".json", content);
+}
+
+//===============================================================
+// Returns the index of an entry (-1 if not found)
+//===============================================================
+static int FindEntry(const ThemeIndex& index, const char* fileName)
+{
+  for (uint16_t entry = 0; entry < index.GetCount(); entry++)
+  {
+    if (strcmp(index.GetEntry(entry)->fileName, fileName) == 0)
+    {
+      return entry;
+    }
+  }
+  return -1;
+}
+
+//===============================================================
+// Parses all theme files and sorts them by file name
+//===============================================================
+static void TestUpdate()
+{
+  CHECK(CopyTheme("WineBar"));
+  CHECK(CopyTheme("AperolSpritz"));
+  CHECK(CopyTheme("HugoSpritz"));
+
+  ThemeIndex index;
+  CHECK(index.Update());
+  CHECK_EQUAL(3, index.GetCount());
+  CHECK_EQUAL(3, index.GetParsedCount());
+  CHECK(index.GetEntry(3) == NULL);
+  CHECK_STRING("AperolSpritz.json", index.GetEntry(0)->fileName);
+  CHECK_STRING("HugoSpritz.json", index.GetEntry(1)->fileName);
+  CHECK_STRING("WineBar.json", index.GetEntry(2)->fileName);
+
+  const ThemeIndexEntry* entry = index.GetEntry(0);
+  CHECK_EQUAL(1, entry->isValid);
+  CHECK_EQUAL(1, entry->isMixer);
+  CHECK_STRING("APEROLSpritz", entry->mixerName);
+  CHECK_STRING("/LogoAperolSpritz.bmp", entry->images[0]);
+  CHECK_STRING("/BottleAperol.bmp", entry->images[2]);
+}
+
+//===============================================================
+// Parses only new and changed files on the next update
+//===============================================================
+static void TestChangedFiles()
+{
+  ThemeIndex unchangedIndex;
+  CHECK(unchangedIndex.Update());
+  CHECK_EQUAL(3, unchangedIndex.GetCount());
+  CHECK_EQUAL(0, unchangedIndex.GetParsedCount());
+
+  CHECK(CopyTheme("Hugoliker"));
+  File file = FileSystem.open("/WineBar.json", FILE_APPEND);
+  file.write((const uint8_t*)"\n", 1);
+  file.close();
+
+  ThemeIndex changedIndex;
+  CHECK(changedIndex.Update());
+  CHECK_EQUAL(4, changedIndex.GetCount());
+  CHECK_EQUAL(2, changedIndex.GetParsedCount());
+  CHECK_STRING("Hugoliker.json", changedIndex.GetEntry(2)->fileName);
+}
+
+//===============================================================
+// Parses an invalidated file again, even if it is unchanged
+//===============================================================
+static void TestInvalidate()
+{
+  ThemeIndex::Invalidate("/HugoSpritz.json");
+
+  ThemeIndex index;
+  CHECK(index.Update());
+  CHECK_EQUAL(1, index.GetParsedCount());
+  CHECK_EQUAL(1, index.GetEntry(FindEntry(index, "HugoSpritz.json"))->isValid);
+}
+
+//===============================================================
+// Removes entries of deleted files
+//===============================================================
+static void TestRemovedFile()
+{
+  CHECK(FileSystem.remove("/Hugoliker.json"));
+
+  ThemeIndex index;
+  CHECK(index.Update());
+  CHECK_EQUAL(3, index.GetCount());
+  CHECK_EQUAL(-1, FindEntry(index, "Hugoliker.json"));
+}
+
+//===============================================================
+// Flags unreadable themes and themes with invalid values
+//===============================================================
+static void TestInvalidThemes()
+{
+  std::string content = ReadTheme("AperolSpritz");
+  std::string badColor = content;
+  badColor.replace(badColor.find("\"0x0F1F\""), 8, "\"0x10F1F\"");
+  std::string longName = content;
+  longName.replace(longName.find("\"Aperol\""), 8, "\"AperolAperol\"");
+  CHECK(WriteFile("/BadColor.json", badColor));
+  CHECK(WriteFile("/LongName.json", longName));
+  CHECK(WriteFile("/Truncated.json", content.substr(0, content.size() / 2)));
+
+  ThemeIndex index;
+  CHECK(index.Update());
+  CHECK_EQUAL(6, index.GetCount());
+  CHECK_EQUAL(3, index.GetParsedCount());
+  CHECK_EQUAL(0, index.GetEntry(FindEntry(index, "BadColor.json"))->isValid);
+  CHECK_EQUAL(0, index.GetEntry(FindEntry(index, "LongName.json"))->isValid);
+  CHECK_EQUAL(0, index.GetEntry(FindEntry(index, "Truncated.json"))->isValid);
+  CHECK_EQUAL(1, index.GetEntry(FindEntry(index, "AperolSpritz.json"))->isValid);
+}
+
+//===============================================================
+// Finds the valid themes of the index in the catalogue
+//===============================================================
+static void TestCatalogueFind()
+{
+  ThemeCatalogue catalogue;
+  CHECK(catalogue.Begin());
+  CHECK_EQUAL(3, catalogue.GetCount());
+  CHECK_EQUAL(0, catalogue.Find("AperolSpritz.json"));
+  CHECK_EQUAL(1, catalogue.Find("HugoSpritz.json"));
+  CHECK_EQUAL(2, catalogue.Find("WineBar.json"));
+  CHECK_EQUAL(-1, catalogue.Find("Hugoliker.json"));
+  CHECK_EQUAL(-1, catalogue.Find("AAA.json"));
+  CHECK_EQUAL(-1, catalogue.Find("ZZZ.json"));
+  CHECK_EQUAL(-1, catalogue.Find("BadColor.json"));
+  CHECK_EQUAL(-1, catalogue.Find("LongName.json"));
+  CHECK_EQUAL(-1, catalogue.Find("Truncated.json"));
+
+  char name[THEMEINDEX_MAXNAMELENGTH];
+  CHECK(catalogue.GetName(2, name, sizeof(name)));
+  CHECK_STRING("WineBar.json", name);
+  CHECK(!catalogue.GetName(3, name, sizeof(name)));
+}
+
+//===============================================================
+// Runs all tests on an empty partition
+//===============================================================
+int main()
+{
+  const char* rootVariable = getenv("THEMEINDEXTEST_ROOT");
+  std::string root = rootVariable ? rootVariable : (std::filesystem::temp_directory_path() / "ThemeIndexPartition").string();
+  std::filesystem::remove_all(root);
+  SetHostPartitionRoot(root.c_str());
+  if (!FileSystem.Begin())
+  {
+    fprintf(stderr, "Failed to mount the file system\n");
+    return 1;
+  }
+
+  RUN_TEST(TestUpdate);
+  RUN_TEST(TestChangedFiles);
+  RUN_TEST(TestInvalidate);
+  RUN_TEST(TestRemovedFile);
+  RUN_TEST(TestInvalidThemes);
+  RUN_TEST(TestCatalogueFind);
+
+  FileSystem.End();
+  return TEST_RESULT();
+}
@@ -0,0 +1,145 @@
+/*
+ * Tests the coalescing of web commands
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "TestHelper.h"
+#include "WebCommandBatch.h"
+
+//===============================================================
+// Defines
+//===============================================================
+#define TEST_WINDOW_MS              50
+
+//===============================================================
+// Returns a value command
+//===============================================================
+static WebCommand ValueCommand(int16_t increment1, int16_t increment2, int16_t increment3, uint32_t cycleTimespan_ms)
+{
+  WebCommand command = { eWebValues, { increment1, increment2, increment3 }, cycleTimespan_ms };
+  return command;
+}
+
+//===============================================================
+// Applies nothing before the first command
+//===============================================================
+static void TestEmpty()
+{
+  WebCommandBatch batch(TEST_WINDOW_MS);
+
+  CHECK(!batch.IsPending());
+  CHECK(!batch.IsDue(1000));
+}
+
+//===============================================================
+// Is due when the window of the first command has passed
+//===============================================================
+static void TestWindow()
+{
+  WebCommandBatch batch(TEST_WINDOW_MS);
+  batch.Add(ValueCommand(5, 0, 0, 0), 1000);
+  batch.Add(ValueCommand(5, 0, 0, 0), 1040);
+
+  // Later commands do not extend the window
+  CHECK(batch.IsPending());
+  CHECK(!batch.IsDue(1049));
+  CHECK(batch.IsDue(1050));
+}
+
+//===============================================================
+// Is due across the overflow of 'millis()'
+//===============================================================
+static void TestTimeOverflow()
+{
+  WebCommandBatch batch(TEST_WINDOW_MS);
+  batch.Add(ValueCommand(5, 0, 0, 0), 0xFFFFFFF0UL);
+
+  CHECK(!batch.IsDue(0xFFFFFFFFUL));
+  CHECK(batch.IsDue(0x00000022UL));
+}
+
+//===============================================================
+// Sums up increments of all clients per liquid
+//===============================================================
+static void TestIncrements()
+{
+  WebCommandBatch batch(TEST_WINDOW_MS);
+  batch.Add(ValueCommand(5, -5, 0, 0), 0);
+  batch.Add(ValueCommand(5, 0, 10, 0), 10);
+  batch.Add(ValueCommand(-15, 0, 0, 0), 20);
+
+  const WebCommand& values = batch.GetValues();
+  CHECK_EQUAL(eWebValues, values.type);
+  CHECK_EQUAL(-5, values.increments_Degrees[0]);
+  CHECK_EQUAL(-5, values.increments_Degrees[1]);
+  CHECK_EQUAL(10, values.increments_Degrees[2]);
+  CHECK_EQUAL(0, values.cycleTimespan_ms);
+}
+
+//===============================================================
+// Limits the increments to one turn
+//===============================================================
+static void TestIncrementLimit()
+{
+  WebCommandBatch batch(TEST_WINDOW_MS);
+  batch.Add(ValueCommand(300, -300, 0, 0), 0);
+  batch.Add(ValueCommand(300, -300, 0, 0), 10);
+
+  CHECK_EQUAL(360, batch.GetValues().increments_Degrees[0]);
+  CHECK_EQUAL(-360, batch.GetValues().increments_Degrees[1]);
+}
+
+//===============================================================
+// Keeps the last cycle timespan, unchanged ones are ignored
+//===============================================================
+static void TestCycleTimespan()
+{
+  WebCommandBatch batch(TEST_WINDOW_MS);
+  batch.Add(ValueCommand(0, 0, 0, 1000), 0);
+  batch.Add(ValueCommand(0, 0, 0, 2000), 10);
+  batch.Add(ValueCommand(5, 0, 0, 0), 20);
+
+  CHECK_EQUAL(2000, batch.GetValues().cycleTimespan_ms);
+  CHECK_EQUAL(5, batch.GetValues().increments_Degrees[0]);
+}
+
+//===============================================================
+// Starts a new window after clearing
+//===============================================================
+static void TestClear()
+{
+  WebCommandBatch batch(TEST_WINDOW_MS);
+  batch.Add(ValueCommand(5, 5, 5, 1000), 0);
+  batch.Clear();
+
+  CHECK(!batch.IsPending());
+  CHECK(!batch.IsDue(1000));
+  CHECK_EQUAL(0, batch.GetValues().increments_Degrees[0]);
+  CHECK_EQUAL(0, batch.GetValues().cycleTimespan_ms);
+
+  batch.Add(ValueCommand(1, 0, 0, 0), 1000);
+  CHECK(!batch.IsDue(1049));
+  CHECK(batch.IsDue(1050));
+  CHECK_EQUAL(1, batch.GetValues().increments_Degrees[0]);
+}
+
+//===============================================================
+// Runs all tests
+//===============================================================
+int main()
+{
+  RUN_TEST(TestEmpty);
+  RUN_TEST(TestWindow);
+  RUN_TEST(TestTimeOverflow);
+  RUN_TEST(TestIncrements);
+  RUN_TEST(TestIncrementLimit);
+  RUN_TEST(TestCycleTimespan);
+  RUN_TEST(TestClear);
+  return TEST_RESULT();
+}
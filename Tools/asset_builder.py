@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+#
+# Builds the read-only CocktailCube asset partition image
+#
+# The image holds the stock theme images and web files. The
+# firmware maps the partition into memory and uses the files
+# without copying them to RAM. The layout must match
+# 'AssetStore.h' of the firmware (Little endian):
+#
+#   Header   : uint32 magic "CTAS", uint16 version, uint16 count,
+#              uint32 used size, uint32 reserved
+#   Directory: count x (char name[32], uint32 offset, uint32 length),
+#              sorted by name
+#   Data     : file contents, 4 byte aligned
+#
+# Usage:
+#   asset_builder.py <files or folders> [-o assets.bin] [--size 0x80000]
+#
+# Gzip variants ('[name].gz', see 'web_compress.py') are added as well
+# and sent to clients accepting gzip.
+#
+# Example (Stock themes and web files of the repository):
+#   web_compress.py ESP32S2_CocktailCube_V1.3/ressources
+#   asset_builder.py ESP32S2_CocktailCube_V1.3/ressources ESP32S2_CocktailCube_V1.3/themes -o assets.bin
+#   esptool.py --chip esp32s2 --port COMXX write_flash 0x190000 assets.bin
+#
+# @author    Florian Stäblein
+# @date      2025/01/01
+# @copyright © 2025 Florian Stäblein
+#
+
+import argparse
+import os
+import struct
+import sys
+
+ASSETS_MAGIC = 0x53415443  # "CTAS"
+ASSETS_VERSION = 1
+ASSETS_HEADER = "<IHHII"
+ASSETS_ENTRY = "<32sII"
+ASSETS_OFFSET = 0x190000  # See 'partitions.csv'
+ASSETS_SIZE = 0x80000
+MAX_NAME_LENGTH = 31
+EXTENSIONS = (".bmp", ".html", ".css", ".js", ".svg", ".png", ".ico", ".gz")
+
+
+def find_assets(paths):
+    """Returns a dictionary of asset names and contents"""
+    assets = {}
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, names in sorted(os.walk(path)):
+                files += [os.path.join(root, name) for name in sorted(names)]
+        else:
+            files.append(path)
+
+    for file in files:
+        name = os.path.basename(file)
+        if not name.lower().endswith(EXTENSIONS):
+            continue
+        if len(name.encode("utf-8")) > MAX_NAME_LENGTH:
+            print("Skipped '%s': Name exceeds %d characters" % (file, MAX_NAME_LENGTH))
+            continue
+
+        with open(file, "rb") as handle:
+            content = handle.read()
+
+        # Stock themes share images, only different contents are a problem
+        if name in assets:
+            if assets[name] != content:
+                print("Warning: '%s' differs from an asset with the same name, keeping the first" % file)
+            continue
+        assets[name] = content
+
+    return assets
+
+
+def build_image(assets):
+    """Returns the partition image of all assets"""
+    names = sorted(assets.keys(), key=lambda name: name.encode("utf-8"))
+    offset = struct.calcsize(ASSETS_HEADER) + len(names) * struct.calcsize(ASSETS_ENTRY)
+
+    directory = b""
+    data = b""
+    for name in names:
+        offset += (-offset) % 4
+        data += b"\0" * ((-len(data)) % 4)
+        directory += struct.pack(ASSETS_ENTRY, name.encode("utf-8"), offset, len(assets[name]))
+        data += assets[name]
+        offset += len(assets[name])
+
+    header = struct.pack(ASSETS_HEADER, ASSETS_MAGIC, ASSETS_VERSION, len(names), offset, 0)
+    return header + directory + data
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Builds the read-only CocktailCube asset partition image")
+    parser.add_argument("paths", nargs="+", help="Asset files or folders")
+    parser.add_argument("-o", "--output", default="assets.bin", help="Output image")
+    parser.add_argument("--size", type=lambda value: int(value, 0), default=ASSETS_SIZE, help="Partition size")
+    args = parser.parse_args()
+
+    assets = find_assets(args.paths)
+    if not assets:
+        print("No assets found")
+        return 1
+
+    image = build_image(assets)
+    if len(image) > args.size:
+        print("Image exceeds partition size (%d / %d bytes)" % (len(image), args.size))
+        return 1
+
+    with open(args.output, "wb") as handle:
+        handle.write(image)
+
+    for name in sorted(assets.keys()):
+        print("%-32s %8d bytes" % (name, len(assets[name])))
+    print("Built '%s' with %d assets (%d / %d bytes). Flash at 0x%X" % (args.output, len(assets), len(image), args.size, ASSETS_OFFSET))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+#
+# Packs CocktailCube themes into archives for the SPIFFS editor
+#
+# An archive is an uncompressed tar file with the json config and
+# all images of a theme (Flat names, same as on SPIFFS). Uploaded
+# to '/edit', the firmware extracts it while receiving, validates
+# config and images and installs all files at once. With '--host'
+# the archive is uploaded and the time is printed, '--compare'
+# additionally uploads the files one by one as before.
+#
+# Usage:
+#   theme_archiver.py <theme folders or json files> [-o output folder] [-s search folder] [--host 192.168.1.1] [--compare]
+#
+# Example (Install a theme of the repository):
+#   theme_archiver.py ESP32S2_CocktailCube_V1.3/themes/HugoSpritz -s ESP32S2_CocktailCube_V1.3/data --host 192.168.1.1 --compare
+#
+# @author    Florian Stäblein
+# @date      2025/01/01
+# @copyright © 2025 Florian Stäblein
+#
+
+import argparse
+import io
+import json
+import os
+import sys
+import tarfile
+import zlib
+
+from theme_compiler import IMAGE_KEYS, find_themes
+from theme_packer import MAX_NAME_LENGTH, find_image
+from web_upload_test import upload
+
+ARCHIVE_EXTENSION = ".tar"
+
+
+def theme_files(file, search_folders):
+    """Returns the flat names and paths of a json theme and its images"""
+    with open(file, "r", encoding="utf-8") as handle:
+        theme = json.load(handle)
+
+    files = [(os.path.basename(file), file)]
+    folders = [os.path.dirname(file)] + search_folders
+    for key in IMAGE_KEYS:
+        name = str(theme.get(key, ""))
+        if not name:
+            continue
+        path = find_image(name, folders)
+        if not path:
+            raise ValueError("Image '%s' not found" % name)
+        if os.path.basename(name) not in [entry[0] for entry in files]:
+            files.append((os.path.basename(name), path))
+
+    for name, _ in files:
+        if len(name) + 1 > MAX_NAME_LENGTH:
+            raise ValueError("File name '%s' exceeds %d characters" % (name, MAX_NAME_LENGTH))
+    return files
+
+
+def pack_archive(files):
+    """Returns the ustar archive of the files (Images first, config last)"""
+    buffer = io.BytesIO()
+    with tarfile.open(fileobj=buffer, mode="w", format=tarfile.USTAR_FORMAT) as archive:
+        for name, path in files[1:] + files[:1]:
+            with open(path, "rb") as handle:
+                content = handle.read()
+            info = tarfile.TarInfo(name)
+            info.size = len(content)
+            info.mode = 0o644
+            archive.addfile(info, io.BytesIO(content))
+    return buffer.getvalue()
+
+
+def install(host, name, content, timeout):
+    """Uploads a file with checksum and returns status, response text and duration"""
+    headers = {"Host": host, "X-Upload-CRC32": "%08x" % zlib.crc32(content)}
+    return upload(host, "/" + name, content, headers, timeout)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Packs CocktailCube themes into archives for the SPIFFS editor")
+    parser.add_argument("paths", nargs="+", help="Theme folders or json files")
+    parser.add_argument("-o", "--output", help="Output folder (Default: next to the json file)")
+    parser.add_argument("-s", "--search", action="append", default=[], help="Additional image folder")
+    parser.add_argument("--host", help="Upload the archives to the CocktailCube at this address")
+    parser.add_argument("--compare", action="store_true", help="Also upload the files one by one")
+    parser.add_argument("--timeout", type=float, default=60.0, help="Request timeout in seconds")
+    args = parser.parse_args()
+
+    files = find_themes(args.paths)
+    if not files:
+        print("No json themes found")
+        return 1
+
+    result = 0
+    for file in files:
+        name = os.path.splitext(os.path.basename(file))[0] + ARCHIVE_EXTENSION
+        try:
+            entries = theme_files(file, args.search)
+        except (ValueError, KeyError) as error:
+            print("Skipped '%s': %s" % (file, error))
+            result = 1
+            continue
+
+        content = pack_archive(entries)
+        folder = args.output if args.output else os.path.dirname(file)
+        os.makedirs(folder, exist_ok=True)
+        output = os.path.join(folder, name)
+        with open(output, "wb") as handle:
+            handle.write(content)
+        print("Packed '%s' -> '%s' (%d files, %d bytes)" % (file, output, len(entries), len(content)))
+
+        if not args.host:
+            continue
+
+        try:
+            if args.compare:
+                total = 0.0
+                for entry_name, path in entries:
+                    with open(path, "rb") as handle:
+                        status, text, duration = install(args.host, entry_name, handle.read(), args.timeout)
+                    total += duration
+                    if status != 200:
+                        print("  Upload of '%s' failed: %s" % (entry_name, text.strip()))
+                print("  Single files: %7.0f ms" % (total * 1000))
+
+            status, text, duration = install(args.host, name, content, args.timeout)
+            print("  Archive:      %7.0f ms (%.1f KB/s) %s" % (duration * 1000, len(content) / 1024 / duration, text.strip()))
+            if status != 200:
+                result = 1
+        except Exception as error:
+            print("Could not upload to 'http://%s/edit': %s" % (args.host, error))
+            return 1
+
+    return result
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+#
+# Compiles CocktailCube json themes into binary theme blobs (.ctb)
+#
+# The blob layout must match 'ThemeBlob.h' of the firmware. The
+# compiled files can be uploaded next to the json files, so the
+# firmware loads them with a single read instead of parsing json.
+# If no blob is uploaded, the firmware creates it on first load.
+#
+# Usage:
+#   theme_compiler.py <json files or folders> [-o output folder]
+#   theme_compiler.py <json files or folders> --benchmark [-n iterations]
+#
+# @author    Florian Stäblein
+# @date      2025/01/01
+# @copyright © 2025 Florian Stäblein
+#
+
+import argparse
+import json
+import os
+import struct
+import sys
+import time
+
+BLOB_EXTENSION = ".ctb"
+BLOB_MAGIC = 0x31425443  # "CTB1"
+BLOB_VERSION = 1
+
+# Little endian, packed (Same order as 'ThemeBlob.h')
+BLOB_FORMAT = "<IHHBB16s12s12s12s3h8s8s8s14H32s32s32s32s32s32s6h"
+BLOB_SIZE = struct.calcsize(BLOB_FORMAT) + 4  # Including checksum
+
+TFT_COLOR_KEYS = [
+    "TFT_COLOR_LIQUID_1",
+    "TFT_COLOR_LIQUID_2",
+    "TFT_COLOR_LIQUID_3",
+    "TFT_COLOR_STARTPAGE",
+    "TFT_COLOR_STARTPAGE_FOREGROUND",
+    "TFT_COLOR_STARTPAGE_BACKGROUND",
+    "TFT_COLOR_TEXT_HEADER",
+    "TFT_COLOR_TEXT_BODY",
+    "TFT_COLOR_INFOBOX_BORDER",
+    "TFT_COLOR_INFOBOX_FOREGROUND",
+    "TFT_COLOR_INFOBOX_BACKGROUND",
+    "TFT_COLOR_MENU_SELECTOR",
+    "TFT_COLOR_FOREGROUND",
+    "TFT_COLOR_BACKGROUND",
+]
+
+IMAGE_KEYS = ["IMAGE_LOGO", "IMAGE_GLASS", "IMAGE_BOTTLE1", "IMAGE_BOTTLE2", "IMAGE_BOTTLE3", "IMAGE_BOTTLE4"]
+
+POSITION_KEYS = [
+    "TFT_LOGO_POS_X",
+    "TFT_LOGO_POS_Y",
+    "TFT_GLASS_POS_X",
+    "TFT_GLASS_POS_Y",
+    "TFT_BOTTLE_POS_X",
+    "TFT_BOTTLE_POS_Y",
+]
+
+
+def fnv1a(data):
+    """Returns the FNV-1a hash of the data (Same as the firmware)"""
+    value = 2166136261
+    for byte in data:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def fixed_string(value, length):
+    """Returns a zero terminated, zero padded string of fixed length"""
+    data = str(value).encode("utf-8")
+    if len(data) >= length:
+        raise ValueError("'%s' exceeds %d characters" % (value, length - 1))
+    return data
+
+
+def hex_to_uint16(value):
+    """Converts a color string like the firmware (strtol with base 0)"""
+    result = int(str(value).strip(), 0)
+    if result < 0 or result > 0xFFFF:
+        raise ValueError("Color '%s' out of range" % value)
+    return result
+
+
+def compile_theme(theme):
+    """Returns the blob of a loaded json theme"""
+    values = [
+        BLOB_MAGIC,
+        BLOB_VERSION,
+        BLOB_SIZE,
+        1 if theme["IS_MIXER"] else 0,
+        0,
+        fixed_string(theme["MIXER_NAME"], 16),
+        fixed_string(theme["LIQUID_NAME_1"], 12),
+        fixed_string(theme["LIQUID_NAME_2"], 12),
+        fixed_string(theme["LIQUID_NAME_3"], 12),
+        int(theme["LIQUID_ANGLE_1"]),
+        int(theme["LIQUID_ANGLE_2"]),
+        int(theme["LIQUID_ANGLE_3"]),
+        fixed_string(theme["LIQUID_COLOR_1"], 8),
+        fixed_string(theme["LIQUID_COLOR_2"], 8),
+        fixed_string(theme["LIQUID_COLOR_3"], 8),
+    ]
+    values += [hex_to_uint16(theme[key]) for key in TFT_COLOR_KEYS]
+    values += [fixed_string(theme[key], 32) for key in IMAGE_KEYS]
+    values += [int(theme[key]) for key in POSITION_KEYS]
+
+    data = struct.pack(BLOB_FORMAT, *values)
+    return data + struct.pack("<I", fnv1a(data))
+
+
+def load_blob(data):
+    """Returns the values of a blob or None if invalid"""
+    if len(data) != BLOB_SIZE:
+        return None
+    values = struct.unpack(BLOB_FORMAT, data[:-4])
+    checksum = struct.unpack("<I", data[-4:])[0]
+    if values[0] != BLOB_MAGIC or values[1] != BLOB_VERSION or checksum != fnv1a(data[:-4]):
+        return None
+    return values
+
+
+def find_themes(paths):
+    """Returns all json files of the given files and folders"""
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, names in os.walk(path):
+                files += [os.path.join(root, name) for name in sorted(names) if name.endswith(".json")]
+        elif path.endswith(".json"):
+            files.append(path)
+    return files
+
+
+def run_benchmark(files, iterations):
+    """Compares json parsing with loading the compiled blob
+
+    The checksum is measured separately, because the pure python
+    FNV-1a loop is much slower than on the device, while json and
+    struct are both implemented in C on the host.
+    """
+    print("%-32s %10s %10s %10s %8s" % ("Theme", "json [us]", "blob [us]", "fnv [us]", "factor"))
+    for file in files:
+        with open(file, "rb") as handle:
+            text = handle.read()
+        blob = compile_theme(json.loads(text))
+
+        start = time.perf_counter()
+        for _ in range(iterations):
+            theme = json.loads(text)
+            [hex_to_uint16(theme[key]) for key in TFT_COLOR_KEYS]
+        json_us = (time.perf_counter() - start) * 1e6 / iterations
+
+        start = time.perf_counter()
+        for _ in range(iterations):
+            struct.unpack(BLOB_FORMAT, blob[:-4])
+        blob_us = (time.perf_counter() - start) * 1e6 / iterations
+
+        start = time.perf_counter()
+        for _ in range(iterations):
+            fnv1a(blob[:-4])
+        fnv_us = (time.perf_counter() - start) * 1e6 / iterations
+
+        print("%-32s %10.2f %10.2f %10.2f %8.1f" % (os.path.basename(file), json_us, blob_us, fnv_us, json_us / blob_us))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compiles CocktailCube json themes into binary blobs")
+    parser.add_argument("paths", nargs="+", help="Json theme files or folders")
+    parser.add_argument("-o", "--output", help="Output folder (Default: next to the json file)")
+    parser.add_argument("--benchmark", action="store_true", help="Compare json and blob load times on the host")
+    parser.add_argument("-n", "--iterations", type=int, default=1000, help="Benchmark iterations")
+    args = parser.parse_args()
+
+    files = find_themes(args.paths)
+    if not files:
+        print("No json themes found")
+        return 1
+
+    if args.benchmark:
+        run_benchmark(files, args.iterations)
+        return 0
+
+    result = 0
+    for file in files:
+        try:
+            with open(file, "r", encoding="utf-8") as handle:
+                blob = compile_theme(json.load(handle))
+        except (ValueError, KeyError) as error:
+            print("Skipped '%s': %s" % (file, error))
+            result = 1
+            continue
+
+        folder = args.output if args.output else os.path.dirname(file)
+        os.makedirs(folder, exist_ok=True)
+        output = os.path.join(folder, os.path.splitext(os.path.basename(file))[0] + BLOB_EXTENSION)
+        with open(output, "wb") as handle:
+            handle.write(blob)
+        print("Compiled '%s' -> '%s' (%d bytes)" % (file, output, len(blob)))
+
+    return result
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+#
+# Packs CocktailCube themes into single file bundles (.ctp)
+#
+# A bundle holds the compiled config and all images of a theme
+# behind an offset table. The layout must match 'ThemeBundle.h'
+# of the firmware:
+#
+#   Header  : uint32 magic "CTPK", uint16 version, uint16 section count
+#   Table   : section count x (uint32 offset, uint32 length)
+#   Sections: compiled config (See 'theme_compiler.py'), logo, glass,
+#             bottle 1 - 4 (Unmodified bmp files, empty if unused)
+#
+# Usage:
+#   theme_packer.py <theme folders or json files> [-o output folder] [-s search folder]
+#
+# Example (All themes of the repository):
+#   theme_packer.py ESP32S2_CocktailCube_V1.3/themes/* -s ESP32S2_CocktailCube_V1.3/data -o bundles
+#
+# @author    Florian Stäblein
+# @date      2025/01/01
+# @copyright © 2025 Florian Stäblein
+#
+
+import argparse
+import json
+import os
+import struct
+import sys
+
+from theme_compiler import IMAGE_KEYS, compile_theme, find_themes
+
+BUNDLE_EXTENSION = ".ctp"
+BUNDLE_MAGIC = 0x4B505443  # "CTPK"
+BUNDLE_VERSION = 1
+BUNDLE_SECTIONS = 1 + len(IMAGE_KEYS)
+BUNDLE_HEADER = "<IHH"
+BUNDLE_ENTRY = "<II"
+MAX_NAME_LENGTH = 31  # SPIFFS object name length without zero terminator
+
+
+def find_image(name, folders):
+    """Returns the path of an image file or None"""
+    for folder in folders:
+        path = os.path.join(folder, name.lstrip("/"))
+        if os.path.isfile(path):
+            return path
+    return None
+
+
+def pack_theme(file, search_folders):
+    """Returns the bundle of a json theme"""
+    with open(file, "r", encoding="utf-8") as handle:
+        theme = json.load(handle)
+
+    sections = [compile_theme(theme)]
+    folders = [os.path.dirname(file)] + search_folders
+    for index, key in enumerate(IMAGE_KEYS):
+        name = str(theme.get(key, ""))
+
+        # Mixers only use the first bottle (Same as the firmware)
+        if not name or (theme["IS_MIXER"] and index > 2):
+            sections.append(b"")
+            continue
+
+        path = find_image(name, folders)
+        if not path:
+            raise ValueError("Image '%s' not found" % name)
+        with open(path, "rb") as handle:
+            sections.append(handle.read())
+
+    # Offset table (Sections in table order)
+    offset = struct.calcsize(BUNDLE_HEADER) + BUNDLE_SECTIONS * struct.calcsize(BUNDLE_ENTRY)
+    table = b""
+    for section in sections:
+        table += struct.pack(BUNDLE_ENTRY, offset if section else 0, len(section))
+        offset += len(section)
+
+    header = struct.pack(BUNDLE_HEADER, BUNDLE_MAGIC, BUNDLE_VERSION, BUNDLE_SECTIONS)
+    return header + table + b"".join(sections)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Packs CocktailCube themes into single file bundles")
+    parser.add_argument("paths", nargs="+", help="Theme folders or json files")
+    parser.add_argument("-o", "--output", help="Output folder (Default: next to the json file)")
+    parser.add_argument("-s", "--search", action="append", default=[], help="Additional image folder")
+    args = parser.parse_args()
+
+    files = find_themes(args.paths)
+    if not files:
+        print("No json themes found")
+        return 1
+
+    result = 0
+    for file in files:
+        name = os.path.splitext(os.path.basename(file))[0] + BUNDLE_EXTENSION
+        if len(name) > MAX_NAME_LENGTH:
+            print("Skipped '%s': Bundle name exceeds %d characters" % (file, MAX_NAME_LENGTH))
+            result = 1
+            continue
+
+        try:
+            bundle = pack_theme(file, args.search)
+        except (ValueError, KeyError) as error:
+            print("Skipped '%s': %s" % (file, error))
+            result = 1
+            continue
+
+        folder = args.output if args.output else os.path.dirname(file)
+        os.makedirs(folder, exist_ok=True)
+        output = os.path.join(folder, name)
+        with open(output, "wb") as handle:
+            handle.write(bundle)
+        print("Packed '%s' -> '%s' (%d bytes)" % (file, output, len(bundle)))
+
+    return result
+
+
+if __name__ == "__main__":
+    sys.exit(main())
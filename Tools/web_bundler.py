@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+#
+# Bundles the CocktailCube web page into the firmware
+#
+# Inlines the style sheets and scripts referenced by 'index.html',
+# removes comments and indentation and writes the gzip compressed
+# page as PROGMEM array to 'WebUI.h' of the firmware. The page is
+# loaded with a single request and identified by a version hash
+# (ETag). An 'index.html' uploaded to SPIFFS overrides the bundle.
+# Run the bundler after changes of the web files and rebuild the
+# firmware.
+#
+# Usage:
+#   web_bundler.py [--input ESP32S2_CocktailCube_V1.3/ressources/index.html] [--output ESP32S2_CocktailCube_V1.3/WebUI.h]
+#
+# @author    Florian Stäblein
+# @date      2025/01/01
+# @copyright © 2025 Florian Stäblein
+#
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "ESP32S2_CocktailCube_V1.3"))
+STYLE_PATTERN = re.compile(r'<link\s+href="([^":]+\.css)"[^>]*>')
+SCRIPT_PATTERN = re.compile(r'<script\s+src="([^":]+\.js)"\s*>\s*</script>')
+HTML_COMMENT_PATTERN = re.compile(r"<!--(?!\[if)(?!<!\[endif).*?-->", re.S)
+CSS_COMMENT_PATTERN = re.compile(r"/\*.*?\*/", re.S)
+BYTES_PER_LINE = 16
+
+HEADER = """/*
+ * Includes the bundled web page (Generated by 'Tools/web_bundler.py', do not edit)
+ *
+ * @author    Florian Stäblein
+ * @date      2025/01/01
+ * @copyright © 2025 Florian Stäblein
+ */
+
+#ifndef WEBUI_H
+#define WEBUI_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+
+//===============================================================
+// Defines
+//===============================================================
+#define WEBUI_VERSION               "%s"  // Hash of the bundle
+#define webui_html_gz_len           %d
+
+//===============================================================
+// File: %s (%s), Size: %d (%d uncompressed)
+//===============================================================
+const uint8_t webui_html_gz[] PROGMEM =
+{
+%s
+};
+
+#endif
+"""
+
+
+def minify_css(text):
+    """Removes comments and whitespace of a style sheet"""
+    text = CSS_COMMENT_PATTERN.sub("", text)
+    lines = [line.strip() for line in text.splitlines()]
+    return "".join(line for line in lines if line)
+
+
+def minify_js(text):
+    """Removes indentation, empty lines and comment lines of a script (Conservative, code is kept as is)"""
+    lines = []
+    in_comment = False
+    for line in text.splitlines():
+        line = line.strip()
+        if in_comment:
+            in_comment = "*/" not in line
+            if not in_comment and line.split("*/", 1)[1].strip():
+                lines.append(line.split("*/", 1)[1].strip())
+            continue
+        if line.startswith("/*"):
+            in_comment = "*/" not in line[2:]
+            rest = "" if in_comment else line[2:].split("*/", 1)[1].strip()
+            if rest:
+                lines.append(rest)
+            continue
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+
+    # Script end tags inside strings would close the script element
+    return "\n".join(lines).replace("</script", "<\\/script")
+
+
+def minify_html(text):
+    """Removes comments (Not conditional comments), indentation and empty lines of a page"""
+    text = HTML_COMMENT_PATTERN.sub("", text)
+    lines = [line.strip() for line in text.splitlines()]
+    return "\n".join(line for line in lines if line)
+
+
+def bundle(path):
+    """Returns the page with inlined style sheets and scripts and the inlined file names"""
+    folder = os.path.dirname(path)
+    with open(path, "r", encoding="utf-8") as handle:
+        page = handle.read()
+    inlined = []
+
+    def read(name):
+        inlined.append(name)
+        with open(os.path.join(folder, name), "r", encoding="utf-8") as handle:
+            return handle.read()
+
+    # Inlined texts are no patterns, so a function is used as replacement
+    page = minify_html(page)
+    page = STYLE_PATTERN.sub(lambda match: "<style>%s</style>" % minify_css(read(match.group(1))), page)
+    page = SCRIPT_PATTERN.sub(lambda match: "<script>\n%s\n</script>" % minify_js(read(match.group(1))), page)
+    return page, inlined
+
+
+def to_array(data):
+    """Returns the bytes as C array lines"""
+    lines = []
+    for index in range(0, len(data), BYTES_PER_LINE):
+        lines.append("  " + ", ".join("0x%02X" % value for value in data[index:index + BYTES_PER_LINE]))
+    return ",\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Bundles the CocktailCube web page into the firmware")
+    parser.add_argument("--input", default=os.path.join(ROOT, "ressources", "index.html"), help="Web page")
+    parser.add_argument("--output", default=os.path.join(ROOT, "WebUI.h"), help="Generated header")
+    args = parser.parse_args()
+
+    page, inlined = bundle(args.input)
+    content = page.encode("utf-8")
+    compressed = gzip.compress(content, compresslevel=9, mtime=0)
+    version = hashlib.sha256(compressed).hexdigest()[:8]
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as handle:
+        handle.write(HEADER % (version, len(compressed), os.path.basename(args.input), ", ".join(inlined), len(compressed), len(content), to_array(compressed)))
+
+    print("Inlined:  %s" % ", ".join(inlined))
+    print("Bundle:   %d bytes, %d bytes compressed, version %s" % (len(content), len(compressed), version))
+    print("Written:  %s" % args.output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+#
+# Creates the gzip variants of the CocktailCube web files
+#
+# Writes '[name].gz' next to each web file. The firmware sends the
+# variant to clients accepting gzip and the file itself to all
+# others. Variants are only kept if they are smaller. The output is
+# reproducible (No time stamp or file name in the gzip header), so
+# unchanged files keep their ETag. Upload the variant with '/edit'
+# after the file, the upload of a file removes its former variant.
+#
+# Usage:
+#   web_compress.py <files or folders> [--level 9]
+#
+# Example (Web files of the repository, then upload or build the assets):
+#   web_compress.py ESP32S2_CocktailCube_V1.3/ressources
+#
+# @author    Florian Stäblein
+# @date      2025/01/01
+# @copyright © 2025 Florian Stäblein
+#
+
+import argparse
+import gzip
+import os
+import sys
+
+EXTENSIONS = (".html", ".htm", ".css", ".js", ".svg")  # No configurations, the firmware saves them
+MAX_NAME_LENGTH = 31  # SPIFFS object names with leading slash
+
+
+def find_files(paths):
+    """Returns the web files of all paths"""
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, names in sorted(os.walk(path)):
+                files += [os.path.join(root, name) for name in sorted(names)]
+        else:
+            files.append(path)
+    return [file for file in files if file.lower().endswith(EXTENSIONS)]
+
+
+def compress(file, level):
+    """Writes the gzip variant of a file and returns the sizes (None if not useful)"""
+    name = os.path.basename(file) + ".gz"
+    target = file + ".gz"
+    if len(name.encode("utf-8")) + 1 > MAX_NAME_LENGTH:
+        print("Skipped '%s': Name exceeds %d characters" % (target, MAX_NAME_LENGTH))
+        return None
+
+    with open(file, "rb") as handle:
+        content = handle.read()
+    compressed = gzip.compress(content, compresslevel=level, mtime=0)
+
+    if len(compressed) >= len(content):
+        if os.path.exists(target):
+            os.remove(target)
+        return None
+
+    with open(target, "wb") as handle:
+        handle.write(compressed)
+    return len(content), len(compressed)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Creates the gzip variants of the CocktailCube web files")
+    parser.add_argument("paths", nargs="+", help="Web files or folders")
+    parser.add_argument("--level", type=int, default=9, help="Compression level")
+    args = parser.parse_args()
+
+    files = find_files(args.paths)
+    if not files:
+        print("No web files found")
+        return 1
+
+    total = [0, 0]
+    for file in files:
+        sizes = compress(file, args.level)
+        if sizes is None:
+            continue
+        total[0] += sizes[0]
+        total[1] += sizes[1]
+        print("%-40s %8d -> %8d bytes" % (file, sizes[0], sizes[1]))
+    print("Compressed %d -> %d bytes (%.0f %%)" % (total[0], total[1], 100.0 * total[1] / max(total[0], 1)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
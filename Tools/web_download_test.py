@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+#
+# Download test of the CocktailCube SPIFFS editor
+#
+# Downloads a file from '/edit?download=' over connections that
+# are dropped after a number of bytes (Simulated weak connection)
+# and resumes each time with 'Range' and 'If-Range', so only the
+# missing bytes are requested again. Large files have a weak ETag,
+# which never matches 'If-Range', so they are resumed with 'Range'
+# only. The result is compared with
+# a complete download and the durations of both are printed.
+#
+# Usage:
+#   web_download_test.py path [--host 192.168.1.1] [--drop 16384]
+#
+# Example:
+#   web_download_test.py /CocktailCube.json --drop 512
+#
+# @author    Florian Stäblein
+# @date      2025/01/01
+# @copyright © 2025 Florian Stäblein
+#
+
+import argparse
+import http.client
+import sys
+import time
+import urllib.parse
+
+EDIT_PATH = "/edit?download="
+
+
+def get(host, path, headers, limit, timeout):
+    """Requests the file and reads at most limit bytes (Connection is dropped after)"""
+    connection = http.client.HTTPConnection(host, 80, timeout=timeout)
+    connection.request("GET", EDIT_PATH + urllib.parse.quote(path, safe="/"), headers=headers)
+    response = connection.getresponse()
+    body = response.read(limit) if limit else response.read()
+    connection.close()
+    return response.status, response.headers, body
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Download test of the CocktailCube SPIFFS editor")
+    parser.add_argument("path", help="File on the CocktailCube")
+    parser.add_argument("--host", default="192.168.1.1", help="Address of the CocktailCube")
+    parser.add_argument("--drop", type=int, default=16384, help="Bytes per connection before it is dropped")
+    parser.add_argument("--timeout", type=float, default=30.0, help="Request timeout in seconds")
+    args = parser.parse_args()
+
+    try:
+        # Complete download as reference
+        start = time.time()
+        status, headers, expected = get(args.host, args.path, {"Host": args.host}, 0, args.timeout)
+        if status != 200:
+            print("Error: Download returned %d" % status)
+            return 1
+        print("Complete:  %8d bytes in %7.0f ms, ETag %s" % (len(expected), (time.time() - start) * 1000, headers.get("ETag")))
+
+        # Resumed download with dropped connections
+        start = time.time()
+        etag = None
+        content = b""
+        connections = 0
+        while True:
+            request_headers = {"Host": args.host}
+            if content:
+                request_headers["Range"] = "bytes=%d-" % len(content)
+                if etag and not etag.startswith("W/"):
+                    request_headers["If-Range"] = etag
+            status, headers, body = get(args.host, args.path, request_headers, args.drop, args.timeout)
+            connections += 1
+            if status == 416:
+                break
+            if status == 200:
+                # File has changed, restart from zero
+                content = b""
+            elif status != 206:
+                print("Error: Resumed download returned %d" % status)
+                return 1
+            etag = headers.get("ETag")
+            content += body
+            if len(content) >= int(headers.get("Content-Range", "/%d" % len(content)).rsplit("/", 1)[1]):
+                break
+        print("Resumed:   %8d bytes in %7.0f ms, %d connections" % (len(content), (time.time() - start) * 1000, connections))
+    except Exception as error:
+        print("Could not download 'http://%s%s%s': %s" % (args.host, EDIT_PATH, args.path, error))
+        return 1
+
+    if content != expected:
+        print("Error: Resumed download differs from the complete download")
+        return 1
+    print("Resumed download matches")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+#
+# Load test of the CocktailCube web server
+#
+# Starts concurrent clients and reads the loop time of the firmware
+# from '/systeminfo' once per second, so the influence of web
+# traffic on pumps and UI becomes visible. The firmware rejects
+# requests above its limit with 503. Modes:
+#
+#   load : Clients request the web page files and control values
+#   poll : Idle web pages polling '/control?values=0' every 500 ms
+#   push : Idle web pages connected to the web socket '/ws'
+#
+# For 'poll' and 'push' the processing time of the web page handler
+# and the estimated bytes on air (Payload, HTTP/web socket headers
+# and TCP/IP packets) are printed per second.
+#
+# Usage:
+#   web_load_test.py [--host 192.168.1.1] [--mode load] [--clients 8] [--duration 30]
+#
+# Example (Phone traffic of 8 clients, idle pages polling vs. pushed):
+#   web_load_test.py --clients 8 --duration 60
+#   web_load_test.py --mode poll --clients 5
+#   web_load_test.py --mode push --clients 5
+#
+# @author    Florian Stäblein
+# @date      2025/01/01
+# @copyright © 2025 Florian Stäblein
+#
+
+import argparse
+import base64
+import os
+import re
+import socket
+import sys
+import threading
+import time
+import urllib.error
+import urllib.request
+
+PATHS = ("/", "/index.js", "/index.css", "/draggableDoughnutChart.js", "/control?values=0", "/control?settings=0")
+POLL_PATH = "/control?values=0"
+POLL_INTERVAL = 0.5
+INFO_PATTERN = re.compile(r"(Loop average|Loop maximum|Web busy time):\s+(\d+) us")
+PACKET_OVERHEAD = 40  # TCP/IP headers of a packet
+
+
+class Statistics:
+    """Collects the results of all clients"""
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latencies = []
+        self.rejected = 0
+        self.errors = 0
+        self.bytes = 0
+        self.wire_bytes = 0
+        self.packets = 0
+
+    def add(self, latency, size):
+        with self.lock:
+            self.latencies.append(latency)
+            self.bytes += size
+
+    def add_wire(self, size, packets):
+        with self.lock:
+            self.wire_bytes += size + packets * PACKET_OVERHEAD
+            self.packets += packets
+
+    def reject(self):
+        with self.lock:
+            self.rejected += 1
+
+    def error(self):
+        with self.lock:
+            self.errors += 1
+
+
+def percentile(values, percent):
+    """Returns the percentile of sorted values"""
+    if not values:
+        return 0.0
+    index = min(len(values) - 1, int(len(values) * percent / 100.0))
+    return values[index]
+
+
+def run_client(host, end, statistics, timeout):
+    """Requests all paths until the end time"""
+    index = 0
+    while time.time() < end:
+        url = "http://%s%s" % (host, PATHS[index % len(PATHS)])
+        index += 1
+        start = time.time()
+        try:
+            with urllib.request.urlopen(url, timeout=timeout) as response:
+                size = len(response.read())
+            statistics.add(time.time() - start, size)
+        except urllib.error.HTTPError as error:
+            if error.code == 503:
+                statistics.reject()
+                time.sleep(0.1)
+            else:
+                statistics.error()
+        except Exception:
+            statistics.error()
+
+
+def run_poll_client(host, end, statistics, timeout):
+    """Polls the control values like an idle web page"""
+    while time.time() < end:
+        start = time.time()
+        try:
+            request = urllib.request.Request("http://%s%s" % (host, POLL_PATH))
+            with urllib.request.urlopen(request, timeout=timeout) as response:
+                body = response.read()
+                header = str(response.headers)
+            statistics.add(time.time() - start, len(body))
+
+            # Request and response headers, connection setup and teardown (6 packets), request and response packets
+            statistics.add_wire(len(POLL_PATH) + 64 + len(header) + len(body), 8)
+        except Exception:
+            statistics.error()
+        time.sleep(max(0.0, POLL_INTERVAL - (time.time() - start)))
+
+
+def run_push_client(host, end, statistics, timeout):
+    """Connects to the web socket and receives pushed values like an idle web page"""
+    try:
+        connection = socket.create_connection((host, 80), timeout=timeout)
+        key = base64.b64encode(os.urandom(16)).decode("ascii")
+        handshake = ("GET /ws HTTP/1.1\r\nHost: %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                     "Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n\r\n" % (host, key))
+        connection.sendall(handshake.encode("ascii"))
+        response = b""
+        while b"\r\n\r\n" not in response:
+            data = connection.recv(1024)
+            if not data:
+                raise ConnectionError("Handshake failed")
+            response += data
+        if b" 101 " not in response.split(b"\r\n")[0]:
+            raise ConnectionError("Handshake rejected")
+        statistics.add_wire(len(handshake) + response.index(b"\r\n\r\n") + 4, 8)
+        pending = response[response.index(b"\r\n\r\n") + 4:]
+    except Exception:
+        statistics.error()
+        return
+
+    # Server frames are not masked: 2 byte header, extended length for 126
+    connection.settimeout(0.5)
+    while time.time() < end:
+        try:
+            data = connection.recv(1024)
+            if not data:
+                statistics.error()
+                break
+            pending += data
+        except socket.timeout:
+            pass
+        except Exception:
+            statistics.error()
+            break
+
+        while len(pending) >= 2:
+            length = pending[1] & 0x7F
+            header = 2
+            if length == 126:
+                if len(pending) < 4:
+                    break
+                length = (pending[2] << 8) | pending[3]
+                header = 4
+            if len(pending) < header + length:
+                break
+            statistics.add(0.0, length)
+
+            # Frame and the acknowledge packet of the client
+            statistics.add_wire(header + length, 2)
+            pending = pending[header + length:]
+    connection.close()
+
+
+def read_system_info(host, timeout):
+    """Returns the loop average, loop maximum and web busy time in us (None if not available)"""
+    try:
+        with urllib.request.urlopen("http://%s/systeminfo" % host, timeout=timeout) as response:
+            text = response.read().decode("utf-8", "replace")
+    except Exception:
+        return None
+
+    values = dict(INFO_PATTERN.findall(text))
+    if "Loop average" not in values or "Loop maximum" not in values:
+        return None
+    return int(values["Loop average"]), int(values["Loop maximum"]), int(values.get("Web busy time", 0))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Load test of the CocktailCube web server")
+    parser.add_argument("--host", default="192.168.1.1", help="Address of the CocktailCube")
+    parser.add_argument("--mode", choices=("load", "poll", "push"), default="load", help="Client behaviour")
+    parser.add_argument("--clients", type=int, default=8, help="Concurrent clients")
+    parser.add_argument("--duration", type=int, default=30, help="Test duration in seconds")
+    parser.add_argument("--timeout", type=float, default=10.0, help="Request timeout in seconds")
+    args = parser.parse_args()
+
+    idle = read_system_info(args.host, args.timeout)
+    if idle is None:
+        print("Could not read loop time from 'http://%s/systeminfo'" % args.host)
+        return 1
+    print("Idle loop time: average %d us, maximum %d us" % idle[:2])
+
+    statistics = Statistics()
+    end = time.time() + args.duration
+    target = {"load": run_client, "poll": run_poll_client, "push": run_push_client}[args.mode]
+    clients = [threading.Thread(target=target, args=(args.host, end, statistics, args.timeout)) for _ in range(args.clients)]
+    for client in clients:
+        client.start()
+
+    # Sample loop time while the clients are running
+    print("%8s %12s %12s" % ("Time", "Average", "Maximum"))
+    samples = []
+    start = time.time()
+    while time.time() < end:
+        time.sleep(1.0)
+        sample = read_system_info(args.host, args.timeout)
+        if sample:
+            samples.append(sample)
+            print("%7.0fs %9d us %9d us" % (time.time() - start, sample[0], sample[1]))
+
+    for client in clients:
+        client.join()
+
+    latencies = sorted(statistics.latencies)
+    print()
+    print("Mode:             %s" % args.mode)
+    print("Clients:          %d" % args.clients)
+    print("Requests:         %d ok, %d rejected (503), %d errors" % (len(latencies), statistics.rejected, statistics.errors))
+    print("Throughput:       %.1f requests/s, %.1f KB/s" % (len(latencies) / args.duration, statistics.bytes / 1024.0 / args.duration))
+    print("Request latency:  p50 %.0f ms, p95 %.0f ms, max %.0f ms" % (percentile(latencies, 50) * 1000, percentile(latencies, 95) * 1000, (latencies[-1] if latencies else 0) * 1000))
+    if samples:
+        print("Loop time:        average %d us, worst window maximum %d us (idle %d / %d us)" % (
+            sum(sample[0] for sample in samples) / len(samples), max(sample[1] for sample in samples), idle[0], idle[1]))
+    if args.mode != "load":
+        # The system info requests itself are not counted by the web page handler
+        print("On air:           %.0f bytes/s, %.1f packets/s (estimated)" % (statistics.wire_bytes / args.duration, statistics.packets / args.duration))
+        if samples:
+            print("Handler time:     %.0f us/s (%.2f %% CPU)" % (
+                (samples[-1][2] - idle[2]) / args.duration, (samples[-1][2] - idle[2]) / args.duration / 10000.0))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+#
+# Page load test of the CocktailCube web page
+#
+# Loads the web page files like a phone browser: A first visit
+# without cached files, then revisits with the cache of the first
+# visit (Files within their 'Cache-Control' lifetime are not
+# requested again, others are revalidated with 'If-None-Match').
+# Prints the bytes on air (Request and response headers, bodies
+# and estimated TCP/IP packets) and the load time per visit. The
+# style sheets and scripts are taken from the page, so the bundled
+# page of the firmware is loaded with a single request.
+#
+# Usage:
+#   web_page_test.py [--host 192.168.1.1] [--revisits 5] [--no-gzip] [--age 0]
+#
+# Example (Revisit after two hours, all files are revalidated):
+#   web_page_test.py --age 7200
+#
+# @author    Florian Stäblein
+# @date      2025/01/01
+# @copyright © 2025 Florian Stäblein
+#
+
+import argparse
+import gzip
+import http.client
+import re
+import sys
+import time
+
+PAGE_PATH = "/"
+REFERENCE_PATTERN = re.compile(r'(?:src|href)="([^":]+\.(?:js|css))"')
+PACKET_OVERHEAD = 40  # TCP/IP headers of a packet
+SEGMENT_SIZE = 1436
+MAX_AGE_PATTERN = re.compile(r"max-age=(\d+)")
+
+
+class CacheEntry:
+    """Cached response of a path"""
+
+    def __init__(self, etag, max_age, time_stamp, references):
+        self.etag = etag
+        self.max_age = max_age
+        self.time_stamp = time_stamp
+        self.references = references
+
+
+def request(host, path, headers, timeout):
+    """Sends a request and returns status, response headers and bytes on air"""
+    connection = http.client.HTTPConnection(host, 80, timeout=timeout)
+    connection.request("GET", path, headers=headers)
+    response = connection.getresponse()
+    body = response.read()
+    connection.close()
+
+    request_size = len("GET %s HTTP/1.1\r\n" % path) + sum(len(key) + len(value) + 4 for key, value in headers.items()) + 2
+    response_size = len(str(response.headers)) + 17 + len(body)
+    packets = 7 + (response_size + SEGMENT_SIZE - 1) // SEGMENT_SIZE  # Connection setup and teardown, request, acknowledges
+    return response.status, response.headers, request_size + response_size + packets * PACKET_OVERHEAD, body
+
+
+def visit(host, cache, accept_gzip, age, timeout):
+    """Loads all page files and returns bytes on air, load time and statistics"""
+    wire_bytes = 0
+    statistics = {"requested": 0, "cached": 0, "not modified": 0, "gzip": 0, "body": 0}
+    start = time.time()
+    paths = [PAGE_PATH]
+    while paths:
+        path = paths.pop(0)
+        entry = cache.get(path)
+        if entry and entry.time_stamp + entry.max_age > time.time() + age:
+            statistics["cached"] += 1
+            paths += entry.references
+            continue
+
+        headers = {"Host": host, "Accept-Encoding": "gzip, deflate" if accept_gzip else "identity"}
+        if entry and entry.etag:
+            headers["If-None-Match"] = entry.etag
+        status, response_headers, size, body = request(host, path, headers, timeout)
+        wire_bytes += size
+        statistics["requested"] += 1
+        statistics["body"] += len(body)
+        if status == 304:
+            statistics["not modified"] += 1
+            references = entry.references
+        elif status == 200:
+            if response_headers.get("Content-Encoding") == "gzip":
+                statistics["gzip"] += 1
+                body = gzip.decompress(body)
+            references = []
+            if path == PAGE_PATH:
+                references = ["/" + name.lstrip("/") for name in REFERENCE_PATTERN.findall(body.decode("utf-8", "replace"))]
+        else:
+            print("Error: '%s' returned %d" % (path, status))
+            continue
+        paths += references
+
+        match = MAX_AGE_PATTERN.search(response_headers.get("Cache-Control", ""))
+        cache[path] = CacheEntry(response_headers.get("ETag"), int(match.group(1)) if match else 0, time.time(), references)
+    return wire_bytes, time.time() - start, statistics
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Page load test of the CocktailCube web page")
+    parser.add_argument("--host", default="192.168.1.1", help="Address of the CocktailCube")
+    parser.add_argument("--revisits", type=int, default=5, help="Revisits with cached files")
+    parser.add_argument("--age", type=int, default=0, help="Seconds between first visit and revisits (Simulated)")
+    parser.add_argument("--no-gzip", action="store_true", help="Client does not accept gzip")
+    parser.add_argument("--timeout", type=float, default=10.0, help="Request timeout in seconds")
+    args = parser.parse_args()
+
+    cache = {}
+    print("%-10s %10s %10s %10s %8s %8s %8s %6s" % ("Visit", "On air", "Body", "Time", "Requests", "Cached", "304", "Gzip"))
+    for index in range(args.revisits + 1):
+        try:
+            wire_bytes, duration, statistics = visit(args.host, cache, not args.no_gzip, args.age if index else 0, args.timeout)
+        except Exception as error:
+            print("Could not load 'http://%s/': %s" % (args.host, error))
+            return 1
+        print("%-10s %8d B %8d B %7.0f ms %8d %8d %8d %6d" % (
+            "first" if index == 0 else "revisit %d" % index, wire_bytes, statistics["body"], duration * 1000,
+            statistics["requested"], statistics["cached"], statistics["not modified"], statistics["gzip"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+#
+# Upload test of the CocktailCube SPIFFS editor
+#
+# Uploads a file to '/edit' like the editor page (Multipart form,
+# the file name is the target path) and prints the throughput in
+# KB/s. The CRC32 or SHA256 of the file is sent with the headers
+# 'X-Upload-CRC32' and 'X-Upload-SHA256', so the firmware only
+# renames the upload into place, if it was received completely.
+# With '--corrupt' a wrong checksum is sent and the upload has to
+# be rejected with 400, leaving the former file untouched.
+#
+# Usage:
+#   web_upload_test.py file [--host 192.168.1.1] [--path /name.bmp] [--checksum crc32|sha256|none] [--repeat 3] [--corrupt]
+#
+# Example:
+#   web_upload_test.py ../ESP32S2_CocktailCube_V1.3/data/logo.bmp --checksum sha256
+#
+# @author    Florian Stäblein
+# @date      2025/01/01
+# @copyright © 2025 Florian Stäblein
+#
+
+import argparse
+import hashlib
+import http.client
+import os
+import sys
+import time
+import uuid
+import zlib
+
+EDIT_PATH = "/edit"
+
+
+def upload(host, path, content, headers, timeout):
+    """Uploads the content as multipart form and returns status, response text and duration"""
+    boundary = uuid.uuid4().hex
+    body = b"".join([
+        ("--%s\r\n" % boundary).encode(),
+        ('Content-Disposition: form-data; name="data"; filename="%s"\r\n' % path).encode(),
+        b"Content-Type: application/octet-stream\r\n\r\n",
+        content,
+        ("\r\n--%s--\r\n" % boundary).encode()])
+
+    headers = dict(headers)
+    headers["Content-Type"] = "multipart/form-data; boundary=%s" % boundary
+    headers["Content-Length"] = str(len(body))
+
+    start = time.time()
+    connection = http.client.HTTPConnection(host, 80, timeout=timeout)
+    connection.request("POST", EDIT_PATH, body=body, headers=headers)
+    response = connection.getresponse()
+    text = response.read().decode("utf-8", "replace")
+    connection.close()
+    return response.status, text, time.time() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Upload test of the CocktailCube SPIFFS editor")
+    parser.add_argument("file", help="File to upload")
+    parser.add_argument("--host", default="192.168.1.1", help="Address of the CocktailCube")
+    parser.add_argument("--path", help="Target path (Default: '/' and the file name)")
+    parser.add_argument("--checksum", choices=["crc32", "sha256", "none"], default="crc32", help="Checksum sent to the firmware")
+    parser.add_argument("--repeat", type=int, default=3, help="Uploads of the file")
+    parser.add_argument("--corrupt", action="store_true", help="Send a wrong checksum")
+    parser.add_argument("--timeout", type=float, default=30.0, help="Request timeout in seconds")
+    args = parser.parse_args()
+
+    with open(args.file, "rb") as handle:
+        content = handle.read()
+    path = args.path or "/" + os.path.basename(args.file)
+    if len(path) > 31:
+        print("Error: Path '%s' is longer than 31 characters (SPIFFS)" % path)
+        return 1
+
+    headers = {"Host": args.host}
+    if args.checksum == "crc32":
+        crc = zlib.crc32(content) ^ (1 if args.corrupt else 0)
+        headers["X-Upload-CRC32"] = "%08x" % crc
+    elif args.checksum == "sha256":
+        digest = bytearray(hashlib.sha256(content).digest())
+        digest[0] ^= 1 if args.corrupt else 0
+        headers["X-Upload-SHA256"] = digest.hex()
+
+    print("%-8s %10s %10s %10s %6s" % ("Upload", "Size", "Time", "KB/s", "Status"))
+    for index in range(args.repeat):
+        try:
+            status, text, duration = upload(args.host, path, content, headers, args.timeout)
+        except Exception as error:
+            print("Could not upload to 'http://%s%s': %s" % (args.host, EDIT_PATH, error))
+            return 1
+        print("%-8d %8d B %7.0f ms %10.1f %6d" % (index + 1, len(content), duration * 1000, len(content) / 1024 / duration, status))
+        if status != 200:
+            print("  %s" % text.strip())
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())